@@ -0,0 +1,202 @@
+/*
+ * RazorForge Runtime - Compression benchmark
+ * Compresses and decompresses synthetic log text, a slowly varying f64
+ * series and i64 timestamps (each with and without the 8-byte shuffle
+ * filter) and random bytes as RFZ1 frames, and the log text as raw blocks. Reports the ratio and MB
+ * per second of original data per core, with memcpy for scale.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/compress_bench [MB].
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "razorforge_compress.h"
+
+#define ROUNDS 5
+
+static volatile uint64_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t next_random(uint64_t* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static void make_log(uint8_t* data, size_t length)
+{
+    static const char* levels[] = {"INFO", "INFO", "INFO", "WARN", "DEBUG", "ERROR"};
+    static const char* events[] = {"request served", "cache miss", "connection reset by peer", "slow query",
+                                   "user logged in", "retrying upload"};
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    size_t n = 0;
+    char line[160];
+    for (uint64_t t = 1700000000000u; n < length; t += next_random(&state) % 50)
+    {
+        uint64_t r = next_random(&state);
+        int size = snprintf(line, sizeof(line), "%llu %s worker-%u %s path=/api/v1/items/%u status=%u ms=%u\n",
+                            (unsigned long long)t, levels[r % 6], (unsigned)(r >> 8 & 15), events[r >> 12 & 3 ? 0 : r >> 16 & 3],
+                            (unsigned)(r >> 20 & 0xFFFF), r >> 40 & 7 ? 200u : 503u, (unsigned)(r >> 44 & 255));
+        size_t take = (size_t)size < length - n ? (size_t)size : length - n;
+        memcpy(data + n, line, take);
+        n += take;
+    }
+}
+
+static void make_series(uint8_t* data, size_t length)
+{
+    uint64_t state = 0x2545F4914F6CDD1Du;
+    double value = 20.0;
+    for (size_t i = 0; i + sizeof(double) <= length; i += sizeof(double))
+    {
+        value += (double)(int64_t)(next_random(&state) % 201 - 100) * 0.001;
+        double rounded = (double)(int64_t)(value * 100.0) / 100.0;
+        memcpy(data + i, &rounded, sizeof(double));
+    }
+}
+
+static void make_timestamps(uint8_t* data, size_t length)
+{
+    uint64_t state = 0x853C49E6748FEA9Bu;
+    int64_t t = 1700000000000000;
+    for (size_t i = 0; i + sizeof(int64_t) <= length; i += sizeof(int64_t))
+    {
+        t += (int64_t)(next_random(&state) % 2000);
+        memcpy(data + i, &t, sizeof(int64_t));
+    }
+}
+
+static void make_random(uint8_t* data, size_t length)
+{
+    uint64_t state = 0xDEADBEEFCAFEF00Du;
+    for (size_t i = 0; i + 8 <= length; i += 8)
+    {
+        uint64_t r = next_random(&state);
+        memcpy(data + i, &r, 8);
+    }
+}
+
+#define MBPS(bytes, seconds) ((double)(bytes) * ROUNDS / (seconds) / 1e6)
+
+static void bench_frame(const char* label, const uint8_t* data, size_t length, size_t element_size)
+{
+    rf_lz_options options = {0, element_size, 1, RF_LZ_UNKNOWN_SIZE, NULL, 0};
+    size_t bound = rf_lz_frame_bound(length, &options);
+    uint8_t* frame = malloc(bound);
+    uint8_t* back = malloc(length);
+    size_t written = 0;
+    size_t produced = 0;
+
+    double start = now_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        rf_lz_frame_compress(data, length, frame, bound, &options, &written);
+    }
+    double compress_seconds = now_s() - start;
+
+    start = now_s();
+    int status = RF_LZ_OK;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        status |= rf_lz_frame_decompress(frame, written, back, length, NULL, 0, &produced);
+    }
+    double decompress_seconds = now_s() - start;
+
+    printf("%-30s ratio %6.2f  compress %8.1f MB/s  decompress %8.1f MB/s%s\n", label,
+           (double)length / (double)written, MBPS(length, compress_seconds), MBPS(length, decompress_seconds),
+           status == RF_LZ_OK && produced == length && memcmp(back, data, length) == 0 ? "" : "  MISMATCH");
+    free(frame);
+    free(back);
+}
+
+static void bench_block(const char* label, const uint8_t* data, size_t length)
+{
+    // Blocks are capped at RF_LZ_MAX_INPUT; 4 MiB pieces keep this comparable to frames
+    const size_t piece = (size_t)4 << 20;
+    size_t pieces = (length + piece - 1) / piece;
+    uint8_t* packed = malloc(pieces * rf_lz_compress_bound(piece));
+    size_t* sizes = malloc(pieces * sizeof(size_t));
+    uint8_t* back = malloc(length);
+    size_t total = 0;
+
+    double start = now_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        total = 0;
+        for (size_t i = 0; i < pieces; i++)
+        {
+            size_t n = length - i * piece < piece ? length - i * piece : piece;
+            sizes[i] = rf_lz_compress(data + i * piece, n, packed + total, rf_lz_compress_bound(n));
+            total += sizes[i];
+        }
+    }
+    double compress_seconds = now_s() - start;
+
+    start = now_s();
+    size_t produced = 0;
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        size_t offset = 0;
+        produced = 0;
+        for (size_t i = 0; i < pieces; i++)
+        {
+            produced += rf_lz_decompress(packed + offset, sizes[i], back + i * piece, piece);
+            offset += sizes[i];
+        }
+    }
+    double decompress_seconds = now_s() - start;
+
+    printf("%-30s ratio %6.2f  compress %8.1f MB/s  decompress %8.1f MB/s%s\n", label,
+           (double)length / (double)total, MBPS(length, compress_seconds), MBPS(length, decompress_seconds),
+           produced == length && memcmp(back, data, length) == 0 ? "" : "  MISMATCH");
+    free(packed);
+    free(sizes);
+    free(back);
+}
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? (size_t)atoi(argv[1]) : 32;
+    size_t length = megabytes << 20;
+    uint8_t* data = malloc(length);
+    uint8_t* copy = malloc(length);
+
+    make_log(data, length);
+    memset(copy, 1, length);
+    double start = now_s();
+    for (int round = 0; round < ROUNDS; round++)
+    {
+        memcpy(copy, data, length);
+        sink = copy[length / 2];
+    }
+    printf("%-30s                 memcpy   %8.1f MB/s\n", "reference", MBPS(length, now_s() - start));
+
+    bench_frame("log text (frame)", data, length, 0);
+    bench_block("log text (raw blocks)", data, length);
+
+    make_series(data, length);
+    bench_frame("f64 series", data, length, 0);
+    bench_frame("f64 series, shuffle 8", data, length, 8);
+
+    make_timestamps(data, length);
+    bench_frame("i64 timestamps", data, length, 0);
+    bench_frame("i64 timestamps, shuffle 8", data, length, 8);
+
+    make_random(data, length);
+    bench_frame("random bytes", data, length, 0);
+
+    free(data);
+    free(copy);
+    return 0;
+}
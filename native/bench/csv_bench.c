@@ -0,0 +1,303 @@
+/*
+ * RazorForge Runtime - CSV benchmark
+ * Reads a synthetic file of orders (integers, floats, plain and quoted text,
+ * doubled quotes, quoted newlines) with rf_csv_next from memory and through
+ * a 64 KiB stream buffer, with rf_csv_read_columns on the numeric columns,
+ * and with a byte-at-a-time state machine for comparison. Reports MB per
+ * second per core; the field count and the sum of one column must agree.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/csv_bench [MB].
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "razorforge_csv.h"
+#include "razorforge_parse.h"
+
+#define ROUNDS 5
+
+static volatile uint64_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t next_random(uint64_t* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static char* make_file(size_t target, size_t* length)
+{
+    static const char* names[] = {"widget", "gadget, large", "sprocket \"deluxe\"", "flange", "gear\nset"};
+    char* text = malloc(target + 4096);
+    size_t n = (size_t)sprintf(text, "id,product,price,quantity,comment\n");
+    uint64_t state = 0x2545F4914F6CDD1Du;
+    for (size_t id = 0; n < target; id++)
+    {
+        uint64_t r = next_random(&state);
+        const char* name = names[r % 5];
+        n += (size_t)sprintf(text + n, "%zu,", id);
+        if (strpbrk(name, ",\"\n"))
+        {
+            text[n++] = '"';
+            for (const char* c = name; *c; c++)
+            {
+                if (*c == '"')
+                {
+                    text[n++] = '"';
+                }
+                text[n++] = *c;
+            }
+            text[n++] = '"';
+        }
+        else
+        {
+            n += (size_t)sprintf(text + n, "%s", name);
+        }
+        n += (size_t)sprintf(text + n, ",%.2f,%u,%s\r\n", (double)(r >> 40) / 1000.0, (unsigned)(r >> 20 & 0x3FF),
+                             (r >> 8 & 3) == 0 ? "\"rush, gift wrap\"" : "standard shipping - no signature required");
+    }
+    *length = n;
+    return text;
+}
+
+// ============================================================================
+// Byte-at-a-time state machine
+// ============================================================================
+
+typedef struct
+{
+    const char* p;
+    const char* end;
+    rf_csv_field fields[64];
+    char scratch[4096];
+} naive_reader;
+
+// Next row into reader->fields; returns the field count, 0 at the end
+static size_t naive_next(naive_reader* reader)
+{
+    size_t count = 0;
+    size_t used = 0;
+    if (reader->p >= reader->end)
+    {
+        return 0;
+    }
+    for (;;)
+    {
+        rf_csv_field* field = &reader->fields[count++];
+        if (reader->p < reader->end && *reader->p == '"')
+        {
+            // Quoted: copy into scratch, collapsing doubled quotes
+            char* out = reader->scratch + used;
+            size_t length = 0;
+            reader->p++;
+            while (reader->p < reader->end)
+            {
+                if (*reader->p == '"')
+                {
+                    if (reader->p + 1 < reader->end && reader->p[1] == '"')
+                    {
+                        out[length++] = '"';
+                        reader->p += 2;
+                        continue;
+                    }
+                    reader->p++;
+                    break;
+                }
+                out[length++] = *reader->p++;
+            }
+            field->data = out;
+            field->length = length;
+            used += length;
+        }
+        else
+        {
+            const char* start = reader->p;
+            while (reader->p < reader->end && *reader->p != ',' && *reader->p != '\n')
+            {
+                reader->p++;
+            }
+            field->data = start;
+            field->length = (size_t)(reader->p - start);
+            if (field->length > 0 && start[field->length - 1] == '\r' &&
+                (reader->p == reader->end || *reader->p == '\n'))
+            {
+                field->length--;
+            }
+        }
+        if (reader->p < reader->end && *reader->p == '\r')
+        {
+            reader->p++;
+        }
+        if (reader->p >= reader->end || *reader->p == '\n')
+        {
+            reader->p++;
+            return count;
+        }
+        reader->p++;  // ','
+    }
+}
+
+// ============================================================================
+// Stream source
+// ============================================================================
+
+typedef struct
+{
+    const char* data;
+    size_t length;
+    size_t offset;
+} memory_source;
+
+static ptrdiff_t read_memory(void* context, char* buffer, size_t capacity)
+{
+    memory_source* source = context;
+    size_t n = source->length - source->offset < capacity ? source->length - source->offset : capacity;
+    memcpy(buffer, source->data + source->offset, n);
+    source->offset += n;
+    return (ptrdiff_t)n;
+}
+
+static int64_t quantity_of(const rf_csv_field* fields)
+{
+    int64_t quantity = 0;
+    rf_csv_field field = fields[3];
+    rf_i64_parse_letter8(field.data, field.length, &quantity);
+    return quantity;
+}
+
+#define BENCH(label, ...)                                                                              \
+    do                                                                                                \
+    {                                                                                                 \
+        double start = now_s();                                                                       \
+        for (int round = 0; round < ROUNDS; round++)                                                  \
+        {                                                                                             \
+            __VA_ARGS__;                                                                              \
+        }                                                                                             \
+        double seconds = now_s() - start;                                                             \
+        printf("%-34s %8.1f MB/s  fields %zu  sum %lld\n", label, (double)length * ROUNDS / seconds / 1e6, \
+               fields_seen, (long long)quantity_sum);                                                 \
+    } while (0)
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? (size_t)atoi(argv[1]) : 64;
+    size_t length;
+    char* text = make_file(megabytes << 20, &length);
+    printf("file: %.1f MB\n", (double)length / 1e6);
+
+    size_t fields_seen = 0;
+    int64_t quantity_sum = 0;
+    const rf_csv_field* fields;
+    size_t count;
+
+    static naive_reader naive;
+    BENCH("byte-at-a-time state machine", {
+        naive.p = text;
+        naive.end = text + length;
+        fields_seen = 0;
+        quantity_sum = 0;
+        naive_next(&naive);  // header
+        while ((count = naive_next(&naive)) != 0)
+        {
+            fields_seen += count;
+            quantity_sum += quantity_of(naive.fields);
+        }
+        sink = fields_seen;
+    });
+
+    BENCH("rf_csv_next (memory)", {
+        rf_csv_reader* reader = rf_csv_open_memory(text, length, ',', '"');
+        fields_seen = 0;
+        quantity_sum = 0;
+        rf_csv_next(reader, &fields, &count);  // header
+        while (rf_csv_next(reader, &fields, &count) == RF_CSV_OK)
+        {
+            fields_seen += count;
+            quantity_sum += quantity_of(fields);
+        }
+        rf_csv_close(reader);
+        sink = fields_seen;
+    });
+
+    BENCH("rf_csv_next (64 KiB stream)", {
+        memory_source source = {text, length, 0};
+        rf_csv_reader* reader = rf_csv_open_stream(read_memory, &source, ',', '"', 64 * 1024);
+        fields_seen = 0;
+        quantity_sum = 0;
+        rf_csv_next(reader, &fields, &count);
+        while (rf_csv_next(reader, &fields, &count) == RF_CSV_OK)
+        {
+            fields_seen += count;
+            quantity_sum += quantity_of(fields);
+        }
+        rf_csv_close(reader);
+        sink = fields_seen;
+    });
+
+    BENCH("state machine + 3 columns parsed", {
+        naive.p = text;
+        naive.end = text + length;
+        fields_seen = 0;
+        quantity_sum = 0;
+        naive_next(&naive);
+        while ((count = naive_next(&naive)) != 0)
+        {
+            int64_t id;
+            double price;
+            rf_i64_parse_letter8(naive.fields[0].data, naive.fields[0].length, &id);
+            rf_f64_parse_letter8(naive.fields[2].data, naive.fields[2].length, &price);
+            fields_seen += count;
+            quantity_sum += quantity_of(naive.fields);
+            sink = (uint64_t)id + (uint64_t)price;
+        }
+    });
+
+    // Typed columns, 4096 rows per call
+    enum { BATCH = 4096 };
+    static int64_t ids[BATCH];
+    static double prices[BATCH];
+    static int64_t quantities[BATCH];
+    rf_csv_column columns[] = {
+        {0, RF_CSV_I64, ids},
+        {2, RF_CSV_F64, prices},
+        {3, RF_CSV_I64, quantities},
+    };
+    BENCH("rf_csv_read_columns (3 columns)", {
+        rf_csv_reader* reader = rf_csv_open_memory(text, length, ',', '"');
+        size_t rows;
+        fields_seen = 0;
+        quantity_sum = 0;
+        rf_csv_next(reader, &fields, &count);
+        int status;
+        do
+        {
+            status = rf_csv_read_columns(reader, columns, 3, BATCH, &rows);
+            for (size_t i = 0; i < rows; i++)
+            {
+                quantity_sum += quantities[i];
+            }
+            fields_seen += rows * 5;
+        } while (status == RF_CSV_OK);
+        if (status != RF_CSV_END)
+        {
+            printf("  read_columns failed with %d at row %zu\n", status, rf_csv_row_number(reader));
+        }
+        rf_csv_close(reader);
+        sink = fields_seen;
+    });
+
+    free(text);
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * RazorForge Runtime - encoding benchmark
+ * Base64 and hex throughput in GB/s of binary data per core.
+ * RF_CPU_LEVEL=baseline|sse2 measure the scalar and SSSE3 kernels.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/encoding_bench.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "razorforge_cpu.h"
+#include "razorforge_encoding.h"
+
+#define TOTAL_BYTES ((size_t)1 << 30)  // binary bytes processed per measurement
+
+static volatile size_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+#define BENCH(label, size, STATEMENT)                                          \
+    do                                                                         \
+    {                                                                          \
+        size_t rounds = TOTAL_BYTES / (size);                                  \
+        double start = now_s();                                                \
+        for (size_t round = 0; round < rounds; round++)                        \
+        {                                                                      \
+            STATEMENT;                                                         \
+        }                                                                      \
+        double seconds = now_s() - start;                                      \
+        printf("%-14s %8zu B %8.2f GB/s\n", label, (size_t)(size),             \
+               (double)rounds * (double)(size) / seconds / 1e9);               \
+    } while (0)
+
+int main(void)
+{
+    static const size_t sizes[] = {96, 3 << 12, 3 << 20};
+    size_t largest = sizes[2];
+    unsigned char* data = malloc(largest);
+    unsigned char* decoded = malloc(largest);
+    char* text = malloc(2 * largest);
+    for (size_t i = 0; i < largest; i++)
+    {
+        data[i] = (unsigned char)(i * 131 + (i >> 9));
+    }
+
+    printf("level: %s, ssse3: %s\n", rf_cpu_level_name(rf_cpu_active_level()),
+           rf_cpu_has_ssse3() ? "yes" : "no");
+    for (int s = 0; s < 3; s++)
+    {
+        size_t size = sizes[s];
+        size_t base64_length = rf_base64_encode(data, size, text, 0);
+        BENCH("base64 encode", size, sink = rf_base64_encode(data, size, text, 0));
+        BENCH("base64 decode", size, sink = rf_base64_decode(text, base64_length, decoded, 0));
+        BENCH("hex encode", size, sink = rf_hex_encode(data, size, text, 0));
+        BENCH("hex decode", size, sink = rf_hex_decode(text, 2 * size, decoded));
+    }
+    free(data);
+    free(decoded);
+    free(text);
+    return 0;
+}
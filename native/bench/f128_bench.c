@@ -0,0 +1,163 @@
+/*
+ * RazorForge Runtime - f128 benchmark
+ * Times each public rf_f128 routine against the portable soft-float core on
+ * the same inputs. On a build without __float128 both columns run the soft
+ * core, so the ratio is ~1. The "wide" rows convert values from the whole
+ * exponent range, subnormals included, where the decimal conversions work
+ * on integers of up to ~16,000 bits.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/f128_bench.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "razorforge_f128.h"
+
+#ifdef RF_HAS_INT128
+
+#define COUNT 4096
+#define ROUNDS 64
+#define WIDE_COUNT 512
+
+static rf_u128 inputs_a[COUNT];
+static rf_u128 inputs_b[COUNT];
+static rf_u128 inputs_small[COUNT];
+static char texts[COUNT][RF_F128_MAX_CHARS];
+static size_t text_lengths[COUNT];
+static rf_u128 inputs_wide[WIDE_COUNT];
+static char texts_wide[WIDE_COUNT][RF_F128_MAX_CHARS];
+static size_t text_lengths_wide[WIDE_COUNT];
+static volatile rf_u128 sink;
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Positive values spread over [2^-64, 2^64], so log/sqrt/pow stay finite,
+// and values in [-64, 64) for exp
+static void fill_inputs(void)
+{
+    uint64_t state = 0x9e3779b97f4a7c15ull;
+    for (int i = 0; i < COUNT; i++)
+    {
+        rf_u128 pair[2];
+        for (int k = 0; k < 2; k++)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            uint64_t hi = state;
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            uint64_t exponent = 0x3fffull - 64 + (hi >> 57);
+            pair[k] = RF_F128_BITS((exponent << 48) | (hi & 0xffffffffffffull), state);
+        }
+        inputs_a[i] = pair[0];
+        inputs_b[i] = pair[1];
+        inputs_small[i] = rf_f128_soft_from_f64((double)(state >> 11) * 0x1p-46 - 64.0);
+        text_lengths[i] = rf_f128_soft_to_chars(pair[0], texts[i]);
+    }
+
+    // Every biased exponent from 0 (subnormal) to 0x7ffe, evenly spaced
+    for (int i = 0; i < WIDE_COUNT; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t hi = state;
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t exponent = (uint64_t)i * 0x7ffe / (WIDE_COUNT - 1);
+        inputs_wide[i] = RF_F128_BITS((exponent << 48) | (hi & 0xffffffffffffull), state | 1);
+        text_lengths_wide[i] = rf_f128_soft_to_chars(inputs_wide[i], texts_wide[i]);
+    }
+}
+
+// Like BENCH, once over the wide inputs
+#define BENCH_WIDE(label, native_expr, soft_expr)                                      \
+    do                                                                                 \
+    {                                                                                  \
+        double start = now_ns();                                                       \
+        for (int i = 0; i < WIDE_COUNT; i++)                                           \
+        {                                                                              \
+            rf_f128 a = rf_f128_from_bits(inputs_wide[i]);                             \
+            sink = rf_f128_to_bits(native_expr);                                       \
+        }                                                                              \
+        double native_ns = (now_ns() - start) / WIDE_COUNT;                            \
+        start = now_ns();                                                              \
+        for (int i = 0; i < WIDE_COUNT; i++)                                           \
+        {                                                                              \
+            rf_u128 a = inputs_wide[i];                                                \
+            sink = (soft_expr);                                                        \
+        }                                                                              \
+        double soft_ns = (now_ns() - start) / WIDE_COUNT;                              \
+        printf("%-13s %10.1f %10.1f %8.2fx\n", label, native_ns, soft_ns, soft_ns / native_ns); \
+    } while (0)
+
+#define BENCH(label, native_expr, soft_expr)                                           \
+    do                                                                                 \
+    {                                                                                  \
+        double start = now_ns();                                                       \
+        for (int round = 0; round < ROUNDS; round++)                                   \
+            for (int i = 0; i < COUNT; i++)                                            \
+            {                                                                          \
+                rf_f128 a = rf_f128_from_bits(inputs_a[i]);                            \
+                rf_f128 b = rf_f128_from_bits(inputs_b[i]);                            \
+                rf_f128 x = rf_f128_from_bits(inputs_small[i]);                        \
+                (void)a;                                                               \
+                (void)b;                                                               \
+                (void)x;                                                               \
+                sink = rf_f128_to_bits(native_expr);                                   \
+            }                                                                          \
+        double native_ns = (now_ns() - start) / (COUNT * ROUNDS);                      \
+        start = now_ns();                                                              \
+        for (int round = 0; round < ROUNDS; round++)                                   \
+            for (int i = 0; i < COUNT; i++)                                            \
+            {                                                                          \
+                rf_u128 a = inputs_a[i];                                               \
+                rf_u128 b = inputs_b[i];                                               \
+                rf_u128 x = inputs_small[i];                                           \
+                (void)a;                                                               \
+                (void)b;                                                               \
+                (void)x;                                                               \
+                sink = (soft_expr);                                                    \
+            }                                                                          \
+        double soft_ns = (now_ns() - start) / (COUNT * ROUNDS);                        \
+        printf("%-13s %10.1f %10.1f %8.2fx\n", label, native_ns, soft_ns, soft_ns / native_ns); \
+    } while (0)
+
+int main(void)
+{
+    fill_inputs();
+    char buffer[RF_F128_MAX_CHARS];
+
+    printf("%-13s %10s %10s %9s\n", "op (ns)", "rf_f128", "soft", "soft/rf");
+    BENCH("add", rf_f128_add(a, b), rf_f128_soft_add(a, b));
+    BENCH("mul", rf_f128_mul(a, b), rf_f128_soft_mul(a, b));
+    BENCH("div", rf_f128_div(a, b), rf_f128_soft_div(a, b));
+    BENCH("sqrt", rf_f128_sqrt(a), rf_f128_soft_sqrt(a));
+    BENCH("fma", rf_f128_fma(a, b, a), rf_f128_soft_fma(a, b, a));
+    BENCH("exp", rf_f128_exp(x), rf_f128_soft_exp(x));
+    BENCH("log", rf_f128_log(a), rf_f128_soft_log(a));
+    BENCH("sin", rf_f128_sin(a), rf_f128_soft_sin(a));
+    BENCH("pow", rf_f128_pow(a, rf_f128_from_f64(0.75)),
+        rf_f128_soft_pow(a, rf_f128_soft_from_f64(0.75)));
+    BENCH("to_chars", rf_f128_from_bits(rf_f128_to_chars(a, buffer)),
+        rf_f128_soft_to_chars(a, buffer));
+    BENCH("parse",
+        (rf_f128_parse(texts[i], text_lengths[i], &a), a),
+        (rf_f128_soft_parse(texts[i], text_lengths[i], &a), a));
+    BENCH_WIDE("to_chars wide", rf_f128_from_bits(rf_f128_to_chars(a, buffer)),
+        rf_f128_soft_to_chars(a, buffer));
+    BENCH_WIDE("parse wide",
+        (rf_f128_parse(texts_wide[i], text_lengths_wide[i], &a), a),
+        (rf_f128_soft_parse(texts_wide[i], text_lengths_wide[i], &a), a));
+    return 0;
+}
+
+#else
+
+int main(void)
+{
+    puts("f128 needs 128-bit integer support");
+    return 0;
+}
+
+#endif // RF_HAS_INT128
@@ -0,0 +1,388 @@
+/*
+ * RazorForge Runtime - JSON benchmark
+ * Parses a synthetic document of records (integers, floats, plain and escaped
+ * strings, nested arrays) with rf_json_parse in tape and lazy mode, and with
+ * a scalar recursive-descent parser that builds a preorder node array, then
+ * reports MB per second per core. Both parsers use rf_*_parse_letter8 for
+ * numbers, so the difference is the structural work. An XOR over the bits
+ * of every number confirms they agree.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/json_bench [MB].
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "razorforge_json.h"
+#include "razorforge_parse.h"
+
+#define ROUNDS 10
+
+static volatile uint64_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t next_random(uint64_t* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+static char* make_document(size_t target, size_t* length)
+{
+    static const char* words[] = {"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"};
+    char* text = malloc(target + 4096);
+    size_t n = 0;
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    n += (size_t)sprintf(text + n, "[");
+    for (size_t id = 0; n < target; id++)
+    {
+        uint64_t r = next_random(&state);
+        n += (size_t)sprintf(text + n,
+                             "%s{\"id\": %zu, \"score\": %.6g, \"name\": \"%s %s\", \"note\": \"line\\n\\t\\\"%s\\\"\", "
+                             "\"tags\": [%u, %u, %u], \"active\": %s, \"parent\": null}",
+                             id ? ",\n  " : "\n  ", id, (double)(r >> 11) * 0x1p-53 * 1000.0 - 500.0,
+                             words[r & 7], words[r >> 3 & 7], words[r >> 6 & 7], (unsigned)(r >> 16 & 0xFFFF),
+                             (unsigned)(r >> 32 & 0xFF), (unsigned)(r >> 40 & 0xFFFFF), (r >> 60) & 1 ? "true" : "false");
+    }
+    n += (size_t)sprintf(text + n, "\n]\n");
+    *length = n;
+    return text;
+}
+
+// ============================================================================
+// Scalar recursive descent
+// ============================================================================
+
+typedef struct
+{
+    uint8_t type;  // rf_json_type
+    uint32_t count;  // children of arrays and objects (keys count as children)
+    union
+    {
+        double number;
+        struct
+        {
+            const char* data;
+            size_t length;
+        } string;
+    };
+} node;
+
+typedef struct
+{
+    const char* p;
+    const char* end;
+    node* nodes;
+    size_t node_count;
+    char* strings;  // unescaped copies
+    size_t strings_used;
+    int depth;
+} rd_parser;
+
+static void skip_ws(rd_parser* parser)
+{
+    while (parser->p < parser->end && (*parser->p == ' ' || *parser->p == '\n' || *parser->p == '\r' || *parser->p == '\t'))
+    {
+        parser->p++;
+    }
+}
+
+static int rd_string(rd_parser* parser)
+{
+    const char* start = ++parser->p;
+    bool escaped = false;
+    while (parser->p < parser->end && *parser->p != '"')
+    {
+        if ((unsigned char)*parser->p < 0x20)
+        {
+            return 0;
+        }
+        if (*parser->p == '\\')
+        {
+            escaped = true;
+            parser->p++;
+        }
+        parser->p++;
+    }
+    if (parser->p >= parser->end)
+    {
+        return 0;
+    }
+    node* out = &parser->nodes[parser->node_count++];
+    out->type = RF_JSON_STRING;
+    out->string.data = start;
+    out->string.length = (size_t)(parser->p - start);
+    if (escaped)
+    {
+        // Simple escapes only; enough for the generated document
+        char* copy = parser->strings + parser->strings_used;
+        size_t written = 0;
+        for (const char* s = start; s < parser->p; s++)
+        {
+            if (*s == '\\')
+            {
+                s++;
+                copy[written++] = *s == 'n' ? '\n' : *s == 't' ? '\t' : *s == 'r' ? '\r' : *s;
+            }
+            else
+            {
+                copy[written++] = *s;
+            }
+        }
+        out->string.data = copy;
+        out->string.length = written;
+        parser->strings_used += written;
+    }
+    parser->p++;
+    return 1;
+}
+
+static int rd_value(rd_parser* parser)
+{
+    skip_ws(parser);
+    if (parser->p >= parser->end)
+    {
+        return 0;
+    }
+    char c = *parser->p;
+    if (c == '{' || c == '[')
+    {
+        if (++parser->depth > RF_JSON_MAX_DEPTH)
+        {
+            return 0;
+        }
+        size_t self = parser->node_count++;
+        parser->nodes[self].type = c == '{' ? RF_JSON_OBJECT : RF_JSON_ARRAY;
+        uint32_t count = 0;
+        char close = (char)(c + 2);
+        parser->p++;
+        skip_ws(parser);
+        if (parser->p < parser->end && *parser->p == close)
+        {
+            parser->p++;
+        }
+        else
+        {
+            for (;;)
+            {
+                if (c == '{')
+                {
+                    skip_ws(parser);
+                    if (parser->p >= parser->end || *parser->p != '"' || !rd_string(parser))
+                    {
+                        return 0;
+                    }
+                    skip_ws(parser);
+                    if (parser->p >= parser->end || *parser->p++ != ':')
+                    {
+                        return 0;
+                    }
+                }
+                if (!rd_value(parser))
+                {
+                    return 0;
+                }
+                count++;
+                skip_ws(parser);
+                if (parser->p >= parser->end)
+                {
+                    return 0;
+                }
+                char next = *parser->p++;
+                if (next == close)
+                {
+                    break;
+                }
+                if (next != ',')
+                {
+                    return 0;
+                }
+            }
+        }
+        parser->nodes[self].count = count;
+        parser->depth--;
+        return 1;
+    }
+    if (c == '"')
+    {
+        return rd_string(parser);
+    }
+    node* out = &parser->nodes[parser->node_count++];
+    const char* start = parser->p;
+    while (parser->p < parser->end && strchr(" \t\r\n,:]}", *parser->p) == NULL)
+    {
+        parser->p++;
+    }
+    size_t length = (size_t)(parser->p - start);
+    if (length == 4 && memcmp(start, "true", 4) == 0)
+    {
+        out->type = RF_JSON_BOOL, out->number = 1;
+    }
+    else if (length == 5 && memcmp(start, "false", 5) == 0)
+    {
+        out->type = RF_JSON_BOOL, out->number = 0;
+    }
+    else if (length == 4 && memcmp(start, "null", 4) == 0)
+    {
+        out->type = RF_JSON_NULL;
+    }
+    else
+    {
+        int64_t integer;
+        out->type = RF_JSON_FLOAT;
+        if (rf_i64_parse_letter8(start, length, &integer) == RF_PARSE_OK)
+        {
+            out->type = RF_JSON_INTEGER;
+            out->number = (double)integer;
+        }
+        else if (rf_f64_parse_letter8(start, length, &out->number) != RF_PARSE_OK)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static uint64_t bits_of(double number)
+{
+    uint64_t bits;
+    memcpy(&bits, &number, sizeof(bits));
+    return bits;
+}
+
+static uint64_t rd_checksum(const rd_parser* parser)
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < parser->node_count; i++)
+    {
+        uint8_t type = parser->nodes[i].type;
+        if (type == RF_JSON_INTEGER || type == RF_JSON_FLOAT)
+        {
+            sum ^= bits_of(parser->nodes[i].number);
+        }
+    }
+    return sum;
+}
+
+// ============================================================================
+// Tape walk
+// ============================================================================
+
+static uint64_t json_checksum(rf_json_value value)
+{
+    uint64_t sum = 0;
+    double number;
+    rf_json_value child;
+    rf_json_value key;
+    switch (rf_json_type_of(value))
+    {
+    case RF_JSON_INTEGER:
+    case RF_JSON_UNSIGNED:
+    case RF_JSON_FLOAT:
+        rf_json_get_f64(value, &number);
+        return bits_of(number);
+    case RF_JSON_ARRAY:
+        for (bool more = rf_json_array_first(value, &child); more; more = rf_json_array_next(&child))
+        {
+            sum ^= json_checksum(child);
+        }
+        return sum;
+    case RF_JSON_OBJECT:
+        for (bool more = rf_json_object_first(value, &key, &child); more; more = rf_json_object_next(&key, &child))
+        {
+            sum ^= json_checksum(child);
+        }
+        return sum;
+    default:
+        return 0;
+    }
+}
+
+#define BENCH(label, STATEMENT)                                                                  \
+    do                                                                                           \
+    {                                                                                            \
+        double start = now_s();                                                                  \
+        for (int round = 0; round < ROUNDS; round++)                                             \
+        {                                                                                        \
+            STATEMENT;                                                                           \
+        }                                                                                        \
+        double seconds = now_s() - start;                                                        \
+        printf("%-30s %8.1f MB/s\n", label, (double)length * ROUNDS / seconds / 1e6);            \
+    } while (0)
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? (size_t)atoi(argv[1]) : 32;
+    size_t length;
+    char* text = make_document(megabytes << 20, &length);
+    printf("document: %.1f MB\n", (double)length / 1e6);
+
+    rd_parser parser = {0};
+    parser.nodes = malloc(length * sizeof(node) / 2);
+    parser.strings = malloc(length);
+
+    BENCH("recursive descent (DOM)", {
+        parser.p = text;
+        parser.end = text + length;
+        parser.node_count = parser.strings_used = 0;
+        if (!rd_value(&parser))
+        {
+            fprintf(stderr, "recursive descent failed\n");
+            return 1;
+        }
+        sink = parser.node_count;
+    });
+    BENCH("rf_json_parse (tape)", {
+        rf_json_document* document = rf_json_parse(text, length, 0);
+        sink = (uint64_t)rf_json_error(document);
+        rf_json_free(document);
+    });
+    rf_json_document* reused = rf_json_parse(text, length, 0);
+    BENCH("rf_json_reparse (tape)", {
+        sink = (uint64_t)rf_json_reparse(reused, text, length, 0);
+    });
+    BENCH("rf_json_parse (lazy, index only)", {
+        rf_json_document* document = rf_json_parse(text, length, RF_JSON_LAZY);
+        sink = (uint64_t)rf_json_error(document);
+        rf_json_free(document);
+    });
+    BENCH("rf_json_reparse (lazy, index only)", {
+        sink = (uint64_t)rf_json_reparse(reused, text, length, RF_JSON_LAZY);
+    });
+    BENCH("rf_json_parse (tape) + walk", {
+        rf_json_document* document = rf_json_parse(text, length, 0);
+        sink = json_checksum(rf_json_root(document));
+        rf_json_free(document);
+    });
+    BENCH("rf_json_parse (lazy) + walk", {
+        rf_json_document* document = rf_json_parse(text, length, RF_JSON_LAZY);
+        sink = json_checksum(rf_json_root(document));
+        rf_json_free(document);
+    });
+
+    rf_json_document* tape = rf_json_parse(text, length, 0);
+    rf_json_document* lazy = rf_json_parse(text, length, RF_JSON_LAZY);
+    uint64_t expected = rd_checksum(&parser);
+    uint64_t from_tape = json_checksum(rf_json_root(tape));
+    uint64_t from_lazy = json_checksum(rf_json_root(lazy));
+    printf("checksum: %016llx tape %016llx lazy %016llx%s\n", (unsigned long long)expected,
+           (unsigned long long)from_tape, (unsigned long long)from_lazy,
+           expected == from_tape && expected == from_lazy ? "" : "  MISMATCH");
+    rf_json_free(reused);
+    rf_json_free(tape);
+    rf_json_free(lazy);
+    free(parser.nodes);
+    free(parser.strings);
+    free(text);
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * RazorForge Runtime - memory_copy/memory_fill benchmark
+ * GB/s per core for memory_copy and memory_fill against libc memmove and
+ * memset, for sizes from 8 bytes to 1 GiB. Above the last-level cache it
+ * also compares the streaming tier with plain memmove/memset and times a
+ * pass over a cache-sized working set after each operation: the cost the
+ * operation imposed by evicting it. RF_CPU_LEVEL=baseline disables streaming.
+ * The search kernels (memory_search.c) run against memcmp, memchr and memmem
+ * over cache-resident buffers, with RF_CPU_LEVEL selecting their level.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/memory_bench [max MB].
+ */
+
+#define _GNU_SOURCE  // memmem
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "razorforge_cpu.h"
+#include "razorforge_memory.h"
+
+#define MIN_BYTES_PER_MEASUREMENT ((size_t)1 << 28)
+#define MIN_ROUNDS 3
+
+static volatile uint64_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static size_t rounds_for(size_t size)
+{
+    size_t rounds = MIN_BYTES_PER_MEASUREMENT / size;
+    return rounds < MIN_ROUNDS ? MIN_ROUNDS : rounds;
+}
+
+#define MEASURE(result, size, STATEMENT)                                       \
+    do                                                                         \
+    {                                                                          \
+        size_t rounds = rounds_for(size);                                      \
+        double start = now_s();                                                \
+        for (size_t round = 0; round < rounds; round++)                        \
+        {                                                                      \
+            STATEMENT;                                                         \
+        }                                                                      \
+        double seconds = now_s() - start;                                      \
+        (result) = (double)rounds * (double)(size) / seconds / 1e9;            \
+    } while (0)
+
+// Reads the working set once, one load per cache line; ns per line
+static double reread_ns(const uint8_t* working_set, size_t length)
+{
+    uint64_t sum = 0;
+    double start = now_s();
+    for (size_t i = 0; i < length; i += 64)
+    {
+        sum += working_set[i];
+    }
+    double seconds = now_s() - start;
+    sink = sum;
+    return seconds * 1e9 / (double)(length / 64);
+}
+
+// Average over a few operations of the reread cost after each one
+#define REREAD_AFTER(result, working_set, working_size, STATEMENT)             \
+    do                                                                         \
+    {                                                                          \
+        double total = 0;                                                      \
+        for (int pass = 0; pass < MIN_ROUNDS; pass++)                          \
+        {                                                                      \
+            reread_ns(working_set, working_size);                              \
+            STATEMENT;                                                         \
+            total += reread_ns(working_set, working_size);                     \
+        }                                                                      \
+        (result) = total / MIN_ROUNDS;                                         \
+    } while (0)
+
+int main(int argc, char** argv)
+{
+    size_t max_size = (size_t)1 << 30;
+    if (argc > 1)
+    {
+        max_size = (size_t)strtoull(argv[1], NULL, 10) << 20;
+    }
+
+    uint8_t* src = malloc(max_size);
+    uint8_t* dst = malloc(max_size);
+    if (src == NULL || dst == NULL)
+    {
+        fprintf(stderr, "cannot allocate 2 x %zu MB; pass a smaller size\n", max_size >> 20);
+        return 1;
+    }
+    for (size_t i = 0; i < max_size; i++)
+    {
+        src[i] = (uint8_t)(i * 131 + (i >> 9));
+    }
+    memset(dst, 0, max_size);
+
+    size_t cache = rf_cpu_cache_size();
+    size_t threshold = rf_memory_stream_threshold();
+    printf("level: %s, last-level cache: %zu KiB, streaming from: ", rf_cpu_level_name(rf_cpu_active_level()),
+           cache >> 10);
+    if (threshold == SIZE_MAX)
+    {
+        printf("never\n");
+    }
+    else
+    {
+        printf("%zu KiB\n", threshold >> 10);
+    }
+
+    printf("%12s %12s %12s %12s %12s   (GB/s)\n", "bytes", "memory_copy", "memmove", "memory_fill", "memset");
+    for (size_t size = 8; size <= max_size; size *= 8)
+    {
+        double copy, libc_copy, fill, libc_fill;
+        MEASURE(copy, size, memory_copy((uintptr_t)src, (uintptr_t)dst, size));
+        MEASURE(libc_copy, size, memmove(dst, src, size));
+        MEASURE(fill, size, memory_fill((uintptr_t)dst, round, size));
+        MEASURE(libc_fill, size, memset(dst, (int)(round & 0xFF), size));
+        printf("%12zu %12.2f %12.2f %12.2f %12.2f\n", size, copy, libc_copy, fill, libc_fill);
+    }
+
+    // Search: the match, or the differing byte, is the last byte
+    printf("\n%12s %12s %12s %12s %12s %12s %12s %12s   (GB/s)\n", "bytes", "mismatch", "memcmp", "find_byte",
+           "memchr", "find", "memmem", "count_byte");
+    static const char pattern[] = "needle:";
+    size_t pattern_length = sizeof(pattern) - 1;
+    for (size_t size = 64; size <= ((size_t)1 << 20) && size <= max_size; size *= 16)
+    {
+        memset(src, 'a', size);
+        memcpy(dst, src, size);
+        dst[size - 1] = 'b';
+        memcpy(src + size - pattern_length, pattern, pattern_length);
+        double mismatch, libc_compare, find_byte, libc_find_byte, find, libc_find, count;
+        MEASURE(mismatch, size, sink += rf_memory_mismatch(src, dst, size));
+        MEASURE(libc_compare, size, sink += (uint64_t)memcmp(src, dst, size));
+        MEASURE(find_byte, size, sink += rf_memory_find_byte(src, size, ':'));
+        MEASURE(libc_find_byte, size, sink += (uintptr_t)memchr(src, ':', size));
+        MEASURE(find, size, sink += rf_memory_find(src, size, pattern, pattern_length));
+        MEASURE(libc_find, size, sink += (uintptr_t)memmem(src, size, pattern, pattern_length));
+        MEASURE(count, size, sink += rf_memory_count_byte(src, size, 'a'));
+        printf("%12zu %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f %12.2f\n", size, mismatch, libc_compare, find_byte,
+               libc_find_byte, find, libc_find, count);
+    }
+
+    if (threshold == SIZE_MAX)
+    {
+        free(src);
+        free(dst);
+        return 0;
+    }
+
+    // Past the cache: streaming against cached stores, and what each leaves
+    // of a working set half the size of the cache
+    size_t working_size = cache / 2;
+    uint8_t* working_set = malloc(working_size);
+    memset(working_set, 1, working_size);
+    printf("\n%12s %12s %12s %12s %12s   (GB/s, then ns per line to reread %zu KiB)\n", "bytes", "streamed",
+           "cached", "reread after", "reread after", working_size >> 10);
+    for (size_t size = threshold; size <= max_size; size *= 2)
+    {
+        double streamed, cached, streamed_reread, cached_reread;
+        MEASURE(streamed, size, memory_copy((uintptr_t)src, (uintptr_t)dst, size));
+        REREAD_AFTER(streamed_reread, working_set, working_size,
+                     memory_copy((uintptr_t)src, (uintptr_t)dst, size));
+        size_t previous = rf_memory_set_stream_threshold(SIZE_MAX);
+        MEASURE(cached, size, memory_copy((uintptr_t)src, (uintptr_t)dst, size));
+        REREAD_AFTER(cached_reread, working_set, working_size, memory_copy((uintptr_t)src, (uintptr_t)dst, size));
+        rf_memory_set_stream_threshold(previous);
+        printf("%12zu %12.2f %12.2f %12.2f %12.2f   copy\n", size, streamed, cached, streamed_reread,
+               cached_reread);
+
+        MEASURE(streamed, size, memory_zero((uintptr_t)dst, size));
+        REREAD_AFTER(streamed_reread, working_set, working_size, memory_zero((uintptr_t)dst, size));
+        previous = rf_memory_set_stream_threshold(SIZE_MAX);
+        MEASURE(cached, size, memory_zero((uintptr_t)dst, size));
+        REREAD_AFTER(cached_reread, working_set, working_size, memory_zero((uintptr_t)dst, size));
+        rf_memory_set_stream_threshold(previous);
+        printf("%12zu %12.2f %12.2f %12.2f %12.2f   zero\n", size, streamed, cached, streamed_reread,
+               cached_reread);
+    }
+
+    free(working_set);
+    free(src);
+    free(dst);
+    return 0;
+}
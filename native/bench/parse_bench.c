@@ -0,0 +1,101 @@
+/*
+ * RazorForge Runtime - number parsing benchmark
+ * Parses a list of random numbers with rf_*_parse_letter8 and with the C
+ * library (strtod/strtoll, which need NUL-terminated text) and reports
+ * millions of numbers and MB of text per second per core.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/parse_bench.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "razorforge_parse.h"
+
+#define COUNT 100000  // numbers per list
+#define ROUNDS 20
+
+static volatile double sink_f64;
+static volatile int64_t sink_i64;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t next_random(uint64_t* state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// NUL-separated numbers; starts[i] and lengths[i] locate each one
+typedef struct
+{
+    char* text;
+    size_t bytes;
+    size_t starts[COUNT];
+    size_t lengths[COUNT];
+} number_list;
+
+static void list_add(number_list* list, size_t i, const char* number)
+{
+    size_t length = strlen(number);
+    list->starts[i] = list->bytes;
+    list->lengths[i] = length;
+    memcpy(list->text + list->bytes, number, length + 1);
+    list->bytes += length + 1;
+}
+
+#define BENCH(label, list, STATEMENT)                                                          \
+    do                                                                                         \
+    {                                                                                          \
+        double start = now_s();                                                                \
+        for (int round = 0; round < ROUNDS; round++)                                           \
+        {                                                                                      \
+            for (size_t i = 0; i < COUNT; i++)                                                 \
+            {                                                                                  \
+                const char* number = (list)->text + (list)->starts[i];                         \
+                size_t length = (list)->lengths[i];                                            \
+                (void)length;                                                                  \
+                STATEMENT;                                                                     \
+            }                                                                                  \
+        }                                                                                      \
+        double seconds = now_s() - start;                                                      \
+        printf("%-22s %8.1f M/s %8.1f MB/s\n", label, (double)COUNT * ROUNDS / seconds / 1e6, \
+               (double)((list)->bytes - COUNT) * ROUNDS / seconds / 1e6);                      \
+    } while (0)
+
+int main(void)
+{
+    static number_list floats;
+    static number_list integers;
+    floats.text = malloc(COUNT * 32);
+    integers.text = malloc(COUNT * 24);
+    uint64_t state = 0x9E3779B97F4A7C15u;
+    char number[32];
+    for (size_t i = 0; i < COUNT; i++)
+    {
+        double value = (double)(next_random(&state) >> 11) * 0x1p-53 * 2000.0 - 1000.0;
+        snprintf(number, sizeof(number), "%.17g", value);
+        list_add(&floats, i, number);
+        snprintf(number, sizeof(number), "%lld", (long long)next_random(&state) >> (i % 48));
+        list_add(&integers, i, number);
+    }
+
+    double f64;
+    int64_t i64;
+    BENCH("f64 rf_f64_parse", &floats, rf_f64_parse_letter8(number, length, &f64); sink_f64 = f64);
+    BENCH("f64 strtod", &floats, sink_f64 = strtod(number, NULL));
+    BENCH("i64 rf_i64_parse", &integers, rf_i64_parse_letter8(number, length, &i64); sink_i64 = i64);
+    BENCH("i64 strtoll", &integers, sink_i64 = strtoll(number, NULL, 10));
+    free(floats.text);
+    free(integers.text);
+    return 0;
+}
@@ -0,0 +1,61 @@
+/*
+ * RazorForge Runtime - random benchmark
+ * Throughput of the bulk fills against one-at-a-time draws, in millions of
+ * values per second. RF_CPU_LEVEL=sse2|avx2|avx512 picks the fill kernels.
+ *
+ * Build with -DRF_BUILD_BENCHMARKS=ON and run bin/random_bench.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "razorforge_cpu.h"
+#include "razorforge_random.h"
+
+#define COUNT (1 << 16)
+#define ROUNDS 512
+
+static uint64_t u64_buffer[COUNT];
+static double f64_buffer[COUNT];
+static float f32_buffer[COUNT];
+static volatile uint64_t sink;
+
+static double now_s(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+#define BENCH(label, STATEMENT)                                              \
+    do                                                                       \
+    {                                                                        \
+        double start = now_s();                                              \
+        for (int round = 0; round < ROUNDS; round++)                         \
+        {                                                                    \
+            STATEMENT;                                                       \
+        }                                                                    \
+        double seconds = now_s() - start;                                    \
+        printf("%-22s %10.0f M/s\n", label, COUNT * (double)ROUNDS / seconds / 1e6); \
+    } while (0)
+
+int main(void)
+{
+    rf_random rng;
+    rf_random_seed(&rng, 42);
+    rf_pcg32 pcg;
+    rf_pcg32_seed(&pcg, 42, 54);
+
+    printf("kernels: %s\n", rf_cpu_level_name(rf_cpu_active_level()));
+    BENCH("next_u64 loop", for (int i = 0; i < COUNT; i++) sink = rf_random_next_u64(&rng));
+    BENCH("fill_u64", rf_random_fill_u64(&rng, u64_buffer, COUNT));
+    BENCH("fill_below(1000)", rf_random_fill_below(&rng, u64_buffer, COUNT, 1000));
+    BENCH("fill_f64", rf_random_fill_f64(&rng, f64_buffer, COUNT));
+    BENCH("fill_f32", rf_random_fill_f32(&rng, f32_buffer, COUNT));
+    BENCH("next_normal loop",
+        for (int i = 0; i < COUNT; i++) f64_buffer[i] = rf_random_next_normal(&rng));
+    BENCH("fill_normal_f64", rf_random_fill_normal_f64(&rng, f64_buffer, COUNT));
+    BENCH("fill_normal_f32", rf_random_fill_normal_f32(&rng, f32_buffer, COUNT));
+    BENCH("pcg32 fill_u32", rf_pcg32_fill_u32(&pcg, (uint32_t*)u64_buffer, COUNT));
+    return 0;
+}
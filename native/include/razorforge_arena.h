@@ -0,0 +1,45 @@
+#ifndef RAZORFORGE_ARENA_H
+#define RAZORFORGE_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Region (arena) allocator
+// Bump allocation out of chained blocks; everything is released by one reset
+// ============================================================================
+
+typedef struct rf_arena rf_arena;
+
+// Lifecycle management
+rf_arena* rf_arena_new(size_t block_bytes);
+void rf_arena_free(rf_arena* arena);
+void rf_arena_reset(rf_arena* arena);
+
+// Allocation (arena-owned memory is never freed individually)
+void* rf_arena_alloc(rf_arena* arena, size_t bytes);
+size_t rf_arena_used(const rf_arena* arena);
+
+// ============================================================================
+// Per-thread runtime allocator
+// Allocations go to the arena bound to the calling thread, or to the heap
+// when no arena is bound. Every block remembers its owner, so rf_thread_free
+// and rf_thread_realloc accept memory from either source.
+// ============================================================================
+
+rf_arena* rf_thread_arena(void);
+rf_arena* rf_thread_arena_bind(rf_arena* arena);  // returns the previous binding
+
+void* rf_thread_alloc(size_t bytes);
+void* rf_thread_realloc(void* ptr, size_t bytes);
+void rf_thread_free(void* ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_ARENA_H
@@ -0,0 +1,60 @@
+#ifndef RAZORFORGE_CHECKSUM_H
+#define RAZORFORGE_CHECKSUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Checksums and hashes (checksum.c)
+//
+// CRC32C and Adler-32 stream by feeding a result back in as the starting
+// value: rf_crc32c(rf_crc32c(0, a, n), b, m) == CRC of a followed by b. The
+// *_combine functions join checksums of pieces computed independently (for
+// example on different threads) given only the length of the second piece.
+//
+// CRC32C uses the SSE4.2 crc32 instruction with PCLMULQDQ to merge parallel
+// streams, Adler-32 uses AVX2, both dispatched on razorforge_cpu; every
+// other CPU gets table/scalar code with identical results.
+// ============================================================================
+
+// CRC32C (Castagnoli polynomial, as in iSCSI, ext4 and SSE4.2). Start at 0.
+uint32_t rf_crc32c(uint32_t crc, const void* data, size_t length);
+uint32_t rf_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t length_b);
+
+// Adler-32 (zlib). Start at 1.
+uint32_t rf_adler32(uint32_t adler, const void* data, size_t length);
+uint32_t rf_adler32_combine(uint32_t adler_a, uint32_t adler_b, uint64_t length_b);
+
+// ============================================================================
+// xxHash64: fast non-cryptographic 64-bit hash. Not combinable; stream with
+// rf_xxh64_state instead. Output matches the reference XXH64.
+// ============================================================================
+
+uint64_t rf_xxh64(const void* data, size_t length, uint64_t seed);
+
+typedef struct
+{
+    uint64_t accumulators[4];
+    uint64_t total_length;
+    uint64_t seed;
+    uint8_t buffer[32];  // input not yet consumed as a full 32-byte stripe
+    uint32_t buffered;
+} rf_xxh64_state;
+
+void rf_xxh64_reset(rf_xxh64_state* state, uint64_t seed);
+void rf_xxh64_update(rf_xxh64_state* state, const void* data, size_t length);
+uint64_t rf_xxh64_digest(const rf_xxh64_state* state);  // state stays usable
+
+// Heap-allocated state for the stdlib
+rf_xxh64_state* rf_xxh64_new(uint64_t seed);
+void rf_xxh64_free(rf_xxh64_state* state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_CHECKSUM_H
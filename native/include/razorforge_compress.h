@@ -0,0 +1,133 @@
+#ifndef RAZORFORGE_COMPRESS_H
+#define RAZORFORGE_COMPRESS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Block compression (compress.c)
+//
+// Blocks use the LZ4 block format, so they interoperate with any LZ4
+// implementation. The compressor probes one hash slot per position and skips
+// faster through incompressible data; the decoder copies in 8 and 16-byte
+// steps. Offsets reach 64 KiB back.
+// ============================================================================
+
+#define RF_LZ_INVALID SIZE_MAX
+#define RF_LZ_MAX_INPUT 0x7E000000u  // largest block rf_lz_compress accepts
+
+size_t rf_lz_compress_bound(size_t length);
+
+// Returns the compressed size, or 0 if it would exceed capacity (or length
+// exceeds RF_LZ_MAX_INPUT)
+size_t rf_lz_compress(const void* src, size_t length, void* dest, size_t capacity);
+
+// Returns the decompressed size, or RF_LZ_INVALID if src is malformed or
+// decodes to more than capacity bytes. Never reads or writes out of bounds.
+size_t rf_lz_decompress(const void* src, size_t length, void* dest, size_t capacity);
+
+// ============================================================================
+// Byte-shuffle filter
+//
+// Regroups an array of element_size-byte values so that all first bytes come
+// first, then all second bytes, and so on. Numeric arrays whose values are
+// close together turn into long runs that compress far better. Trailing
+// bytes that do not fill an element are copied unchanged. src and dest must
+// not overlap. SSSE3 kernels for 2, 4 and 8-byte elements.
+// ============================================================================
+
+void rf_shuffle(const void* src, void* dest, size_t length, size_t element_size);
+void rf_unshuffle(const void* src, void* dest, size_t length, size_t element_size);
+
+// ============================================================================
+// Frames
+//
+// A frame wraps a stream of independently compressed blocks:
+//
+//   header   24 bytes: magic "RFZ1", block size log2, shuffle element size,
+//            flags, content size (u64, or RF_LZ_UNKNOWN_SIZE), dictionary
+//            id (u32, 0 for none), CRC32C of the preceding 20 bytes
+//   blocks   u32 word (size, high bit set when stored uncompressed), data
+//   end      u32 zero
+//   trailer  xxHash64 of the content, when the checksum flag is set
+//
+// All integers are little-endian. With a dictionary, every block may match
+// into its last 64 KiB, which helps most on small, similar payloads; the
+// decoder must be given the same dictionary. The shuffle filter, when set,
+// is applied to each block before compression.
+// ============================================================================
+
+// Status codes
+#define RF_LZ_OK 0
+#define RF_LZ_ERROR_FORMAT 1      // not a frame, or a corrupt header or block
+#define RF_LZ_ERROR_CHECKSUM 2    // content does not match the trailer hash
+#define RF_LZ_ERROR_DICTIONARY 3  // frame needs a dictionary not supplied
+#define RF_LZ_ERROR_TRUNCATED 4   // input ended inside the frame
+#define RF_LZ_ERROR_IO 5          // the write callback failed
+#define RF_LZ_ERROR_CAPACITY 6    // out of memory, or destination too small
+#define RF_LZ_ERROR_ARGUMENT 7    // bad options, or input length differs from the declared size
+
+#define RF_LZ_UNKNOWN_SIZE UINT64_MAX
+
+typedef struct
+{
+    unsigned block_log;          // log2 of the block size, 12..24; 0 for 18 (256 KiB)
+    size_t element_size;         // shuffle filter element size, 0 or 1 for none; at most 255
+    int checksum;                // append an xxHash64 of the content
+    uint64_t content_size;       // recorded in the header; RF_LZ_UNKNOWN_SIZE if not known
+    const void* dictionary;      // NULL for none
+    size_t dictionary_length;
+} rf_lz_options;
+
+// NULL options mean: default block size, no filter, checksum on, size unknown
+size_t rf_lz_frame_bound(size_t length, const rf_lz_options* options);
+
+// One-shot frames. content_size in options is ignored (length is recorded).
+int rf_lz_frame_compress(const void* src, size_t length, void* dest, size_t capacity,
+                         const rf_lz_options* options, size_t* written);
+int rf_lz_frame_decompress(const void* src, size_t length, void* dest, size_t capacity,
+                           const void* dictionary, size_t dictionary_length, size_t* written);
+
+// Content size from a frame header; RF_LZ_UNKNOWN_SIZE if it was not recorded
+int rf_lz_frame_content_size(const void* src, size_t length, uint64_t* size);
+
+// ============================================================================
+// Streaming
+//
+// Encoders take input in any chunk sizes and emit a frame; decoders take a
+// frame in any chunk sizes and emit the content. Output goes to the write
+// callback, or, when it is NULL, into an internal buffer drained with
+// *_available and *_read. Errors are sticky. The dictionary is copied.
+// ============================================================================
+
+// Consumes length bytes; returns 0, or non-zero to fail with RF_LZ_ERROR_IO
+typedef int (*rf_lz_write_fn)(void* context, const void* data, size_t length);
+
+typedef struct rf_lz_encoder rf_lz_encoder;
+typedef struct rf_lz_decoder rf_lz_decoder;
+
+// NULL on allocation failure or invalid options
+rf_lz_encoder* rf_lz_encoder_new(const rf_lz_options* options, rf_lz_write_fn write, void* context);
+int rf_lz_encoder_write(rf_lz_encoder* encoder, const void* data, size_t length);
+int rf_lz_encoder_finish(rf_lz_encoder* encoder);  // flushes the last block and the trailer
+size_t rf_lz_encoder_available(const rf_lz_encoder* encoder);
+size_t rf_lz_encoder_read(rf_lz_encoder* encoder, void* dest, size_t capacity);
+void rf_lz_encoder_free(rf_lz_encoder* encoder);
+
+rf_lz_decoder* rf_lz_decoder_new(const void* dictionary, size_t dictionary_length, rf_lz_write_fn write,
+                                 void* context);
+int rf_lz_decoder_write(rf_lz_decoder* decoder, const void* data, size_t length);
+int rf_lz_decoder_finish(rf_lz_decoder* decoder);  // RF_LZ_ERROR_TRUNCATED unless the frame ended
+size_t rf_lz_decoder_available(const rf_lz_decoder* decoder);
+size_t rf_lz_decoder_read(rf_lz_decoder* decoder, void* dest, size_t capacity);
+void rf_lz_decoder_free(rf_lz_decoder* decoder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_COMPRESS_H
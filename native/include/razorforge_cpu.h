@@ -0,0 +1,56 @@
+#ifndef RAZORFORGE_CPU_H
+#define RAZORFORGE_CPU_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// CPU feature dispatch
+// The runtime ships one binary with kernels for several SIMD levels. The
+// level is detected once (cpuid plus the OS-enabled register state) and
+// kernel tables are bound from it, so callers never branch per call.
+//
+// RF_CPU_LEVEL=baseline|sse2|avx2|avx512 forces a lower level for tests and
+// benchmarks; a level above what the machine supports is clamped to it.
+// ============================================================================
+
+typedef enum
+{
+    RF_CPU_BASELINE = 0,  // portable 16-byte kernels (NEON/generic off x86)
+    RF_CPU_SSE2 = 1,      // x86-64 baseline
+    RF_CPU_AVX2 = 2,
+    RF_CPU_AVX512 = 3,    // AVX-512 F + DQ
+} rf_cpu_level;
+
+// Highest level the hardware and OS support, ignoring RF_CPU_LEVEL
+rf_cpu_level rf_cpu_detected_level(void);
+
+// Level kernels dispatch on: the detected level, capped by RF_CPU_LEVEL
+rf_cpu_level rf_cpu_active_level(void);
+
+const char* rf_cpu_level_name(rf_cpu_level level);
+
+// F16C half<->single conversions. Only reported at the AVX2 level or above,
+// so RF_CPU_LEVEL=sse2 disables it along with the wide kernels.
+int rf_cpu_has_f16c(void);
+
+// SSE4.2 crc32 plus PCLMULQDQ, for CRC32C. Reported at the SSE2 level or
+// above, so RF_CPU_LEVEL=baseline selects the table code.
+int rf_cpu_has_crc32c(void);
+
+// SSSE3 byte shuffles, for the text codecs below AVX2. Same SSE2 gating.
+int rf_cpu_has_ssse3(void);
+
+// Size in bytes of the largest data cache (the last level), from cpuid
+// deterministic cache parameters or the OS; 8 MiB if neither reports one.
+// Unaffected by RF_CPU_LEVEL.
+size_t rf_cpu_cache_size(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_CPU_H
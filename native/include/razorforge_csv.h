@@ -0,0 +1,113 @@
+#ifndef RAZORFORGE_CSV_H
+#define RAZORFORGE_CSV_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Streaming delimited-text reader (csv.c)
+//
+// RFC 4180 records: fields split by a delimiter byte, rows by '\n' (a '\r'
+// before it is dropped), fields optionally enclosed in quotes, with a doubled
+// quote standing for one quote inside them. Quoted fields may span lines.
+// A quote only opens a quoted field as the field's first byte; anywhere else
+// in an unquoted field it is an ordinary character (so 5'11" with a quote
+// of '"' is one plain field). Blank lines are skipped.
+//
+// Unquoted delimiters and newlines are located 64 bytes at a time with SIMD
+// (AVX2, then SSE2, then scalar, dispatched on razorforge_cpu). Rows are
+// returned as field views into the reader's buffer, valid until the next
+// call; only quoted fields containing doubled quotes are copied, into a
+// per-row scratch buffer. Streams refill a buffer that grows to hold the
+// longest row.
+// ============================================================================
+
+// Status codes
+#define RF_CSV_OK 0
+#define RF_CSV_END 1              // no more rows
+#define RF_CSV_ERROR_QUOTE 2      // unterminated quote, or text after a closing quote
+#define RF_CSV_ERROR_IO 3         // the read callback failed, or the file could not be opened
+#define RF_CSV_ERROR_CAPACITY 4   // out of memory
+#define RF_CSV_ERROR_FIELD 5      // typed read: row has no such column
+#define RF_CSV_ERROR_NUMBER 6     // typed read: field is not a number of the column's type
+
+typedef struct rf_csv_reader rf_csv_reader;
+
+typedef struct
+{
+    const char* data;
+    size_t length;
+} rf_csv_field;
+
+// Fills buffer with up to capacity bytes; returns the count, 0 at the end of
+// the input, or a negative value on error
+typedef ptrdiff_t (*rf_csv_read_fn)(void* context, char* buffer, size_t capacity);
+
+// Readers. delimiter and quote must differ and be neither '\r' nor '\n'.
+// Memory readers borrow data, which must outlive the reader.
+rf_csv_reader* rf_csv_open_memory(const char* data, size_t length, char delimiter, char quote);
+rf_csv_reader* rf_csv_open_stream(rf_csv_read_fn read, void* context, char delimiter, char quote,
+                                  size_t buffer_bytes);
+rf_csv_reader* rf_csv_open_file(const char* path, char delimiter, char quote);  // NULL if unreadable
+void rf_csv_close(rf_csv_reader* reader);
+
+// Next row: RF_CSV_OK with *fields and *count set, RF_CSV_END, or an error
+// (which is sticky)
+int rf_csv_next(rf_csv_reader* reader, const rf_csv_field** fields, size_t* count);
+
+// rf_csv_next by value, for callers that cannot pass out-pointers (the
+// stdlib): fields is NULL and count 0 unless status is RF_CSV_OK
+typedef struct
+{
+    const rf_csv_field* fields;
+    size_t count;
+    int status;
+} rf_csv_row;
+
+rf_csv_row rf_csv_next_row(rf_csv_reader* reader);
+
+// Rows returned so far; after an error, the row that failed is this + 1
+size_t rf_csv_row_number(const rf_csv_reader* reader);
+
+// ============================================================================
+// Typed columns
+//
+// Reads up to max_rows rows, parsing the chosen columns straight into arrays
+// (out[i] of each column receives row i), with no per-field allocation.
+// *rows is set to the rows stored. Returns RF_CSV_OK, RF_CSV_END when the
+// input ran out first (*rows may still be non-zero), or an error.
+// ============================================================================
+
+#define RF_CSV_I64 0
+#define RF_CSV_F64 1
+
+typedef struct
+{
+    size_t index;  // 0-based field position
+    int type;      // RF_CSV_I64 or RF_CSV_F64
+    void* out;     // int64_t[max_rows] or double[max_rows]
+} rf_csv_column;
+
+int rf_csv_read_columns(rf_csv_reader* reader, const rf_csv_column* columns, size_t column_count,
+                        size_t max_rows, size_t* rows);
+
+// One column by value, for the same callers: rows stored and the status of
+// rf_csv_read_columns
+typedef struct
+{
+    size_t rows;
+    int status;
+} rf_csv_column_batch;
+
+rf_csv_column_batch rf_csv_read_column(rf_csv_reader* reader, size_t index, int type, void* out,
+                                       size_t max_rows);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_CSV_H
@@ -0,0 +1,262 @@
+#ifndef RAZORFORGE_DIVIDE_H
+#define RAZORFORGE_DIVIDE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "razorforge_int.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Invariant-divisor division
+// A divider precomputes a magic multiplier and shift for one runtime divisor
+// (Granlund-Montgomery, as in libdivide) so that each subsequent division is
+// a high multiply, an optional add and a shift instead of a 20-90 cycle div.
+// Worth it once the same divisor is used more than a handful of times.
+//
+// A zero divisor produces a divider that returns the numerator unchanged;
+// callers that must trap on zero check before building the divider.
+// ============================================================================
+
+#ifndef RF_DIVIDE_API
+    #define RF_DIVIDE_API static inline
+#endif
+
+#define RF_DIVIDER_ADD 0x01       // magic needs an extra bit: use the add-and-halve fixup
+#define RF_DIVIDER_NEGATIVE 0x02  // signed divisor was negative
+
+// Packed shift/flags byte used by the code generator (shift | add << 6)
+#define RF_DIVIDER_MORE_ADD 0x40
+
+// Per-width helpers: high half of a product, and (hi * 2^BITS) / d for hi < d
+#define RF_DEFINE_DIVIDER_WIDE_OPS(N, UT, ST, UW, SW, BITS)                       \
+    static inline UT rf_mulhi_u##N(UT a, UT b)                                    \
+    {                                                                             \
+        return (UT)(((UW)a * b) >> BITS);                                         \
+    }                                                                             \
+    static inline ST rf_mulhi_s##N(ST a, ST b)                                    \
+    {                                                                             \
+        return (ST)(((SW)a * b) >> BITS);                                         \
+    }                                                                             \
+    static inline UT rf_divwide_u##N(UT hi, UT d, UT* rem)                        \
+    {                                                                             \
+        UW n = (UW)hi << BITS;                                                    \
+        *rem = (UT)(n % d);                                                       \
+        return (UT)(n / d);                                                       \
+    }
+
+static inline int rf_floor_log2_u8(uint32_t x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+static inline int rf_floor_log2_u16(uint32_t x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+static inline int rf_floor_log2_u32(uint32_t x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+static inline int rf_floor_log2_u64(uint64_t x)
+{
+    return 63 - __builtin_clzll(x);
+}
+
+RF_DEFINE_DIVIDER_WIDE_OPS(8, rf_u8, rf_i8, uint32_t, int32_t, 8)
+RF_DEFINE_DIVIDER_WIDE_OPS(16, rf_u16, rf_i16, uint32_t, int32_t, 16)
+RF_DEFINE_DIVIDER_WIDE_OPS(32, rf_u32, rf_i32, uint64_t, int64_t, 32)
+
+#ifdef RF_HAS_INT128
+RF_DEFINE_DIVIDER_WIDE_OPS(64, rf_u64, rf_i64, rf_u128, rf_i128, 64)
+
+// No 256-bit type: build the 128-bit helpers from 64-bit limbs
+static inline int rf_floor_log2_u128(rf_u128 x)
+{
+    uint64_t hi = (uint64_t)(x >> 64);
+    return hi ? 127 - __builtin_clzll(hi) : 63 - __builtin_clzll((uint64_t)x);
+}
+
+static inline rf_u128 rf_mulhi_u128(rf_u128 a, rf_u128 b)
+{
+    uint64_t a0 = (uint64_t)a, a1 = (uint64_t)(a >> 64);
+    uint64_t b0 = (uint64_t)b, b1 = (uint64_t)(b >> 64);
+    rf_u128 p00 = (rf_u128)a0 * b0;
+    rf_u128 p01 = (rf_u128)a0 * b1;
+    rf_u128 p10 = (rf_u128)a1 * b0;
+    rf_u128 p11 = (rf_u128)a1 * b1;
+    rf_u128 mid = (p00 >> 64) + (uint64_t)p01 + (uint64_t)p10;
+    return p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+}
+
+static inline rf_i128 rf_mulhi_s128(rf_i128 a, rf_i128 b)
+{
+    rf_u128 hi = rf_mulhi_u128((rf_u128)a, (rf_u128)b);
+    hi -= a < 0 ? (rf_u128)b : 0;
+    hi -= b < 0 ? (rf_u128)a : 0;
+    return (rf_i128)hi;
+}
+
+// Restoring long division; only runs when a divider is built
+static inline rf_u128 rf_divwide_u128(rf_u128 hi, rf_u128 d, rf_u128* rem)
+{
+    rf_u128 r = hi;
+    rf_u128 q = 0;
+    for (int i = 0; i < 128; i++)
+    {
+        bool carry = (r >> 127) != 0;
+        r <<= 1;
+        q <<= 1;
+        if (carry || r >= d)
+        {
+            r -= d;
+            q |= 1;
+        }
+    }
+    *rem = r;
+    return q;
+}
+#endif
+
+#define RF_DEFINE_DIVIDER(N, UT, ST, BITS)                                        \
+    typedef struct                                                                \
+    {                                                                             \
+        UT magic;                                                                 \
+        UT divisor;                                                               \
+        uint8_t shift;                                                            \
+        uint8_t flags;                                                            \
+    } rf_divider_u##N;                                                            \
+                                                                                  \
+    typedef struct                                                                \
+    {                                                                             \
+        ST magic;                                                                 \
+        ST divisor;                                                               \
+        uint8_t shift;                                                            \
+        uint8_t flags;                                                            \
+    } rf_divider_s##N;                                                            \
+                                                                                  \
+    RF_DIVIDE_API rf_divider_u##N rf_divider_u##N##_new(UT d)                     \
+    {                                                                             \
+        rf_divider_u##N div = {0, d, 0, 0};                                       \
+        if (d == 0) return div;                                                   \
+                                                                                  \
+        int floor_log2 = rf_floor_log2_u##N(d);                                   \
+        div.shift = (uint8_t)floor_log2;                                          \
+        if ((d & (d - 1)) == 0) return div;                                       \
+                                                                                  \
+        UT rem;                                                                   \
+        UT m = rf_divwide_u##N((UT)((UT)1 << floor_log2), d, &rem);               \
+        UT e = (UT)(d - rem);                                                     \
+        if (e >= (UT)((UT)1 << floor_log2))                                       \
+        {                                                                         \
+            /* 2^(BITS+k)/d needs BITS+1 bits: keep the low BITS, fix up later */ \
+            UT twice_rem = (UT)(rem + rem);                                       \
+            m = (UT)(m + m);                                                      \
+            if (twice_rem >= d || twice_rem < rem) m = (UT)(m + 1);               \
+            div.flags = RF_DIVIDER_ADD;                                           \
+        }                                                                         \
+        div.magic = (UT)(m + 1);                                                  \
+        return div;                                                               \
+    }                                                                             \
+                                                                                  \
+    RF_DIVIDE_API UT rf_divider_u##N##_div(rf_divider_u##N div, UT n)             \
+    {                                                                             \
+        if (div.magic == 0) return (UT)(n >> div.shift);                          \
+        UT q = rf_mulhi_u##N(div.magic, n);                                       \
+        if (div.flags & RF_DIVIDER_ADD)                                           \
+        {                                                                         \
+            UT t = (UT)((UT)((UT)(n - q) >> 1) + q);                              \
+            return (UT)(t >> div.shift);                                          \
+        }                                                                         \
+        return (UT)(q >> div.shift);                                              \
+    }                                                                             \
+                                                                                  \
+    RF_DIVIDE_API UT rf_divider_u##N##_rem(rf_divider_u##N div, UT n)             \
+    {                                                                             \
+        return (UT)(n - (UT)(rf_divider_u##N##_div(div, n) * div.divisor));       \
+    }                                                                             \
+                                                                                  \
+    RF_DIVIDE_API rf_divider_s##N rf_divider_s##N##_new(ST d)                     \
+    {                                                                             \
+        rf_divider_s##N div = {0, d, 0, 0};                                       \
+        if (d == 0) return div;                                                   \
+                                                                                  \
+        bool negative = d < 0;                                                    \
+        UT abs_d = negative ? (UT)(0 - (UT)d) : (UT)d;                            \
+        int floor_log2 = rf_floor_log2_u##N(abs_d);                               \
+        div.flags = negative ? RF_DIVIDER_NEGATIVE : 0;                           \
+        div.shift = (uint8_t)floor_log2;                                          \
+        if ((abs_d & (abs_d - 1)) == 0) return div;                               \
+                                                                                  \
+        UT rem;                                                                   \
+        UT m = rf_divwide_u##N((UT)((UT)1 << (floor_log2 - 1)), abs_d, &rem);     \
+        UT e = (UT)(abs_d - rem);                                                 \
+        if (e < (UT)((UT)1 << floor_log2))                                        \
+        {                                                                         \
+            div.shift = (uint8_t)(floor_log2 - 1);                                \
+        }                                                                         \
+        else                                                                      \
+        {                                                                         \
+            UT twice_rem = (UT)(rem + rem);                                       \
+            m = (UT)(m + m);                                                      \
+            if (twice_rem >= abs_d || twice_rem < rem) m = (UT)(m + 1);           \
+            div.flags |= RF_DIVIDER_ADD;                                          \
+        }                                                                         \
+        m = (UT)(m + 1);                                                          \
+        div.magic = (ST)(negative ? (UT)(0 - m) : m);                             \
+        return div;                                                               \
+    }                                                                             \
+                                                                                  \
+    RF_DIVIDE_API ST rf_divider_s##N##_div(rf_divider_s##N div, ST n)             \
+    {                                                                             \
+        UT sign = (div.flags & RF_DIVIDER_NEGATIVE) ? (UT)-1 : 0;                 \
+        if (div.magic == 0)                                                       \
+        {                                                                         \
+            /* Power of two: bias negative numerators so the shift truncates */   \
+            UT mask = (UT)(((UT)1 << div.shift) - 1);                             \
+            UT bias = RF_INT_NEG(n, BITS) ? mask : 0;                             \
+            ST q = (ST)((UT)((UT)n + bias));                                      \
+            q = (ST)(q >> div.shift);                                             \
+            return (ST)((UT)((UT)q ^ sign) - sign);                               \
+        }                                                                         \
+        UT uq = (UT)rf_mulhi_s##N(div.magic, n);                                  \
+        if (div.flags & RF_DIVIDER_ADD)                                           \
+        {                                                                         \
+            uq = (UT)(uq + (UT)((UT)((UT)n ^ sign) - sign));                      \
+        }                                                                         \
+        ST q = (ST)(uq);                                                          \
+        q = (ST)(q >> div.shift);                                                 \
+        return (ST)(q + RF_INT_NEG(q, BITS));                                     \
+    }                                                                             \
+                                                                                  \
+    RF_DIVIDE_API ST rf_divider_s##N##_rem(rf_divider_s##N div, ST n)             \
+    {                                                                             \
+        UT product = (UT)((UT)rf_divider_s##N##_div(div, n) * (UT)div.divisor);   \
+        return (ST)((UT)((UT)n - product));                                       \
+    }
+
+RF_DEFINE_DIVIDER(8, rf_u8, rf_i8, 8)
+RF_DEFINE_DIVIDER(16, rf_u16, rf_i16, 16)
+RF_DEFINE_DIVIDER(32, rf_u32, rf_i32, 32)
+
+#ifdef RF_HAS_INT128
+RF_DEFINE_DIVIDER(64, rf_u64, rf_i64, 64)
+RF_DEFINE_DIVIDER(128, rf_u128, rf_i128, 128)
+#endif
+
+// Scalar entry points for generated code, which hoists these out of loops and
+// inlines the multiply-shift itself (divide.c)
+rf_u32 rf_divider_u32_magic(rf_u32 d);
+uint8_t rf_divider_u32_more(rf_u32 d);
+rf_u64 rf_divider_u64_magic(rf_u64 d);
+uint8_t rf_divider_u64_more(rf_u64 d);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_DIVIDE_H
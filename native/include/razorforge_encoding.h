@@ -0,0 +1,46 @@
+#ifndef RAZORFORGE_ENCODING_H
+#define RAZORFORGE_ENCODING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Base64 and hex codecs (encoding.c)
+//
+// All functions write into a caller-provided buffer sized with the *_length
+// helpers, write no terminator, and return the number of bytes written.
+// Decoders return RF_DECODE_INVALID on malformed input, leaving dest
+// partially written.
+//
+// Kernels: AVX2, then SSSE3, then scalar, dispatched on razorforge_cpu.
+// ============================================================================
+
+#define RF_DECODE_INVALID SIZE_MAX
+
+// Base64 flags
+#define RF_BASE64_URL 1     // RFC 4648 section 5 alphabet: '-' and '_' for '+' and '/'
+#define RF_BASE64_NO_PAD 2  // encode without trailing '='
+
+size_t rf_base64_encoded_length(size_t length, int flags);
+size_t rf_base64_decoded_max_length(size_t length);  // exact unless padded
+
+size_t rf_base64_encode(const void* src, size_t length, char* dest, int flags);
+
+// Accepts input with or without padding; rejects whitespace and characters
+// outside the alphabet chosen by flags
+size_t rf_base64_decode(const char* src, size_t length, void* dest, int flags);
+
+// Hex: two digits per byte, encoded lowercase unless upper; decoding accepts
+// both cases and rejects odd lengths
+size_t rf_hex_encode(const void* src, size_t length, char* dest, int upper);
+size_t rf_hex_decode(const char* src, size_t length, void* dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_ENCODING_H
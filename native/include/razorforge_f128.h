@@ -0,0 +1,121 @@
+#ifndef RAZORFORGE_F128_H
+#define RAZORFORGE_F128_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "razorforge_int.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Quad precision (IEEE 754 binary128)
+// rf_f128 is the C type that matches an LLVM fp128: __float128 on GCC/Clang
+// x86-64, long double where that is already binary128 (AArch64/RISC-V Linux).
+// Elsewhere it is the raw bit pattern and every operation goes through the
+// portable soft-float core (f128_soft.c).
+//
+// Backends, chosen at build time (f128.c):
+//   - add, sub, mul, sqrt, fma: always the soft-float core (faster than
+//     libgcc/libquadmath here, and correctly rounded)
+//   - div, f64 conversions: the compiler's quad support when present
+//   - transcendentals, parse/format: libquadmath (RF_HAS_QUADMATH) or the
+//     long double libm, falling back to the soft-float core
+// All paths share one text grammar and one output format.
+//
+// Soft core accuracy: +, -, *, /, sqrt and fma are correctly rounded (ties to
+// even). exp, log, sin and cos stay within a few ulp; sin/cos reduce by a
+// three-part pi/2 and lose accuracy past |x| ~ 2^50. pow is exp(y * log x),
+// so its error grows with |y * log x|.
+// ============================================================================
+
+#ifdef RF_HAS_INT128
+
+#if defined(__SIZEOF_FLOAT128__)
+    #define RF_HAS_FLOAT128 1
+__extension__ typedef __float128 rf_f128;
+#elif defined(__LDBL_MANT_DIG__) && __LDBL_MANT_DIG__ == 113
+    #define RF_HAS_FLOAT128 1
+    #define RF_F128_IS_LONG_DOUBLE 1
+typedef long double rf_f128;
+#else
+typedef rf_u128 rf_f128;
+#endif
+
+#define RF_F128_BITS(hi, lo) (((rf_u128)(hi) << 64) | (rf_u128)(lo))
+
+// Longest rf_f128_to_chars output: sign, 36 digits, point, "e-4966"
+#define RF_F128_MAX_CHARS 48
+
+// Bit pattern conversions
+rf_u128 rf_f128_to_bits(rf_f128 value);
+rf_f128 rf_f128_from_bits(rf_u128 bits);
+
+// Arithmetic
+rf_f128 rf_f128_add(rf_f128 a, rf_f128 b);
+rf_f128 rf_f128_sub(rf_f128 a, rf_f128 b);
+rf_f128 rf_f128_mul(rf_f128 a, rf_f128 b);
+rf_f128 rf_f128_div(rf_f128 a, rf_f128 b);
+rf_f128 rf_f128_sqrt(rf_f128 x);
+rf_f128 rf_f128_fma(rf_f128 a, rf_f128 b, rf_f128 c);
+
+// Transcendentals
+rf_f128 rf_f128_exp(rf_f128 x);
+rf_f128 rf_f128_log(rf_f128 x);
+rf_f128 rf_f128_sin(rf_f128 x);
+rf_f128 rf_f128_cos(rf_f128 x);
+rf_f128 rf_f128_tan(rf_f128 x);
+rf_f128 rf_f128_pow(rf_f128 base, rf_f128 exponent);
+
+// Conversions to and from f64
+rf_f128 rf_f128_from_f64(double value);
+double rf_f128_to_f64(rf_f128 value);
+
+// Formatting: shortest text that parses back to the same value (at most 36
+// significant digits, %g layout). Buffer needs RF_F128_MAX_CHARS bytes;
+// returns the length without NUL.
+size_t rf_f128_to_chars(rf_f128 value, char* buffer);
+char* rf_f128_to_cstr(rf_f128 value);
+
+// Parsing: optional sign, decimal digits with an optional point and exponent,
+// or inf/infinity/nan. Returns an RF_PARSE_* status; RF_PARSE_OVERFLOW still
+// stores the correctly signed infinity.
+int rf_f128_parse(const char* text, size_t length, rf_f128* out);
+int rf_f128_parse_letters(const void* text, size_t length, size_t letter_size, rf_f128* out);
+int32_t rf_f128_parse_status(const char* text);
+rf_f128 rf_f128_from_cstr(const char* text);
+
+// ============================================================================
+// Portable soft-float core on bit patterns (f128_soft.c)
+// Always built, so benchmarks and tests can compare it against the native
+// backend on machines that have one.
+// ============================================================================
+
+rf_u128 rf_f128_soft_add(rf_u128 a, rf_u128 b);
+rf_u128 rf_f128_soft_sub(rf_u128 a, rf_u128 b);
+rf_u128 rf_f128_soft_mul(rf_u128 a, rf_u128 b);
+rf_u128 rf_f128_soft_div(rf_u128 a, rf_u128 b);
+rf_u128 rf_f128_soft_sqrt(rf_u128 x);
+rf_u128 rf_f128_soft_fma(rf_u128 a, rf_u128 b, rf_u128 c);
+rf_u128 rf_f128_soft_exp(rf_u128 x);
+rf_u128 rf_f128_soft_log(rf_u128 x);
+rf_u128 rf_f128_soft_sin(rf_u128 x);
+rf_u128 rf_f128_soft_cos(rf_u128 x);
+rf_u128 rf_f128_soft_tan(rf_u128 x);
+rf_u128 rf_f128_soft_pow(rf_u128 base, rf_u128 exponent);
+rf_u128 rf_f128_soft_from_f64(double value);
+double rf_f128_soft_to_f64(rf_u128 bits);
+
+// Correctly rounded for inputs of up to 37 significant digits; longer inputs
+// fold the extra digits into a sticky digit
+int rf_f128_soft_parse(const char* text, size_t length, rf_u128* out);
+size_t rf_f128_soft_to_chars(rf_u128 bits, char* buffer);
+
+#endif // RF_HAS_INT128
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_F128_H
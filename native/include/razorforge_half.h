@@ -0,0 +1,151 @@
+#ifndef RAZORFORGE_HALF_H
+#define RAZORFORGE_HALF_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Half precision (IEEE 754 binary16)
+// rf_f16 is the raw bit pattern of an LLVM half. Arithmetic promotes to f32
+// and rounds back once; f32 carries more than 2*11+2 bits, so +, -, *, / and
+// sqrt round exactly as native half hardware would.
+// ============================================================================
+
+#ifndef RF_HALF_API
+    #define RF_HALF_API static inline
+#endif
+
+typedef uint16_t rf_f16;
+
+RF_HALF_API float rf_f16_to_f32(rf_f16 h)
+{
+    uint32_t sign = (uint32_t)(h & 0x8000u) << 16;
+    uint32_t exponent = (h >> 10) & 0x1fu;
+    uint32_t mantissa = h & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0x1f)
+    {
+        // Infinity, or NaN with its payload kept and the quiet bit set (as F16C does)
+        bits = sign | 0x7f800000u | (mantissa << 13) | (mantissa ? 0x400000u : 0);
+    }
+    else if (exponent != 0)
+    {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+    else
+    {
+        // Zero or subnormal: mantissa * 2^-24 is exact in f32
+        float magnitude = (float)mantissa * 0x1p-24f;
+        memcpy(&bits, &magnitude, sizeof(bits));
+        bits |= sign;
+    }
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// Round to nearest, ties to even; overflow goes to infinity, NaN stays quiet
+RF_HALF_API rf_f16 rf_f32_to_f16(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    uint16_t sign = (uint16_t)((x >> 16) & 0x8000u);
+    x &= 0x7fffffffu;
+
+    if (x >= 0x7f800000u)
+    {
+        uint16_t nan = x > 0x7f800000u ? (uint16_t)(0x200u | ((x >> 13) & 0x3ffu)) : 0;
+        return (rf_f16)(sign | 0x7c00u | nan);
+    }
+    if (x >= 0x477ff000u)  // >= 65520 rounds past F16_MAX
+    {
+        return (rf_f16)(sign | 0x7c00u);
+    }
+    if (x < 0x38800000u)
+    {
+        // Below 2^-14: adding 0.5 lines the half subnormal up with the f32
+        // mantissa, and the FPU does the rounding
+        float magnitude;
+        memcpy(&magnitude, &x, sizeof(magnitude));
+        magnitude += 0.5f;
+        memcpy(&x, &magnitude, sizeof(x));
+        return (rf_f16)(sign | (x - 0x3f000000u));
+    }
+
+    // Rebias the exponent and round the 13 dropped bits to even
+    uint32_t odd = (x >> 13) & 1u;
+    x += 0xc8000fffu + odd;
+    return (rf_f16)(sign | (x >> 13));
+}
+
+RF_HALF_API rf_f16 rf_f16_add(rf_f16 a, rf_f16 b)
+{
+    return rf_f32_to_f16(rf_f16_to_f32(a) + rf_f16_to_f32(b));
+}
+
+RF_HALF_API rf_f16 rf_f16_sub(rf_f16 a, rf_f16 b)
+{
+    return rf_f32_to_f16(rf_f16_to_f32(a) - rf_f16_to_f32(b));
+}
+
+RF_HALF_API rf_f16 rf_f16_mul(rf_f16 a, rf_f16 b)
+{
+    return rf_f32_to_f16(rf_f16_to_f32(a) * rf_f16_to_f32(b));
+}
+
+RF_HALF_API rf_f16 rf_f16_div(rf_f16 a, rf_f16 b)
+{
+    return rf_f32_to_f16(rf_f16_to_f32(a) / rf_f16_to_f32(b));
+}
+
+// The product of two halves is exact, but the sum with c can need more bits
+// than f32 has, and rounding it to f32 and then to f16 can land on a false tie.
+// The sum is formed exactly in double (plus a two-sum error term), narrowed to
+// f32 with round-to-odd, and rounded to f16 once from there.
+RF_HALF_API rf_f16 rf_f16_fma(rf_f16 a, rf_f16 b, rf_f16 c)
+{
+    double product = (double)rf_f16_to_f32(a) * (double)rf_f16_to_f32(b);
+    double addend = (double)rf_f16_to_f32(c);
+    double sum = product + addend;
+    double back = sum - product;
+    double error = (product - (sum - back)) + (addend - back);
+
+    float narrow = (float)sum;
+    double residual = (sum - (double)narrow) + error;
+
+    uint32_t bits;
+    memcpy(&bits, &narrow, sizeof(bits));
+    if ((bits & 0x7f800000u) != 0x7f800000u && residual != 0.0 && (bits & 1u) == 0)
+    {
+        // Inexact with an even last bit: step to the odd neighbour on the true side
+        bits += (residual > 0.0) == (narrow > 0.0f) ? 1u : (uint32_t)-1;
+        memcpy(&narrow, &bits, sizeof(narrow));
+    }
+
+    return rf_f32_to_f16(narrow);
+}
+
+// Scalar entry points for generated code (half.c); transcendentals are
+// evaluated in f32 and rounded once
+rf_f16 rf_f16_sqrt(rf_f16 x);
+rf_f16 rf_f16_sin(rf_f16 x);
+rf_f16 rf_f16_cos(rf_f16 x);
+rf_f16 rf_f16_exp(rf_f16 x);
+rf_f16 rf_f16_log(rf_f16 x);
+rf_f16 rf_f16_pow(rf_f16 base, rf_f16 exponent);
+
+// Bulk conversion; uses F16C (8 lanes per instruction) when the CPU has it
+void rf_f16_to_f32_batch(const rf_f16* src, float* dest, size_t count);
+void rf_f32_to_f16_batch(const float* src, rf_f16* dest, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_HALF_H
@@ -0,0 +1,285 @@
+#ifndef RAZORFORGE_INT_H
+#define RAZORFORGE_INT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Fixed-width integer kernels
+// One template instantiated for s8-s128 and u8-u128. Every width gets
+// add, sub, mul, div, rem, neg, shl, shr and abs in three flavours:
+//   _wrap      - modulo 2^N arithmetic
+//   _saturate  - clamp to the type's MIN/MAX
+//   _checked   - wrapped value plus an overflow flag
+// The kernels are static inline so C callers fold them down to the same
+// instructions the LLVM *.with.overflow / *.sat intrinsics produce; the
+// runtime compiles one out-of-line copy of each (RF_INT_API) for FFI.
+//
+// Division and remainder by zero are reported by the _checked variants
+// and yield 0 from _wrap/_saturate; the language traps before reaching them.
+// ============================================================================
+
+#ifndef RF_INT_API
+    #define RF_INT_API static inline
+#endif
+
+typedef int8_t rf_i8;
+typedef int16_t rf_i16;
+typedef int32_t rf_i32;
+typedef int64_t rf_i64;
+typedef uint8_t rf_u8;
+typedef uint16_t rf_u16;
+typedef uint32_t rf_u32;
+typedef uint64_t rf_u64;
+
+#if defined(__SIZEOF_INT128__)
+    #define RF_HAS_INT128 1
+__extension__ typedef __int128 rf_i128;
+__extension__ typedef unsigned __int128 rf_u128;
+    #define RF_U128_MAX (~(rf_u128)0)
+    #define RF_I128_MAX ((rf_i128)(RF_U128_MAX >> 1))
+    #define RF_I128_MIN (-RF_I128_MAX - 1)
+#endif
+
+// Text parsing status (int128.c, parse.c)
+#define RF_PARSE_OK 0
+#define RF_PARSE_INVALID 1
+#define RF_PARSE_OVERFLOW 2
+
+// Sign test that does not trip -Wtype-limits when instantiated for unsigned T
+#define RF_INT_NEG(x, BITS) (((x) >> ((BITS) - 1)) != 0)
+
+#define RF_DEFINE_INT_KERNELS(N, T, UT, BITS, MIN, MAX, SIGNED)                 \
+    typedef struct                                                              \
+    {                                                                           \
+        T value;                                                                \
+        bool overflow;                                                          \
+    } rf_##N##_result;                                                          \
+                                                                                \
+    /* add / sub / mul */                                                       \
+    RF_INT_API T rf_##N##_add_wrap(T a, T b)                                    \
+    {                                                                           \
+        T r;                                                                    \
+        __builtin_add_overflow(a, b, &r);                                       \
+        return r;                                                               \
+    }                                                                           \
+    RF_INT_API T rf_##N##_sub_wrap(T a, T b)                                    \
+    {                                                                           \
+        T r;                                                                    \
+        __builtin_sub_overflow(a, b, &r);                                       \
+        return r;                                                               \
+    }                                                                           \
+    RF_INT_API T rf_##N##_mul_wrap(T a, T b)                                    \
+    {                                                                           \
+        T r;                                                                    \
+        __builtin_mul_overflow(a, b, &r);                                       \
+        return r;                                                               \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_add_checked(T a, T b)                   \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = __builtin_add_overflow(a, b, &res.value);                \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_sub_checked(T a, T b)                   \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = __builtin_sub_overflow(a, b, &res.value);                \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_mul_checked(T a, T b)                   \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = __builtin_mul_overflow(a, b, &res.value);                \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_add_saturate(T a, T b)                                \
+    {                                                                           \
+        T r;                                                                    \
+        if (!__builtin_add_overflow(a, b, &r)) return r;                        \
+        return (SIGNED && RF_INT_NEG(b, BITS)) ? MIN : MAX;                     \
+    }                                                                           \
+    RF_INT_API T rf_##N##_sub_saturate(T a, T b)                                \
+    {                                                                           \
+        T r;                                                                    \
+        if (!__builtin_sub_overflow(a, b, &r)) return r;                        \
+        return (SIGNED && RF_INT_NEG(b, BITS)) ? MAX : MIN;                     \
+    }                                                                           \
+    RF_INT_API T rf_##N##_mul_saturate(T a, T b)                                \
+    {                                                                           \
+        T r;                                                                    \
+        if (!__builtin_mul_overflow(a, b, &r)) return r;                        \
+        bool negative = RF_INT_NEG(a, BITS) != RF_INT_NEG(b, BITS);             \
+        return (SIGNED && negative) ? MIN : MAX;                                \
+    }                                                                           \
+                                                                                \
+    /* div / rem: the only overflowing quotient is MIN / -1 */                  \
+    RF_INT_API rf_##N##_result rf_##N##_div_checked(T a, T b)                   \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = b == 0 || (SIGNED && a == MIN && b == (T)-1);            \
+        res.value = b == 0 ? 0 : res.overflow ? MIN : (T)(a / b);               \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_div_wrap(T a, T b)                                    \
+    {                                                                           \
+        return rf_##N##_div_checked(a, b).value;                                \
+    }                                                                           \
+    RF_INT_API T rf_##N##_div_saturate(T a, T b)                                \
+    {                                                                           \
+        rf_##N##_result res = rf_##N##_div_checked(a, b);                       \
+        return (res.overflow && b != 0) ? MAX : res.value;                      \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_rem_checked(T a, T b)                   \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = b == 0;                                                  \
+        res.value = (b == 0 || (SIGNED && b == (T)-1)) ? 0 : (T)(a % b);        \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_rem_wrap(T a, T b)                                    \
+    {                                                                           \
+        return rf_##N##_rem_checked(a, b).value;                                \
+    }                                                                           \
+    RF_INT_API T rf_##N##_rem_saturate(T a, T b)                                \
+    {                                                                           \
+        return rf_##N##_rem_checked(a, b).value;                                \
+    }                                                                           \
+                                                                                \
+    /* neg / abs: signed overflow only at MIN, unsigned neg at any non-zero */  \
+    RF_INT_API rf_##N##_result rf_##N##_neg_checked(T a)                        \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = __builtin_sub_overflow((T)0, a, &res.value);             \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_neg_wrap(T a)                                         \
+    {                                                                           \
+        return (T)(0 - (UT)a);                                                  \
+    }                                                                           \
+    RF_INT_API T rf_##N##_neg_saturate(T a)                                     \
+    {                                                                           \
+        rf_##N##_result res = rf_##N##_neg_checked(a);                          \
+        return res.overflow ? (SIGNED ? MAX : 0) : res.value;                   \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_abs_checked(T a)                        \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = SIGNED && a == MIN;                                      \
+        res.value = (SIGNED && RF_INT_NEG(a, BITS)) ? rf_##N##_neg_wrap(a) : a; \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_abs_wrap(T a)                                         \
+    {                                                                           \
+        return rf_##N##_abs_checked(a).value;                                   \
+    }                                                                           \
+    RF_INT_API T rf_##N##_abs_saturate(T a)                                     \
+    {                                                                           \
+        rf_##N##_result res = rf_##N##_abs_checked(a);                          \
+        return res.overflow ? MAX : res.value;                                  \
+    }                                                                           \
+                                                                                \
+    /* shl / shr: wrap masks the amount, checked/saturate treat lost bits */    \
+    RF_INT_API T rf_##N##_shl_wrap(T a, uint32_t b)                             \
+    {                                                                           \
+        return (T)((UT)a << (b & (BITS - 1)));                                  \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_shl_checked(T a, uint32_t b)            \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.value = rf_##N##_shl_wrap(a, b);                                    \
+        res.overflow = b >= BITS || (T)(res.value >> b) != a;                   \
+        return res;                                                             \
+    }                                                                           \
+    RF_INT_API T rf_##N##_shl_saturate(T a, uint32_t b)                         \
+    {                                                                           \
+        rf_##N##_result res = rf_##N##_shl_checked(a, b);                       \
+        if (!res.overflow || a == 0) return a == 0 ? 0 : res.value;             \
+        return (SIGNED && RF_INT_NEG(a, BITS)) ? MIN : MAX;                     \
+    }                                                                           \
+    RF_INT_API T rf_##N##_shr_wrap(T a, uint32_t b)                             \
+    {                                                                           \
+        return (T)(a >> (b & (BITS - 1)));                                      \
+    }                                                                           \
+    RF_INT_API T rf_##N##_shr_saturate(T a, uint32_t b)                         \
+    {                                                                           \
+        if (b < BITS) return (T)(a >> b);                                       \
+        return (SIGNED && RF_INT_NEG(a, BITS)) ? (T)-1 : 0;                     \
+    }                                                                           \
+    RF_INT_API rf_##N##_result rf_##N##_shr_checked(T a, uint32_t b)            \
+    {                                                                           \
+        rf_##N##_result res;                                                    \
+        res.overflow = b >= BITS;                                               \
+        res.value = rf_##N##_shr_wrap(a, b);                                    \
+        return res;                                                             \
+    }                                                                           \
+                                                                                \
+    /* unchecked (danger mode): plain C operators, UB on overflow */            \
+    RF_INT_API T rf_##N##_add_unchecked(T a, T b)                               \
+    {                                                                           \
+        return (T)(a + b);                                                      \
+    }                                                                           \
+    RF_INT_API T rf_##N##_sub_unchecked(T a, T b)                               \
+    {                                                                           \
+        return (T)(a - b);                                                      \
+    }                                                                           \
+    RF_INT_API T rf_##N##_mul_unchecked(T a, T b)                               \
+    {                                                                           \
+        return (T)(a * b);                                                      \
+    }
+
+RF_DEFINE_INT_KERNELS(i8, rf_i8, rf_u8, 8, INT8_MIN, INT8_MAX, 1)
+RF_DEFINE_INT_KERNELS(i16, rf_i16, rf_u16, 16, INT16_MIN, INT16_MAX, 1)
+RF_DEFINE_INT_KERNELS(i32, rf_i32, rf_u32, 32, INT32_MIN, INT32_MAX, 1)
+RF_DEFINE_INT_KERNELS(i64, rf_i64, rf_u64, 64, INT64_MIN, INT64_MAX, 1)
+RF_DEFINE_INT_KERNELS(u8, rf_u8, rf_u8, 8, 0, UINT8_MAX, 0)
+RF_DEFINE_INT_KERNELS(u16, rf_u16, rf_u16, 16, 0, UINT16_MAX, 0)
+RF_DEFINE_INT_KERNELS(u32, rf_u32, rf_u32, 32, 0, UINT32_MAX, 0)
+RF_DEFINE_INT_KERNELS(u64, rf_u64, rf_u64, 64, 0, UINT64_MAX, 0)
+
+#ifdef RF_HAS_INT128
+RF_DEFINE_INT_KERNELS(i128, rf_i128, rf_u128, 128, RF_I128_MIN, RF_I128_MAX, 1)
+RF_DEFINE_INT_KERNELS(u128, rf_u128, rf_u128, 128, 0, RF_U128_MAX, 0)
+
+// ============================================================================
+// 128-bit division and decimal text conversion (int128.c)
+// Division takes 64-bit fast paths before falling back to a normalized
+// 128-by-64 estimate; formatting works in 10^19 chunks.
+// ============================================================================
+
+#define RF_U128_MAX_DIGITS 39
+
+// Division (divisor must be non-zero; rem may be NULL)
+rf_u128 rf_u128_div_u64(rf_u128 n, uint64_t d, uint64_t* rem);
+rf_u128 rf_u128_divmod(rf_u128 n, rf_u128 d, rf_u128* rem);
+rf_u128 rf_u128_div(rf_u128 n, rf_u128 d);
+rf_u128 rf_u128_rem(rf_u128 n, rf_u128 d);
+rf_i128 rf_i128_divmod(rf_i128 n, rf_i128 d, rf_i128* rem);
+rf_i128 rf_i128_div(rf_i128 n, rf_i128 d);
+rf_i128 rf_i128_rem(rf_i128 n, rf_i128 d);
+
+// Formatting (buffer needs RF_U128_MAX_DIGITS + 2 bytes; returns length without NUL)
+size_t rf_u128_to_chars(rf_u128 value, char* buffer);
+size_t rf_i128_to_chars(rf_i128 value, char* buffer);
+char* rf_u128_to_cstr(rf_u128 value);
+char* rf_i128_to_cstr(rf_i128 value);
+
+// Parsing (optional sign, decimal digits only; returns an RF_PARSE_* status)
+int rf_u128_parse(const char* text, size_t length, rf_u128* out);
+int rf_i128_parse(const char* text, size_t length, rf_i128* out);
+int32_t rf_u128_parse_status(const char* text);
+rf_u128 rf_u128_from_cstr(const char* text);
+int32_t rf_i128_parse_status(const char* text);
+rf_i128 rf_i128_from_cstr(const char* text);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_INT_H
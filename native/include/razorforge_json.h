@@ -0,0 +1,129 @@
+#ifndef RAZORFORGE_JSON_H
+#define RAZORFORGE_JSON_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Two-stage JSON parser (json.c)
+//
+// Stage 1 indexes structural characters with SIMD (AVX2, then SSE2, then
+// scalar, dispatched on razorforge_cpu); stage 2 walks the index and builds
+// a tape in the document's arena. The source buffer is borrowed, not
+// copied: it must outlive the document, and strings without escapes are
+// returned as views into it. Escaped strings are decoded into the arena.
+//
+// With RF_JSON_LAZY, stage 2 is skipped and values are read on demand from
+// the index through the same accessors. The parse still checks that the
+// root's brackets close exactly at the end of the input; beyond that only the
+// parts visited are validated, so errors surface from the accessors instead
+// of the parse (the first one is also kept for rf_json_error and
+// rf_json_error_offset).
+//
+// Documents are limited to 4 GiB. Bytes >= 0x80 are checked to be UTF-8.
+// ============================================================================
+
+// Status codes
+#define RF_JSON_OK 0
+#define RF_JSON_ERROR_SYNTAX 1      // misplaced or missing structural character
+#define RF_JSON_ERROR_STRING 2      // unterminated string, bad escape or control character
+#define RF_JSON_ERROR_NUMBER 3      // malformed number, or a float beyond f64
+#define RF_JSON_ERROR_LITERAL 4     // not true, false or null
+#define RF_JSON_ERROR_UTF8 5
+#define RF_JSON_ERROR_DEPTH 6       // nesting deeper than RF_JSON_MAX_DEPTH
+#define RF_JSON_ERROR_EMPTY 7       // no value at all
+#define RF_JSON_ERROR_CAPACITY 8    // too large, or out of memory
+#define RF_JSON_ERROR_TYPE 9        // accessor does not match the value
+#define RF_JSON_ERROR_NOT_FOUND 10  // no such field or index
+
+#define RF_JSON_MAX_DEPTH 1024
+
+// Parse flags
+#define RF_JSON_LAZY 1
+
+typedef enum
+{
+    RF_JSON_NULL = 0,
+    RF_JSON_BOOL,
+    RF_JSON_INTEGER,   // fits in i64
+    RF_JSON_UNSIGNED,  // integer above INT64_MAX that fits in u64
+    RF_JSON_FLOAT,     // anything with a fraction or exponent, or beyond u64
+    RF_JSON_STRING,
+    RF_JSON_ARRAY,
+    RF_JSON_OBJECT,
+    RF_JSON_INVALID,   // lazy mode: the value failed to parse
+} rf_json_type;
+
+typedef struct rf_json_document rf_json_document;
+
+// A position in a document: a tape slot, or an index entry in lazy mode.
+// Valid as long as the document.
+typedef struct
+{
+    rf_json_document* document;
+    size_t at;
+} rf_json_value;
+
+// Lifecycle. Returns NULL only when out of memory; check rf_json_error.
+rf_json_document* rf_json_parse(const char* src, size_t length, int flags);
+void rf_json_free(rf_json_document* document);
+
+// Parses another source into an existing document, reusing its memory.
+// Values from the previous parse are invalidated. Returns rf_json_error.
+int rf_json_reparse(rf_json_document* document, const char* src, size_t length, int flags);
+
+int rf_json_error(const rf_json_document* document);
+size_t rf_json_error_offset(const rf_json_document* document);  // byte offset in src
+
+rf_json_value rf_json_root(rf_json_document* document);
+rf_json_type rf_json_type_of(rf_json_value value);
+
+// Scalars: RF_JSON_OK, or RF_JSON_ERROR_TYPE / a parse error in lazy mode.
+// get_f64 accepts any number; get_i64 and get_u64 only integers in range.
+int rf_json_get_bool(rf_json_value value, bool* out);
+int rf_json_get_i64(rf_json_value value, int64_t* out);
+int rf_json_get_u64(rf_json_value value, uint64_t* out);
+int rf_json_get_f64(rf_json_value value, double* out);
+
+// Strings (and object keys): UTF-8 bytes, not NUL-terminated. *data points
+// into src when the string has no escapes, else into the document's arena.
+int rf_json_get_string(rf_json_value value, const char** data, size_t* length);
+
+// The getters by value, for callers that cannot pass out-pointers (the
+// stdlib). status is what the getter returns; value is 0 (data NULL) unless
+// status is RF_JSON_OK.
+typedef struct { bool value; int status; } rf_json_bool_result;
+typedef struct { int64_t value; int status; } rf_json_i64_result;
+typedef struct { uint64_t value; int status; } rf_json_u64_result;
+typedef struct { double value; int status; } rf_json_f64_result;
+typedef struct { const char* data; size_t length; int status; } rf_json_string_result;
+
+rf_json_bool_result rf_json_bool_of(rf_json_value value);
+rf_json_i64_result rf_json_i64_of(rf_json_value value);
+rf_json_u64_result rf_json_u64_of(rf_json_value value);
+rf_json_f64_result rf_json_f64_of(rf_json_value value);
+rf_json_string_result rf_json_string_of(rf_json_value value);
+
+// Containers. count is O(1) on the tape and a walk in lazy mode.
+size_t rf_json_count(rf_json_value container);
+
+// Array iteration: first/next return false at the end (or on a type error)
+bool rf_json_array_first(rf_json_value array, rf_json_value* element);
+bool rf_json_array_next(rf_json_value* element);
+int rf_json_array_at(rf_json_value array, size_t index, rf_json_value* out);
+
+// Object iteration in document order; keys are strings
+bool rf_json_object_first(rf_json_value object, rf_json_value* key, rf_json_value* value);
+bool rf_json_object_next(rf_json_value* key, rf_json_value* value);
+int rf_json_object_find(rf_json_value object, const char* key, size_t key_length, rf_json_value* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_JSON_H
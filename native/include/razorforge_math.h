@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -100,6 +101,106 @@ int rf_bigint_sqrt(rf_bigint* result, rf_bigint* a);
 int rf_bigint_gcd(rf_bigint* result, rf_bigint* a, rf_bigint* b);
 int rf_bigint_lcm(rf_bigint* result, rf_bigint* a, rf_bigint* b);
 
+// ============================================================================
+// Fraction - Exact rational arithmetic
+// Inline 64-bit numerator/denominator with automatic promotion to rf_bigint
+// (promotion requires HAVE_LIBTOMMATH; the 64-bit stubs abort on overflow)
+// ============================================================================
+
+typedef struct rf_fraction {
+    int64_t num;          // inline numerator (valid when big_num is NULL)
+    int64_t den;          // inline denominator, always > 0
+    rf_bigint* big_num;   // promoted numerator, NULL on the fast path
+    rf_bigint* big_den;   // promoted denominator, always > 0
+    int32_t reduced;      // non-zero once num/den are in lowest terms
+} rf_fraction;
+
+// Lifecycle management
+rf_fraction* rf_fraction_new(void);
+void rf_fraction_free(rf_fraction* f);
+int rf_fraction_copy(rf_fraction* dest, const rf_fraction* src);
+
+// Initialization (return -1 for a zero denominator or malformed text)
+int rf_fraction_set_i64(rf_fraction* f, int64_t num, int64_t den);
+int rf_fraction_set_bigint(rf_fraction* f, rf_bigint* num, rf_bigint* den);
+int rf_fraction_set_str(rf_fraction* f, const char* str);
+
+// Arithmetic operations (result may alias an operand; div/inv return -1 on zero)
+int rf_fraction_add(rf_fraction* result, rf_fraction* a, rf_fraction* b);
+int rf_fraction_sub(rf_fraction* result, rf_fraction* a, rf_fraction* b);
+int rf_fraction_mul(rf_fraction* result, rf_fraction* a, rf_fraction* b);
+int rf_fraction_div(rf_fraction* result, rf_fraction* a, rf_fraction* b);
+int rf_fraction_neg(rf_fraction* result, rf_fraction* a);
+int rf_fraction_abs(rf_fraction* result, rf_fraction* a);
+int rf_fraction_inv(rf_fraction* result, rf_fraction* a);
+
+// Comparison
+int rf_fraction_cmp(rf_fraction* a, rf_fraction* b);  // -1, 0, 1
+int rf_fraction_is_zero(const rf_fraction* f);
+int rf_fraction_is_neg(const rf_fraction* f);
+int rf_fraction_is_integer(rf_fraction* f);
+
+// Normalization (lazy; the accessors below normalize on demand)
+void rf_fraction_normalize(rf_fraction* f);
+int rf_fraction_is_big(const rf_fraction* f);
+
+// Conversion
+int rf_fraction_get_num(rf_fraction* f, rf_bigint* out);
+int rf_fraction_get_den(rf_fraction* f, rf_bigint* out);
+int64_t rf_fraction_num_i64(rf_fraction* f);
+int64_t rf_fraction_den_i64(rf_fraction* f);
+double rf_fraction_get_f64(rf_fraction* f);
+char* rf_fraction_get_str(rf_fraction* f);
+
+// ============================================================================
+// Vector Math - Batch elementwise kernels over f32/f64 slices
+// SIMD polynomial evaluation with libm fallback for special lanes; see
+// vector_math_kernels.h for the ULP bounds. dest may alias the source.
+// ============================================================================
+
+void rf_f64_sin_batch(const double* src, double* dest, size_t count);
+void rf_f64_cos_batch(const double* src, double* dest, size_t count);
+void rf_f64_exp_batch(const double* src, double* dest, size_t count);
+void rf_f64_log_batch(const double* src, double* dest, size_t count);
+void rf_f64_sqrt_batch(const double* src, double* dest, size_t count);
+void rf_f64_tanh_batch(const double* src, double* dest, size_t count);
+void rf_f64_pow_batch(const double* base, const double* exponent, double* dest, size_t count);
+
+void rf_f32_sin_batch(const float* src, float* dest, size_t count);
+void rf_f32_cos_batch(const float* src, float* dest, size_t count);
+void rf_f32_exp_batch(const float* src, float* dest, size_t count);
+void rf_f32_log_batch(const float* src, float* dest, size_t count);
+void rf_f32_sqrt_batch(const float* src, float* dest, size_t count);
+void rf_f32_tanh_batch(const float* src, float* dest, size_t count);
+void rf_f32_pow_batch(const float* base, const float* exponent, float* dest, size_t count);
+
+// Strict mode (--strict-math) swaps the kernels for per-element libm calls
+void rf_math_set_strict(bool strict);
+bool rf_math_is_strict(void);
+
+// ============================================================================
+// Vector Math - Reductions over f32/f64 slices
+// Compensated accumulation in a fixed set of lanes: about as accurate as
+// summing in twice the precision, and bit-identical whichever SIMD variant
+// runs. f32 accumulates in f64 and rounds once. See vector_reduce.c.
+// ============================================================================
+
+double rf_f64_sum(const double* src, size_t count);
+double rf_f64_dot(const double* a, const double* b, size_t count);
+double rf_f64_min(const double* src, size_t count);   // +inf when empty, NaN if any is NaN
+double rf_f64_max(const double* src, size_t count);   // -inf when empty, NaN if any is NaN
+double rf_f64_mean(const double* src, size_t count);  // NaN when empty
+double rf_f64_variance(const double* src, size_t count, size_t ddof);  // NaN if count <= ddof
+double rf_f64_norm(const double* src, size_t count);  // Euclidean, no intermediate overflow
+
+float rf_f32_sum(const float* src, size_t count);
+float rf_f32_dot(const float* a, const float* b, size_t count);
+float rf_f32_min(const float* src, size_t count);
+float rf_f32_max(const float* src, size_t count);
+float rf_f32_mean(const float* src, size_t count);
+float rf_f32_variance(const float* src, size_t count, size_t ddof);
+float rf_f32_norm(const float* src, size_t count);
+
 // ============================================================================
 // MAPM - Mike's Arbitrary Precision Math Library
 // https://github.com/LuaDist/mapm (Freeware)
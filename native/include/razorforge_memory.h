@@ -0,0 +1,116 @@
+#ifndef RAZORFORGE_MEMORY_H
+#define RAZORFORGE_MEMORY_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Bulk memory operations (memory.c)
+//
+// Addresses are integers, as RazorForge's DynamicSlice passes them; a zero
+// address or length is a no-op. Sizes fall in three tiers:
+//
+//   small constant   never reach these functions: the code generator
+//                    inlines them as llvm.memmove/memset, which become a
+//                    few loads and stores
+//   below the        memmove/memset. A hand-written small-size path here
+//   threshold        measured slower than libc's, the call being the cost
+//   at the threshold non-temporal (streaming) stores that bypass the
+//   and above        caches, so a copy larger than the last-level cache
+//                    does not evict the rest of the working set
+//
+// The threshold defaults to the last-level cache size (rf_cpu_cache_size).
+// Streaming needs SSE2, so RF_CPU_LEVEL=baseline turns it off, and a copy
+// whose source and destination overlap always goes through memmove.
+// ============================================================================
+
+void memory_copy(uintptr_t src_address, uintptr_t dst_address, uintptr_t bytes);
+void memory_fill(uintptr_t address, uintptr_t pattern_byte, uintptr_t bytes);
+void memory_zero(uintptr_t address, uintptr_t bytes);
+
+// Size at which copies and fills switch to streaming stores; SIZE_MAX when
+// this CPU has no streaming path
+size_t rf_memory_stream_threshold(void);
+
+// Sets the threshold and returns the previous one. 0 restores the default;
+// SIZE_MAX turns streaming off. Meant for tuning and benchmarks.
+size_t rf_memory_set_stream_threshold(size_t bytes);
+
+// Declared for danger! code by stdlib/memory/CSubsystem.rf; note the
+// destination comes first here, unlike memory_copy
+void copy_memory(uintptr_t dest_address, uintptr_t src_address, uintptr_t bytes);
+void zero_memory(uintptr_t address, uintptr_t bytes);
+
+// ============================================================================
+// Volatile access for memory-mapped I/O (memory.c)
+//
+// Device registers often accept only one access width, so every access here
+// is a single load or store of the stated width at an address aligned to it.
+// The code generator emits volatile_read_as<T>/volatile_write_as<T> inline as
+// one access of T's size; these are for native callers and bulk transfers.
+// ============================================================================
+
+uint8_t volatile_read_u8(uintptr_t address);
+uint16_t volatile_read_u16(uintptr_t address);
+uint32_t volatile_read_u32(uintptr_t address);
+uint64_t volatile_read_u64(uintptr_t address);
+void volatile_write_u8(uintptr_t address, uint8_t value);
+void volatile_write_u16(uintptr_t address, uint16_t value);
+void volatile_write_u32(uintptr_t address, uint32_t value);
+void volatile_write_u64(uintptr_t address, uint64_t value);
+
+// count accesses of width (1, 2, 4 or 8) bytes, in address order, between
+// device memory and a buffer of count * width bytes. Returns the bytes
+// moved: 0 for a zero address, an unsupported width or a misaligned address.
+uintptr_t volatile_read_block(uintptr_t address, void* output, uintptr_t count, uintptr_t width);
+uintptr_t volatile_write_block(uintptr_t address, const void* input, uintptr_t count, uintptr_t width);
+
+// As the block forms, but every access goes to the same address (a FIFO or
+// data port register)
+uintptr_t volatile_read_repeat(uintptr_t address, void* output, uintptr_t count, uintptr_t width);
+uintptr_t volatile_write_repeat(uintptr_t address, const void* input, uintptr_t count, uintptr_t width);
+
+// Byte ranges with no width requirement: at each step the widest access the
+// address is aligned for and the remaining length allows, so 64-bit accesses
+// through the aligned middle
+void volatile_read_bytes(uintptr_t address, void* output, uintptr_t bytes);
+void volatile_write_bytes(uintptr_t address, const void* input, uintptr_t bytes);
+
+// ============================================================================
+// Comparison and search (memory_search.c)
+//
+// SSE2/AVX2 kernels dispatched on razorforge_cpu (libc memcmp/memchr where
+// those are faster); results are identical on every CPU. Positions are byte offsets
+// from the start of the searched range, RF_MEMORY_NOT_FOUND if there is no
+// match. Pointers may be NULL only when the length is 0.
+// ============================================================================
+
+#define RF_MEMORY_NOT_FOUND SIZE_MAX
+
+// memcmp order as -1, 0 or 1 (bytes compare unsigned)
+int rf_memory_compare(const void* a, const void* b, size_t length);
+int32_t compare_memory(uintptr_t a_address, uintptr_t b_address, uintptr_t bytes);
+
+// 1 if the ranges hold the same bytes
+int rf_memory_equal(const void* a, const void* b, size_t length);
+
+// Offset of the first differing byte; length if there is none
+size_t rf_memory_mismatch(const void* a, const void* b, size_t length);
+
+// First occurrence of a byte, or of a byte sequence (an empty pattern
+// matches at 0)
+size_t rf_memory_find_byte(const void* data, size_t length, uint8_t value);
+size_t rf_memory_find(const void* data, size_t length, const void* pattern, size_t pattern_length);
+
+// Occurrences of a byte
+size_t rf_memory_count_byte(const void* data, size_t length, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_MEMORY_H
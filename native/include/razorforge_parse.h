@@ -0,0 +1,68 @@
+#ifndef RAZORFORGE_PARSE_H
+#define RAZORFORGE_PARSE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "razorforge_int.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Number parsing from letter buffers (parse.c)
+//
+// Every parser reads exactly `length` letters - no NUL terminator, no
+// leading or trailing whitespace - and returns an RF_PARSE_* status, writing
+// *out only on RF_PARSE_OK (and RF_PARSE_OVERFLOW for floats and decimals).
+// Each type comes in three widths: _letter8 (bytes), _letter16 (UTF-16 code
+// units) and _letter32 (code points). _letters picks one from letter_size
+// (1, 2 or 4) for callers generic over the letter type.
+//
+// Integers: optional sign ('-' only for signed types), decimal digits.
+//
+// Floats: optional sign, digits with an optional '.', optional exponent
+// ('e'/'E', optional sign, digits); at least one mantissa digit. "inf",
+// "infinity" and "nan" are accepted in any case. Results are correctly
+// rounded (Clinger's fast path, then Eisel-Lemire, then exact decimal
+// arithmetic for the rare ties hidden past the 19th digit). Values that
+// round past the largest finite number store +-inf and report
+// RF_PARSE_OVERFLOW; underflow to zero is not an error.
+//
+// Decimals: the float syntax, stored as IEEE 754 BID bits with the exponent
+// of the text ("1.50" keeps two fraction digits). Excess digits round half
+// to even; overflow stores +-inf and reports RF_PARSE_OVERFLOW.
+// ============================================================================
+
+#define RF_DECLARE_PARSERS(N, T)                                                 \
+    int rf_##N##_parse_letter8(const char* text, size_t length, T* out);        \
+    int rf_##N##_parse_letter16(const uint16_t* text, size_t length, T* out);   \
+    int rf_##N##_parse_letter32(const uint32_t* text, size_t length, T* out);   \
+    int rf_##N##_parse_letters(const void* text, size_t length, size_t letter_size, T* out);
+
+RF_DECLARE_PARSERS(i8, int8_t)
+RF_DECLARE_PARSERS(i16, int16_t)
+RF_DECLARE_PARSERS(i32, int32_t)
+RF_DECLARE_PARSERS(i64, int64_t)
+RF_DECLARE_PARSERS(u8, uint8_t)
+RF_DECLARE_PARSERS(u16, uint16_t)
+RF_DECLARE_PARSERS(u32, uint32_t)
+RF_DECLARE_PARSERS(u64, uint64_t)
+RF_DECLARE_PARSERS(f32, float)
+RF_DECLARE_PARSERS(f64, double)
+RF_DECLARE_PARSERS(d32, uint32_t)
+RF_DECLARE_PARSERS(d64, uint64_t)
+
+#ifdef RF_HAS_INT128
+RF_DECLARE_PARSERS(i128, rf_i128)
+RF_DECLARE_PARSERS(u128, rf_u128)
+RF_DECLARE_PARSERS(d128, rf_u128)
+#endif
+
+#undef RF_DECLARE_PARSERS
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_PARSE_H
@@ -0,0 +1,90 @@
+#ifndef RAZORFORGE_RANDOM_H
+#define RAZORFORGE_RANDOM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Pseudo-random number generation (random.c)
+//
+// rf_random is RF_RANDOM_LANES interleaved xoshiro256++ generators: output j
+// comes from lane j % RF_RANDOM_LANES. Bulk fills step all lanes at once in
+// SIMD registers; single draws step one lane. Both walk the same sequence, so
+// filling 100 values equals drawing them one by one, on every CPU the
+// runtime dispatches to.
+//
+// Lanes are seeded independently with splitmix64. rf_random_jump advances
+// every lane by 2^128 steps, which yields a non-overlapping stream for a
+// parallel worker (rf_random_split); rf_random_long_jump (2^192) separates
+// groups of such streams.
+//
+// Not for cryptographic use.
+// ============================================================================
+
+#define RF_RANDOM_LANES 8
+
+typedef struct
+{
+    uint64_t state[4][RF_RANDOM_LANES];  // word-major, so lanes load as vectors
+    uint32_t lane;                       // lane of the next single draw
+} rf_random;
+
+// Lifecycle
+void rf_random_seed(rf_random* rng, uint64_t seed);
+rf_random* rf_random_new(uint64_t seed);
+void rf_random_free(rf_random* rng);
+
+// Streams
+void rf_random_jump(rf_random* rng);
+void rf_random_long_jump(rf_random* rng);
+rf_random* rf_random_split(rf_random* rng);  // copy of rng, then rng jumps ahead
+
+// Generator owned by the calling thread. The first call on a thread takes the
+// next jump-separated stream from a process-wide base, so threads never share
+// or overlap a sequence. rf_random_seed_threads reseeds that base (threads
+// that already drew keep their stream).
+rf_random* rf_random_thread(void);
+void rf_random_seed_threads(uint64_t seed);
+
+// Single draws
+uint64_t rf_random_next_u64(rf_random* rng);
+uint64_t rf_random_next_below(rf_random* rng, uint64_t bound);  // [0, bound), unbiased
+double rf_random_next_f64(rf_random* rng);                      // [0, 1), 52 random bits
+float rf_random_next_f32(rf_random* rng);                       // [0, 1), 23 random bits
+double rf_random_next_normal(rf_random* rng);                   // mean 0, stddev 1
+
+// Bulk fills (SIMD, dispatched on razorforge_cpu)
+void rf_random_fill_u64(rf_random* rng, uint64_t* dest, size_t count);
+void rf_random_fill_below(rf_random* rng, uint64_t* dest, size_t count, uint64_t bound);
+void rf_random_fill_f64(rf_random* rng, double* dest, size_t count);
+void rf_random_fill_f32(rf_random* rng, float* dest, size_t count);
+void rf_random_fill_normal_f64(rf_random* rng, double* dest, size_t count);
+void rf_random_fill_normal_f32(rf_random* rng, float* dest, size_t count);
+
+// ============================================================================
+// PCG32 (XSH-RR): 64-bit state, 32-bit output, 2^63 selectable streams and
+// O(log n) jump-ahead to any position. Smaller and slower than rf_random.
+// ============================================================================
+
+typedef struct
+{
+    uint64_t state;
+    uint64_t increment;  // odd; selects the stream
+} rf_pcg32;
+
+void rf_pcg32_seed(rf_pcg32* rng, uint64_t seed, uint64_t stream);
+uint32_t rf_pcg32_next(rf_pcg32* rng);
+uint32_t rf_pcg32_next_below(rf_pcg32* rng, uint32_t bound);
+double rf_pcg32_next_f64(rf_pcg32* rng);  // [0, 1) from two outputs
+void rf_pcg32_advance(rf_pcg32* rng, uint64_t delta);
+void rf_pcg32_fill_u32(rf_pcg32* rng, uint32_t* dest, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_RANDOM_H
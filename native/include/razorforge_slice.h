@@ -0,0 +1,234 @@
+#ifndef RAZORFORGE_SLICE_H
+#define RAZORFORGE_SLICE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "razorforge_int.h"
+#include "razorforge_half.h"
+#include "razorforge_f128.h"
+#include "razorforge_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Typed slice accessors
+// One template instantiated for i8-i128, u8-u128, f16-f128 and d32-d128.
+// Every type gets, in native, little- (_le) and big-endian (_be) byte order:
+//   rf_load_T / rf_store_T               - value at any address, no alignment
+//   rf_load_T_array / rf_store_T_array   - count values packed back to back
+//   rf_slice_read_T / rf_slice_write_T   - at a byte offset in an rf_slice,
+//                                          crashing if it runs past the end
+//   ..._unchecked                        - the same without the bounds test
+//   rf_slice_read_T_array / ..._write_T_array - bounds-checked bulk forms
+// Accesses go through memcpy, which compiles to one unaligned load or store
+// (plus a bswap for the foreign byte order) instead of a misaligned pointer
+// cast. Bulk loops vectorize. The accessors are static inline so C callers
+// and the runtime's memory_read_T entry points fold them away; slice.c
+// compiles one out-of-line copy of each (RF_SLICE_API) for FFI.
+// ============================================================================
+
+#ifndef RF_SLICE_API
+    #define RF_SLICE_API static inline
+#endif
+
+// Layout of a RazorForge DynamicSlice
+typedef struct rf_slice
+{
+    uintptr_t address;
+    uintptr_t size;
+} rf_slice;
+
+// Reports an access of bytes at offset past a slice of size, then aborts
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((noreturn, cold))
+#endif
+void rf_slice_out_of_bounds(uintptr_t offset, uintptr_t bytes, uintptr_t size);
+
+// Whether bytes at offset lie inside the slice, without overflow
+RF_SLICE_API bool rf_slice_fits(const rf_slice* slice, uintptr_t offset, uintptr_t bytes)
+{
+    return offset <= slice->size && bytes <= slice->size - offset;
+}
+
+RF_SLICE_API void rf_slice_check(const rf_slice* slice, uintptr_t offset, uintptr_t bytes)
+{
+    if (!rf_slice_fits(slice, offset, bytes))
+    {
+        rf_slice_out_of_bounds(offset, bytes, slice->size);
+    }
+}
+
+// count elements of width bytes at offset; count * width may overflow
+RF_SLICE_API void rf_slice_check_array(const rf_slice* slice, uintptr_t offset, uintptr_t count,
+                                       uintptr_t width)
+{
+    if (count > slice->size / width || !rf_slice_fits(slice, offset, count * width))
+    {
+        rf_slice_out_of_bounds(offset, count > UINTPTR_MAX / width ? UINTPTR_MAX : count * width,
+                               slice->size);
+    }
+}
+
+// Byte order conversion on the raw bits
+#define RF_SLICE_KEEP(x) (x)
+#define rf_slice_bswap8(x) (x)
+#define rf_slice_bswap16 __builtin_bswap16
+#define rf_slice_bswap32 __builtin_bswap32
+#define rf_slice_bswap64 __builtin_bswap64
+
+#ifdef RF_HAS_INT128
+RF_SLICE_API rf_u128 rf_slice_bswap128(rf_u128 x)
+{
+    return (rf_u128)__builtin_bswap64((uint64_t)x) << 64 | __builtin_bswap64((uint64_t)(x >> 64));
+}
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define RF_SLICE_LE(BITS) rf_slice_bswap##BITS
+    #define RF_SLICE_BE(BITS) RF_SLICE_KEEP
+#else
+    #define RF_SLICE_LE(BITS) RF_SLICE_KEEP
+    #define RF_SLICE_BE(BITS) rf_slice_bswap##BITS
+#endif
+
+// The accessors of type T in one byte order: ORDER is the name suffix,
+// UT an unsigned integer as wide as T, SWAP converts UT to and from it
+#define RF_DEFINE_SLICE_ORDER(N, T, UT, ORDER, SWAP)                            \
+    RF_SLICE_API T rf_load_##N##ORDER(const void* source)                       \
+    {                                                                           \
+        UT bits;                                                                \
+        memcpy(&bits, source, sizeof(bits));                                    \
+        bits = SWAP(bits);                                                      \
+        T value;                                                                \
+        memcpy(&value, &bits, sizeof(value));                                   \
+        return value;                                                           \
+    }                                                                           \
+    RF_SLICE_API void rf_store_##N##ORDER(void* dest, T value)                  \
+    {                                                                           \
+        UT bits;                                                                \
+        memcpy(&bits, &value, sizeof(bits));                                    \
+        bits = SWAP(bits);                                                      \
+        memcpy(dest, &bits, sizeof(bits));                                      \
+    }                                                                           \
+    RF_SLICE_API void rf_load_##N##_array##ORDER(T* dest, const void* source,   \
+                                                 size_t count)                  \
+    {                                                                           \
+        const uint8_t* bytes = (const uint8_t*)source;                          \
+        for (size_t i = 0; i < count; i++)                                      \
+        {                                                                       \
+            dest[i] = rf_load_##N##ORDER(bytes + i * sizeof(T));                \
+        }                                                                       \
+    }                                                                           \
+    RF_SLICE_API void rf_store_##N##_array##ORDER(void* dest, const T* source,  \
+                                                  size_t count)                 \
+    {                                                                           \
+        uint8_t* bytes = (uint8_t*)dest;                                        \
+        for (size_t i = 0; i < count; i++)                                      \
+        {                                                                       \
+            rf_store_##N##ORDER(bytes + i * sizeof(T), source[i]);              \
+        }                                                                       \
+    }                                                                           \
+    RF_SLICE_API T rf_slice_read_##N##ORDER##_unchecked(const rf_slice* slice,  \
+                                                        uintptr_t offset)       \
+    {                                                                           \
+        return rf_load_##N##ORDER((const void*)(slice->address + offset));      \
+    }                                                                           \
+    RF_SLICE_API void rf_slice_write_##N##ORDER##_unchecked(                    \
+        const rf_slice* slice, uintptr_t offset, T value)                       \
+    {                                                                           \
+        rf_store_##N##ORDER((void*)(slice->address + offset), value);           \
+    }                                                                           \
+    RF_SLICE_API T rf_slice_read_##N##ORDER(const rf_slice* slice,              \
+                                            uintptr_t offset)                   \
+    {                                                                           \
+        rf_slice_check(slice, offset, sizeof(T));                               \
+        return rf_load_##N##ORDER((const void*)(slice->address + offset));      \
+    }                                                                           \
+    RF_SLICE_API void rf_slice_write_##N##ORDER(const rf_slice* slice,          \
+                                                uintptr_t offset, T value)      \
+    {                                                                           \
+        rf_slice_check(slice, offset, sizeof(T));                               \
+        rf_store_##N##ORDER((void*)(slice->address + offset), value);           \
+    }                                                                           \
+    RF_SLICE_API void rf_slice_read_##N##_array##ORDER(                         \
+        const rf_slice* slice, uintptr_t offset, T* dest, size_t count)         \
+    {                                                                           \
+        rf_slice_check_array(slice, offset, count, sizeof(T));                  \
+        rf_load_##N##_array##ORDER(dest, (const void*)(slice->address + offset), \
+                                   count);                                      \
+    }                                                                           \
+    RF_SLICE_API void rf_slice_write_##N##_array##ORDER(                        \
+        const rf_slice* slice, uintptr_t offset, const T* source, size_t count) \
+    {                                                                           \
+        rf_slice_check_array(slice, offset, count, sizeof(T));                  \
+        rf_store_##N##_array##ORDER((void*)(slice->address + offset), source,   \
+                                    count);                                     \
+    }
+
+#define RF_DEFINE_SLICE_ACCESSORS(N, T, UT, BITS)                               \
+    RF_DEFINE_SLICE_ORDER(N, T, UT, , RF_SLICE_KEEP)                            \
+    RF_DEFINE_SLICE_ORDER(N, T, UT, _le, RF_SLICE_LE(BITS))                     \
+    RF_DEFINE_SLICE_ORDER(N, T, UT, _be, RF_SLICE_BE(BITS))
+
+RF_DEFINE_SLICE_ACCESSORS(i8, rf_i8, uint8_t, 8)
+RF_DEFINE_SLICE_ACCESSORS(i16, rf_i16, uint16_t, 16)
+RF_DEFINE_SLICE_ACCESSORS(i32, rf_i32, uint32_t, 32)
+RF_DEFINE_SLICE_ACCESSORS(i64, rf_i64, uint64_t, 64)
+RF_DEFINE_SLICE_ACCESSORS(u8, rf_u8, uint8_t, 8)
+RF_DEFINE_SLICE_ACCESSORS(u16, rf_u16, uint16_t, 16)
+RF_DEFINE_SLICE_ACCESSORS(u32, rf_u32, uint32_t, 32)
+RF_DEFINE_SLICE_ACCESSORS(u64, rf_u64, uint64_t, 64)
+RF_DEFINE_SLICE_ACCESSORS(f16, rf_f16, uint16_t, 16)
+RF_DEFINE_SLICE_ACCESSORS(f32, float, uint32_t, 32)
+RF_DEFINE_SLICE_ACCESSORS(f64, double, uint64_t, 64)
+// Decimals are IEEE 754 BID bit patterns (libdfp), swapped as integers
+RF_DEFINE_SLICE_ACCESSORS(d32, uint32_t, uint32_t, 32)
+RF_DEFINE_SLICE_ACCESSORS(d64, uint64_t, uint64_t, 64)
+
+#ifdef RF_HAS_INT128
+RF_DEFINE_SLICE_ACCESSORS(i128, rf_i128, rf_u128, 128)
+RF_DEFINE_SLICE_ACCESSORS(u128, rf_u128, rf_u128, 128)
+RF_DEFINE_SLICE_ACCESSORS(f128, rf_f128, rf_u128, 128)
+RF_DEFINE_SLICE_ACCESSORS(d128, d128_t, rf_u128, 128)
+#endif
+
+// ============================================================================
+// Code generator entry points (slice.c)
+// DynamicSlice.read<T>/write<T> lower to memory_read_T(slice, offset) and
+// memory_write_T(slice, offset, value), with the language's type names; both
+// are the bounds-checked native-order accessors above.
+// ============================================================================
+
+#define RF_DECLARE_SLICE_ENTRY(NAME, T)                                         \
+    T memory_read_##NAME(const rf_slice* slice, uintptr_t offset);              \
+    void memory_write_##NAME(const rf_slice* slice, uintptr_t offset, T value);
+
+RF_DECLARE_SLICE_ENTRY(s8, rf_i8)
+RF_DECLARE_SLICE_ENTRY(s16, rf_i16)
+RF_DECLARE_SLICE_ENTRY(s32, rf_i32)
+RF_DECLARE_SLICE_ENTRY(s64, rf_i64)
+RF_DECLARE_SLICE_ENTRY(u8, rf_u8)
+RF_DECLARE_SLICE_ENTRY(u16, rf_u16)
+RF_DECLARE_SLICE_ENTRY(u32, rf_u32)
+RF_DECLARE_SLICE_ENTRY(u64, rf_u64)
+RF_DECLARE_SLICE_ENTRY(f16, rf_f16)
+RF_DECLARE_SLICE_ENTRY(f32, float)
+RF_DECLARE_SLICE_ENTRY(f64, double)
+RF_DECLARE_SLICE_ENTRY(d32, uint32_t)
+RF_DECLARE_SLICE_ENTRY(d64, uint64_t)
+
+#ifdef RF_HAS_INT128
+RF_DECLARE_SLICE_ENTRY(s128, rf_i128)
+RF_DECLARE_SLICE_ENTRY(u128, rf_u128)
+RF_DECLARE_SLICE_ENTRY(f128, rf_f128)
+RF_DECLARE_SLICE_ENTRY(d128, d128_t)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_SLICE_H
@@ -0,0 +1,59 @@
+#ifndef RAZORFORGE_WIRE_H
+#define RAZORFORGE_WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ============================================================================
+// Zero-copy record messages (wire.c)
+//
+// Records that follow Serializable get compiler-generated writers and field
+// readers for this layout; the runtime only validates a buffer once, after
+// which every field is a plain load at a constant offset:
+//
+//   header   32 bytes: magic "RFW1", fixed section size (u32), schema id
+//            (u64), total message size (u32), variable slot count (u16),
+//            reserved zeros
+//   fixed    variable slots first (u32 offset from the message start, u32
+//            byte length), then scalar fields by decreasing alignment, each
+//            at its natural alignment
+//   payload  Text bytes and List elements, each starting 16-byte aligned and
+//            followed by a zero byte, so Text reads are C strings in place
+//
+// All integers are little-endian. The schema id is a hash of the record name
+// and its field names and types, so a reader built against a different
+// version of the record rejects the message instead of misreading it.
+// ============================================================================
+
+#define RF_WIRE_MAGIC 0x31574652u  // "RFW1"
+#define RF_WIRE_HEADER_SIZE 32u
+#define RF_WIRE_PAYLOAD_ALIGNMENT 16u
+
+// Status codes
+#define RF_WIRE_OK 0
+#define RF_WIRE_ERROR_FORMAT 1     // not a message, or a slot points outside it
+#define RF_WIRE_ERROR_SCHEMA 2     // a different record, or another version of it
+#define RF_WIRE_ERROR_TRUNCATED 3  // buffer shorter than the message
+#define RF_WIRE_ERROR_ALIGNMENT 4  // buffer not aligned for the record's fields
+
+// Validates the message at data against the reader's layout: schema id,
+// fixed section size, variable slot count and alignment (that of its widest
+// field or element, at most 16). Bytes after the message are allowed, so
+// messages can be packed back to back.
+int rf_wire_check(const void* data, size_t size, uint64_t schema, uint32_t fixed_size, uint32_t slots,
+                  uint32_t alignment);
+
+// Header fields, for routing and framing before a record type is chosen;
+// 0 if size is too small for a header or the magic is wrong
+uint64_t rf_wire_schema(const void* data, size_t size);
+uint32_t rf_wire_size(const void* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RAZORFORGE_WIRE_H
@@ -0,0 +1,355 @@
+/*
+ * RazorForge Runtime - Arena Allocation
+ * Region allocator and a per-thread allocator that can be pointed at one
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "../include/razorforge_arena.h"
+
+// ============================================================================
+// Type Definitions
+// ============================================================================
+
+// All arena allocations are aligned for the widest scalar we hand out (i128/f128)
+#define RF_ARENA_ALIGN 16
+#define RF_ARENA_DEFAULT_BLOCK (64 * 1024)
+#define RF_ALIGN_UP(n) (((n) + (RF_ARENA_ALIGN - 1)) & ~(size_t)(RF_ARENA_ALIGN - 1))
+
+typedef struct rf_arena_block
+{
+    struct rf_arena_block* next;
+    size_t capacity;
+    size_t offset;
+} rf_arena_block;
+
+struct rf_arena
+{
+    rf_arena_block* first;
+    rf_arena_block* current;
+    size_t block_bytes;
+};
+
+// Header placed in front of every rf_thread_alloc block so that free/realloc
+// know whether the memory came from an arena or from the heap
+typedef struct
+{
+    size_t size;
+    rf_arena* owner;
+} rf_alloc_header;
+
+#define RF_BLOCK_HEADER_SIZE RF_ALIGN_UP(sizeof(rf_arena_block))
+#define RF_ALLOC_HEADER_SIZE RF_ALIGN_UP(sizeof(rf_alloc_header))
+
+#ifdef _WIN32
+    #define RF_THREAD_LOCAL __declspec(thread)
+#else
+    #define RF_THREAD_LOCAL __thread
+#endif
+
+static RF_THREAD_LOCAL rf_arena* rf_current_arena = NULL;
+
+// ============================================================================
+// Block Management
+// ============================================================================
+
+static unsigned char* block_data(rf_arena_block* block)
+{
+    return (unsigned char*)block + RF_BLOCK_HEADER_SIZE;
+}
+
+static rf_arena_block* block_new(size_t capacity)
+{
+    rf_arena_block* block = (rf_arena_block*)malloc(RF_BLOCK_HEADER_SIZE + capacity);
+    if (!block)
+    {
+        fprintf(stderr, "RazorForge: Failed to allocate arena block of %zu bytes\n", capacity);
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
+}
+
+// ============================================================================
+// Arena Lifecycle
+// ============================================================================
+
+rf_arena* rf_arena_new(size_t block_bytes)
+{
+    rf_arena* arena = (rf_arena*)malloc(sizeof(rf_arena));
+    if (!arena)
+    {
+        return NULL;
+    }
+
+    arena->block_bytes = block_bytes ? RF_ALIGN_UP(block_bytes) : RF_ARENA_DEFAULT_BLOCK;
+    arena->first = block_new(arena->block_bytes);
+    arena->current = arena->first;
+
+    if (!arena->first)
+    {
+        free(arena);
+        return NULL;
+    }
+
+    return arena;
+}
+
+void rf_arena_free(rf_arena* arena)
+{
+    if (!arena)
+    {
+        return;
+    }
+
+    if (rf_current_arena == arena)
+    {
+        rf_current_arena = NULL;
+    }
+
+    rf_arena_block* block = arena->first;
+    while (block)
+    {
+        rf_arena_block* next = block->next;
+        free(block);
+        block = next;
+    }
+
+    free(arena);
+}
+
+/*
+ * Releases every allocation made from the arena at once.
+ * Blocks are kept and reused by subsequent allocations.
+ */
+void rf_arena_reset(rf_arena* arena)
+{
+    if (!arena)
+    {
+        return;
+    }
+
+    for (rf_arena_block* block = arena->first; block; block = block->next)
+    {
+        block->offset = 0;
+    }
+
+    arena->current = arena->first;
+}
+
+// ============================================================================
+// Arena Allocation
+// ============================================================================
+
+void* rf_arena_alloc(rf_arena* arena, size_t bytes)
+{
+    if (!arena)
+    {
+        return NULL;
+    }
+
+    size_t needed = RF_ALIGN_UP(bytes ? bytes : 1);
+    rf_arena_block* block = arena->current;
+
+    if (block->capacity - block->offset < needed)
+    {
+        rf_arena_block* next = block->next;
+        if (next && next->capacity >= needed)
+        {
+            // Reuse a block retained by a previous reset
+            next->offset = 0;
+            block = next;
+        }
+        else
+        {
+            // Splice a fresh block in after the current one
+            size_t capacity = needed > arena->block_bytes ? needed : arena->block_bytes;
+            rf_arena_block* fresh = block_new(capacity);
+            if (!fresh)
+            {
+                return NULL;
+            }
+
+            fresh->next = block->next;
+            block->next = fresh;
+            block = fresh;
+        }
+    }
+
+    arena->current = block;
+    void* ptr = block_data(block) + block->offset;
+    block->offset += needed;
+    return ptr;
+}
+
+size_t rf_arena_used(const rf_arena* arena)
+{
+    if (!arena)
+    {
+        return 0;
+    }
+
+    size_t used = 0;
+    for (const rf_arena_block* block = arena->first; block; block = block->next)
+    {
+        used += block->offset;
+        if (block == arena->current)
+        {
+            break;
+        }
+    }
+    return used;
+}
+
+// Returns true if ptr..ptr+bytes is the most recent allocation in the current block
+static bool is_arena_top(rf_arena* arena, void* ptr, size_t bytes)
+{
+    rf_arena_block* block = arena->current;
+    unsigned char* end = block_data(block) + block->offset;
+    return (unsigned char*)ptr + RF_ALIGN_UP(bytes) == end;
+}
+
+// ============================================================================
+// Per-Thread Allocator
+// ============================================================================
+
+rf_arena* rf_thread_arena(void)
+{
+    return rf_current_arena;
+}
+
+rf_arena* rf_thread_arena_bind(rf_arena* arena)
+{
+    rf_arena* previous = rf_current_arena;
+    rf_current_arena = arena;
+    return previous;
+}
+
+static rf_alloc_header* header_of(void* ptr)
+{
+    return (rf_alloc_header*)((unsigned char*)ptr - RF_ALLOC_HEADER_SIZE);
+}
+
+static void* owned_alloc(rf_arena* owner, size_t bytes)
+{
+    size_t total = RF_ALLOC_HEADER_SIZE + bytes;
+    rf_alloc_header* header = owner
+        ? (rf_alloc_header*)rf_arena_alloc(owner, total)
+        : (rf_alloc_header*)malloc(total);
+
+    if (!header)
+    {
+        return NULL;
+    }
+
+    header->size = bytes;
+    header->owner = owner;
+    return (unsigned char*)header + RF_ALLOC_HEADER_SIZE;
+}
+
+static void owned_free(void* ptr)
+{
+    rf_alloc_header* header = header_of(ptr);
+    rf_arena* owner = header->owner;
+
+    if (!owner)
+    {
+        free(header);
+        return;
+    }
+
+    // Arena memory is reclaimed by reset; only the top allocation can be rolled back
+    size_t total = RF_ALLOC_HEADER_SIZE + header->size;
+    if (is_arena_top(owner, header, total))
+    {
+        owner->current->offset -= RF_ALIGN_UP(total);
+    }
+}
+
+static void* owned_realloc(rf_arena* owner, void* ptr, size_t bytes)
+{
+    if (!ptr)
+    {
+        return owned_alloc(owner, bytes);
+    }
+
+    if (bytes == 0)
+    {
+        owned_free(ptr);
+        return NULL;
+    }
+
+    rf_alloc_header* header = header_of(ptr);
+
+    if (!header->owner)
+    {
+        rf_alloc_header* grown = (rf_alloc_header*)realloc(header, RF_ALLOC_HEADER_SIZE + bytes);
+        if (!grown)
+        {
+            return NULL;
+        }
+
+        grown->size = bytes;
+        return (unsigned char*)grown + RF_ALLOC_HEADER_SIZE;
+    }
+
+    rf_arena* arena = header->owner;
+    size_t old_total = RF_ALLOC_HEADER_SIZE + header->size;
+    size_t new_total = RF_ALLOC_HEADER_SIZE + bytes;
+
+    // Shrinking, or growing the top allocation within its block, happens in place
+    if (bytes <= header->size)
+    {
+        if (is_arena_top(arena, header, old_total))
+        {
+            arena->current->offset -= RF_ALIGN_UP(old_total) - RF_ALIGN_UP(new_total);
+        }
+        header->size = bytes;
+        return ptr;
+    }
+
+    if (is_arena_top(arena, header, old_total))
+    {
+        rf_arena_block* block = arena->current;
+        size_t extra = RF_ALIGN_UP(new_total) - RF_ALIGN_UP(old_total);
+        if (block->capacity - block->offset >= extra)
+        {
+            block->offset += extra;
+            header->size = bytes;
+            return ptr;
+        }
+    }
+
+    void* moved = owned_alloc(arena, bytes);
+    if (!moved)
+    {
+        return NULL;
+    }
+
+    memcpy(moved, ptr, header->size);
+    return moved;
+}
+
+void* rf_thread_alloc(size_t bytes)
+{
+    return owned_alloc(rf_current_arena, bytes);
+}
+
+void* rf_thread_realloc(void* ptr, size_t bytes)
+{
+    return owned_realloc(rf_current_arena, ptr, bytes);
+}
+
+void rf_thread_free(void* ptr)
+{
+    if (ptr)
+    {
+        owned_free(ptr);
+    }
+}
@@ -6,6 +6,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <errno.h>
 #include "../include/razorforge_math.h"
 
 // ============================================================================
@@ -178,37 +181,43 @@ void rf_bigint_clear(rf_bigint* a) {
     }
 }
 
+// The stub keeps its single 64-bit limb in dp; reuse it instead of leaking
+static void* stub_limb(rf_bigint* a) {
+    if (!a->dp) a->dp = malloc(sizeof(int64_t));
+    return a->dp;
+}
+
 int rf_bigint_copy(rf_bigint* dest, rf_bigint* src) {
     if (!dest || !src) return -1;
     dest->used = src->used;
     dest->alloc = src->alloc;
     dest->sign = src->sign;
-    if (src->dp) {
-        dest->dp = malloc(sizeof(int64_t));
-        if (dest->dp) *(int64_t*)dest->dp = *(int64_t*)src->dp;
+    if (src->dp && stub_limb(dest)) {
+        *(int64_t*)dest->dp = *(int64_t*)src->dp;
     }
     return 0;
 }
 
 int rf_bigint_set_i64(rf_bigint* a, int64_t val) {
-    a->dp = malloc(sizeof(int64_t));
-    if (a->dp) *(int64_t*)a->dp = val;
+    if (stub_limb(a)) *(int64_t*)a->dp = val;
     a->used = 1;
     a->sign = val < 0 ? 1 : 0;
     return 0;
 }
 
 int rf_bigint_set_u64(rf_bigint* a, uint64_t val) {
-    a->dp = malloc(sizeof(uint64_t));
-    if (a->dp) *(uint64_t*)a->dp = val;
+    if (stub_limb(a)) *(uint64_t*)a->dp = val;
     a->used = 1;
     a->sign = 0;
     return 0;
 }
 
+// Values outside int64 are rejected rather than saturated
 int rf_bigint_set_str(rf_bigint* a, const char* str, int radix) {
-    (void)radix;
-    int64_t val = strtoll(str, NULL, radix);
+    char* end = NULL;
+    errno = 0;
+    int64_t val = strtoll(str, &end, radix);
+    if (errno == ERANGE || end == str || *end != '\0') return -1;
     return rf_bigint_set_i64(a, val);
 }
 
@@ -299,11 +308,14 @@ int rf_bigint_xor(rf_bigint* result, rf_bigint* a, rf_bigint* b) {
 }
 
 int rf_bigint_shl(rf_bigint* result, rf_bigint* a, int bits) {
-    return rf_bigint_set_i64(result, rf_bigint_get_i64(a) << bits);
+    if (bits >= 64) return rf_bigint_set_i64(result, 0);
+    return rf_bigint_set_i64(result, (int64_t)((uint64_t)rf_bigint_get_i64(a) << bits));
 }
 
 int rf_bigint_shr(rf_bigint* result, rf_bigint* a, int bits) {
-    return rf_bigint_set_i64(result, rf_bigint_get_i64(a) >> bits);
+    int64_t v = rf_bigint_get_i64(a);
+    if (bits >= 64) return rf_bigint_set_i64(result, v < 0 ? -1 : 0);
+    return rf_bigint_set_i64(result, v >> bits);
 }
 
 int rf_bigint_pow(rf_bigint* result, rf_bigint* base, uint32_t exp) {
@@ -337,7 +349,7 @@ int rf_bigint_lcm(rf_bigint* result, rf_bigint* a, rf_bigint* b) {
     int64_t av = rf_bigint_get_i64(a);
     int64_t bv = rf_bigint_get_i64(b);
     int64_t gv = rf_bigint_get_i64(&gcd_result);
-    rf_bigint_clear(&gcd_result);
+    free(gcd_result.dp);
     return rf_bigint_set_i64(result, (av / gv) * bv);
 }
 
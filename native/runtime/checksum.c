@@ -0,0 +1,379 @@
+/*
+ * RazorForge Runtime - Checksums
+ * CRC32C, Adler-32 and xxHash64: portable implementations, combine, and the
+ * dispatch to the SSE4.2/AVX2 kernels
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_checksum.h"
+#include "checksum_internal.h"
+
+static inline uint64_t load_le64(const uint8_t* p)
+{
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 |
+           (uint64_t)p[7] << 56;
+}
+
+static inline uint32_t load_le32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// ============================================================================
+// CRC32C
+// ============================================================================
+
+// Slicing-by-8: tables[k][n] is the CRC of byte n followed by k zero bytes
+static uint32_t crc_tables[8][256];
+
+static void crc_build_tables(void)
+{
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t crc = n;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 1) ? (crc >> 1) ^ RF_CRC32C_POLY : crc >> 1;
+        }
+        crc_tables[0][n] = crc;
+    }
+    for (uint32_t n = 0; n < 256; n++)
+    {
+        uint32_t crc = crc_tables[0][n];
+        for (int k = 1; k < 8; k++)
+        {
+            crc = crc_tables[0][crc & 0xff] ^ (crc >> 8);
+            crc_tables[k][n] = crc;
+        }
+    }
+}
+
+static uint32_t crc32c_portable(uint32_t crc, const uint8_t* data, size_t length)
+{
+    for (; length >= 8; length -= 8, data += 8)
+    {
+        uint64_t word = load_le64(data) ^ crc;
+        crc = crc_tables[7][word & 0xff] ^ crc_tables[6][(word >> 8) & 0xff] ^
+              crc_tables[5][(word >> 16) & 0xff] ^ crc_tables[4][(word >> 24) & 0xff] ^
+              crc_tables[3][(word >> 32) & 0xff] ^ crc_tables[2][(word >> 40) & 0xff] ^
+              crc_tables[1][(word >> 48) & 0xff] ^ crc_tables[0][word >> 56];
+    }
+    for (; length > 0; length--, data++)
+    {
+        crc = crc_tables[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+uint32_t rf_crc32c_multiply(uint32_t a, uint32_t b)
+{
+    uint32_t product = 0;
+    for (uint32_t mask = 1u << 31; mask != 0; mask >>= 1)
+    {
+        if (a & mask)
+        {
+            product ^= b;
+        }
+        b = (b & 1) ? (b >> 1) ^ RF_CRC32C_POLY : b >> 1;
+    }
+    return product;
+}
+
+uint32_t rf_crc32c_xpow(uint64_t exponent)
+{
+    uint32_t result = 1u << 31;  // x^0
+    uint32_t square = 1u << 30;  // x^1, x^2, x^4, ...
+    for (; exponent != 0; exponent >>= 1)
+    {
+        if (exponent & 1)
+        {
+            result = rf_crc32c_multiply(result, square);
+        }
+        square = rf_crc32c_multiply(square, square);
+    }
+    return result;
+}
+
+// ============================================================================
+// Adler-32
+// ============================================================================
+
+static uint32_t adler32_portable(uint32_t adler, const uint8_t* data, size_t length)
+{
+    uint32_t a = adler & 0xffff;
+    uint32_t b = adler >> 16;
+    while (length > 0)
+    {
+        size_t block = length < RF_ADLER_NMAX ? length : RF_ADLER_NMAX;
+        length -= block;
+        for (; block >= 8; block -= 8, data += 8)
+        {
+            a += data[0]; b += a;
+            a += data[1]; b += a;
+            a += data[2]; b += a;
+            a += data[3]; b += a;
+            a += data[4]; b += a;
+            a += data[5]; b += a;
+            a += data[6]; b += a;
+            a += data[7]; b += a;
+        }
+        for (; block > 0; block--, data++)
+        {
+            a += *data;
+            b += a;
+        }
+        a %= RF_ADLER_MOD;
+        b %= RF_ADLER_MOD;
+    }
+    return (b << 16) | a;
+}
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+typedef uint32_t (*rf_checksum_fn)(uint32_t, const uint8_t*, size_t);
+
+static rf_checksum_fn crc_kernel = NULL;
+static rf_checksum_fn adler_kernel = NULL;
+
+// Idempotent: concurrent first callers build identical tables
+static void bind_checksum_kernels(void)
+{
+    rf_checksum_fn crc = crc32c_portable;
+    rf_checksum_fn adler = adler32_portable;
+    crc_build_tables();
+#ifdef RF_CHECKSUM_HAS_X86
+    if (rf_cpu_has_crc32c())
+    {
+        rf_crc32c_sse42_init();
+        crc = rf_crc32c_sse42;
+    }
+    if (rf_cpu_active_level() >= RF_CPU_AVX2)
+    {
+        adler = rf_adler32_avx2;
+    }
+#endif
+    __atomic_store_n(&adler_kernel, adler, __ATOMIC_RELEASE);
+    __atomic_store_n(&crc_kernel, crc, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_checksum_kernels(void)
+{
+    bind_checksum_kernels();
+}
+
+uint32_t rf_crc32c(uint32_t crc, const void* data, size_t length)
+{
+    rf_checksum_fn kernel = __atomic_load_n(&crc_kernel, __ATOMIC_ACQUIRE);
+    if (kernel == NULL)
+    {
+        bind_checksum_kernels();
+        kernel = __atomic_load_n(&crc_kernel, __ATOMIC_ACQUIRE);
+    }
+    return ~kernel(~crc, (const uint8_t*)data, length);
+}
+
+// crc(A || B) = crc(A) * x^(8|B|) + crc(B); the inversions cancel
+uint32_t rf_crc32c_combine(uint32_t crc_a, uint32_t crc_b, uint64_t length_b)
+{
+    return rf_crc32c_multiply(rf_crc32c_xpow(length_b * 8), crc_a) ^ crc_b;
+}
+
+uint32_t rf_adler32(uint32_t adler, const void* data, size_t length)
+{
+    rf_checksum_fn kernel = __atomic_load_n(&adler_kernel, __ATOMIC_ACQUIRE);
+    if (kernel == NULL)
+    {
+        bind_checksum_kernels();
+        kernel = __atomic_load_n(&adler_kernel, __ATOMIC_ACQUIRE);
+    }
+    return kernel(adler, (const uint8_t*)data, length);
+}
+
+// zlib's adler32_combine: a = a_A + a_B - 1, b = b_A + b_B + |B| * (a_A - 1)
+uint32_t rf_adler32_combine(uint32_t adler_a, uint32_t adler_b, uint64_t length_b)
+{
+    uint32_t remainder = (uint32_t)(length_b % RF_ADLER_MOD);
+    uint32_t a = adler_a & 0xffff;
+    uint32_t b = (uint32_t)(((uint64_t)remainder * a) % RF_ADLER_MOD);
+    uint32_t sum_a = a + (adler_b & 0xffff) + RF_ADLER_MOD - 1;
+    uint32_t sum_b = (adler_a >> 16) + (adler_b >> 16) + RF_ADLER_MOD - remainder + b;
+    sum_a %= RF_ADLER_MOD;
+    sum_b %= RF_ADLER_MOD;
+    return (sum_b << 16) | sum_a;
+}
+
+// ============================================================================
+// xxHash64
+// ============================================================================
+
+#define XXH_PRIME1 UINT64_C(0x9E3779B185EBCA87)
+#define XXH_PRIME2 UINT64_C(0xC2B2AE3D27D4EB4F)
+#define XXH_PRIME3 UINT64_C(0x165667B19E3779F9)
+#define XXH_PRIME4 UINT64_C(0x85EBCA77C2B2AE63)
+#define XXH_PRIME5 UINT64_C(0x27D4EB2F165667C5)
+
+static inline uint64_t xxh_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t xxh_round(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * XXH_PRIME2;
+    return xxh_rotl(accumulator, 31) * XXH_PRIME1;
+}
+
+static inline uint64_t xxh_merge(uint64_t hash, uint64_t accumulator)
+{
+    hash ^= xxh_round(0, accumulator);
+    return hash * XXH_PRIME1 + XXH_PRIME4;
+}
+
+static void xxh_init(uint64_t accumulators[4], uint64_t seed)
+{
+    accumulators[0] = seed + XXH_PRIME1 + XXH_PRIME2;
+    accumulators[1] = seed + XXH_PRIME2;
+    accumulators[2] = seed;
+    accumulators[3] = seed - XXH_PRIME1;
+}
+
+// Consumes whole 32-byte stripes; returns the bytes used
+static size_t xxh_stripes(uint64_t accumulators[4], const uint8_t* data, size_t length)
+{
+    uint64_t v1 = accumulators[0];
+    uint64_t v2 = accumulators[1];
+    uint64_t v3 = accumulators[2];
+    uint64_t v4 = accumulators[3];
+    size_t used = 0;
+    for (; used + 32 <= length; used += 32)
+    {
+        v1 = xxh_round(v1, load_le64(data + used));
+        v2 = xxh_round(v2, load_le64(data + used + 8));
+        v3 = xxh_round(v3, load_le64(data + used + 16));
+        v4 = xxh_round(v4, load_le64(data + used + 24));
+    }
+    accumulators[0] = v1;
+    accumulators[1] = v2;
+    accumulators[2] = v3;
+    accumulators[3] = v4;
+    return used;
+}
+
+static uint64_t xxh_finish(const uint64_t accumulators[4], uint64_t seed, uint64_t total_length,
+                           const uint8_t* tail, size_t tail_length)
+{
+    uint64_t hash;
+    if (total_length >= 32)
+    {
+        hash = xxh_rotl(accumulators[0], 1) + xxh_rotl(accumulators[1], 7) +
+               xxh_rotl(accumulators[2], 12) + xxh_rotl(accumulators[3], 18);
+        for (int i = 0; i < 4; i++)
+        {
+            hash = xxh_merge(hash, accumulators[i]);
+        }
+    }
+    else
+    {
+        hash = seed + XXH_PRIME5;
+    }
+    hash += total_length;
+
+    for (; tail_length >= 8; tail_length -= 8, tail += 8)
+    {
+        hash ^= xxh_round(0, load_le64(tail));
+        hash = xxh_rotl(hash, 27) * XXH_PRIME1 + XXH_PRIME4;
+    }
+    if (tail_length >= 4)
+    {
+        hash ^= (uint64_t)load_le32(tail) * XXH_PRIME1;
+        hash = xxh_rotl(hash, 23) * XXH_PRIME2 + XXH_PRIME3;
+        tail_length -= 4;
+        tail += 4;
+    }
+    for (; tail_length > 0; tail_length--, tail++)
+    {
+        hash ^= *tail * XXH_PRIME5;
+        hash = xxh_rotl(hash, 11) * XXH_PRIME1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= XXH_PRIME2;
+    hash ^= hash >> 29;
+    hash *= XXH_PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+uint64_t rf_xxh64(const void* data, size_t length, uint64_t seed)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint64_t accumulators[4];
+    xxh_init(accumulators, seed);
+    size_t used = xxh_stripes(accumulators, bytes, length);
+    return xxh_finish(accumulators, seed, length, bytes + used, length - used);
+}
+
+void rf_xxh64_reset(rf_xxh64_state* state, uint64_t seed)
+{
+    memset(state, 0, sizeof(*state));
+    state->seed = seed;
+    xxh_init(state->accumulators, seed);
+}
+
+void rf_xxh64_update(rf_xxh64_state* state, const void* data, size_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    state->total_length += length;
+
+    if (state->buffered > 0)
+    {
+        size_t take = 32 - state->buffered;
+        if (take > length)
+        {
+            take = length;
+        }
+        memcpy(state->buffer + state->buffered, bytes, take);
+        state->buffered += (uint32_t)take;
+        bytes += take;
+        length -= take;
+        if (state->buffered < 32)
+        {
+            return;
+        }
+        xxh_stripes(state->accumulators, state->buffer, 32);
+        state->buffered = 0;
+    }
+
+    size_t used = xxh_stripes(state->accumulators, bytes, length);
+    memcpy(state->buffer, bytes + used, length - used);
+    state->buffered = (uint32_t)(length - used);
+}
+
+uint64_t rf_xxh64_digest(const rf_xxh64_state* state)
+{
+    return xxh_finish(state->accumulators, state->seed, state->total_length, state->buffer,
+                      state->buffered);
+}
+
+rf_xxh64_state* rf_xxh64_new(uint64_t seed)
+{
+    rf_xxh64_state* state = (rf_xxh64_state*)malloc(sizeof(rf_xxh64_state));
+    if (state)
+    {
+        rf_xxh64_reset(state, seed);
+    }
+    return state;
+}
+
+void rf_xxh64_free(rf_xxh64_state* state)
+{
+    free(state);
+}
@@ -0,0 +1,68 @@
+/*
+ * RazorForge Runtime - Checksums, AVX2 Adler-32 kernel
+ * 32 bytes per step: vpsadbw sums the bytes for a, vpmaddubsw weights them
+ * 32..1 for b, and the running a is folded into b once per block;
+ * only called at RF_CPU_AVX2 or above
+ */
+
+#include <immintrin.h>
+#include "checksum_internal.h"
+
+#ifndef __AVX2__
+    #error "checksum_avx2.c must be compiled with -mavx2"
+#endif
+
+// Largest multiple of 32 not above RF_ADLER_NMAX
+#define ADLER_BLOCK (RF_ADLER_NMAX & ~31)
+
+static inline uint64_t sum_lanes(__m256i v)
+{
+    __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0x4e));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0xb1));
+    return (uint32_t)_mm_cvtsi128_si32(sum);
+}
+
+uint32_t rf_adler32_avx2(uint32_t adler, const uint8_t* data, size_t length)
+{
+    const __m256i weights = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+                                             19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+                                             5, 4, 3, 2, 1);
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256i zero = _mm256_setzero_si256();
+    uint64_t a = adler & 0xffff;
+    uint64_t b = adler >> 16;
+
+    while (length >= 32)
+    {
+        size_t block = length < ADLER_BLOCK ? length & ~(size_t)31 : ADLER_BLOCK;
+        length -= block;
+
+        // b gains the starting a once per byte, plus per 32-byte chunk j the
+        // sum of all earlier chunks (times 32) and the chunk's weighted bytes
+        b += a * block;
+        __m256i sums = zero;
+        __m256i prefix = zero;
+        __m256i weighted = zero;
+        for (size_t i = 0; i < block; i += 32)
+        {
+            __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+            prefix = _mm256_add_epi32(prefix, sums);
+            sums = _mm256_add_epi32(sums, _mm256_sad_epu8(bytes, zero));
+            weighted = _mm256_add_epi32(
+                weighted, _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, weights), ones));
+        }
+        data += block;
+
+        a = (a + sum_lanes(sums)) % RF_ADLER_MOD;
+        b = (b + 32 * sum_lanes(prefix) + sum_lanes(weighted)) % RF_ADLER_MOD;
+    }
+    _mm256_zeroupper();
+
+    for (; length > 0; length--, data++)
+    {
+        a += *data;
+        b += a;
+    }
+    return (uint32_t)((b % RF_ADLER_MOD) << 16 | (a % RF_ADLER_MOD));
+}
@@ -0,0 +1,33 @@
+/*
+ * RazorForge Runtime - Checksums (internal)
+ * GF(2) arithmetic modulo the CRC32C polynomial, shared by the portable code
+ * (combine) and the SSE4.2 kernel (merging its parallel streams), plus the
+ * ISA kernels themselves. Kernels work on the raw CRC register: the public
+ * entry points apply the pre/post inversion.
+ */
+
+#ifndef RAZORFORGE_CHECKSUM_INTERNAL_H
+#define RAZORFORGE_CHECKSUM_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Reflected: bit 31 is x^0, bit 0 is x^31
+#define RF_CRC32C_POLY 0x82F63B78u
+
+uint32_t rf_crc32c_multiply(uint32_t a, uint32_t b);  // a(x) * b(x) mod P
+uint32_t rf_crc32c_xpow(uint64_t exponent);           // x^exponent mod P
+
+#define RF_ADLER_MOD 65521u
+#define RF_ADLER_NMAX 5552  // most bytes before b can overflow 32 bits
+
+#ifdef RF_CHECKSUM_HAS_X86
+// checksum_sse42.c, compiled with -msse4.2 -mpclmul
+void rf_crc32c_sse42_init(void);
+uint32_t rf_crc32c_sse42(uint32_t crc, const uint8_t* data, size_t length);
+
+// checksum_avx2.c, compiled with -mavx2
+uint32_t rf_adler32_avx2(uint32_t adler, const uint8_t* data, size_t length);
+#endif
+
+#endif // RAZORFORGE_CHECKSUM_INTERNAL_H
@@ -0,0 +1,82 @@
+/*
+ * RazorForge Runtime - Checksums, SSE4.2 CRC32C kernel
+ * The crc32 instruction has 3-cycle latency but issues every cycle, so three
+ * independent streams run over adjacent blocks and are merged with one
+ * carry-less multiply each; only called after rf_cpu_has_crc32c()
+ */
+
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#include <string.h>
+#include "checksum_internal.h"
+
+#if !defined(__SSE4_2__) || !defined(__PCLMUL__)
+    #error "checksum_sse42.c must be compiled with -msse4.2 -mpclmul"
+#endif
+
+// Bytes per stream: long blocks for throughput, short ones so mid-sized
+// buffers still get the parallel streams
+#define LONG_BLOCK 8192
+#define SHORT_BLOCK 256
+
+// x^(8 * bytes - 33) mod P: clmul adds one factor of x and the final crc32
+// another 32, so crc32(0, clmul(crc, k)) shifts crc past that many zero bytes
+static uint32_t long_shift[2];
+static uint32_t short_shift[2];
+
+void rf_crc32c_sse42_init(void)
+{
+    long_shift[0] = rf_crc32c_xpow(8 * 2 * LONG_BLOCK - 33);
+    long_shift[1] = rf_crc32c_xpow(8 * LONG_BLOCK - 33);
+    short_shift[0] = rf_crc32c_xpow(8 * 2 * SHORT_BLOCK - 33);
+    short_shift[1] = rf_crc32c_xpow(8 * SHORT_BLOCK - 33);
+}
+
+static inline uint64_t load64(const uint8_t* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// crc0 * x^(16 * block) + crc1 * x^(8 * block), reduced
+static inline uint64_t merge_streams(uint64_t crc0, uint64_t crc1, const uint32_t shift[2])
+{
+    __m128i product0 = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)crc0),
+                                            _mm_cvtsi32_si128((int)shift[0]), 0x00);
+    __m128i product1 = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)crc1),
+                                            _mm_cvtsi32_si128((int)shift[1]), 0x00);
+    return _mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(_mm_xor_si128(product0, product1)));
+}
+
+#define CRC_THREE_WAY(BLOCK, SHIFT)                                        \
+    while (length >= 3 * (BLOCK))                                          \
+    {                                                                      \
+        uint64_t crc1 = 0;                                                 \
+        uint64_t crc2 = 0;                                                 \
+        for (size_t i = 0; i < (BLOCK); i += 8)                            \
+        {                                                                  \
+            crc0 = _mm_crc32_u64(crc0, load64(data + i));                  \
+            crc1 = _mm_crc32_u64(crc1, load64(data + (BLOCK) + i));        \
+            crc2 = _mm_crc32_u64(crc2, load64(data + 2 * (BLOCK) + i));    \
+        }                                                                  \
+        crc0 = merge_streams(crc0, crc1, SHIFT) ^ crc2;                    \
+        data += 3 * (BLOCK);                                               \
+        length -= 3 * (BLOCK);                                             \
+    }
+
+uint32_t rf_crc32c_sse42(uint32_t crc, const uint8_t* data, size_t length)
+{
+    uint64_t crc0 = crc;
+    CRC_THREE_WAY(LONG_BLOCK, long_shift)
+    CRC_THREE_WAY(SHORT_BLOCK, short_shift)
+    for (; length >= 8; length -= 8, data += 8)
+    {
+        crc0 = _mm_crc32_u64(crc0, load64(data));
+    }
+    for (; length > 0; length--, data++)
+    {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, *data);
+    }
+    return (uint32_t)crc0;
+}
@@ -0,0 +1,1277 @@
+/*
+ * RazorForge Runtime - Compression
+ * LZ4-format block codec, the byte-shuffle filter, and the RFZ1 frame format
+ * with its streaming encoder and decoder
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_checksum.h"
+#include "../include/razorforge_compress.h"
+#include "../include/razorforge_cpu.h"
+#include "compress_internal.h"
+
+// ============================================================================
+// Block Format
+//
+// A block is a run of sequences: a token (literal count in the high nibble,
+// match length - 4 in the low one, 15 meaning more length bytes follow, each
+// adding up to 255), the literals, then a 2-byte little-endian match offset.
+// The last sequence has literals only. The last 5 bytes are always literals
+// and no match starts in the last 12, so the decoder's wide copies only need
+// bounds checks per sequence, not per byte.
+// ============================================================================
+
+#define MIN_MATCH 4
+#define LAST_LITERALS 5
+#define MATCH_START_LIMIT 12
+#define MAX_OFFSET 65535
+#define HASH_LOG 13
+#define HASH_ENTRIES (1u << HASH_LOG)
+#define SKIP_TRIGGER 6  // after 2^6 failed probes, step 2 bytes, and so on
+#define WILD_COPY 16    // slack the wide copies need past the end of a run
+
+static inline uint32_t read32(const uint8_t* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint64_t read64(const uint8_t* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline uint32_t load_le32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t load_le64(const uint8_t* p)
+{
+    return (uint64_t)load_le32(p) | (uint64_t)load_le32(p + 4) << 32;
+}
+
+static inline void store_le32(uint8_t* p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static inline void store_le64(uint8_t* p, uint64_t value)
+{
+    store_le32(p, (uint32_t)value);
+    store_le32(p + 4, (uint32_t)(value >> 32));
+}
+
+static inline uint32_t hash4(uint32_t sequence)
+{
+    return (sequence * 2654435761u) >> (32 - HASH_LOG);
+}
+
+// Index of the first differing byte in memory order, given a non-zero XOR
+static inline size_t first_difference(uint64_t difference)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return (size_t)__builtin_ctzll(difference) >> 3;
+#else
+    return (size_t)__builtin_clzll(difference) >> 3;
+#endif
+}
+
+static inline size_t common_length(const uint8_t* p, const uint8_t* match, const uint8_t* limit)
+{
+    const uint8_t* start = p;
+    while (p + 8 <= limit)
+    {
+        uint64_t difference = read64(p) ^ read64(match);
+        if (difference != 0)
+        {
+            return (size_t)(p - start) + first_difference(difference);
+        }
+        p += 8;
+        match += 8;
+    }
+    while (p < limit && *p == *match)
+    {
+        p++;
+        match++;
+    }
+    return (size_t)(p - start);
+}
+
+// 15 in a token nibble, then bytes of 255 and a final remainder
+static inline uint8_t* write_length(uint8_t* op, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *op++ = 255;
+    }
+    *op++ = (uint8_t)length;
+    return op;
+}
+
+// ============================================================================
+// Compressor
+// ============================================================================
+
+// Compresses base[prefix, prefix + length) into dest. base[0, prefix) is
+// history (a dictionary) that matches may reach into; table holds positions
+// relative to base, zeroed or primed with the history. Returns the size, or
+// 0 if it does not fit in capacity.
+static size_t lz_encode(const uint8_t* base, size_t prefix, size_t length, uint8_t* dest, size_t capacity,
+                        uint32_t* table)
+{
+    const uint8_t* ip = base + prefix;
+    const uint8_t* anchor = ip;
+    const uint8_t* const iend = ip + length;
+    uint8_t* op = dest;
+    uint8_t* const oend = dest + capacity;
+
+    if (length > MATCH_START_LIMIT)
+    {
+        const uint8_t* const last_match_start = iend - MATCH_START_LIMIT;
+        const uint8_t* const match_end_limit = iend - LAST_LITERALS;
+
+        table[hash4(read32(ip))] = (uint32_t)(ip - base);
+        ip++;
+        for (;;)
+        {
+            // Probe one slot per position, stepping further apart the longer
+            // nothing matches
+            const uint8_t* match;
+            const uint8_t* forward = ip;
+            unsigned probes = 1u << SKIP_TRIGGER;
+            do
+            {
+                uint32_t h = hash4(read32(forward));
+                ip = forward;
+                forward += probes++ >> SKIP_TRIGGER;
+                if (__builtin_expect(forward > last_match_start, 0))
+                {
+                    goto last_literals;
+                }
+                match = base + table[h];
+                table[h] = (uint32_t)(ip - base);
+            } while (ip - match > MAX_OFFSET || read32(match) != read32(ip));
+
+            while (ip > anchor && match > base && ip[-1] == match[-1])
+            {
+                ip--;
+                match--;
+            }
+
+            size_t literals = (size_t)(ip - anchor);
+            if ((size_t)(oend - op) < 1 + literals + literals / 255 + 1 + 2)
+            {
+                return 0;
+            }
+            uint8_t* token = op++;
+            if (literals >= 15)
+            {
+                *token = 15 << 4;
+                op = write_length(op, literals - 15);
+            }
+            else
+            {
+                *token = (uint8_t)(literals << 4);
+            }
+            memcpy(op, anchor, literals);
+            op += literals;
+
+            for (;;)
+            {
+                size_t offset = (size_t)(ip - match);
+                op[0] = (uint8_t)offset;
+                op[1] = (uint8_t)(offset >> 8);
+                op += 2;
+
+                size_t extra = common_length(ip + MIN_MATCH, match + MIN_MATCH, match_end_limit);
+                ip += MIN_MATCH + extra;
+                if (extra >= 15)
+                {
+                    if ((size_t)(oend - op) < extra / 255 + 1)
+                    {
+                        return 0;
+                    }
+                    *token |= 15;
+                    op = write_length(op, extra - 15);
+                }
+                else
+                {
+                    *token |= (uint8_t)extra;
+                }
+                anchor = ip;
+                if (ip > last_match_start)
+                {
+                    goto last_literals;
+                }
+
+                table[hash4(read32(ip - 2))] = (uint32_t)(ip - 2 - base);
+
+                // A match right away needs no literals
+                uint32_t h = hash4(read32(ip));
+                match = base + table[h];
+                table[h] = (uint32_t)(ip - base);
+                if (ip - match > MAX_OFFSET || read32(match) != read32(ip))
+                {
+                    break;
+                }
+                if ((size_t)(oend - op) < 1 + 2)
+                {
+                    return 0;
+                }
+                token = op++;
+                *token = 0;
+            }
+            ip++;
+        }
+    }
+
+last_literals:
+    {
+        size_t literals = (size_t)(iend - anchor);
+        if ((size_t)(oend - op) < 1 + literals + (literals >= 15 ? (literals - 15) / 255 + 1 : 0))
+        {
+            return 0;
+        }
+        if (literals >= 15)
+        {
+            *op++ = 15 << 4;
+            op = write_length(op, literals - 15);
+        }
+        else
+        {
+            *op++ = (uint8_t)(literals << 4);
+        }
+        memcpy(op, anchor, literals);
+        op += literals;
+    }
+    return (size_t)(op - dest);
+}
+
+// ============================================================================
+// Decompressor
+// ============================================================================
+
+static inline bool read_length(const uint8_t** ip, const uint8_t* iend, size_t* length)
+{
+    unsigned byte;
+    do
+    {
+        if (*ip >= iend)
+        {
+            return false;
+        }
+        byte = *(*ip)++;
+        *length += byte;
+    } while (byte == 255);
+    return true;
+}
+
+// Repeating pattern copy for offsets below 8 (after LZ4): the first 8 bytes
+// are built so that afterwards the source trails the destination by at
+// least 8 bytes, and whole multiples of the period, so copy8 is safe
+static const int spread_forward[8] = {0, 1, 2, 1, 0, 4, 4, 4};
+static const int spread_back[8] = {0, 0, 0, -1, -4, 1, 2, 3};
+
+// Decodes a block into dest. dest[-prefix, 0) is history (a dictionary) that
+// matches may reach into. Returns the decoded size, or RF_LZ_INVALID.
+static size_t lz_decode(const uint8_t* src, size_t length, uint8_t* dest, size_t capacity, size_t prefix)
+{
+    const uint8_t* ip = src;
+    const uint8_t* const iend = src + length;
+    uint8_t* op = dest;
+    uint8_t* const oend = dest + capacity;
+    const uint8_t* const low = dest - prefix;
+
+    for (;;)
+    {
+        if (ip >= iend)
+        {
+            return RF_LZ_INVALID;
+        }
+        unsigned token = *ip++;
+
+        size_t literals = token >> 4;
+        if (literals == 15 && !read_length(&ip, iend, &literals))
+        {
+            return RF_LZ_INVALID;
+        }
+        if (literals + WILD_COPY <= (size_t)(iend - ip) && literals + WILD_COPY <= (size_t)(oend - op))
+        {
+            uint8_t* end = op + literals;
+            do
+            {
+                memcpy(op, ip, 16);
+                op += 16;
+                ip += 16;
+            } while (op < end);
+            ip -= op - end;
+            op = end;
+        }
+        else
+        {
+            if (literals > (size_t)(iend - ip) || literals > (size_t)(oend - op))
+            {
+                return RF_LZ_INVALID;
+            }
+            memcpy(op, ip, literals);
+            op += literals;
+            ip += literals;
+            if (ip == iend)
+            {
+                return (size_t)(op - dest);
+            }
+        }
+
+        if (iend - ip < 2)
+        {
+            return RF_LZ_INVALID;
+        }
+        size_t offset = (size_t)ip[0] | (size_t)ip[1] << 8;
+        ip += 2;
+        if (offset == 0 || offset > (size_t)(op - low))
+        {
+            return RF_LZ_INVALID;
+        }
+        const uint8_t* match = op - offset;
+
+        size_t match_length = token & 15;
+        if (match_length == 15 && !read_length(&ip, iend, &match_length))
+        {
+            return RF_LZ_INVALID;
+        }
+        match_length += MIN_MATCH;
+        if (match_length > (size_t)(oend - op))
+        {
+            return RF_LZ_INVALID;
+        }
+
+        uint8_t* end = op + match_length;
+        if (match_length + WILD_COPY <= (size_t)(oend - op))
+        {
+            if (offset < 8)
+            {
+                op[0] = match[0];
+                op[1] = match[1];
+                op[2] = match[2];
+                op[3] = match[3];
+                match += spread_forward[offset];
+                memcpy(op + 4, match, 4);
+                match -= spread_back[offset];
+            }
+            else if (offset >= 16)
+            {
+                // Far enough back for 16-byte steps
+                do
+                {
+                    memcpy(op, match, 16);
+                    op += 16;
+                    match += 16;
+                } while (op < end);
+                op = end;
+                continue;
+            }
+            else
+            {
+                memcpy(op, match, 8);
+                match += 8;
+            }
+            op += 8;
+            while (op < end)
+            {
+                memcpy(op, match, 8);
+                op += 8;
+                match += 8;
+            }
+            op = end;
+        }
+        else
+        {
+            while (op < end)
+            {
+                *op++ = *match++;
+            }
+        }
+    }
+}
+
+size_t rf_lz_compress_bound(size_t length)
+{
+    return length + length / 255 + 16;
+}
+
+size_t rf_lz_compress(const void* src, size_t length, void* dest, size_t capacity)
+{
+    if (length > RF_LZ_MAX_INPUT)
+    {
+        return 0;
+    }
+    uint32_t* table = calloc(HASH_ENTRIES, sizeof(uint32_t));
+    if (table == NULL)
+    {
+        return 0;
+    }
+    size_t size = lz_encode(src, 0, length, dest, capacity, table);
+    free(table);
+    return size;
+}
+
+size_t rf_lz_decompress(const void* src, size_t length, void* dest, size_t capacity)
+{
+    return lz_decode(src, length, dest, capacity, 0);
+}
+
+// ============================================================================
+// Byte Shuffle
+// ============================================================================
+
+static rf_shuffle_fn active_shuffle = NULL;
+static rf_shuffle_fn active_unshuffle = NULL;
+
+static size_t shuffle_none(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size)
+{
+    (void)src;
+    (void)dest;
+    (void)count;
+    (void)element_size;
+    return 0;
+}
+
+// Idempotent: concurrent first callers store the same pointers
+static void bind_shuffle_kernels(void)
+{
+    rf_shuffle_fn shuffle = shuffle_none;
+    rf_shuffle_fn unshuffle = shuffle_none;
+#ifdef RF_COMPRESS_HAS_X86
+    if (rf_cpu_has_ssse3())
+    {
+        shuffle = rf_shuffle_ssse3;
+        unshuffle = rf_unshuffle_ssse3;
+    }
+#endif
+    __atomic_store_n(&active_unshuffle, unshuffle, __ATOMIC_RELEASE);
+    __atomic_store_n(&active_shuffle, shuffle, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_shuffle_kernels(void)
+{
+    bind_shuffle_kernels();
+}
+
+static inline rf_shuffle_fn shuffle_kernel(rf_shuffle_fn* slot)
+{
+    rf_shuffle_fn kernel = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(kernel == NULL, 0))
+    {
+        bind_shuffle_kernels();
+        kernel = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+    }
+    return kernel;
+}
+
+void rf_shuffle(const void* src, void* dest, size_t length, size_t element_size)
+{
+    const uint8_t* in = src;
+    uint8_t* out = dest;
+    if (element_size <= 1 || length < element_size)
+    {
+        memcpy(out, in, length);
+        return;
+    }
+    size_t count = length / element_size;
+    size_t done = shuffle_kernel(&active_shuffle)(in, out, count, element_size);
+    for (size_t b = 0; b < element_size; b++)
+    {
+        uint8_t* plane = out + b * count;
+        for (size_t i = done; i < count; i++)
+        {
+            plane[i] = in[i * element_size + b];
+        }
+    }
+    memcpy(out + count * element_size, in + count * element_size, length - count * element_size);
+}
+
+void rf_unshuffle(const void* src, void* dest, size_t length, size_t element_size)
+{
+    const uint8_t* in = src;
+    uint8_t* out = dest;
+    if (element_size <= 1 || length < element_size)
+    {
+        memcpy(out, in, length);
+        return;
+    }
+    size_t count = length / element_size;
+    size_t done = shuffle_kernel(&active_unshuffle)(in, out, count, element_size);
+    for (size_t b = 0; b < element_size; b++)
+    {
+        const uint8_t* plane = in + b * count;
+        for (size_t i = done; i < count; i++)
+        {
+            out[i * element_size + b] = plane[i];
+        }
+    }
+    memcpy(out + count * element_size, in + count * element_size, length - count * element_size);
+}
+
+// ============================================================================
+// Frame Format
+// ============================================================================
+
+#define FRAME_MAGIC 0x315A4652u  // "RFZ1"
+#define FRAME_HEADER 24
+#define FRAME_CHECKSUM 1         // header flag: xxHash64 trailer present
+#define BLOCK_STORED 0x80000000u
+#define DEFAULT_BLOCK_LOG 18
+#define MIN_BLOCK_LOG 12
+#define MAX_BLOCK_LOG 24
+#define HISTORY 65536            // dictionary bytes a block can reach
+
+typedef struct
+{
+    unsigned block_log;
+    size_t element_size;  // 1 for no filter
+    bool checksum;
+    uint64_t content_size;
+    uint32_t dictionary_id;
+} frame_header;
+
+static uint32_t dictionary_id(const void* dictionary, size_t length)
+{
+    if (dictionary == NULL || length == 0)
+    {
+        return 0;
+    }
+    uint32_t id = (uint32_t)rf_xxh64(dictionary, length, 0);
+    return id != 0 ? id : 1;
+}
+
+static void write_header(uint8_t out[FRAME_HEADER], const frame_header* header)
+{
+    store_le32(out, FRAME_MAGIC);
+    out[4] = (uint8_t)header->block_log;
+    out[5] = (uint8_t)header->element_size;
+    out[6] = header->checksum ? FRAME_CHECKSUM : 0;
+    out[7] = 0;
+    store_le64(out + 8, header->content_size);
+    store_le32(out + 16, header->dictionary_id);
+    store_le32(out + 20, rf_crc32c(0, out, 20));
+}
+
+static int read_header(const uint8_t in[FRAME_HEADER], frame_header* header)
+{
+    if (load_le32(in) != FRAME_MAGIC || load_le32(in + 20) != rf_crc32c(0, in, 20) || in[4] < MIN_BLOCK_LOG ||
+        in[4] > MAX_BLOCK_LOG || (in[6] & ~FRAME_CHECKSUM) != 0 || in[7] != 0)
+    {
+        return RF_LZ_ERROR_FORMAT;
+    }
+    header->block_log = in[4];
+    header->element_size = in[5] > 1 ? in[5] : 1;
+    header->checksum = (in[6] & FRAME_CHECKSUM) != 0;
+    header->content_size = load_le64(in + 8);
+    header->dictionary_id = load_le32(in + 16);
+    return RF_LZ_OK;
+}
+
+// ============================================================================
+// Output Sink
+// ============================================================================
+
+typedef struct
+{
+    rf_lz_write_fn write;  // NULL: collect into buffer
+    void* context;
+    uint8_t* buffer;       // unread output is buffer[start, length)
+    size_t start;
+    size_t length;
+    size_t capacity;
+} sink;
+
+static int sink_put(sink* out, const void* data, size_t length)
+{
+    if (out->write != NULL)
+    {
+        return out->write(out->context, data, length) == 0 ? RF_LZ_OK : RF_LZ_ERROR_IO;
+    }
+    if (length > out->capacity - out->length && out->start > 0)
+    {
+        memmove(out->buffer, out->buffer + out->start, out->length - out->start);
+        out->length -= out->start;
+        out->start = 0;
+    }
+    if (length > out->capacity - out->length)
+    {
+        size_t capacity = out->capacity ? out->capacity : 4096;
+        while (capacity - out->length < length)
+        {
+            capacity *= 2;
+        }
+        uint8_t* buffer = realloc(out->buffer, capacity);
+        if (buffer == NULL)
+        {
+            return RF_LZ_ERROR_CAPACITY;
+        }
+        out->buffer = buffer;
+        out->capacity = capacity;
+    }
+    memcpy(out->buffer + out->length, data, length);
+    out->length += length;
+    return RF_LZ_OK;
+}
+
+static size_t sink_available(const sink* out)
+{
+    return out->length - out->start;
+}
+
+static size_t sink_read(sink* out, void* dest, size_t capacity)
+{
+    size_t n = sink_available(out) < capacity ? sink_available(out) : capacity;
+    if (n > 0)
+    {
+        memcpy(dest, out->buffer + out->start, n);
+        out->start += n;
+    }
+    if (out->start == out->length)
+    {
+        out->start = out->length = 0;
+    }
+    return n;
+}
+
+// ============================================================================
+// Encoder
+// ============================================================================
+
+struct rf_lz_encoder
+{
+    sink out;
+    frame_header header;
+    size_t block_size;
+    int status;
+    bool finished;
+    uint64_t consumed;
+    rf_xxh64_state hash;
+
+    // work holds the dictionary tail (history bytes), then the block being
+    // compressed; input collects in pending, which is the block itself
+    // unless the shuffle filter needs a separate source
+    uint8_t* work;
+    size_t history;
+    uint8_t* pending;
+    size_t pending_length;
+    uint8_t* compressed;  // block word, then the compressed block
+    uint32_t* table;
+    uint32_t* dictionary_table;  // table primed with the history, or NULL
+};
+
+static void encode_block(rf_lz_encoder* encoder, const uint8_t* data, size_t length)
+{
+    const uint8_t* base = data;
+    size_t prefix = 0;
+    if (encoder->header.element_size > 1)
+    {
+        rf_shuffle(data, encoder->work + encoder->history, length, encoder->header.element_size);
+        base = encoder->work;
+        prefix = encoder->history;
+    }
+    else if (data == encoder->work + encoder->history)
+    {
+        base = encoder->work;
+        prefix = encoder->history;
+    }
+    if (encoder->dictionary_table != NULL)
+    {
+        memcpy(encoder->table, encoder->dictionary_table, HASH_ENTRIES * sizeof(uint32_t));
+    }
+    else
+    {
+        memset(encoder->table, 0, HASH_ENTRIES * sizeof(uint32_t));
+    }
+
+    // Anything not strictly smaller is stored
+    size_t size = lz_encode(base, prefix, length, encoder->compressed + 4, length - 1, encoder->table);
+    if (size == 0)
+    {
+        uint8_t word[4];
+        store_le32(word, BLOCK_STORED | (uint32_t)length);
+        encoder->status = sink_put(&encoder->out, word, 4);
+        if (encoder->status == RF_LZ_OK)
+        {
+            encoder->status = sink_put(&encoder->out, base + prefix, length);
+        }
+        return;
+    }
+    store_le32(encoder->compressed, (uint32_t)size);
+    encoder->status = sink_put(&encoder->out, encoder->compressed, 4 + size);
+}
+
+static bool valid_options(const rf_lz_options* options)
+{
+    return (options->block_log == 0 || (options->block_log >= MIN_BLOCK_LOG && options->block_log <= MAX_BLOCK_LOG)) &&
+           options->element_size <= 255 && (options->dictionary != NULL || options->dictionary_length == 0);
+}
+
+static const rf_lz_options default_options = {0, 0, 1, RF_LZ_UNKNOWN_SIZE, NULL, 0};
+
+rf_lz_encoder* rf_lz_encoder_new(const rf_lz_options* options, rf_lz_write_fn write, void* context)
+{
+    if (options == NULL)
+    {
+        options = &default_options;
+    }
+    if (!valid_options(options))
+    {
+        return NULL;
+    }
+    rf_lz_encoder* encoder = calloc(1, sizeof(rf_lz_encoder));
+    if (encoder == NULL)
+    {
+        return NULL;
+    }
+    encoder->out.write = write;
+    encoder->out.context = context;
+    encoder->header.block_log = options->block_log ? options->block_log : DEFAULT_BLOCK_LOG;
+    encoder->header.element_size = options->element_size > 1 ? options->element_size : 1;
+    encoder->header.checksum = options->checksum != 0;
+    encoder->header.content_size = options->content_size;
+    encoder->header.dictionary_id = dictionary_id(options->dictionary, options->dictionary_length);
+    encoder->block_size = (size_t)1 << encoder->header.block_log;
+    rf_xxh64_reset(&encoder->hash, 0);
+
+    size_t history = options->dictionary_length < HISTORY ? options->dictionary_length : HISTORY;
+    encoder->history = history;
+    encoder->work = malloc(history + encoder->block_size);
+    encoder->compressed = malloc(4 + encoder->block_size);
+    encoder->table = malloc(HASH_ENTRIES * sizeof(uint32_t));
+    encoder->pending = encoder->header.element_size > 1 ? malloc(encoder->block_size) : encoder->work + history;
+    if (encoder->work == NULL || encoder->compressed == NULL || encoder->table == NULL || encoder->pending == NULL)
+    {
+        rf_lz_encoder_free(encoder);
+        return NULL;
+    }
+
+    if (history > 0)
+    {
+        memcpy(encoder->work, (const uint8_t*)options->dictionary + options->dictionary_length - history, history);
+        encoder->dictionary_table = calloc(HASH_ENTRIES, sizeof(uint32_t));
+        if (encoder->dictionary_table == NULL)
+        {
+            rf_lz_encoder_free(encoder);
+            return NULL;
+        }
+        for (size_t p = 0; p + MIN_MATCH <= history; p++)
+        {
+            encoder->dictionary_table[hash4(read32(encoder->work + p))] = (uint32_t)p;
+        }
+    }
+
+    uint8_t header[FRAME_HEADER];
+    write_header(header, &encoder->header);
+    encoder->status = sink_put(&encoder->out, header, FRAME_HEADER);
+    return encoder;
+}
+
+int rf_lz_encoder_write(rf_lz_encoder* encoder, const void* data, size_t length)
+{
+    if (encoder->status != RF_LZ_OK)
+    {
+        return encoder->status;
+    }
+    if (encoder->finished || length > encoder->header.content_size - encoder->consumed)
+    {
+        return encoder->status = RF_LZ_ERROR_ARGUMENT;
+    }
+    encoder->consumed += length;
+    if (encoder->header.checksum)
+    {
+        rf_xxh64_update(&encoder->hash, data, length);
+    }
+
+    const uint8_t* in = data;
+    while (length > 0 && encoder->status == RF_LZ_OK)
+    {
+        // Whole blocks compress straight from the caller when they need no
+        // filter or history
+        if (encoder->pending_length == 0 && length >= encoder->block_size && encoder->header.element_size == 1 &&
+            encoder->history == 0)
+        {
+            encode_block(encoder, in, encoder->block_size);
+            in += encoder->block_size;
+            length -= encoder->block_size;
+            continue;
+        }
+        size_t take = encoder->block_size - encoder->pending_length;
+        take = take < length ? take : length;
+        memcpy(encoder->pending + encoder->pending_length, in, take);
+        encoder->pending_length += take;
+        in += take;
+        length -= take;
+        if (encoder->pending_length == encoder->block_size)
+        {
+            encode_block(encoder, encoder->pending, encoder->block_size);
+            encoder->pending_length = 0;
+        }
+    }
+    return encoder->status;
+}
+
+int rf_lz_encoder_finish(rf_lz_encoder* encoder)
+{
+    if (encoder->status != RF_LZ_OK || encoder->finished)
+    {
+        return encoder->status;
+    }
+    if (encoder->header.content_size != RF_LZ_UNKNOWN_SIZE && encoder->consumed != encoder->header.content_size)
+    {
+        return encoder->status = RF_LZ_ERROR_ARGUMENT;
+    }
+    if (encoder->pending_length > 0)
+    {
+        encode_block(encoder, encoder->pending, encoder->pending_length);
+        encoder->pending_length = 0;
+    }
+    uint8_t trailer[12] = {0};
+    size_t trailer_length = 4;
+    if (encoder->header.checksum)
+    {
+        store_le64(trailer + 4, rf_xxh64_digest(&encoder->hash));
+        trailer_length = 12;
+    }
+    if (encoder->status == RF_LZ_OK)
+    {
+        encoder->status = sink_put(&encoder->out, trailer, trailer_length);
+    }
+    encoder->finished = true;
+    return encoder->status;
+}
+
+size_t rf_lz_encoder_available(const rf_lz_encoder* encoder)
+{
+    return sink_available(&encoder->out);
+}
+
+size_t rf_lz_encoder_read(rf_lz_encoder* encoder, void* dest, size_t capacity)
+{
+    return sink_read(&encoder->out, dest, capacity);
+}
+
+void rf_lz_encoder_free(rf_lz_encoder* encoder)
+{
+    if (encoder == NULL)
+    {
+        return;
+    }
+    if (encoder->pending != encoder->work + encoder->history)
+    {
+        free(encoder->pending);
+    }
+    free(encoder->work);
+    free(encoder->compressed);
+    free(encoder->table);
+    free(encoder->dictionary_table);
+    free(encoder->out.buffer);
+    free(encoder);
+}
+
+// ============================================================================
+// Decoder
+// ============================================================================
+
+typedef enum
+{
+    EXPECT_HEADER,
+    EXPECT_BLOCK_WORD,
+    EXPECT_BLOCK,
+    EXPECT_CHECKSUM,
+    EXPECT_NOTHING,
+} decoder_state;
+
+struct rf_lz_decoder
+{
+    sink out;
+    decoder_state state;
+    int status;
+    frame_header header;
+    size_t block_size;
+    uint32_t block_word;
+    uint64_t produced;
+    rf_xxh64_state hash;
+
+    // Input that arrived split across calls collects in staging until the
+    // current unit (header, block word, block, checksum) is complete
+    uint8_t* staging;
+    size_t staged;
+    uint8_t small[FRAME_HEADER];
+
+    uint8_t* dictionary;  // tail of the caller's dictionary
+    size_t dictionary_length;
+    uint32_t dictionary_id;
+
+    // Blocks decode after the dictionary tail in work; filtered blocks are
+    // then unshuffled into plain
+    uint8_t* work;
+    size_t history;
+    uint8_t* plain;
+
+    // One-shot decoding writes unfiltered blocks without history straight
+    // here instead of through the sink
+    uint8_t* direct;
+    size_t direct_capacity;
+};
+
+rf_lz_decoder* rf_lz_decoder_new(const void* dictionary, size_t dictionary_length, rf_lz_write_fn write,
+                                 void* context)
+{
+    rf_lz_decoder* decoder = calloc(1, sizeof(rf_lz_decoder));
+    if (decoder == NULL || (dictionary == NULL && dictionary_length > 0))
+    {
+        free(decoder);
+        return NULL;
+    }
+    decoder->out.write = write;
+    decoder->out.context = context;
+    decoder->staging = decoder->small;
+    decoder->dictionary_id = dictionary_id(dictionary, dictionary_length);
+    decoder->dictionary_length = dictionary_length < HISTORY ? dictionary_length : HISTORY;
+    if (decoder->dictionary_length > 0)
+    {
+        decoder->dictionary = malloc(decoder->dictionary_length);
+        if (decoder->dictionary == NULL)
+        {
+            free(decoder);
+            return NULL;
+        }
+        memcpy(decoder->dictionary, (const uint8_t*)dictionary + dictionary_length - decoder->dictionary_length,
+               decoder->dictionary_length);
+    }
+    return decoder;
+}
+
+static int start_frame(rf_lz_decoder* decoder, const uint8_t* header)
+{
+    int status = read_header(header, &decoder->header);
+    if (status != RF_LZ_OK)
+    {
+        return status;
+    }
+    if (decoder->header.dictionary_id != 0 && decoder->header.dictionary_id != decoder->dictionary_id)
+    {
+        return RF_LZ_ERROR_DICTIONARY;
+    }
+    decoder->block_size = (size_t)1 << decoder->header.block_log;
+    decoder->history = decoder->header.dictionary_id != 0 ? decoder->dictionary_length : 0;
+    rf_xxh64_reset(&decoder->hash, 0);
+
+    decoder->staging = malloc(decoder->block_size);
+    decoder->work = malloc(decoder->history + decoder->block_size);
+    if (decoder->header.element_size > 1)
+    {
+        decoder->plain = malloc(decoder->block_size);
+    }
+    if (decoder->staging == NULL || decoder->work == NULL || (decoder->header.element_size > 1 && decoder->plain == NULL))
+    {
+        return RF_LZ_ERROR_CAPACITY;
+    }
+    if (decoder->history > 0)
+    {
+        memcpy(decoder->work, decoder->dictionary, decoder->history);
+    }
+    return RF_LZ_OK;
+}
+
+static int finish_block(rf_lz_decoder* decoder, const uint8_t* data, size_t length, bool in_place)
+{
+    if (length > decoder->header.content_size - decoder->produced)
+    {
+        return RF_LZ_ERROR_FORMAT;
+    }
+    decoder->produced += length;
+    if (decoder->header.checksum)
+    {
+        rf_xxh64_update(&decoder->hash, data, length);
+    }
+    return in_place ? RF_LZ_OK : sink_put(&decoder->out, data, length);
+}
+
+static int decode_block(rf_lz_decoder* decoder, const uint8_t* block, size_t size, bool stored)
+{
+    bool filtered = decoder->header.element_size > 1;
+
+    // Straight into the one-shot destination when nothing sits in between
+    uint8_t* target = decoder->work + decoder->history;
+    size_t capacity = decoder->block_size;
+    bool in_place = decoder->direct != NULL && !filtered && decoder->history == 0;
+    if (in_place)
+    {
+        target = decoder->direct + decoder->produced;
+        capacity = decoder->direct_capacity - decoder->produced;
+        capacity = capacity < decoder->block_size ? capacity : decoder->block_size;
+    }
+
+    size_t length = size;
+    const uint8_t* decoded = block;
+    if (stored)
+    {
+        if (in_place)
+        {
+            if (size > capacity)
+            {
+                return RF_LZ_ERROR_CAPACITY;
+            }
+            memcpy(target, block, size);
+            decoded = target;
+        }
+    }
+    else
+    {
+        length = lz_decode(block, size, target, capacity, decoder->history);
+        if (length == RF_LZ_INVALID)
+        {
+            // A valid block that only overflowed the caller's buffer
+            if (capacity < decoder->block_size &&
+                lz_decode(block, size, decoder->work, decoder->block_size, 0) != RF_LZ_INVALID)
+            {
+                return RF_LZ_ERROR_CAPACITY;
+            }
+            return RF_LZ_ERROR_FORMAT;
+        }
+        decoded = target;
+    }
+
+    if (filtered)
+    {
+        rf_unshuffle(decoded, decoder->plain, length, decoder->header.element_size);
+        decoded = decoder->plain;
+    }
+    return finish_block(decoder, decoded, length, in_place);
+}
+
+int rf_lz_decoder_write(rf_lz_decoder* decoder, const void* data, size_t length)
+{
+    const uint8_t* in = data;
+    while (decoder->status == RF_LZ_OK && length > 0)
+    {
+        size_t need;
+        switch (decoder->state)
+        {
+        case EXPECT_HEADER:
+            need = FRAME_HEADER;
+            break;
+        case EXPECT_BLOCK_WORD:
+            need = 4;
+            break;
+        case EXPECT_BLOCK:
+            need = decoder->block_word & ~BLOCK_STORED;
+            break;
+        case EXPECT_CHECKSUM:
+            need = 8;
+            break;
+        default:
+            return decoder->status = RF_LZ_ERROR_FORMAT;  // bytes after the frame
+        }
+
+        // Whole units are used in place; split ones are staged
+        const uint8_t* unit;
+        if (decoder->staged == 0 && length >= need)
+        {
+            unit = in;
+            in += need;
+            length -= need;
+        }
+        else
+        {
+            size_t take = need - decoder->staged < length ? need - decoder->staged : length;
+            memcpy(decoder->staging + decoder->staged, in, take);
+            decoder->staged += take;
+            in += take;
+            length -= take;
+            if (decoder->staged < need)
+            {
+                break;
+            }
+            unit = decoder->staging;
+            decoder->staged = 0;
+        }
+
+        switch (decoder->state)
+        {
+        case EXPECT_HEADER:
+            decoder->status = start_frame(decoder, unit);
+            decoder->state = EXPECT_BLOCK_WORD;
+            break;
+        case EXPECT_BLOCK_WORD:
+        {
+            uint32_t word = load_le32(unit);
+            uint32_t size = word & ~BLOCK_STORED;
+            if (word == 0)
+            {
+                if (decoder->header.content_size != RF_LZ_UNKNOWN_SIZE &&
+                    decoder->produced != decoder->header.content_size)
+                {
+                    decoder->status = RF_LZ_ERROR_FORMAT;
+                }
+                decoder->state = decoder->header.checksum ? EXPECT_CHECKSUM : EXPECT_NOTHING;
+            }
+            else if (size == 0 || size > decoder->block_size)
+            {
+                decoder->status = RF_LZ_ERROR_FORMAT;
+            }
+            else
+            {
+                decoder->block_word = word;
+                decoder->state = EXPECT_BLOCK;
+            }
+            break;
+        }
+        case EXPECT_BLOCK:
+            decoder->status = decode_block(decoder, unit, need, (decoder->block_word & BLOCK_STORED) != 0);
+            decoder->state = EXPECT_BLOCK_WORD;
+            break;
+        case EXPECT_CHECKSUM:
+            if (load_le64(unit) != rf_xxh64_digest(&decoder->hash))
+            {
+                decoder->status = RF_LZ_ERROR_CHECKSUM;
+            }
+            decoder->state = EXPECT_NOTHING;
+            break;
+        default:
+            break;
+        }
+    }
+    return decoder->status;
+}
+
+int rf_lz_decoder_finish(rf_lz_decoder* decoder)
+{
+    if (decoder->status == RF_LZ_OK && decoder->state != EXPECT_NOTHING)
+    {
+        decoder->status = RF_LZ_ERROR_TRUNCATED;
+    }
+    return decoder->status;
+}
+
+size_t rf_lz_decoder_available(const rf_lz_decoder* decoder)
+{
+    return sink_available(&decoder->out);
+}
+
+size_t rf_lz_decoder_read(rf_lz_decoder* decoder, void* dest, size_t capacity)
+{
+    return sink_read(&decoder->out, dest, capacity);
+}
+
+void rf_lz_decoder_free(rf_lz_decoder* decoder)
+{
+    if (decoder == NULL)
+    {
+        return;
+    }
+    if (decoder->staging != decoder->small)
+    {
+        free(decoder->staging);
+    }
+    free(decoder->dictionary);
+    free(decoder->work);
+    free(decoder->plain);
+    free(decoder->out.buffer);
+    free(decoder);
+}
+
+// ============================================================================
+// One-shot Frames
+// ============================================================================
+
+typedef struct
+{
+    uint8_t* dest;
+    size_t capacity;
+    size_t used;
+} memory_target;
+
+static int write_memory(void* context, const void* data, size_t length)
+{
+    memory_target* target = context;
+    if (length > target->capacity - target->used)
+    {
+        return 1;
+    }
+    memcpy(target->dest + target->used, data, length);
+    target->used += length;
+    return 0;
+}
+
+size_t rf_lz_frame_bound(size_t length, const rf_lz_options* options)
+{
+    unsigned block_log = options != NULL && options->block_log != 0 ? options->block_log : DEFAULT_BLOCK_LOG;
+    size_t blocks = (length >> block_log) + 1;
+    return FRAME_HEADER + length + 4 * blocks + 4 + 8;
+}
+
+int rf_lz_frame_compress(const void* src, size_t length, void* dest, size_t capacity,
+                         const rf_lz_options* options, size_t* written)
+{
+    rf_lz_options sized = options != NULL ? *options : default_options;
+    sized.content_size = length;
+    memory_target target = {dest, capacity, 0};
+    *written = 0;
+    rf_lz_encoder* encoder = rf_lz_encoder_new(&sized, write_memory, &target);
+    if (encoder == NULL)
+    {
+        return valid_options(&sized) ? RF_LZ_ERROR_CAPACITY : RF_LZ_ERROR_ARGUMENT;
+    }
+    rf_lz_encoder_write(encoder, src, length);
+    int status = rf_lz_encoder_finish(encoder);
+    rf_lz_encoder_free(encoder);
+    if (status == RF_LZ_ERROR_IO)
+    {
+        return RF_LZ_ERROR_CAPACITY;
+    }
+    *written = target.used;
+    return status;
+}
+
+int rf_lz_frame_decompress(const void* src, size_t length, void* dest, size_t capacity,
+                           const void* dictionary, size_t dictionary_length, size_t* written)
+{
+    memory_target target = {dest, capacity, 0};
+    *written = 0;
+    rf_lz_decoder* decoder = rf_lz_decoder_new(dictionary, dictionary_length, write_memory, &target);
+    if (decoder == NULL)
+    {
+        return dictionary == NULL && dictionary_length > 0 ? RF_LZ_ERROR_ARGUMENT : RF_LZ_ERROR_CAPACITY;
+    }
+    decoder->direct = dest;
+    decoder->direct_capacity = capacity;
+    rf_lz_decoder_write(decoder, src, length);
+    int status = rf_lz_decoder_finish(decoder);
+    size_t produced = (size_t)decoder->produced;
+    rf_lz_decoder_free(decoder);
+    if (status == RF_LZ_ERROR_IO)
+    {
+        return RF_LZ_ERROR_CAPACITY;
+    }
+    *written = status == RF_LZ_OK ? produced : 0;
+    return status;
+}
+
+int rf_lz_frame_content_size(const void* src, size_t length, uint64_t* size)
+{
+    frame_header header;
+    if (length < FRAME_HEADER)
+    {
+        return RF_LZ_ERROR_TRUNCATED;
+    }
+    int status = read_header(src, &header);
+    *size = status == RF_LZ_OK ? header.content_size : 0;
+    return status;
+}
@@ -0,0 +1,24 @@
+/*
+ * RazorForge Runtime - Compression (internal)
+ * Byte-shuffle kernels. They handle whole groups of 16 elements and return
+ * how many elements they did (0 for element sizes they do not cover); the
+ * scalar code in compress.c finishes the rest.
+ */
+
+#ifndef RAZORFORGE_COMPRESS_INTERNAL_H
+#define RAZORFORGE_COMPRESS_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// src holds count elements interleaved; dest holds element_size planes of
+// count bytes each (unshuffle reads planes and writes elements)
+typedef size_t (*rf_shuffle_fn)(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size);
+
+#ifdef RF_COMPRESS_HAS_X86
+// compress_ssse3.c, compiled with -mssse3
+size_t rf_shuffle_ssse3(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size);
+size_t rf_unshuffle_ssse3(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size);
+#endif
+
+#endif // RAZORFORGE_COMPRESS_INTERNAL_H
@@ -0,0 +1,176 @@
+/*
+ * RazorForge Runtime - Compression, SSSE3 byte-shuffle kernels
+ * 16 elements at a time: pshufb groups equal byte positions inside each
+ * vector, then a transpose of 32-bit (4-byte elements) or 16-bit (8-byte
+ * elements) words across the vectors lines up whole planes. Both transposes
+ * are their own inverse, so unshuffling runs the steps in reverse with the
+ * inverse byte mask. Only selected after rf_cpu_has_ssse3().
+ */
+
+#include <tmmintrin.h>
+#include "compress_internal.h"
+
+#ifndef __SSSE3__
+    #error "compress_ssse3.c must be compiled with -mssse3"
+#endif
+
+static inline __m128i load(const uint8_t* p)
+{
+    return _mm_loadu_si128((const __m128i*)p);
+}
+
+static inline void store(uint8_t* p, __m128i v)
+{
+    _mm_storeu_si128((__m128i*)p, v);
+}
+
+// Even bytes, then odd bytes; also the inverse of interleave_bytes_2
+static inline __m128i split_bytes_2(void)
+{
+    return _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+}
+
+// Byte b of each 4-byte element, for b = 0..3; its own inverse
+static inline __m128i split_bytes_4(void)
+{
+    return _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+}
+
+// Byte b of both 8-byte elements side by side, for b = 0..7
+static inline __m128i interleave_bytes_2(void)
+{
+    return _mm_setr_epi8(0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15);
+}
+
+static inline void transpose_4x32(__m128i v[4])
+{
+    __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]);
+    __m128i t1 = _mm_unpacklo_epi32(v[2], v[3]);
+    __m128i t2 = _mm_unpackhi_epi32(v[0], v[1]);
+    __m128i t3 = _mm_unpackhi_epi32(v[2], v[3]);
+    v[0] = _mm_unpacklo_epi64(t0, t1);
+    v[1] = _mm_unpackhi_epi64(t0, t1);
+    v[2] = _mm_unpacklo_epi64(t2, t3);
+    v[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+static inline void transpose_8x16(__m128i v[8])
+{
+    __m128i a[8];
+    __m128i b[8];
+    for (int i = 0; i < 4; i++)
+    {
+        a[i] = _mm_unpacklo_epi16(v[2 * i], v[2 * i + 1]);
+        a[i + 4] = _mm_unpackhi_epi16(v[2 * i], v[2 * i + 1]);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        b[4 * i] = _mm_unpacklo_epi32(a[4 * i], a[4 * i + 1]);
+        b[4 * i + 1] = _mm_unpacklo_epi32(a[4 * i + 2], a[4 * i + 3]);
+        b[4 * i + 2] = _mm_unpackhi_epi32(a[4 * i], a[4 * i + 1]);
+        b[4 * i + 3] = _mm_unpackhi_epi32(a[4 * i + 2], a[4 * i + 3]);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        v[2 * i] = _mm_unpacklo_epi64(b[2 * i], b[2 * i + 1]);
+        v[2 * i + 1] = _mm_unpackhi_epi64(b[2 * i], b[2 * i + 1]);
+    }
+}
+
+size_t rf_shuffle_ssse3(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size)
+{
+    size_t done = count & ~(size_t)15;
+    switch (element_size)
+    {
+    case 2:
+        for (size_t i = 0; i < done; i += 16, src += 32)
+        {
+            __m128i v0 = _mm_shuffle_epi8(load(src), split_bytes_2());
+            __m128i v1 = _mm_shuffle_epi8(load(src + 16), split_bytes_2());
+            store(dest + i, _mm_unpacklo_epi64(v0, v1));
+            store(dest + count + i, _mm_unpackhi_epi64(v0, v1));
+        }
+        return done;
+    case 4:
+        for (size_t i = 0; i < done; i += 16, src += 64)
+        {
+            __m128i v[4];
+            for (int k = 0; k < 4; k++)
+            {
+                v[k] = _mm_shuffle_epi8(load(src + 16 * k), split_bytes_4());
+            }
+            transpose_4x32(v);
+            for (int k = 0; k < 4; k++)
+            {
+                store(dest + k * count + i, v[k]);
+            }
+        }
+        return done;
+    case 8:
+        for (size_t i = 0; i < done; i += 16, src += 128)
+        {
+            __m128i v[8];
+            for (int k = 0; k < 8; k++)
+            {
+                v[k] = _mm_shuffle_epi8(load(src + 16 * k), interleave_bytes_2());
+            }
+            transpose_8x16(v);
+            for (int k = 0; k < 8; k++)
+            {
+                store(dest + k * count + i, v[k]);
+            }
+        }
+        return done;
+    default:
+        return 0;
+    }
+}
+
+size_t rf_unshuffle_ssse3(const uint8_t* src, uint8_t* dest, size_t count, size_t element_size)
+{
+    size_t done = count & ~(size_t)15;
+    switch (element_size)
+    {
+    case 2:
+        for (size_t i = 0; i < done; i += 16, dest += 32)
+        {
+            __m128i low = load(src + i);
+            __m128i high = load(src + count + i);
+            store(dest, _mm_unpacklo_epi8(low, high));
+            store(dest + 16, _mm_unpackhi_epi8(low, high));
+        }
+        return done;
+    case 4:
+        for (size_t i = 0; i < done; i += 16, dest += 64)
+        {
+            __m128i v[4];
+            for (int k = 0; k < 4; k++)
+            {
+                v[k] = load(src + k * count + i);
+            }
+            transpose_4x32(v);
+            for (int k = 0; k < 4; k++)
+            {
+                store(dest + 16 * k, _mm_shuffle_epi8(v[k], split_bytes_4()));
+            }
+        }
+        return done;
+    case 8:
+        for (size_t i = 0; i < done; i += 16, dest += 128)
+        {
+            __m128i v[8];
+            for (int k = 0; k < 8; k++)
+            {
+                v[k] = load(src + k * count + i);
+            }
+            transpose_8x16(v);
+            for (int k = 0; k < 8; k++)
+            {
+                store(dest + 16 * k, _mm_shuffle_epi8(v[k], split_bytes_2()));
+            }
+        }
+        return done;
+    default:
+        return 0;
+    }
+}
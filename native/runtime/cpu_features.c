@@ -0,0 +1,241 @@
+/*
+ * RazorForge Runtime - CPU Feature Detection
+ * Detects the SIMD level once and applies the RF_CPU_LEVEL override
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../include/razorforge_cpu.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+    #define RF_CPU_X86 1
+#endif
+#ifndef _WIN32
+    #include <unistd.h>
+#endif
+
+#define RF_CPU_DEFAULT_CACHE_SIZE ((size_t)8 << 20)
+
+// Resolved once; -1 until then. Racing initializers compute the same value.
+static int detected_level = -1;
+static int active_level = -1;
+static size_t cache_size = 0;
+
+#ifdef RF_CPU_X86
+static uint64_t read_xcr0(void)
+{
+    uint32_t eax;
+    uint32_t edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t)edx << 32) | eax;
+}
+
+static rf_cpu_level detect_x86(void)
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        return RF_CPU_BASELINE;
+    }
+
+    rf_cpu_level level = (edx & bit_SSE2) ? RF_CPU_SSE2 : RF_CPU_BASELINE;
+
+    // AVX state must be enabled by the OS (XSAVE'd XMM and YMM), not just present
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX))
+    {
+        return level;
+    }
+    uint64_t xcr0 = read_xcr0();
+    if ((xcr0 & 0x06) != 0x06)
+    {
+        return level;
+    }
+
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) || !(ebx & bit_AVX2))
+    {
+        return level;
+    }
+    level = RF_CPU_AVX2;
+
+    // AVX-512 additionally needs opmask, ZMM0-15 upper and ZMM16-31 state
+    if ((ebx & bit_AVX512F) && (ebx & bit_AVX512DQ) && (xcr0 & 0xe0) == 0xe0)
+    {
+        level = RF_CPU_AVX512;
+    }
+    return level;
+}
+
+// Largest data or unified cache that a deterministic cache parameters leaf
+// describes: leaf 4 on Intel, 0x8000001D on AMD (same register layout)
+static size_t largest_cache_x86(unsigned int leaf)
+{
+    size_t largest = 0;
+    for (unsigned int index = 0; index < 16; index++)
+    {
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid_count(leaf, index, &eax, &ebx, &ecx, &edx) || (eax & 0x1F) == 0)
+        {
+            break;
+        }
+        if ((eax & 0x1F) == 2)
+        {
+            continue;  // instruction cache
+        }
+        size_t ways = ((ebx >> 22) & 0x3FF) + 1;
+        size_t partitions = ((ebx >> 12) & 0x3FF) + 1;
+        size_t line = (ebx & 0xFFF) + 1;
+        size_t sets = (size_t)ecx + 1;
+        size_t size = ways * partitions * line * sets;
+        if (size > largest)
+        {
+            largest = size;
+        }
+    }
+    return largest;
+}
+#endif
+
+static int parse_level(const char* text)
+{
+    static const char* const names[] = {"baseline", "sse2", "avx2", "avx512"};
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])); i++)
+    {
+        if (strcmp(text, names[i]) == 0)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+rf_cpu_level rf_cpu_detected_level(void)
+{
+    int level = __atomic_load_n(&detected_level, __ATOMIC_ACQUIRE);
+    if (level < 0)
+    {
+#ifdef RF_CPU_X86
+        level = detect_x86();
+#else
+        level = RF_CPU_BASELINE;
+#endif
+        __atomic_store_n(&detected_level, level, __ATOMIC_RELEASE);
+    }
+    return (rf_cpu_level)level;
+}
+
+rf_cpu_level rf_cpu_active_level(void)
+{
+    int level = __atomic_load_n(&active_level, __ATOMIC_ACQUIRE);
+    if (level >= 0)
+    {
+        return (rf_cpu_level)level;
+    }
+
+    level = rf_cpu_detected_level();
+    const char* forced = getenv("RF_CPU_LEVEL");
+    if (forced && forced[0])
+    {
+        int requested = parse_level(forced);
+        if (requested < 0)
+        {
+            fprintf(stderr, "RazorForge: Ignoring unknown RF_CPU_LEVEL '%s'\n", forced);
+        }
+        else if (requested < level)
+        {
+            level = requested;
+        }
+    }
+    __atomic_store_n(&active_level, level, __ATOMIC_RELEASE);
+    return (rf_cpu_level)level;
+}
+
+int rf_cpu_has_f16c(void)
+{
+    if (rf_cpu_active_level() < RF_CPU_AVX2)
+    {
+        return 0;
+    }
+#ifdef RF_CPU_X86
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_F16C) != 0;
+#else
+    return 0;
+#endif
+}
+
+int rf_cpu_has_crc32c(void)
+{
+    if (rf_cpu_active_level() < RF_CPU_SSE2)
+    {
+        return 0;
+    }
+#ifdef RF_CPU_X86
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSE4_2) && (ecx & bit_PCLMUL);
+#else
+    return 0;
+#endif
+}
+
+int rf_cpu_has_ssse3(void)
+{
+    if (rf_cpu_active_level() < RF_CPU_SSE2)
+    {
+        return 0;
+    }
+#ifdef RF_CPU_X86
+    unsigned int eax, ebx, ecx, edx;
+    return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_SSSE3) != 0;
+#else
+    return 0;
+#endif
+}
+
+size_t rf_cpu_cache_size(void)
+{
+    size_t size = __atomic_load_n(&cache_size, __ATOMIC_ACQUIRE);
+    if (size != 0)
+    {
+        return size;
+    }
+
+#ifdef RF_CPU_X86
+    size = largest_cache_x86(4);
+    if (size == 0)
+    {
+        size = largest_cache_x86(0x8000001D);
+    }
+#endif
+#ifdef _SC_LEVEL3_CACHE_SIZE
+    if (size == 0)
+    {
+        long reported = sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (reported <= 0)
+        {
+            reported = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        }
+        size = reported > 0 ? (size_t)reported : 0;
+    }
+#endif
+    if (size == 0)
+    {
+        size = RF_CPU_DEFAULT_CACHE_SIZE;
+    }
+    __atomic_store_n(&cache_size, size, __ATOMIC_RELEASE);
+    return size;
+}
+
+const char* rf_cpu_level_name(rf_cpu_level level)
+{
+    switch (level)
+    {
+        case RF_CPU_BASELINE: return "baseline";
+        case RF_CPU_SSE2: return "sse2";
+        case RF_CPU_AVX2: return "avx2";
+        case RF_CPU_AVX512: return "avx512";
+    }
+    return "unknown";
+}
@@ -0,0 +1,563 @@
+/*
+ * RazorForge Runtime - CSV
+ * Scanner dispatch and the scalar classifier, the refillable buffer, and
+ * row/field cutting over the scanned separator offsets.
+ *
+ * The separator index is built in batches of SCAN_BATCH bytes, so memory
+ * readers of any size need only a small fixed index. Stream readers only
+ * scan whole 64-byte blocks until the input ends; when a row runs past the
+ * buffered data the row is moved to the front of the buffer (or the buffer
+ * doubled), more is read, and the row is rescanned from its start, which is
+ * always outside quotes.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_csv.h"
+#include "../include/razorforge_parse.h"
+#include "csv_internal.h"
+
+// ============================================================================
+// Scanner: scalar classification and dispatch
+// ============================================================================
+
+// SWAR: exact per-byte equality in each 8-byte word, then the high bits
+// gathered into 8 mask bits by one multiply
+static inline uint64_t swar_equal(uint64_t word, uint8_t c)
+{
+    uint64_t x = word ^ (UINT64_C(0x0101010101010101) * c);
+    uint64_t zero = ~(((x & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x7F7F7F7F7F7F7F7F)) | x);
+    return zero & UINT64_C(0x8080808080808080);
+}
+
+static inline uint64_t swar_gather(uint64_t high_bits)
+{
+    return ((high_bits >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+}
+
+static inline void csv_classify(const uint8_t* block, uint8_t delimiter, uint8_t quote, rf_csv_masks* masks)
+{
+    masks->quote = masks->separator = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        uint64_t word;
+        memcpy(&word, block + 8 * i, 8);
+        masks->quote |= swar_gather(swar_equal(word, quote)) << (8 * i);
+        masks->separator |= swar_gather(swar_equal(word, delimiter) | swar_equal(word, '\n')) << (8 * i);
+    }
+}
+
+#define RF_CSV_SCAN rf_csv_scan_scalar
+#include "csv_scan.h"
+
+static rf_csv_scan_fn active_scan = NULL;
+
+static void bind_csv_kernels(void)
+{
+    rf_csv_scan_fn scan = rf_csv_scan_scalar;
+#ifdef RF_CSV_HAS_X86
+    if (rf_cpu_active_level() >= RF_CPU_AVX2)
+    {
+        scan = rf_csv_scan_avx2;
+    }
+    else if (rf_cpu_active_level() >= RF_CPU_SSE2)
+    {
+        scan = rf_csv_scan_sse2;
+    }
+#endif
+    __atomic_store_n(&active_scan, scan, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_csv_kernels(void)
+{
+    bind_csv_kernels();
+}
+
+static inline rf_csv_scan_fn csv_scan(void)
+{
+    rf_csv_scan_fn scan = __atomic_load_n(&active_scan, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(scan == NULL, 0))
+    {
+        bind_csv_kernels();
+        scan = __atomic_load_n(&active_scan, __ATOMIC_ACQUIRE);
+    }
+    return scan;
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+#define SCAN_BATCH 4096  // bytes per scanner call; a multiple of 64
+#define DEFAULT_BUFFER (1024 * 1024)
+
+struct rf_csv_reader
+{
+    rf_csv_read_fn read;  // NULL for memory readers
+    void* context;
+    FILE* file;  // owned by file readers
+
+    const uint8_t* data;
+    uint8_t* buffer;  // == data for stream readers, NULL for memory readers
+    size_t capacity;
+    size_t begin;  // first byte of the next row
+    size_t end;    // bytes available in data
+    bool eof;
+    uint8_t delimiter;
+    uint8_t quote;
+
+    // Separators of the current batch, as offsets from seps_base
+    uint32_t seps[SCAN_BATCH + 4];
+    size_t sep_count;
+    size_t sep_next;
+    size_t seps_base;
+    size_t scanned;  // data[0..scanned) has been scanned
+    rf_csv_scan_state scan;
+
+    // Current row: its fields, and unescaped copies of those with doubled quotes
+    rf_csv_field* fields;
+    size_t fields_capacity;
+    uint8_t* scratch;
+    size_t scratch_capacity;
+    size_t scratch_used;
+
+    size_t rows;
+    int error;
+};
+
+static rf_csv_reader* reader_new(char delimiter, char quote)
+{
+    if (delimiter == quote || delimiter == '\n' || delimiter == '\r' || quote == '\n' || quote == '\r')
+    {
+        return NULL;
+    }
+    rf_csv_reader* reader = calloc(1, sizeof(rf_csv_reader));
+    if (reader == NULL)
+    {
+        return NULL;
+    }
+    reader->delimiter = (uint8_t)delimiter;
+    reader->quote = (uint8_t)quote;
+    return reader;
+}
+
+rf_csv_reader* rf_csv_open_memory(const char* data, size_t length, char delimiter, char quote)
+{
+    rf_csv_reader* reader = reader_new(delimiter, quote);
+    if (reader == NULL)
+    {
+        return NULL;
+    }
+    reader->data = (const uint8_t*)data;
+    reader->end = length;
+    reader->eof = true;  // everything is already here
+    return reader;
+}
+
+rf_csv_reader* rf_csv_open_stream(rf_csv_read_fn read, void* context, char delimiter, char quote,
+                                  size_t buffer_bytes)
+{
+    rf_csv_reader* reader = reader_new(delimiter, quote);
+    if (reader == NULL)
+    {
+        return NULL;
+    }
+    reader->capacity = buffer_bytes >= 64 ? buffer_bytes : DEFAULT_BUFFER;
+    reader->buffer = malloc(reader->capacity);
+    if (reader->buffer == NULL)
+    {
+        free(reader);
+        return NULL;
+    }
+    reader->data = reader->buffer;
+    reader->read = read;
+    reader->context = context;
+    return reader;
+}
+
+static ptrdiff_t read_file(void* context, char* buffer, size_t capacity)
+{
+    FILE* file = context;
+    size_t n = fread(buffer, 1, capacity, file);
+    return n == 0 && ferror(file) ? -1 : (ptrdiff_t)n;
+}
+
+rf_csv_reader* rf_csv_open_file(const char* path, char delimiter, char quote)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    rf_csv_reader* reader = rf_csv_open_stream(read_file, file, delimiter, quote, 0);
+    if (reader == NULL)
+    {
+        fclose(file);
+        return NULL;
+    }
+    reader->file = file;
+    return reader;
+}
+
+void rf_csv_close(rf_csv_reader* reader)
+{
+    if (reader == NULL)
+    {
+        return;
+    }
+    if (reader->file)
+    {
+        fclose(reader->file);
+    }
+    free(reader->buffer);
+    free(reader->fields);
+    free(reader->scratch);
+    free(reader);
+}
+
+size_t rf_csv_row_number(const rf_csv_reader* reader)
+{
+    return reader ? reader->rows : 0;
+}
+
+// ============================================================================
+// Buffer and scanning
+// ============================================================================
+
+// Scans the next batch; false when nothing can be scanned until more input
+// arrives (or the input is exhausted)
+static bool scan_more(rf_csv_reader* reader)
+{
+    size_t available = reader->end - reader->scanned;
+    if (!reader->eof)
+    {
+        available &= ~(size_t)63;  // a partial block may still grow
+    }
+    if (available == 0)
+    {
+        return false;
+    }
+    if (available > SCAN_BATCH)
+    {
+        available = SCAN_BATCH;
+    }
+    reader->seps_base = reader->scanned;
+    reader->sep_count = csv_scan()(reader->data + reader->scanned, available, reader->delimiter, reader->quote,
+                                   &reader->scan, reader->seps);
+    reader->sep_next = 0;
+    reader->scanned += available;
+    return true;
+}
+
+// Moves the unfinished row to the front (or grows the buffer when it already
+// fills it), reads more, and resets scanning to the row start
+static int refill(rf_csv_reader* reader)
+{
+    size_t keep = reader->end - reader->begin;
+    if (reader->begin > 0)
+    {
+        memmove(reader->buffer, reader->buffer + reader->begin, keep);
+        reader->begin = 0;
+        reader->end = keep;
+    }
+    else if (reader->end == reader->capacity)
+    {
+        uint8_t* grown = realloc(reader->buffer, reader->capacity * 2);
+        if (grown == NULL)
+        {
+            return RF_CSV_ERROR_CAPACITY;
+        }
+        reader->buffer = grown;
+        reader->data = grown;
+        reader->capacity *= 2;
+    }
+
+    ptrdiff_t n = reader->read(reader->context, (char*)reader->buffer + reader->end, reader->capacity - reader->end);
+    if (n < 0)
+    {
+        return RF_CSV_ERROR_IO;
+    }
+    reader->eof = n == 0;
+    reader->end += (size_t)n;
+
+    reader->scanned = 0;
+    reader->scan = (rf_csv_scan_state){0};
+    reader->sep_count = reader->sep_next = 0;
+    return RF_CSV_OK;
+}
+
+// ============================================================================
+// Rows and fields
+// ============================================================================
+
+static bool grow_fields(rf_csv_reader* reader)
+{
+    size_t capacity = reader->fields_capacity ? reader->fields_capacity * 2 : 64;
+    rf_csv_field* grown = realloc(reader->fields, capacity * sizeof(rf_csv_field));
+    if (grown == NULL)
+    {
+        return false;
+    }
+    reader->fields = grown;
+    reader->fields_capacity = capacity;
+    return true;
+}
+
+// Room for bytes more in scratch; fields of the row already copied there are
+// moved along with it
+static bool reserve_scratch(rf_csv_reader* reader, size_t n, size_t bytes)
+{
+    if (reader->scratch_capacity - reader->scratch_used >= bytes)
+    {
+        return true;
+    }
+    size_t capacity = 2 * reader->scratch_capacity > reader->scratch_used + bytes
+                          ? 2 * reader->scratch_capacity
+                          : reader->scratch_used + bytes;
+    // Addresses taken before realloc, since the old block can't be looked at after
+    uintptr_t old_begin = (uintptr_t)reader->scratch;
+    uintptr_t old_end = old_begin + reader->scratch_capacity;
+    uint8_t* grown = realloc(reader->scratch, capacity);
+    if (grown == NULL)
+    {
+        return false;
+    }
+    for (size_t k = 0; k < n; k++)
+    {
+        uintptr_t data = (uintptr_t)reader->fields[k].data;
+        if (data >= old_begin && data < old_end)
+        {
+            reader->fields[k].data = (const char*)grown + (data - old_begin);
+        }
+    }
+    reader->scratch = grown;
+    reader->scratch_capacity = capacity;
+    return true;
+}
+
+// A quoted field spanning data[start..stop) (after any '\r' is dropped).
+// Views the text between the quotes unless doubled quotes must be collapsed.
+static int cut_quoted(rf_csv_reader* reader, size_t n, size_t start, size_t stop, rf_csv_field* field)
+{
+    const uint8_t* data = reader->data;
+    if (stop - start < 2 || data[stop - 1] != reader->quote)
+    {
+        return RF_CSV_ERROR_QUOTE;
+    }
+    size_t body = start + 1;
+    size_t body_end = stop - 1;
+    const uint8_t* quote = memchr(data + body, reader->quote, body_end - body);
+    if (quote == NULL)
+    {
+        field->data = (const char*)data + body;
+        field->length = body_end - body;
+        return RF_CSV_OK;
+    }
+
+    if (!reserve_scratch(reader, n, body_end - body))
+    {
+        return RF_CSV_ERROR_CAPACITY;
+    }
+    uint8_t* out = reader->scratch + reader->scratch_used;
+    uint8_t* write = out;
+    size_t i = body;
+    while (quote != NULL)
+    {
+        // Copy through the first quote of the pair and skip the second
+        size_t run = (size_t)(quote - (data + i)) + 1;
+        if (quote + 1 >= data + body_end || quote[1] != reader->quote)
+        {
+            return RF_CSV_ERROR_QUOTE;
+        }
+        memcpy(write, data + i, run);
+        write += run;
+        i += run + 1;
+        quote = memchr(data + i, reader->quote, body_end - i);
+    }
+    memcpy(write, data + i, body_end - i);
+    write += body_end - i;
+    field->data = (const char*)out;
+    field->length = (size_t)(write - out);
+    reader->scratch_used += field->length;
+    return RF_CSV_OK;
+}
+
+// Cuts the next row into reader->fields, consuming separators as they come;
+// *count is its field count. Blank lines are skipped.
+static int cut_row(rf_csv_reader* reader, size_t* count)
+{
+    const uint8_t* data;
+    size_t row_start;
+    size_t start;
+    size_t n;
+restart:
+    data = reader->data;
+    row_start = start = reader->begin;
+    n = 0;
+    reader->scratch_used = 0;
+    for (;;)
+    {
+        size_t stop;
+        bool line_end;
+        if (reader->sep_next < reader->sep_count)
+        {
+            stop = reader->seps_base + reader->seps[reader->sep_next++];
+            line_end = data[stop] == '\n';
+        }
+        else if (scan_more(reader))
+        {
+            continue;
+        }
+        else if (!reader->eof)
+        {
+            int status = refill(reader);
+            if (status != RF_CSV_OK)
+            {
+                return status;
+            }
+            goto restart;
+        }
+        else
+        {
+            // Input exhausted: the last row has no newline
+            if (reader->scan.in_quote)
+            {
+                return RF_CSV_ERROR_QUOTE;
+            }
+            if (n == 0 && start == reader->end)
+            {
+                return RF_CSV_END;
+            }
+            stop = reader->end;
+            line_end = true;
+        }
+
+        if (n == reader->fields_capacity && !grow_fields(reader))
+        {
+            return RF_CSV_ERROR_CAPACITY;
+        }
+        rf_csv_field* field = &reader->fields[n++];
+        size_t field_stop = stop;
+        if (line_end && field_stop > start && data[field_stop - 1] == '\r')
+        {
+            field_stop--;
+        }
+        if (field_stop == start || data[start] != reader->quote)
+        {
+            field->data = (const char*)data + start;
+            field->length = field_stop - start;
+        }
+        else
+        {
+            int status = cut_quoted(reader, n - 1, start, field_stop, field);
+            if (status != RF_CSV_OK)
+            {
+                return status;
+            }
+        }
+
+        if (line_end)
+        {
+            reader->begin = stop < reader->end ? stop + 1 : stop;
+            if (n == 1 && stop - row_start <= 1 && (stop == row_start || data[row_start] == '\r'))
+            {
+                goto restart;
+            }
+            *count = n;
+            return RF_CSV_OK;
+        }
+        start = stop + 1;
+    }
+}
+
+int rf_csv_next(rf_csv_reader* reader, const rf_csv_field** fields, size_t* count)
+{
+    if (reader->error != RF_CSV_OK)
+    {
+        return reader->error;
+    }
+    int status = cut_row(reader, count);
+    if (status != RF_CSV_OK)
+    {
+        if (status != RF_CSV_END)
+        {
+            reader->error = status;
+        }
+        return status;
+    }
+    reader->rows++;
+    *fields = reader->fields;
+    return RF_CSV_OK;
+}
+
+rf_csv_row rf_csv_next_row(rf_csv_reader* reader)
+{
+    rf_csv_row row = {NULL, 0, RF_CSV_OK};
+    row.status = rf_csv_next(reader, &row.fields, &row.count);
+    if (row.status != RF_CSV_OK)
+    {
+        row.fields = NULL;
+        row.count = 0;
+    }
+    return row;
+}
+
+// ============================================================================
+// Typed columns
+// ============================================================================
+
+int rf_csv_read_columns(rf_csv_reader* reader, const rf_csv_column* columns, size_t column_count,
+                        size_t max_rows, size_t* rows)
+{
+    *rows = 0;
+    if (reader->error != RF_CSV_OK)
+    {
+        return reader->error;
+    }
+    while (*rows < max_rows)
+    {
+        size_t n;
+        int status = cut_row(reader, &n);
+        if (status != RF_CSV_OK)
+        {
+            if (status != RF_CSV_END)
+            {
+                reader->error = status;
+            }
+            return status;
+        }
+        for (size_t c = 0; c < column_count; c++)
+        {
+            const rf_csv_column* column = &columns[c];
+            if (column->index >= n)
+            {
+                return reader->error = RF_CSV_ERROR_FIELD;
+            }
+            // Floats that overflow are stored as infinities, like any IEEE result
+            const rf_csv_field* field = &reader->fields[column->index];
+            int parsed = column->type == RF_CSV_I64
+                             ? rf_i64_parse_letter8(field->data, field->length, (int64_t*)column->out + *rows)
+                             : rf_f64_parse_letter8(field->data, field->length, (double*)column->out + *rows);
+            if (parsed != RF_PARSE_OK && (column->type == RF_CSV_I64 || parsed != RF_PARSE_OVERFLOW))
+            {
+                return reader->error = RF_CSV_ERROR_NUMBER;
+            }
+        }
+        reader->rows++;
+        (*rows)++;
+    }
+    return RF_CSV_OK;
+}
+
+rf_csv_column_batch rf_csv_read_column(rf_csv_reader* reader, size_t index, int type, void* out,
+                                       size_t max_rows)
+{
+    rf_csv_column column = {index, type, out};
+    rf_csv_column_batch batch = {0, RF_CSV_OK};
+    batch.status = rf_csv_read_columns(reader, &column, 1, max_rows, &batch.rows);
+    return batch;
+}
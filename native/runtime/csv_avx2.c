@@ -0,0 +1,29 @@
+/*
+ * RazorForge Runtime - CSV block scanner, AVX2 classification
+ * Three 32-byte compares per half block. Only selected at RF_CPU_AVX2.
+ */
+
+#include <immintrin.h>
+#include "csv_internal.h"
+
+#ifndef __AVX2__
+    #error "csv_avx2.c must be compiled with -mavx2"
+#endif
+
+static inline void csv_classify(const uint8_t* block, uint8_t delimiter, uint8_t quote, rf_csv_masks* masks)
+{
+    const __m256i delimiters = _mm256_set1_epi8((char)delimiter);
+    const __m256i quotes = _mm256_set1_epi8((char)quote);
+    const __m256i newlines = _mm256_set1_epi8('\n');
+    masks->quote = masks->separator = 0;
+    for (int half = 0; half < 2; half++)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(block + 32 * half));
+        __m256i separator = _mm256_or_si256(_mm256_cmpeq_epi8(input, delimiters), _mm256_cmpeq_epi8(input, newlines));
+        masks->quote |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(input, quotes)) << (32 * half);
+        masks->separator |= (uint64_t)(uint32_t)_mm256_movemask_epi8(separator) << (32 * half);
+    }
+}
+
+#define RF_CSV_SCAN rf_csv_scan_avx2
+#include "csv_scan.h"
@@ -0,0 +1,45 @@
+/*
+ * RazorForge Runtime - CSV (internal)
+ * The block scanner (csv_scan.h, one copy per SIMD level) finds the
+ * delimiters and newlines outside quotes; csv.c cuts rows and fields from
+ * those offsets.
+ */
+
+#ifndef RAZORFORGE_CSV_INTERNAL_H
+#define RAZORFORGE_CSV_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 64-byte block classification produced by each kernel's csv_classify
+typedef struct
+{
+    uint64_t quote;
+    uint64_t separator;  // delimiter or '\n'
+} rf_csv_masks;
+
+// Scanner state carried across calls; all zero at the start of a row
+typedef struct
+{
+    uint64_t in_quote;   // all ones while a quoted field is open
+    uint64_t mid_field;  // 1 when the last byte scanned was neither a separator nor a quote
+} rf_csv_scan_state;
+
+// Offsets of the unquoted separators in src[0..length) written to out (room
+// for length rounded up to 64, plus 4). A final partial block is padded with
+// '\r', which is never a separator.
+typedef size_t (*rf_csv_scan_fn)(const uint8_t* src, size_t length, uint8_t delimiter, uint8_t quote,
+                                 rf_csv_scan_state* state, uint32_t* out);
+
+size_t rf_csv_scan_scalar(const uint8_t* src, size_t length, uint8_t delimiter, uint8_t quote,
+                          rf_csv_scan_state* state, uint32_t* out);
+
+#ifdef RF_CSV_HAS_X86
+// csv_sse2.c and csv_avx2.c (-mavx2)
+size_t rf_csv_scan_sse2(const uint8_t* src, size_t length, uint8_t delimiter, uint8_t quote,
+                        rf_csv_scan_state* state, uint32_t* out);
+size_t rf_csv_scan_avx2(const uint8_t* src, size_t length, uint8_t delimiter, uint8_t quote,
+                        rf_csv_scan_state* state, uint32_t* out);
+#endif
+
+#endif // RAZORFORGE_CSV_INTERNAL_H
@@ -0,0 +1,96 @@
+/*
+ * RazorForge Runtime - CSV block scanner
+ * Quote parity by prefix XOR, as in the JSON stage 1: a doubled quote
+ * toggles twice and needs no special case. A quote can only open a field
+ * at its start (or reopen it right after a closing quote, for a doubled
+ * quote); one that would open it anywhere else is text, so it is dropped
+ * from the quote mask and the parity redone. Separators inside quotes are
+ * masked off and the rest flattened to offsets.
+ *
+ * Included by csv.c, csv_sse2.c and csv_avx2.c after they define
+ *   static inline void csv_classify(const uint8_t* block, uint8_t delimiter,
+ *                                   uint8_t quote, rf_csv_masks* masks)
+ * with RF_CSV_SCAN naming the function it defines.
+ */
+
+#include <string.h>
+#include "csv_internal.h"
+
+#ifndef RF_CSV_SCAN
+    #error "define RF_CSV_SCAN before including csv_scan.h"
+#endif
+
+static inline uint64_t csv_prefix_xor(uint64_t bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Quotes that would open a quoted field in the middle of one: quote bits
+// left inside quotes whose previous byte is neither a separator nor a quote
+static inline uint64_t csv_stray_quotes(uint64_t quote, uint64_t quoted, uint64_t separator, uint64_t mid_field)
+{
+    uint64_t field_start = ((separator | quote) << 1) | (mid_field ^ 1);
+    return quote & quoted & ~field_start;
+}
+
+// Four offsets per iteration whatever the count, so out needs 3 entries of
+// slack past the real count
+static inline uint32_t* csv_flatten(uint32_t* out, uint64_t bits, uint32_t base)
+{
+    uint32_t* end = out + __builtin_popcountll(bits);
+    while (bits != 0)
+    {
+        out[0] = base + (uint32_t)__builtin_ctzll(bits);
+        bits &= bits - 1;
+        out[1] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out[2] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out[3] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out += 4;
+    }
+    return end;
+}
+
+size_t RF_CSV_SCAN(const uint8_t* src, size_t length, uint8_t delimiter, uint8_t quote, rf_csv_scan_state* state,
+                   uint32_t* out)
+{
+    uint32_t* write = out;
+    uint64_t carry = state->in_quote;
+    uint64_t mid_field = state->mid_field;
+    uint8_t tail[64];
+    for (size_t base = 0; base < length; base += 64)
+    {
+        const uint8_t* block = src + base;
+        if (length - base < 64)
+        {
+            memset(tail, '\r', sizeof(tail));
+            memcpy(tail, block, length - base);
+            block = tail;
+        }
+        rf_csv_masks masks;
+        csv_classify(block, delimiter, quote, &masks);
+        uint64_t quoted = csv_prefix_xor(masks.quote) ^ carry;
+        uint64_t stray = csv_stray_quotes(masks.quote, quoted, masks.separator, mid_field);
+        while (__builtin_expect(stray != 0, 0))
+        {
+            // Only the first is certain: dropping it changes the parity after it
+            masks.quote ^= stray & -stray;
+            quoted = csv_prefix_xor(masks.quote) ^ carry;
+            stray = csv_stray_quotes(masks.quote, quoted, masks.separator, mid_field);
+        }
+        carry = (uint64_t)((int64_t)quoted >> 63);
+        mid_field = ((masks.separator | masks.quote) >> 63) ^ 1;
+        write = csv_flatten(write, masks.separator & ~quoted, (uint32_t)base);
+    }
+    state->in_quote = carry;
+    state->mid_field = mid_field;
+    return (size_t)(write - out);
+}
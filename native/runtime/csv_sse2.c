@@ -0,0 +1,25 @@
+/*
+ * RazorForge Runtime - CSV block scanner, SSE2 classification
+ * Three 16-byte compares per lane. Part of the x86-64 baseline.
+ */
+
+#include <emmintrin.h>
+#include "csv_internal.h"
+
+static inline void csv_classify(const uint8_t* block, uint8_t delimiter, uint8_t quote, rf_csv_masks* masks)
+{
+    const __m128i delimiters = _mm_set1_epi8((char)delimiter);
+    const __m128i quotes = _mm_set1_epi8((char)quote);
+    const __m128i newlines = _mm_set1_epi8('\n');
+    masks->quote = masks->separator = 0;
+    for (int lane = 0; lane < 4; lane++)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(block + 16 * lane));
+        __m128i separator = _mm_or_si128(_mm_cmpeq_epi8(input, delimiters), _mm_cmpeq_epi8(input, newlines));
+        masks->quote |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(input, quotes)) << (16 * lane);
+        masks->separator |= (uint64_t)(uint16_t)_mm_movemask_epi8(separator) << (16 * lane);
+    }
+}
+
+#define RF_CSV_SCAN rf_csv_scan_sse2
+#include "csv_scan.h"
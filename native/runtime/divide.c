@@ -0,0 +1,42 @@
+/*
+ * RazorForge Runtime - Invariant-Divisor Division
+ * Out-of-line instances of the razorforge_divide.h dividers for FFI callers
+ */
+
+// Emit every divider with external linkage instead of static inline
+#define RF_DIVIDE_API
+
+#include "../include/razorforge_divide.h"
+
+// ============================================================================
+// Code Generator Entry Points
+// Generated loops compute magic/more once in the preheader and expand
+// q = mulhi(magic, n), optional add-and-halve, shift inline.
+// ============================================================================
+
+static uint8_t pack_more(uint8_t shift, uint8_t flags)
+{
+    return (uint8_t)(shift | ((flags & RF_DIVIDER_ADD) ? RF_DIVIDER_MORE_ADD : 0));
+}
+
+rf_u32 rf_divider_u32_magic(rf_u32 d)
+{
+    return rf_divider_u32_new(d).magic;
+}
+
+uint8_t rf_divider_u32_more(rf_u32 d)
+{
+    rf_divider_u32 div = rf_divider_u32_new(d);
+    return pack_more(div.shift, div.flags);
+}
+
+rf_u64 rf_divider_u64_magic(rf_u64 d)
+{
+    return rf_divider_u64_new(d).magic;
+}
+
+uint8_t rf_divider_u64_more(rf_u64 d)
+{
+    rf_divider_u64 div = rf_divider_u64_new(d);
+    return pack_more(div.shift, div.flags);
+}
@@ -0,0 +1,323 @@
+/*
+ * RazorForge Runtime - Encoding
+ * Base64 and hex: scalar codecs, alphabets, and the dispatch to the
+ * SSSE3/AVX2 block kernels
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_encoding.h"
+#include "encoding_internal.h"
+
+// ============================================================================
+// Alphabets
+// ============================================================================
+
+#define ROLL_DIGITS ('0' - 52)
+
+// decode[] is filled in by build_decode_tables
+static rf_base64_alphabet alphabet_standard = {
+    .encode = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+    .encode_shift = {'a' - 26, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS,
+                     ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS,
+                     '+' - 62, '/' - 63, 'A', 0, 0},
+    .decode_lo = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                  0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A},
+    .decode_hi = {0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    .decode_roll = {0, 63 - '/', 62 - '+', 4, -65, -65, -71, -71},
+    .roll_char = '/',
+    .roll_index_offset = -1,
+};
+
+// '_' (0x5F) is valid where 0x7F is not, so high nibble 7 gets its own
+// decode_hi bit; it shares nibble 5 with uppercase letters, so it rolls
+// through its own slot 8
+static rf_base64_alphabet alphabet_url = {
+    .encode = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+    .encode_shift = {'a' - 26, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS,
+                     ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS, ROLL_DIGITS,
+                     '-' - 62, '_' - 63, 'A', 0, 0},
+    .decode_lo = {0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                  0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33},
+    .decode_hi = {0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+                  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10},
+    .decode_roll = {0, 0, 62 - '-', 4, -65, -65, -71, -71, 63 - '_'},
+    .roll_char = '_',
+    .roll_index_offset = 3,
+};
+
+const rf_base64_alphabet* const rf_base64_alphabets[2] = {&alphabet_standard, &alphabet_url};
+
+static void build_decode_tables(rf_base64_alphabet* alphabet)
+{
+    memset(alphabet->decode, -1, sizeof(alphabet->decode));
+    for (int i = 0; i < 64; i++)
+    {
+        alphabet->decode[(uint8_t)alphabet->encode[i]] = (int8_t)i;
+    }
+}
+
+// ============================================================================
+// Scalar Codecs
+// ============================================================================
+
+static size_t base64_encode_scalar(const uint8_t* src, size_t length, char* dest,
+                                   const rf_base64_alphabet* alphabet)
+{
+    size_t used = 0;
+    for (; used + 3 <= length; used += 3, dest += 4)
+    {
+        uint32_t triple = (uint32_t)src[used] << 16 | (uint32_t)src[used + 1] << 8 | src[used + 2];
+        dest[0] = alphabet->encode[triple >> 18];
+        dest[1] = alphabet->encode[(triple >> 12) & 63];
+        dest[2] = alphabet->encode[(triple >> 6) & 63];
+        dest[3] = alphabet->encode[triple & 63];
+    }
+    return used;
+}
+
+// Whole quartets of alphabet characters; stops at the first that is not
+static size_t base64_decode_scalar(const char* src, size_t length, uint8_t* dest,
+                                   const rf_base64_alphabet* alphabet)
+{
+    size_t used = 0;
+    for (; used + 4 <= length; used += 4, dest += 3)
+    {
+        int32_t a = alphabet->decode[(uint8_t)src[used]];
+        int32_t b = alphabet->decode[(uint8_t)src[used + 1]];
+        int32_t c = alphabet->decode[(uint8_t)src[used + 2]];
+        int32_t d = alphabet->decode[(uint8_t)src[used + 3]];
+        if ((a | b | c | d) < 0)
+        {
+            break;
+        }
+        uint32_t triple = (uint32_t)a << 18 | (uint32_t)b << 12 | (uint32_t)c << 6 | (uint32_t)d;
+        dest[0] = (uint8_t)(triple >> 16);
+        dest[1] = (uint8_t)(triple >> 8);
+        dest[2] = (uint8_t)triple;
+    }
+    return used;
+}
+
+static const char hex_digits[2][16] = {
+    {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'},
+    {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'},
+};
+
+static size_t hex_encode_scalar(const uint8_t* src, size_t length, char* dest, int upper)
+{
+    const char* digits = hex_digits[upper != 0];
+    for (size_t i = 0; i < length; i++)
+    {
+        dest[2 * i] = digits[src[i] >> 4];
+        dest[2 * i + 1] = digits[src[i] & 15];
+    }
+    return length;
+}
+
+// Digit value of every character, -1 for non-digits; filled in by
+// build_hex_table
+static int8_t hex_values[256];
+
+static void build_hex_table(void)
+{
+    memset(hex_values, -1, sizeof(hex_values));
+    for (int i = 0; i < 16; i++)
+    {
+        hex_values[(uint8_t)hex_digits[0][i]] = (int8_t)i;
+        hex_values[(uint8_t)hex_digits[1][i]] = (int8_t)i;
+    }
+}
+
+static size_t hex_decode_scalar(const char* src, size_t length, uint8_t* dest)
+{
+    size_t used = 0;
+    for (; used + 2 <= length; used += 2)
+    {
+        int high = hex_values[(uint8_t)src[used]];
+        int low = hex_values[(uint8_t)src[used + 1]];
+        if ((high | low) < 0)
+        {
+            break;
+        }
+        *dest++ = (uint8_t)(high << 4 | low);
+    }
+    return used;
+}
+
+static const rf_encoding_kernels kernels_scalar = {
+    .base64_encode = base64_encode_scalar,
+    .base64_decode = base64_decode_scalar,
+    .hex_encode = hex_encode_scalar,
+    .hex_decode = hex_decode_scalar,
+};
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+static const rf_encoding_kernels* active_kernels = NULL;
+
+// Idempotent: concurrent first callers build identical tables
+static void bind_encoding_kernels(void)
+{
+    build_decode_tables(&alphabet_standard);
+    build_decode_tables(&alphabet_url);
+    build_hex_table();
+
+    const rf_encoding_kernels* kernels = &kernels_scalar;
+#ifdef RF_ENCODING_HAS_X86
+    if (rf_cpu_active_level() >= RF_CPU_AVX2)
+    {
+        kernels = &rf_encoding_kernels_avx2;
+    }
+    else if (rf_cpu_has_ssse3())
+    {
+        kernels = &rf_encoding_kernels_ssse3;
+    }
+#endif
+    __atomic_store_n(&active_kernels, kernels, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_encoding_kernels(void)
+{
+    bind_encoding_kernels();
+}
+
+static inline const rf_encoding_kernels* encoding_kernels(void)
+{
+    const rf_encoding_kernels* kernels = __atomic_load_n(&active_kernels, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(kernels == NULL, 0))
+    {
+        bind_encoding_kernels();
+        kernels = __atomic_load_n(&active_kernels, __ATOMIC_ACQUIRE);
+    }
+    return kernels;
+}
+
+// ============================================================================
+// Base64
+// ============================================================================
+
+size_t rf_base64_encoded_length(size_t length, int flags)
+{
+    if (flags & RF_BASE64_NO_PAD)
+    {
+        return length / 3 * 4 + (length % 3 == 0 ? 0 : length % 3 + 1);
+    }
+    return (length + 2) / 3 * 4;
+}
+
+size_t rf_base64_decoded_max_length(size_t length)
+{
+    return length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1);
+}
+
+size_t rf_base64_encode(const void* src, size_t length, char* dest, int flags)
+{
+    const uint8_t* bytes = (const uint8_t*)src;
+    const rf_base64_alphabet* alphabet = rf_base64_alphabets[(flags & RF_BASE64_URL) != 0];
+
+    size_t used = encoding_kernels()->base64_encode(bytes, length, dest, alphabet);
+    used += base64_encode_scalar(bytes + used, length - used, dest + used / 3 * 4, alphabet);
+    char* out = dest + used / 3 * 4;
+
+    size_t remaining = length - used;
+    if (remaining > 0)
+    {
+        uint32_t last = (uint32_t)bytes[used] << 16;
+        if (remaining == 2)
+        {
+            last |= (uint32_t)bytes[used + 1] << 8;
+        }
+        *out++ = alphabet->encode[last >> 18];
+        *out++ = alphabet->encode[(last >> 12) & 63];
+        if (remaining == 2)
+        {
+            *out++ = alphabet->encode[(last >> 6) & 63];
+        }
+        if (!(flags & RF_BASE64_NO_PAD))
+        {
+            *out++ = '=';
+            if (remaining == 1)
+            {
+                *out++ = '=';
+            }
+        }
+    }
+    return (size_t)(out - dest);
+}
+
+size_t rf_base64_decode(const char* src, size_t length, void* dest, int flags)
+{
+    uint8_t* bytes = (uint8_t*)dest;
+    const rf_base64_alphabet* alphabet = rf_base64_alphabets[(flags & RF_BASE64_URL) != 0];
+
+    // Up to two '=' may end input whose length is a multiple of 4
+    size_t data_length = length;
+    if (length % 4 == 0 && length > 0 && src[length - 1] == '=')
+    {
+        data_length -= (src[length - 2] == '=') ? 2 : 1;
+    }
+    if (data_length % 4 == 1)
+    {
+        return RF_DECODE_INVALID;
+    }
+
+    size_t used = encoding_kernels()->base64_decode(src, data_length, bytes, alphabet);
+    used += base64_decode_scalar(src + used, data_length - used, bytes + used / 4 * 3, alphabet);
+    size_t written = used / 4 * 3;
+
+    size_t remaining = data_length - used;
+    if (remaining >= 4)
+    {
+        return RF_DECODE_INVALID;  // a full quartet the scalar loop refused
+    }
+    if (remaining > 0)
+    {
+        uint32_t last = 0;
+        for (size_t i = 0; i < remaining; i++)
+        {
+            int32_t value = alphabet->decode[(uint8_t)src[used + i]];
+            if (value < 0)
+            {
+                return RF_DECODE_INVALID;
+            }
+            last |= (uint32_t)value << (18 - 6 * i);
+        }
+        bytes[written++] = (uint8_t)(last >> 16);
+        if (remaining == 3)
+        {
+            bytes[written++] = (uint8_t)(last >> 8);
+        }
+    }
+    return written;
+}
+
+// ============================================================================
+// Hex
+// ============================================================================
+
+size_t rf_hex_encode(const void* src, size_t length, char* dest, int upper)
+{
+    const uint8_t* bytes = (const uint8_t*)src;
+    size_t used = encoding_kernels()->hex_encode(bytes, length, dest, upper);
+    hex_encode_scalar(bytes + used, length - used, dest + 2 * used, upper);
+    return 2 * length;
+}
+
+size_t rf_hex_decode(const char* src, size_t length, void* dest)
+{
+    if (length % 2 != 0)
+    {
+        return RF_DECODE_INVALID;
+    }
+    uint8_t* bytes = (uint8_t*)dest;
+    size_t used = encoding_kernels()->hex_decode(src, length, bytes);
+    used += hex_decode_scalar(src + used, length - used, bytes + used / 2);
+    return used == length ? length / 2 : RF_DECODE_INVALID;
+}
@@ -0,0 +1,162 @@
+/*
+ * RazorForge Runtime - Encoding, AVX2 kernels
+ * The SSSE3 algorithms on two 128-bit lanes at once; pshufb stays within a
+ * lane, so each lane gets its own 12 input bytes (base64 encode) and the
+ * packed results are permuted back together. Only selected at RF_CPU_AVX2.
+ */
+
+#include <immintrin.h>
+#include <stdbool.h>
+#include "encoding_internal.h"
+
+#ifndef __AVX2__
+    #error "encoding_avx2.c must be compiled with -mavx2"
+#endif
+
+static inline __m256i load_table(const int8_t table[16])
+{
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)table));
+}
+
+// ============================================================================
+// Base64
+// ============================================================================
+
+static size_t base64_encode_avx2(const uint8_t* src, size_t length, char* dest,
+                                 const rf_base64_alphabet* alphabet)
+{
+    const __m256i shift_table = load_table(alphabet->encode_shift);
+    const __m256i gather = _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                           10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    size_t used = 0;
+    for (; length - used >= 28; used += 24, dest += 32)  // reads 4 bytes past the block
+    {
+        __m256i input = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(src + used))),
+            _mm_loadu_si128((const __m128i*)(src + used + 12)), 1);
+        input = _mm256_shuffle_epi8(input, gather);
+        __m256i high = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00)),
+                                          _mm256_set1_epi32(0x04000040));
+        __m256i low = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0)),
+                                         _mm256_set1_epi32(0x01000010));
+        __m256i values = _mm256_or_si256(high, low);
+
+        __m256i classes = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+        __m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+        classes = _mm256_or_si256(classes, _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+        __m256i output = _mm256_add_epi8(_mm256_shuffle_epi8(shift_table, classes), values);
+        _mm256_storeu_si256((__m256i*)dest, output);
+    }
+    _mm256_zeroupper();
+    return used;
+}
+
+static size_t base64_decode_avx2(const char* src, size_t length, uint8_t* dest,
+                                 const rf_base64_alphabet* alphabet)
+{
+    const __m256i nibble_mask = _mm256_set1_epi8(0x2f);
+    const __m256i table_hi = load_table(alphabet->decode_hi);
+    const __m256i table_lo = load_table(alphabet->decode_lo);
+    const __m256i table_roll = load_table(alphabet->decode_roll);
+    const __m256i roll_char = _mm256_set1_epi8(alphabet->roll_char);
+    const __m256i roll_offset = _mm256_set1_epi8(alphabet->roll_index_offset);
+    const __m256i gather = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i join_lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+    size_t used = 0;
+    // Each store writes 8 bytes past its block; 16 more characters guarantee
+    // the caller writes over them
+    for (; length - used >= 48; used += 32, dest += 24)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(src + used));
+        __m256i high_nibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), nibble_mask);
+        __m256i low_nibbles = _mm256_and_si256(input, nibble_mask);
+        __m256i high = _mm256_shuffle_epi8(table_hi, high_nibbles);
+        __m256i low = _mm256_shuffle_epi8(table_lo, low_nibbles);
+        if (!_mm256_testz_si256(low, high))
+        {
+            break;
+        }
+
+        __m256i is_roll_char = _mm256_cmpeq_epi8(input, roll_char);
+        __m256i roll_index = _mm256_add_epi8(high_nibbles, _mm256_and_si256(is_roll_char, roll_offset));
+        __m256i values = _mm256_add_epi8(input, _mm256_shuffle_epi8(table_roll, roll_index));
+
+        __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i triples = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+        __m256i output = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triples, gather), join_lanes);
+        _mm256_storeu_si256((__m256i*)dest, output);
+    }
+    _mm256_zeroupper();
+    return used;
+}
+
+// ============================================================================
+// Hex
+// ============================================================================
+
+static size_t hex_encode_avx2(const uint8_t* src, size_t length, char* dest, int upper)
+{
+    char a = upper ? 'A' : 'a';
+    const __m256i digits = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', a, (char)(a + 1),
+                      (char)(a + 2), (char)(a + 3), (char)(a + 4), (char)(a + 5)));
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    size_t used = 0;
+    for (; length - used >= 32; used += 32, dest += 64)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(src + used));
+        __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+        __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(input, nibble));
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256((__m256i*)dest, _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256((__m256i*)(dest + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    _mm256_zeroupper();
+    return used;
+}
+
+static inline bool hex_decode_half(__m256i input, __m256i* output)
+{
+    __m256i digit = _mm256_sub_epi8(input, _mm256_set1_epi8('0'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+    __m256i letter = _mm256_sub_epi8(_mm256_or_si256(input, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+    if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter)) != -1)
+    {
+        return false;
+    }
+    __m256i values = _mm256_or_si256(
+        _mm256_and_si256(is_digit, digit),
+        _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+    *output = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+    return true;
+}
+
+static size_t hex_decode_avx2(const char* src, size_t length, uint8_t* dest)
+{
+    size_t used = 0;
+    for (; length - used >= 64; used += 64, dest += 32)
+    {
+        __m256i first;
+        __m256i second;
+        if (!hex_decode_half(_mm256_loadu_si256((const __m256i*)(src + used)), &first) ||
+            !hex_decode_half(_mm256_loadu_si256((const __m256i*)(src + used + 32)), &second))
+        {
+            break;
+        }
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xd8);
+        _mm256_storeu_si256((__m256i*)dest, packed);
+    }
+    _mm256_zeroupper();
+    return used;
+}
+
+const rf_encoding_kernels rf_encoding_kernels_avx2 = {
+    .base64_encode = base64_encode_avx2,
+    .base64_decode = base64_decode_avx2,
+    .hex_encode = hex_encode_avx2,
+    .hex_decode = hex_decode_avx2,
+};
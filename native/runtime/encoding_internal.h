@@ -0,0 +1,55 @@
+/*
+ * RazorForge Runtime - Encoding (internal)
+ * Alphabet tables shared by the scalar codecs in encoding.c and the SIMD
+ * kernels. Kernels only handle whole blocks of valid input and return how
+ * much they consumed; the scalar code finishes the tail, padding and error
+ * reporting, so both paths accept exactly the same inputs.
+ */
+
+#ifndef RAZORFORGE_ENCODING_INTERNAL_H
+#define RAZORFORGE_ENCODING_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct
+{
+    char encode[64];
+    int8_t decode[256];  // -1 outside the alphabet
+
+    // SIMD encode: 6-bit values are first reduced to a class 0..13 (see the
+    // kernels), and encode_shift[class] is added to reach ASCII
+    int8_t encode_shift[16];
+
+    // SIMD decode (Mula's nibble scheme): a character is invalid when
+    // decode_lo[low nibble] & decode_hi[high nibble] is non-zero; otherwise
+    // it is translated by adding decode_roll[high nibble, or roll_index for
+    // roll_char, the one character its nibble class cannot tell apart]
+    int8_t decode_lo[16];
+    int8_t decode_hi[16];
+    int8_t decode_roll[16];
+    char roll_char;
+    int8_t roll_index_offset;  // added to roll_char's high nibble
+} rf_base64_alphabet;
+
+extern const rf_base64_alphabet* const rf_base64_alphabets[2];  // standard, URL
+
+typedef struct
+{
+    // Return the input consumed (encode: multiple of 3 bytes; decode: of 4
+    // characters); output length follows from it
+    size_t (*base64_encode)(const uint8_t* src, size_t length, char* dest,
+                            const rf_base64_alphabet* alphabet);
+    size_t (*base64_decode)(const char* src, size_t length, uint8_t* dest,
+                            const rf_base64_alphabet* alphabet);
+    size_t (*hex_encode)(const uint8_t* src, size_t length, char* dest, int upper);
+    size_t (*hex_decode)(const char* src, size_t length, uint8_t* dest);  // even count
+} rf_encoding_kernels;
+
+#ifdef RF_ENCODING_HAS_X86
+// encoding_ssse3.c (-mssse3) and encoding_avx2.c (-mavx2)
+extern const rf_encoding_kernels rf_encoding_kernels_ssse3;
+extern const rf_encoding_kernels rf_encoding_kernels_avx2;
+#endif
+
+#endif // RAZORFORGE_ENCODING_INTERNAL_H
@@ -0,0 +1,182 @@
+/*
+ * RazorForge Runtime - Encoding, SSSE3 kernels
+ * Base64 after Mula and Lemire: pshufb gathers each 3-byte group into a
+ * 32-bit lane, two multiplies split it into four 6-bit values, and a 16-entry
+ * pshufb table maps value classes to ASCII offsets (decoding runs the same
+ * trick backwards, validating by nibble). Hex uses pshufb as a digit table.
+ * Only selected after rf_cpu_has_ssse3().
+ */
+
+#include <tmmintrin.h>
+#include <stdbool.h>
+#include "encoding_internal.h"
+
+#ifndef __SSSE3__
+    #error "encoding_ssse3.c must be compiled with -mssse3"
+#endif
+
+static inline __m128i load_table(const int8_t table[16])
+{
+    return _mm_loadu_si128((const __m128i*)table);
+}
+
+// ============================================================================
+// Base64
+// ============================================================================
+
+// The first 12 bytes of input become 16 characters
+static inline __m128i base64_encode_block(__m128i input, __m128i shift_table)
+{
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)),
+                                   _mm_set1_epi32(0x04000040));
+    __m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)),
+                                  _mm_set1_epi32(0x01000010));
+    __m128i values = _mm_or_si128(high, low);
+
+    // Classes: 0 for a-z (26..51), 1..12 for digits, '+' and '/', 13 for A-Z
+    __m128i classes = _mm_subs_epu8(values, _mm_set1_epi8(51));
+    __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), values);
+    classes = _mm_or_si128(classes, _mm_and_si128(upper, _mm_set1_epi8(13)));
+    return _mm_add_epi8(_mm_shuffle_epi8(shift_table, classes), values);
+}
+
+static size_t base64_encode_ssse3(const uint8_t* src, size_t length, char* dest,
+                                  const rf_base64_alphabet* alphabet)
+{
+    __m128i shift_table = load_table(alphabet->encode_shift);
+    size_t used = 0;
+    for (; length - used >= 16; used += 12, dest += 16)  // reads 4 bytes past the block
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(src + used));
+        _mm_storeu_si128((__m128i*)dest, base64_encode_block(input, shift_table));
+    }
+    return used;
+}
+
+// Decode tables loaded once per call: stores through dest may alias the
+// alphabet, so the compiler would otherwise reload them every block
+typedef struct
+{
+    __m128i high;
+    __m128i low;
+    __m128i roll;
+    __m128i roll_char;
+    __m128i roll_offset;
+} base64_decode_tables;
+
+// 16 characters become 12 bytes at the bottom of *output; false if any
+// character is outside the alphabet
+static inline bool base64_decode_block(__m128i input, const base64_decode_tables* tables,
+                                       __m128i* output)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x2f);
+    __m128i high_nibbles = _mm_and_si128(_mm_srli_epi32(input, 4), nibble_mask);
+    __m128i low_nibbles = _mm_and_si128(input, nibble_mask);
+    __m128i high = _mm_shuffle_epi8(tables->high, high_nibbles);
+    __m128i low = _mm_shuffle_epi8(tables->low, low_nibbles);
+    if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(low, high), _mm_setzero_si128())) != 0)
+    {
+        return false;
+    }
+
+    __m128i is_roll_char = _mm_cmpeq_epi8(input, tables->roll_char);
+    __m128i roll_index = _mm_add_epi8(high_nibbles, _mm_and_si128(is_roll_char, tables->roll_offset));
+    __m128i values = _mm_add_epi8(input, _mm_shuffle_epi8(tables->roll, roll_index));
+
+    // Pack four 6-bit values per 32-bit lane into 3 bytes, then gather them
+    __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    __m128i triples = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    *output = _mm_shuffle_epi8(triples,
+                               _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return true;
+}
+
+static size_t base64_decode_ssse3(const char* src, size_t length, uint8_t* dest,
+                                  const rf_base64_alphabet* alphabet)
+{
+    const base64_decode_tables tables = {
+        .high = load_table(alphabet->decode_hi),
+        .low = load_table(alphabet->decode_lo),
+        .roll = load_table(alphabet->decode_roll),
+        .roll_char = _mm_set1_epi8(alphabet->roll_char),
+        .roll_offset = _mm_set1_epi8(alphabet->roll_index_offset),
+    };
+    size_t used = 0;
+    // Each store writes 4 bytes past its block; 8 more characters guarantee
+    // the caller writes over them
+    for (; length - used >= 24; used += 16, dest += 12)
+    {
+        __m128i output;
+        if (!base64_decode_block(_mm_loadu_si128((const __m128i*)(src + used)), &tables, &output))
+        {
+            break;
+        }
+        _mm_storeu_si128((__m128i*)dest, output);
+    }
+    return used;
+}
+
+// ============================================================================
+// Hex
+// ============================================================================
+
+static size_t hex_encode_ssse3(const uint8_t* src, size_t length, char* dest, int upper)
+{
+    char a = upper ? 'A' : 'a';
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', a,
+                                         (char)(a + 1), (char)(a + 2), (char)(a + 3),
+                                         (char)(a + 4), (char)(a + 5));
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    size_t used = 0;
+    for (; length - used >= 16; used += 16, dest += 32)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(src + used));
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(input, nibble));
+        _mm_storeu_si128((__m128i*)dest, _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i*)(dest + 16), _mm_unpackhi_epi8(high, low));
+    }
+    return used;
+}
+
+// Digit values of 16 characters, paired into 8 bytes as 16-bit lanes
+static inline bool hex_decode_half(__m128i input, __m128i* output)
+{
+    __m128i digit = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i letter = _mm_sub_epi8(_mm_or_si128(input, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff)
+    {
+        return false;
+    }
+    __m128i values = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                                  _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    *output = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+    return true;
+}
+
+static size_t hex_decode_ssse3(const char* src, size_t length, uint8_t* dest)
+{
+    size_t used = 0;
+    for (; length - used >= 32; used += 32, dest += 16)
+    {
+        __m128i first;
+        __m128i second;
+        if (!hex_decode_half(_mm_loadu_si128((const __m128i*)(src + used)), &first) ||
+            !hex_decode_half(_mm_loadu_si128((const __m128i*)(src + used + 16)), &second))
+        {
+            break;
+        }
+        _mm_storeu_si128((__m128i*)dest, _mm_packus_epi16(first, second));
+    }
+    return used;
+}
+
+const rf_encoding_kernels rf_encoding_kernels_ssse3 = {
+    .base64_encode = base64_encode_ssse3,
+    .base64_decode = base64_decode_ssse3,
+    .hex_encode = hex_encode_ssse3,
+    .hex_decode = hex_decode_ssse3,
+};
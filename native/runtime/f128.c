@@ -0,0 +1,340 @@
+/*
+ * RazorForge Runtime - Quad Precision
+ * Public f128 entry points. Native quad arithmetic and libquadmath (or a
+ * binary128 long double libm) where the toolchain has them, the soft-float
+ * core in f128_soft.c everywhere else.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_f128.h"
+#include "f128_internal.h"
+
+#ifdef RF_HAS_INT128
+
+#if defined(RF_HAS_QUADMATH) && defined(RF_HAS_FLOAT128) && !defined(RF_F128_IS_LONG_DOUBLE)
+    #include <quadmath.h>
+    #define F128_HAS_LIBM 1
+    #define F128_LIBM(name) name##q
+    #define F128_PRINT_E(buffer, size, digits, value) \
+        quadmath_snprintf(buffer, size, "%.*Qe", digits, value)
+    #define F128_STRTO(text) strtoflt128(text, NULL)
+#elif defined(RF_F128_IS_LONG_DOUBLE)
+    #include <math.h>
+    #include <stdio.h>
+    #define F128_HAS_LIBM 1
+    #define F128_LIBM(name) name##l
+    #define F128_PRINT_E(buffer, size, digits, value) snprintf(buffer, size, "%.*Le", digits, value)
+    #define F128_STRTO(text) strtold(text, NULL)
+#endif
+
+// Runs the soft core on an rf_f128, whatever C type it is
+#define SOFT_UNARY(name, x) rf_f128_from_bits(rf_f128_soft_##name(rf_f128_to_bits(x)))
+#define SOFT_BINARY(name, a, b) \
+    rf_f128_from_bits(rf_f128_soft_##name(rf_f128_to_bits(a), rf_f128_to_bits(b)))
+
+rf_u128 rf_f128_to_bits(rf_f128 value)
+{
+    rf_u128 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+rf_f128 rf_f128_from_bits(rf_u128 bits)
+{
+    rf_f128 value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// ============================================================================
+// Arithmetic
+// The soft core beats libgcc's quad add/mul (it skips fenv and exception
+// flags) and libquadmath's fmaq by a wide margin, and unlike sqrtq its sqrt
+// is correctly rounded, so those always run soft. Division and the f64
+// conversions stay native where the compiler has quad support.
+// See bench/f128_bench.c.
+// ============================================================================
+
+rf_f128 rf_f128_add(rf_f128 a, rf_f128 b)
+{
+    return SOFT_BINARY(add, a, b);
+}
+
+rf_f128 rf_f128_sub(rf_f128 a, rf_f128 b)
+{
+    return SOFT_BINARY(sub, a, b);
+}
+
+rf_f128 rf_f128_mul(rf_f128 a, rf_f128 b)
+{
+    return SOFT_BINARY(mul, a, b);
+}
+
+rf_f128 rf_f128_sqrt(rf_f128 x)
+{
+    return SOFT_UNARY(sqrt, x);
+}
+
+rf_f128 rf_f128_fma(rf_f128 a, rf_f128 b, rf_f128 c)
+{
+    return rf_f128_from_bits(
+        rf_f128_soft_fma(rf_f128_to_bits(a), rf_f128_to_bits(b), rf_f128_to_bits(c)));
+}
+
+#ifdef RF_HAS_FLOAT128
+rf_f128 rf_f128_div(rf_f128 a, rf_f128 b)
+{
+    return a / b;
+}
+
+rf_f128 rf_f128_from_f64(double value)
+{
+    return (rf_f128)value;
+}
+
+double rf_f128_to_f64(rf_f128 value)
+{
+    return (double)value;
+}
+#else
+rf_f128 rf_f128_div(rf_f128 a, rf_f128 b)
+{
+    return SOFT_BINARY(div, a, b);
+}
+
+rf_f128 rf_f128_from_f64(double value)
+{
+    return rf_f128_from_bits(rf_f128_soft_from_f64(value));
+}
+
+double rf_f128_to_f64(rf_f128 value)
+{
+    return rf_f128_soft_to_f64(rf_f128_to_bits(value));
+}
+#endif
+
+// ============================================================================
+// Math Library
+// ============================================================================
+
+#ifdef F128_HAS_LIBM
+rf_f128 rf_f128_exp(rf_f128 x)
+{
+    return F128_LIBM(exp)(x);
+}
+
+rf_f128 rf_f128_log(rf_f128 x)
+{
+    return F128_LIBM(log)(x);
+}
+
+rf_f128 rf_f128_sin(rf_f128 x)
+{
+    return F128_LIBM(sin)(x);
+}
+
+rf_f128 rf_f128_cos(rf_f128 x)
+{
+    return F128_LIBM(cos)(x);
+}
+
+rf_f128 rf_f128_tan(rf_f128 x)
+{
+    return F128_LIBM(tan)(x);
+}
+
+rf_f128 rf_f128_pow(rf_f128 base, rf_f128 exponent)
+{
+    return F128_LIBM(pow)(base, exponent);
+}
+#else
+rf_f128 rf_f128_exp(rf_f128 x)
+{
+    return SOFT_UNARY(exp, x);
+}
+
+rf_f128 rf_f128_log(rf_f128 x)
+{
+    return SOFT_UNARY(log, x);
+}
+
+rf_f128 rf_f128_sin(rf_f128 x)
+{
+    return SOFT_UNARY(sin, x);
+}
+
+rf_f128 rf_f128_cos(rf_f128 x)
+{
+    return SOFT_UNARY(cos, x);
+}
+
+rf_f128 rf_f128_tan(rf_f128 x)
+{
+    return SOFT_UNARY(tan, x);
+}
+
+rf_f128 rf_f128_pow(rf_f128 base, rf_f128 exponent)
+{
+    return SOFT_BINARY(pow, base, exponent);
+}
+#endif
+
+// ============================================================================
+// Text Conversion
+// Both backends go through rf_f128_scan and rf_f128_layout, so they accept
+// and produce the same text; only the digit generation differs.
+// ============================================================================
+
+size_t rf_f128_to_chars(rf_f128 value, char* buffer)
+{
+#ifdef F128_HAS_LIBM
+    rf_u128 bits = rf_f128_to_bits(value);
+    size_t special = rf_f128_layout_special(bits, buffer);
+    if (special != 0)
+    {
+        return special;
+    }
+
+    // "-d.ddd...e-XXXX": shortest precision that reads back unchanged
+    char scratch[64];
+    int precision = RF_F128_MIN_ROUNDTRIP_DIGITS;
+    for (;; precision++)
+    {
+        F128_PRINT_E(scratch, sizeof(scratch), precision - 1, value);
+        if (precision == RF_F128_MAX_ROUNDTRIP_DIGITS ||
+            rf_f128_to_bits(F128_STRTO(scratch)) == bits)
+        {
+            break;
+        }
+    }
+
+    char digits[RF_F128_MAX_ROUNDTRIP_DIGITS];
+    int count = 0;
+    const char* cursor = scratch + (scratch[0] == '-');
+    for (; *cursor != 'e'; cursor++)
+    {
+        if (*cursor != '.')
+        {
+            digits[count++] = *cursor;
+        }
+    }
+    int32_t exponent10 = (int32_t)strtol(cursor + 1, NULL, 10);
+    return rf_f128_layout(scratch[0] == '-', digits, count, exponent10, precision, buffer);
+#else
+    return rf_f128_soft_to_chars(rf_f128_to_bits(value), buffer);
+#endif
+}
+
+char* rf_f128_to_cstr(rf_f128 value)
+{
+    char* str = (char*)malloc(RF_F128_MAX_CHARS);
+    if (str)
+    {
+        rf_f128_to_chars(value, str);
+    }
+    return str;
+}
+
+int rf_f128_parse(const char* text, size_t length, rf_f128* out)
+{
+#ifdef F128_HAS_LIBM
+    rf_f128_decimal decimal;
+    int status = rf_f128_scan(text, length, &decimal);
+    if (status != RF_PARSE_OK || decimal.kind != RF_F128_TEXT_FINITE)
+    {
+        rf_u128 bits;
+        status = rf_f128_soft_parse(text, length, &bits);
+        if (status == RF_PARSE_OK)
+        {
+            *out = rf_f128_from_bits(bits);
+        }
+        return status;
+    }
+
+    // The grammar is a subset of strtoflt128's, which needs a NUL terminator
+    char small[128];
+    char* copy = length < sizeof(small) ? small : (char*)malloc(length + 1);
+    if (copy == NULL)
+    {
+        return RF_PARSE_INVALID;
+    }
+    memcpy(copy, text, length);
+    copy[length] = '\0';
+    rf_f128 value = F128_STRTO(copy);
+    if (copy != small)
+    {
+        free(copy);
+    }
+
+    *out = value;
+    rf_u128 magnitude = rf_f128_to_bits(value) & ~((rf_u128)1 << 127);
+    return magnitude == ((rf_u128)0x7fff << 112) ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+#else
+    rf_u128 bits;
+    int status = rf_f128_soft_parse(text, length, &bits);
+    if (status != RF_PARSE_INVALID)
+    {
+        *out = rf_f128_from_bits(bits);
+    }
+    return status;
+#endif
+}
+
+// Letter buffer of any width, as Text stores it; wider letters must all be ASCII
+int rf_f128_parse_letters(const void* text, size_t length, size_t letter_size, rf_f128* out)
+{
+    if (letter_size == 1)
+    {
+        return rf_f128_parse((const char*)text, length, out);
+    }
+    if (letter_size != 2 && letter_size != 4)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    char small[128];
+    char* narrow = length <= sizeof(small) ? small : (char*)malloc(length);
+    if (narrow == NULL)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    int status = RF_PARSE_OK;
+    for (size_t i = 0; i < length; i++)
+    {
+        uint32_t letter = letter_size == 2 ? ((const uint16_t*)text)[i] : ((const uint32_t*)text)[i];
+        if (letter > 0x7f)
+        {
+            status = RF_PARSE_INVALID;
+            break;
+        }
+        narrow[i] = (char)letter;
+    }
+    if (status == RF_PARSE_OK)
+    {
+        status = rf_f128_parse(narrow, length, out);
+    }
+
+    if (narrow != small)
+    {
+        free(narrow);
+    }
+    return status;
+}
+
+int32_t rf_f128_parse_status(const char* text)
+{
+    rf_f128 value;
+    return rf_f128_parse(text, strlen(text), &value);
+}
+
+rf_f128 rf_f128_from_cstr(const char* text)
+{
+    rf_f128 value = rf_f128_from_bits(0);
+    return rf_f128_parse(text, strlen(text), &value) == RF_PARSE_INVALID
+               ? rf_f128_from_bits(0)
+               : value;
+}
+
+#endif // RF_HAS_INT128
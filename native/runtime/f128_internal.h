@@ -0,0 +1,48 @@
+/*
+ * RazorForge Runtime - Quad Precision (internal)
+ * Text helpers shared by the native backend (f128.c) and the soft-float
+ * core (f128_soft.c), so both accept and print exactly the same text
+ */
+
+#ifndef RAZORFORGE_F128_INTERNAL_H
+#define RAZORFORGE_F128_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "../include/razorforge_f128.h"
+
+#ifdef RF_HAS_INT128
+
+// Fewest significant digits that always survive a decimal -> binary128 ->
+// decimal round trip, and the most any binary128 value needs to round-trip
+#define RF_F128_MIN_ROUNDTRIP_DIGITS 33
+#define RF_F128_MAX_ROUNDTRIP_DIGITS 36
+
+#define RF_F128_TEXT_FINITE 0
+#define RF_F128_TEXT_INFINITE 1
+#define RF_F128_TEXT_NAN 2
+
+// A scanned decimal: value = digits * 10^exponent
+typedef struct
+{
+    int kind;
+    bool negative;
+    rf_u128 digits;    // up to 37 significant digits, plus one sticky digit
+    int32_t exponent;
+} rf_f128_decimal;
+
+// Validates the grammar in razorforge_f128.h; returns an RF_PARSE_* status
+int rf_f128_scan(const char* text, size_t length, rf_f128_decimal* out);
+
+// Lays out significant digits d0.d1d2... * 10^exponent10 in %g style
+// (trailing zeros dropped); returns the length without NUL
+size_t rf_f128_layout(bool negative, const char* digits, int count, int32_t exponent10,
+    int precision, char* buffer);
+
+// Text for zero, infinity and NaN bit patterns; 0 when bits is finite non-zero
+size_t rf_f128_layout_special(rf_u128 bits, char* buffer);
+
+#endif // RF_HAS_INT128
+
+#endif // RAZORFORGE_F128_INTERNAL_H
@@ -0,0 +1,1844 @@
+/*
+ * RazorForge Runtime - Quad Precision Soft Float
+ * Portable binary128 arithmetic on bit patterns: correctly rounded basic
+ * operations, series-based transcendentals, and exact decimal conversion.
+ * Used where no native quad type or quad libm exists (see f128.c).
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_f128.h"
+#include "f128_internal.h"
+
+#ifdef RF_HAS_INT128
+
+// ============================================================================
+// Layout and Packing
+// Working significands keep the leading bit at bit 124: 113 significant bits
+// followed by 12 guard bits, the lowest of which is sticky.
+// ============================================================================
+
+#define F128_BIAS 16383
+#define F128_EXP_MAX 0x7fff
+#define F128_SIGN ((rf_u128)1 << 127)
+#define F128_IMPLICIT ((rf_u128)1 << 112)
+#define F128_FRAC_MASK (F128_IMPLICIT - 1)
+#define F128_QUIET ((rf_u128)1 << 111)
+#define F128_INF ((rf_u128)F128_EXP_MAX << 112)
+#define F128_NAN (F128_INF | F128_QUIET)
+#define F128_ONE ((rf_u128)F128_BIAS << 112)
+#define F128_GUARD_BITS 12
+
+#define F128_CLASS_ZERO 0
+#define F128_CLASS_FINITE 1
+#define F128_CLASS_INF 2
+#define F128_CLASS_NAN 3
+
+typedef struct
+{
+    bool sign;
+    int32_t exp;  // biased; below 1 for subnormal inputs
+    rf_u128 sig;  // leading bit at 112
+} f128_parts;
+
+static inline int clz128(rf_u128 x)
+{
+    uint64_t hi = (uint64_t)(x >> 64);
+    return hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((uint64_t)x);
+}
+
+// Right shift that ORs every bit shifted out into bit 0
+static inline rf_u128 shr_sticky(rf_u128 x, int32_t n)
+{
+    if (n <= 0)
+    {
+        return x;
+    }
+    if (n >= 128)
+    {
+        return x != 0;
+    }
+    return (x >> n) | ((x & (((rf_u128)1 << n) - 1)) != 0);
+}
+
+static int unpack(rf_u128 bits, f128_parts* parts)
+{
+    int32_t exp = (int32_t)((bits >> 112) & F128_EXP_MAX);
+    rf_u128 frac = bits & F128_FRAC_MASK;
+    parts->sign = (bits >> 127) != 0;
+    // Special values keep their raw fields so every path leaves parts initialized
+    parts->exp = exp;
+    parts->sig = frac;
+    if (exp == F128_EXP_MAX)
+    {
+        return frac ? F128_CLASS_NAN : F128_CLASS_INF;
+    }
+    if (exp == 0)
+    {
+        if (frac == 0)
+        {
+            return F128_CLASS_ZERO;
+        }
+        int shift = clz128(frac) - 15;
+        parts->sig = frac << shift;
+        parts->exp = 1 - shift;
+        return F128_CLASS_FINITE;
+    }
+    parts->sig = frac | F128_IMPLICIT;
+    parts->exp = exp;
+    return F128_CLASS_FINITE;
+}
+
+// Rounds a working significand to nearest-even and packs it, producing
+// subnormals, zero or infinity as the exponent requires
+static rf_u128 round_pack(bool sign, int32_t exp, rf_u128 sig)
+{
+    rf_u128 sign_bit = sign ? F128_SIGN : 0;
+    if (exp >= F128_EXP_MAX)
+    {
+        return sign_bit | F128_INF;
+    }
+    if (exp < 1)
+    {
+        sig = shr_sticky(sig, 1 - exp);
+        exp = 1;
+    }
+
+    rf_u128 rest = sig & 0xfff;
+    sig >>= F128_GUARD_BITS;
+    if (rest > 0x800 || (rest == 0x800 && (sig & 1)))
+    {
+        sig++;
+    }
+    // The implicit bit carries into the exponent field, which also turns a
+    // rounded-up subnormal into the smallest normal and MAX into infinity
+    return sign_bit | (((rf_u128)(exp - 1) << 112) + sig);
+}
+
+static inline rf_u128 quiet(rf_u128 bits)
+{
+    return bits | F128_QUIET;
+}
+
+static inline rf_u128 negate(rf_u128 bits)
+{
+    return bits ^ F128_SIGN;
+}
+
+static rf_u128 from_i64(int64_t value)
+{
+    if (value == 0)
+    {
+        return 0;
+    }
+    bool sign = value < 0;
+    rf_u128 magnitude = sign ? (rf_u128)(0 - (uint64_t)value) : (rf_u128)value;
+    int shift = clz128(magnitude) - 3;
+    return round_pack(sign, F128_BIAS + 124 - shift, magnitude << shift);
+}
+
+// x * 2^n with a single rounding
+static rf_u128 scale2(rf_u128 x, int32_t n)
+{
+    f128_parts p;
+    if (unpack(x, &p) != F128_CLASS_FINITE)
+    {
+        return x;
+    }
+    return round_pack(p.sign, p.exp + n, p.sig << F128_GUARD_BITS);
+}
+
+// ============================================================================
+// Arithmetic
+// ============================================================================
+
+// Adds two working significands (leading bit at 124)
+static rf_u128 add_parts(bool sign_a, int32_t exp_a, rf_u128 sig_a, bool sign_b, int32_t exp_b,
+    rf_u128 sig_b)
+{
+    if (exp_a < exp_b || (exp_a == exp_b && sig_a < sig_b))
+    {
+        bool sign = sign_a;
+        int32_t exp = exp_a;
+        rf_u128 sig = sig_a;
+        sign_a = sign_b;
+        exp_a = exp_b;
+        sig_a = sig_b;
+        sign_b = sign;
+        exp_b = exp;
+        sig_b = sig;
+    }
+
+    sig_b = shr_sticky(sig_b, exp_a - exp_b);
+    rf_u128 sig;
+    if (sign_a == sign_b)
+    {
+        sig = sig_a + sig_b;
+        if (sig >> 125)
+        {
+            sig = shr_sticky(sig, 1);
+            exp_a++;
+        }
+    }
+    else
+    {
+        sig = sig_a - sig_b;
+        if (sig == 0)
+        {
+            return 0;  // x - x is +0 when rounding to nearest
+        }
+        int shift = clz128(sig) - 3;
+        sig <<= shift;
+        exp_a -= shift;
+    }
+    return round_pack(sign_a, exp_a, sig);
+}
+
+rf_u128 rf_f128_soft_add(rf_u128 a, rf_u128 b)
+{
+    f128_parts x;
+    f128_parts y;
+    int class_a = unpack(a, &x);
+    int class_b = unpack(b, &y);
+    if (class_a == F128_CLASS_NAN || class_b == F128_CLASS_NAN)
+    {
+        return quiet(class_a == F128_CLASS_NAN ? a : b);
+    }
+    if (class_a == F128_CLASS_INF)
+    {
+        return class_b == F128_CLASS_INF && x.sign != y.sign ? F128_NAN : a;
+    }
+    if (class_b == F128_CLASS_INF)
+    {
+        return b;
+    }
+    if (class_a == F128_CLASS_ZERO)
+    {
+        return class_b == F128_CLASS_ZERO ? (x.sign && y.sign ? F128_SIGN : 0) : b;
+    }
+    if (class_b == F128_CLASS_ZERO)
+    {
+        return a;
+    }
+    return add_parts(x.sign, x.exp, x.sig << F128_GUARD_BITS, y.sign, y.exp,
+        y.sig << F128_GUARD_BITS);
+}
+
+rf_u128 rf_f128_soft_sub(rf_u128 a, rf_u128 b)
+{
+    f128_parts y;
+    if (unpack(b, &y) == F128_CLASS_NAN)
+    {
+        return rf_f128_soft_add(a, b);
+    }
+    return rf_f128_soft_add(a, negate(b));
+}
+
+// Full 256-bit product of two 128-bit values
+static void mul_wide(rf_u128 a, rf_u128 b, rf_u128* hi, rf_u128* lo)
+{
+    uint64_t a0 = (uint64_t)a, a1 = (uint64_t)(a >> 64);
+    uint64_t b0 = (uint64_t)b, b1 = (uint64_t)(b >> 64);
+    rf_u128 p00 = (rf_u128)a0 * b0;
+    rf_u128 p01 = (rf_u128)a0 * b1;
+    rf_u128 p10 = (rf_u128)a1 * b0;
+    rf_u128 p11 = (rf_u128)a1 * b1;
+    rf_u128 mid = (p00 >> 64) + (uint64_t)p01 + (uint64_t)p10;
+    *lo = (mid << 64) | (uint64_t)p00;
+    *hi = p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+}
+
+rf_u128 rf_f128_soft_mul(rf_u128 a, rf_u128 b)
+{
+    f128_parts x;
+    f128_parts y;
+    int class_a = unpack(a, &x);
+    int class_b = unpack(b, &y);
+    bool sign = x.sign != y.sign;
+    if (class_a == F128_CLASS_NAN || class_b == F128_CLASS_NAN)
+    {
+        return quiet(class_a == F128_CLASS_NAN ? a : b);
+    }
+    if (class_a == F128_CLASS_INF || class_b == F128_CLASS_INF)
+    {
+        if (class_a == F128_CLASS_ZERO || class_b == F128_CLASS_ZERO)
+        {
+            return F128_NAN;
+        }
+        return (sign ? F128_SIGN : 0) | F128_INF;
+    }
+    if (class_a == F128_CLASS_ZERO || class_b == F128_CLASS_ZERO)
+    {
+        return sign ? F128_SIGN : 0;
+    }
+
+    // 113 x 113 bits: the product's leading bit lands on 224 or 225
+    rf_u128 hi;
+    rf_u128 lo;
+    mul_wide(x.sig, y.sig, &hi, &lo);
+    rf_u128 sig = (hi << 28) | (lo >> 100);
+    sig |= (lo & (((rf_u128)1 << 100) - 1)) != 0;
+    int32_t exp = x.exp + y.exp - F128_BIAS;
+    if (sig >> 125)
+    {
+        sig = shr_sticky(sig, 1);
+        exp++;
+    }
+    return round_pack(sign, exp, sig);
+}
+
+rf_u128 rf_f128_soft_div(rf_u128 a, rf_u128 b)
+{
+    f128_parts x;
+    f128_parts y;
+    int class_a = unpack(a, &x);
+    int class_b = unpack(b, &y);
+    bool sign = x.sign != y.sign;
+    rf_u128 sign_bit = sign ? F128_SIGN : 0;
+    if (class_a == F128_CLASS_NAN || class_b == F128_CLASS_NAN)
+    {
+        return quiet(class_a == F128_CLASS_NAN ? a : b);
+    }
+    if (class_a == F128_CLASS_INF)
+    {
+        return class_b == F128_CLASS_INF ? F128_NAN : sign_bit | F128_INF;
+    }
+    if (class_b == F128_CLASS_INF)
+    {
+        return sign_bit;
+    }
+    if (class_b == F128_CLASS_ZERO)
+    {
+        return class_a == F128_CLASS_ZERO ? F128_NAN : sign_bit | F128_INF;
+    }
+    if (class_a == F128_CLASS_ZERO)
+    {
+        return sign_bit;
+    }
+
+    int32_t exp = x.exp - y.exp + F128_BIAS;
+    rf_u128 remainder = x.sig;
+    if (remainder < y.sig)
+    {
+        remainder <<= 1;
+        exp--;
+    }
+
+    // Restoring division, one quotient bit per step, 125 bits in all
+    rf_u128 quotient = 0;
+    for (int i = 0; i < 125; i++)
+    {
+        quotient <<= 1;
+        if (remainder >= y.sig)
+        {
+            remainder -= y.sig;
+            quotient |= 1;
+        }
+        remainder <<= 1;
+    }
+    return round_pack(sign, exp, quotient | (remainder != 0));
+}
+
+rf_u128 rf_f128_soft_sqrt(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return x;
+    }
+    if (p.sign)
+    {
+        return F128_NAN;
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return x;
+    }
+
+    int32_t exp = p.exp - F128_BIAS;
+    rf_u128 sig = p.sig;
+    if (exp & 1)
+    {
+        sig <<= 1;
+        exp -= 1;
+    }
+
+    // Digit-by-digit integer square root of sig * 2^134: a 124-bit root
+    rf_u128 remainder = 0;
+    rf_u128 root = 0;
+    for (int pair = 123; pair >= 0; pair--)
+    {
+        unsigned bits = pair >= 67 ? (unsigned)(sig >> (2 * pair - 134)) & 3u : 0u;
+        remainder = (remainder << 2) | bits;
+        rf_u128 trial = (root << 2) | 1;
+        root <<= 1;
+        if (remainder >= trial)
+        {
+            remainder -= trial;
+            root |= 1;
+        }
+    }
+    return round_pack(false, exp / 2 + F128_BIAS, (root << 1) | (remainder != 0));
+}
+
+// 256-bit helpers for fma
+typedef struct
+{
+    rf_u128 hi;
+    rf_u128 lo;
+} u256;
+
+static u256 u256_shl(u256 x, int n)
+{
+    if (n == 0)
+    {
+        return x;
+    }
+    if (n >= 128)
+    {
+        return (u256){x.lo << (n - 128), 0};
+    }
+    return (u256){(x.hi << n) | (x.lo >> (128 - n)), x.lo << n};
+}
+
+static u256 u256_shr_sticky(u256 x, int32_t n)
+{
+    if (n <= 0)
+    {
+        return x;
+    }
+    if (n >= 256)
+    {
+        return (u256){0, (x.hi | x.lo) != 0};
+    }
+    if (n >= 128)
+    {
+        bool lost = x.lo != 0 || (n > 128 && (x.hi & (((rf_u128)1 << (n - 128)) - 1)) != 0);
+        return (u256){0, (n == 128 ? x.hi : x.hi >> (n - 128)) | lost};
+    }
+    bool lost = (x.lo & (((rf_u128)1 << n) - 1)) != 0;
+    return (u256){x.hi >> n, ((x.lo >> n) | (x.hi << (128 - n))) | lost};
+}
+
+static int u256_cmp(u256 a, u256 b)
+{
+    if (a.hi != b.hi)
+    {
+        return a.hi < b.hi ? -1 : 1;
+    }
+    return a.lo < b.lo ? -1 : (a.lo > b.lo ? 1 : 0);
+}
+
+static u256 u256_add(u256 a, u256 b)
+{
+    rf_u128 lo = a.lo + b.lo;
+    return (u256){a.hi + b.hi + (lo < a.lo), lo};
+}
+
+static u256 u256_sub(u256 a, u256 b)
+{
+    return (u256){a.hi - b.hi - (a.lo < b.lo), a.lo - b.lo};
+}
+
+rf_u128 rf_f128_soft_fma(rf_u128 a, rf_u128 b, rf_u128 c)
+{
+    f128_parts x;
+    f128_parts y;
+    f128_parts z;
+    int class_a = unpack(a, &x);
+    int class_b = unpack(b, &y);
+    int class_c = unpack(c, &z);
+    bool product_sign = x.sign != y.sign;
+    if (class_a == F128_CLASS_NAN || class_b == F128_CLASS_NAN || class_c == F128_CLASS_NAN)
+    {
+        return quiet(class_a == F128_CLASS_NAN ? a : class_b == F128_CLASS_NAN ? b : c);
+    }
+    if (class_a == F128_CLASS_INF || class_b == F128_CLASS_INF)
+    {
+        if (class_a == F128_CLASS_ZERO || class_b == F128_CLASS_ZERO)
+        {
+            return F128_NAN;
+        }
+        if (class_c == F128_CLASS_INF && z.sign != product_sign)
+        {
+            return F128_NAN;
+        }
+        return (product_sign ? F128_SIGN : 0) | F128_INF;
+    }
+    if (class_c == F128_CLASS_INF)
+    {
+        return c;
+    }
+    if (class_a == F128_CLASS_ZERO || class_b == F128_CLASS_ZERO)
+    {
+        if (class_c == F128_CLASS_ZERO)
+        {
+            return product_sign && z.sign ? F128_SIGN : 0;
+        }
+        return c;
+    }
+    if (class_c == F128_CLASS_ZERO)
+    {
+        return rf_f128_soft_mul(a, b);
+    }
+
+    // Exact product with its leading bit at 224/225; c placed at 224
+    u256 product;
+    mul_wide(x.sig, y.sig, &product.hi, &product.lo);
+    int32_t exp = x.exp + y.exp - F128_BIAS;
+    u256 addend = {z.sig >> 16, z.sig << 112};
+
+    // Align without losing bits while both may still cancel: shift the larger
+    // operand left into the 29 spare bits, otherwise shift the smaller right
+    int32_t diff = z.exp - exp;
+    if (diff > 0 && diff <= 28)
+    {
+        addend = u256_shl(addend, diff);
+    }
+    else if (diff > 28)
+    {
+        product = u256_shr_sticky(product, diff);
+        exp = z.exp;
+    }
+    else
+    {
+        addend = u256_shr_sticky(addend, -diff);
+    }
+
+    bool sign = product_sign;
+    u256 sum;
+    if (product_sign == z.sign)
+    {
+        sum = u256_add(product, addend);
+    }
+    else if (u256_cmp(product, addend) >= 0)
+    {
+        sum = u256_sub(product, addend);
+    }
+    else
+    {
+        sum = u256_sub(addend, product);
+        sign = z.sign;
+    }
+    if (sum.hi == 0 && sum.lo == 0)
+    {
+        return 0;
+    }
+
+    // Bring the leading bit to 124 in a single 128-bit word
+    int leading = sum.hi ? 255 - clz128(sum.hi) : 127 - clz128(sum.lo);
+    rf_u128 sig;
+    if (leading >= 124)
+    {
+        sig = u256_shr_sticky(sum, leading - 124).lo;
+    }
+    else
+    {
+        sig = sum.lo << (124 - leading);
+    }
+    return round_pack(sign, exp + (leading - 224), sig);
+}
+
+// ============================================================================
+// Conversions
+// ============================================================================
+
+rf_u128 rf_f128_soft_from_f64(double value)
+{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    rf_u128 sign = (rf_u128)(bits >> 63) << 127;
+    uint32_t exp = (uint32_t)(bits >> 52) & 0x7ffu;
+    uint64_t frac = bits & ((UINT64_C(1) << 52) - 1);
+    if (exp == 0x7ff)
+    {
+        return sign | F128_INF | ((rf_u128)frac << 60) | (frac ? F128_QUIET : 0);
+    }
+    if (exp == 0)
+    {
+        if (frac == 0)
+        {
+            return sign;
+        }
+        int shift = __builtin_clzll(frac) - 11;
+        frac = (frac << shift) & ((UINT64_C(1) << 52) - 1);
+        exp = 1 - (uint32_t)shift;
+    }
+    return sign | ((rf_u128)(exp + F128_BIAS - 1023) << 112) | ((rf_u128)frac << 60);
+}
+
+double rf_f128_soft_to_f64(rf_u128 bits)
+{
+    f128_parts p;
+    int cls = unpack(bits, &p);
+    uint64_t sign = p.sign ? UINT64_C(1) << 63 : 0;
+    uint64_t out;
+    if (cls == F128_CLASS_NAN)
+    {
+        out = sign | UINT64_C(0x7ff8000000000000) | (uint64_t)((bits & F128_FRAC_MASK) >> 60);
+    }
+    else if (cls == F128_CLASS_INF)
+    {
+        out = sign | UINT64_C(0x7ff0000000000000);
+    }
+    else if (cls == F128_CLASS_ZERO)
+    {
+        out = sign;
+    }
+    else
+    {
+        // Keep 53 of the 113 bits, more for double subnormals
+        int32_t exp = p.exp - F128_BIAS + 1023;
+        int32_t shift = 60;
+        if (exp < 1)
+        {
+            shift += 1 - exp;
+            exp = 1;
+        }
+
+        uint64_t kept = 0;
+        bool round_bit = false;
+        bool sticky = true;
+        if (shift < 128)
+        {
+            kept = (uint64_t)(p.sig >> shift);
+            round_bit = ((p.sig >> (shift - 1)) & 1) != 0;
+            sticky = (p.sig & (((rf_u128)1 << (shift - 1)) - 1)) != 0;
+        }
+        if (round_bit && (sticky || (kept & 1)))
+        {
+            kept++;
+        }
+        out = exp >= 0x7ff ? sign | UINT64_C(0x7ff0000000000000)
+                           : sign | (((uint64_t)(exp - 1) << 52) + kept);
+    }
+    double value;
+    memcpy(&value, &out, sizeof(value));
+    return value;
+}
+
+// ============================================================================
+// Transcendentals
+// Argument reduction, then a Horner polynomial in the soft arithmetic.
+// Coefficients are binary128 roundings of the exact series terms.
+// ============================================================================
+
+#define ADD rf_f128_soft_add
+#define MUL rf_f128_soft_mul
+#define FMA rf_f128_soft_fma
+#define SUB rf_f128_soft_sub
+
+static const rf_u128 ln2_hi = RF_F128_BITS(0x3ffe62e42fefa39eu, 0xf35793c7673007e6u);
+static const rf_u128 ln2_lo = RF_F128_BITS(0xbf8a2a17e1979b31u, 0xace93a4ebe5d148fu);
+static const rf_u128 sqrt2 = RF_F128_BITS(0x3fff6a09e667f3bcu, 0xc908b2fb1366ea95u);
+
+// pi/2 split into three parts; k * part is exact inside fma
+static const rf_u128 pio2_1 = RF_F128_BITS(0x3fff921fb54442d1u, 0x8469898cc51701b8u);
+static const rf_u128 pio2_2 = RF_F128_BITS(0x3f8ccd129024e088u, 0xa67cc74020bbea64u);
+static const rf_u128 pio2_3 = RF_F128_BITS(0xbf1a3b19376bad7du, 0xe19c72fec8841abau);
+
+// 1/13! .. 1/2!
+static const rf_u128 exp_coefficients[] = {
+    RF_F128_BITS(0x3fde6124613a86d0u, 0x97ca38331d23af68u),
+    RF_F128_BITS(0x3fe21eed8eff8d89u, 0x7b544da987acfe85u),
+    RF_F128_BITS(0x3fe5ae64567f544eu, 0x38fe747e4b837dc7u),
+    RF_F128_BITS(0x3fe927e4fb7789f5u, 0xc72ef016d3ea6679u),
+    RF_F128_BITS(0x3fec71de3a556c73u, 0x38faac1c88e50017u),
+    RF_F128_BITS(0x3fefa01a01a01a01u, 0xa01a01a01a01a01au),
+    RF_F128_BITS(0x3ff2a01a01a01a01u, 0xa01a01a01a01a01au),
+    RF_F128_BITS(0x3ff56c16c16c16c1u, 0x6c16c16c16c16c17u),
+    RF_F128_BITS(0x3ff8111111111111u, 0x1111111111111111u),
+    RF_F128_BITS(0x3ffa555555555555u, 0x5555555555555555u),
+    RF_F128_BITS(0x3ffc555555555555u, 0x5555555555555555u),
+    RF_F128_BITS(0x3ffe000000000000u, 0x0000000000000000u),
+};
+
+// 2/49 .. 2/3: 2*atanh(s) = 2s + s^3 * (2/3 + 2/5 s^2 + ...)
+static const rf_u128 log_coefficients[] = {
+    RF_F128_BITS(0x3ffa4e5e0a72f053u, 0x97829cbc14e5e0a7u),
+    RF_F128_BITS(0x3ffa5c9882b93105u, 0x72620ae4c415c988u),
+    RF_F128_BITS(0x3ffa6c16c16c16c1u, 0x6c16c16c16c16c17u),
+    RF_F128_BITS(0x3ffa7d05f417d05fu, 0x417d05f417d05f41u),
+    RF_F128_BITS(0x3ffa8f9c18f9c18fu, 0x9c18f9c18f9c18fau),
+    RF_F128_BITS(0x3ffaa41a41a41a41u, 0xa41a41a41a41a41au),
+    RF_F128_BITS(0x3ffabacf914c1bacu, 0xf914c1bacf914c1cu),
+    RF_F128_BITS(0x3ffad41d41d41d41u, 0xd41d41d41d41d41du),
+    RF_F128_BITS(0x3ffaf07c1f07c1f0u, 0x7c1f07c1f07c1f08u),
+    RF_F128_BITS(0x3ffb084210842108u, 0x4210842108421084u),
+    RF_F128_BITS(0x3ffb1a7b9611a7b9u, 0x611a7b9611a7b961u),
+    RF_F128_BITS(0x3ffb2f684bda12f6u, 0x84bda12f684bda13u),
+    RF_F128_BITS(0x3ffb47ae147ae147u, 0xae147ae147ae147bu),
+    RF_F128_BITS(0x3ffb642c8590b216u, 0x42c8590b21642c86u),
+    RF_F128_BITS(0x3ffb861861861861u, 0x8618618618618618u),
+    RF_F128_BITS(0x3ffbaf286bca1af2u, 0x86bca1af286bca1bu),
+    RF_F128_BITS(0x3ffbe1e1e1e1e1e1u, 0xe1e1e1e1e1e1e1e2u),
+    RF_F128_BITS(0x3ffc111111111111u, 0x1111111111111111u),
+    RF_F128_BITS(0x3ffc3b13b13b13b1u, 0x3b13b13b13b13b14u),
+    RF_F128_BITS(0x3ffc745d1745d174u, 0x5d1745d1745d1746u),
+    RF_F128_BITS(0x3ffcc71c71c71c71u, 0xc71c71c71c71c71cu),
+    RF_F128_BITS(0x3ffd249249249249u, 0x2492492492492492u),
+    RF_F128_BITS(0x3ffd999999999999u, 0x999999999999999au),
+    RF_F128_BITS(0x3ffe555555555555u, 0x5555555555555555u),
+};
+
+// -1/33! .. -1/3! with alternating signs: sin r = r + r^3 * S(r^2)
+static const rf_u128 sin_coefficients[] = {
+    RF_F128_BITS(0x3f843981254dd0d5u, 0x1b5382cdffa97422u),
+    RF_F128_BITS(0xbf8e434d2e783f5bu, 0xc42e1ee46fa6bfc4u),
+    RF_F128_BITS(0x3f98259f98b4358au, 0xd7abe30e7766f129u),
+    RF_F128_BITS(0xbfa1d1ab1c2dcceau, 0x320a9a18f15d4277u),
+    RF_F128_BITS(0x3fab3f3ccdd165fau, 0x8d4e44a419776f11u),
+    RF_F128_BITS(0xbfb4761b41316381u, 0x9d97b8704dd7f628u),
+    RF_F128_BITS(0x3fbd71b8ef6dcf57u, 0x18bef146fcee6e45u),
+    RF_F128_BITS(0xbfc62f49b4681415u, 0x724ca1ec3b7b9675u),
+    RF_F128_BITS(0x3fce952c77030ad4u, 0xa6b2605197771b00u),
+    RF_F128_BITS(0xbfd6ae7f3e733b81u, 0xf11d8656b0ee8cb0u),
+    RF_F128_BITS(0x3fde6124613a86d0u, 0x97ca38331d23af68u),
+    RF_F128_BITS(0xbfe5ae64567f544eu, 0x38fe747e4b837dc7u),
+    RF_F128_BITS(0x3fec71de3a556c73u, 0x38faac1c88e50017u),
+    RF_F128_BITS(0xbff2a01a01a01a01u, 0xa01a01a01a01a01au),
+    RF_F128_BITS(0x3ff8111111111111u, 0x1111111111111111u),
+    RF_F128_BITS(0xbffc555555555555u, 0x5555555555555555u),
+};
+
+// 1/32! .. -1/2!: cos r = 1 + r^2 * C(r^2)
+static const rf_u128 cos_coefficients[] = {
+    RF_F128_BITS(0x3f89434d2e783f5bu, 0xc42e1ee46fa6bfc4u),
+    RF_F128_BITS(0xbf933932c5047d60u, 0xe60caded4c2989c5u),
+    RF_F128_BITS(0x3f9d0a18a2635085u, 0xd373c5c51c354a8du),
+    RF_F128_BITS(0xbfa688e85fc6a4e5u, 0x9a38f2050ba6b015u),
+    RF_F128_BITS(0x3faff2cf01972f57u, 0x7cca4b4067ca9d8au),
+    RF_F128_BITS(0xbfb90ce396db7f85u, 0x29450c90b7f338ecu),
+    RF_F128_BITS(0x3fc1e542ba402022u, 0x507a9cad2bf8f0bbu),
+    RF_F128_BITS(0xbfca6827863b97d9u, 0x77bb004886a2c2abu),
+    RF_F128_BITS(0x3fd2ae7f3e733b81u, 0xf11d8656b0ee8cb0u),
+    RF_F128_BITS(0xbfda93974a8c07c9u, 0xd20badf145dfa3e5u),
+    RF_F128_BITS(0x3fe21eed8eff8d89u, 0x7b544da987acfe85u),
+    RF_F128_BITS(0xbfe927e4fb7789f5u, 0xc72ef016d3ea6679u),
+    RF_F128_BITS(0x3fefa01a01a01a01u, 0xa01a01a01a01a01au),
+    RF_F128_BITS(0xbff56c16c16c16c1u, 0x6c16c16c16c16c17u),
+    RF_F128_BITS(0x3ffa555555555555u, 0x5555555555555555u),
+    RF_F128_BITS(0xbffe000000000000u, 0x0000000000000000u),
+};
+
+#define COUNT_OF(array) (sizeof(array) / sizeof((array)[0]))
+
+static rf_u128 horner(const rf_u128* coefficients, size_t count, rf_u128 x)
+{
+    rf_u128 sum = coefficients[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        sum = FMA(sum, x, coefficients[i]);
+    }
+    return sum;
+}
+
+rf_u128 rf_f128_soft_exp(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return p.sign ? 0 : F128_INF;
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return F128_ONE;
+    }
+
+    // Past these, the result is certainly infinite or rounds to zero
+    double estimate = rf_f128_soft_to_f64(x);
+    if (estimate > 11360.0)
+    {
+        return F128_INF;
+    }
+    if (estimate < -11450.0)
+    {
+        return 0;
+    }
+
+    // x = k ln2 + r with |r| <= ln2/2
+    int64_t k = (int64_t)nearbyint(estimate * 1.4426950408889634);
+    rf_u128 minus_k = negate(from_i64(k));
+    rf_u128 r = FMA(minus_k, ln2_hi, x);
+    r = FMA(minus_k, ln2_lo, r);
+
+    // expm1 on r/256, then doubled back up: expm1(2s) = expm1(s) * (2 + expm1(s))
+    rf_u128 s = scale2(r, -8);
+    rf_u128 expm1 = FMA(MUL(s, s), horner(exp_coefficients, COUNT_OF(exp_coefficients), s), s);
+    for (int i = 0; i < 8; i++)
+    {
+        expm1 = FMA(expm1, expm1, scale2(expm1, 1));
+    }
+    rf_u128 result = ADD(F128_ONE, expm1);
+
+    // Scale in two steps so a subnormal result is rounded only once
+    if (k < -16000)
+    {
+        result = scale2(result, -16000);
+        k += 16000;
+    }
+    return scale2(result, (int32_t)k);
+}
+
+// log(x) as hi + lo: the extra bits keep pow's y * log(x) accurate
+static rf_u128 log_parts(f128_parts p, rf_u128* lo)
+{
+    // x = m * 2^e with m in [sqrt(1/2), sqrt(2))
+    int32_t e = p.exp - F128_BIAS;
+    rf_u128 m = ((rf_u128)F128_BIAS << 112) | (p.sig & F128_FRAC_MASK);
+    if (m > sqrt2)
+    {
+        m = ((rf_u128)(F128_BIAS - 1) << 112) | (p.sig & F128_FRAC_MASK);
+        e++;
+    }
+
+    // log m = 2 atanh(s), s = (m - 1) / (m + 1), with s carried as s + s_lo.
+    // m - 1 is exact, m + 1 = u + u_err exactly, and f - s * u is exact in
+    // the fma because s is the correctly rounded quotient.
+    rf_u128 f = SUB(m, F128_ONE);
+    rf_u128 u = ADD(m, F128_ONE);
+    rf_u128 u_err = SUB(m, SUB(u, F128_ONE));
+    rf_u128 s = rf_f128_soft_div(f, u);
+    rf_u128 remainder = FMA(negate(s), u, f);
+    remainder = FMA(negate(s), u_err, remainder);
+    rf_u128 s_lo = rf_f128_soft_div(remainder, u);
+
+    rf_u128 z = MUL(s, s);
+    rf_u128 two_s = scale2(s, 1);
+    rf_u128 tail = FMA(MUL(s, z), horner(log_coefficients, COUNT_OF(log_coefficients), z),
+        scale2(s_lo, 1));
+    rf_u128 log_m = ADD(two_s, tail);
+    rf_u128 log_m_lo = SUB(tail, SUB(log_m, two_s));
+
+    // + e ln2, recovering the rounding error of the final sum
+    rf_u128 ek = from_i64(e);
+    rf_u128 hi = FMA(ek, ln2_hi, log_m);
+    if (lo != NULL)
+    {
+        rf_u128 error = ADD(log_m, FMA(ek, ln2_hi, negate(hi)));
+        *lo = ADD(error, FMA(ek, ln2_lo, log_m_lo));
+    }
+    return hi;
+}
+
+rf_u128 rf_f128_soft_log(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return F128_SIGN | F128_INF;
+    }
+    if (p.sign)
+    {
+        return F128_NAN;
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return x;
+    }
+    if (x == F128_ONE)
+    {
+        return 0;
+    }
+    return log_parts(p, NULL);
+}
+
+// r = x - k pi/2; returns k mod 4
+static int reduce_pio2(rf_u128 x, rf_u128* r)
+{
+    double estimate = rf_f128_soft_to_f64(x);
+    if (fabs(estimate) < 0.7853981633974483)
+    {
+        *r = x;
+        return 0;
+    }
+    double k = nearbyint(estimate * 0.6366197723675814);
+    rf_u128 minus_k = negate(rf_f128_soft_from_f64(k));
+    rf_u128 reduced = FMA(minus_k, pio2_1, x);
+    reduced = FMA(minus_k, pio2_2, reduced);
+    *r = FMA(minus_k, pio2_3, reduced);
+    return (int)((int64_t)fmod(k, 4.0) & 3);
+}
+
+static rf_u128 sin_kernel(rf_u128 r)
+{
+    rf_u128 z = MUL(r, r);
+    return FMA(MUL(r, z), horner(sin_coefficients, COUNT_OF(sin_coefficients), z), r);
+}
+
+static rf_u128 cos_kernel(rf_u128 r)
+{
+    rf_u128 z = MUL(r, r);
+    return FMA(z, horner(cos_coefficients, COUNT_OF(cos_coefficients), z), F128_ONE);
+}
+
+rf_u128 rf_f128_soft_sin(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return F128_NAN;
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return x;
+    }
+
+    rf_u128 r;
+    switch (reduce_pio2(x, &r))
+    {
+        case 0: return sin_kernel(r);
+        case 1: return cos_kernel(r);
+        case 2: return negate(sin_kernel(r));
+        default: return negate(cos_kernel(r));
+    }
+}
+
+rf_u128 rf_f128_soft_cos(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return F128_NAN;
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return F128_ONE;
+    }
+
+    rf_u128 r;
+    switch (reduce_pio2(x, &r))
+    {
+        case 0: return cos_kernel(r);
+        case 1: return negate(sin_kernel(r));
+        case 2: return negate(cos_kernel(r));
+        default: return sin_kernel(r);
+    }
+}
+
+rf_u128 rf_f128_soft_tan(rf_u128 x)
+{
+    f128_parts p;
+    int cls = unpack(x, &p);
+    if (cls == F128_CLASS_NAN)
+    {
+        return quiet(x);
+    }
+    if (cls == F128_CLASS_INF)
+    {
+        return F128_NAN;
+    }
+    if (cls == F128_CLASS_ZERO)
+    {
+        return x;
+    }
+
+    rf_u128 r;
+    int quadrant = reduce_pio2(x, &r);
+    rf_u128 sine = sin_kernel(r);
+    rf_u128 cosine = cos_kernel(r);
+    return quadrant & 1 ? negate(rf_f128_soft_div(cosine, sine))
+                        : rf_f128_soft_div(sine, cosine);
+}
+
+// 0 for non-integers, 1 for odd integers, 2 for even integers (and zero)
+static int integer_kind(const f128_parts* p, int cls)
+{
+    if (cls != F128_CLASS_FINITE)
+    {
+        return 2;
+    }
+    int32_t exp = p->exp - F128_BIAS;
+    if (exp < 0)
+    {
+        return 0;
+    }
+    if (exp > 112)
+    {
+        return 2;
+    }
+    if ((p->sig & ((F128_IMPLICIT >> exp) - 1)) != 0)
+    {
+        return 0;
+    }
+    return ((p->sig >> (112 - exp)) & 1) ? 1 : 2;
+}
+
+rf_u128 rf_f128_soft_pow(rf_u128 base, rf_u128 exponent)
+{
+    f128_parts x;
+    f128_parts y;
+    int class_x = unpack(base, &x);
+    int class_y = unpack(exponent, &y);
+
+    // C99 Annex F special cases
+    if (class_y == F128_CLASS_ZERO || base == F128_ONE)
+    {
+        return F128_ONE;
+    }
+    if (class_x == F128_CLASS_NAN || class_y == F128_CLASS_NAN)
+    {
+        return quiet(class_x == F128_CLASS_NAN ? base : exponent);
+    }
+
+    int kind = integer_kind(&y, class_y);
+    bool odd = kind == 1;
+    rf_u128 sign = x.sign && odd ? F128_SIGN : 0;
+    if (class_y == F128_CLASS_INF)
+    {
+        if (base == (F128_SIGN | F128_ONE))
+        {
+            return F128_ONE;
+        }
+        bool below_one = (base & ~F128_SIGN) < F128_ONE;
+        return below_one == y.sign ? F128_INF : 0;
+    }
+    if (class_x == F128_CLASS_ZERO)
+    {
+        return y.sign ? (odd ? (base & F128_SIGN) : 0) | F128_INF : (odd ? base : 0);
+    }
+    if (class_x == F128_CLASS_INF)
+    {
+        return sign | (y.sign ? 0 : F128_INF);
+    }
+    if (x.sign && kind == 0)
+    {
+        return F128_NAN;
+    }
+
+    rf_u128 magnitude = base & ~F128_SIGN;
+
+    // |y| < 4 by multiplication: at most two roundings
+    int32_t exp = y.exp - F128_BIAS;
+    if (kind != 0 && exp < 2)
+    {
+        uint32_t n = (uint32_t)(y.sig >> (112 - exp));
+        rf_u128 result = F128_ONE;
+        rf_u128 square = magnitude;
+        while (n != 0)
+        {
+            if (n & 1)
+            {
+                result = MUL(result, square);
+            }
+            square = MUL(square, square);
+            n >>= 1;
+        }
+
+        // Overflowed or subnormal intermediates fall through to exp/log
+        uint32_t field = (uint32_t)(result >> 112);
+        if (!y.sign && field < F128_EXP_MAX)
+        {
+            return sign | result;
+        }
+        if (y.sign && field != 0 && field < F128_EXP_MAX)
+        {
+            return sign | rf_f128_soft_div(F128_ONE, result);
+        }
+    }
+
+    // exp(y log|x|), carrying log's and the product's rounding errors along
+    f128_parts m;
+    unpack(magnitude, &m);
+    rf_u128 log_lo;
+    rf_u128 log_hi = log_parts(m, &log_lo);
+    rf_u128 product = MUL(exponent, log_hi);
+    if (fabs(rf_f128_soft_to_f64(product)) > 12000.0)
+    {
+        return sign | rf_f128_soft_exp(product);  // certain overflow or underflow
+    }
+    rf_u128 product_lo = FMA(exponent, log_hi, negate(product));
+    product_lo = FMA(exponent, log_lo, product_lo);
+    rf_u128 result = rf_f128_soft_exp(product);
+    return sign | FMA(result, product_lo, result);
+}
+
+// ============================================================================
+// Decimal Conversion
+// Exact big-integer arithmetic: value = digits * 10^e is turned into 125
+// significant bits plus a sticky bit, then rounded once by round_pack.
+// ============================================================================
+
+// Enough for the largest finite value (sig * 2^16271, or up to 10^4933 when
+// parsing) plus the limb big_div normalizes into; ~2 KB of stack per number
+#define BIG_LIMBS 544
+
+typedef struct
+{
+    int32_t size;
+    uint32_t limbs[BIG_LIMBS];
+} big_int;
+
+static void big_set_u128(big_int* b, rf_u128 value)
+{
+    b->size = 0;
+    while (value != 0)
+    {
+        b->limbs[b->size++] = (uint32_t)value;
+        value >>= 32;
+    }
+}
+
+static void big_mul_small(big_int* b, uint64_t factor)
+{
+    rf_u128 carry = 0;
+    for (int32_t i = 0; i < b->size; i++)
+    {
+        rf_u128 product = (rf_u128)b->limbs[i] * factor + carry;
+        b->limbs[i] = (uint32_t)product;
+        carry = product >> 32;
+    }
+    for (; carry != 0; carry >>= 32)
+    {
+        b->limbs[b->size++] = (uint32_t)carry;
+    }
+}
+
+static void big_mul_pow5(big_int* b, int32_t n)
+{
+    static const uint64_t pow5[14] = {1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u,
+        390625u, 1953125u, 9765625u, 48828125u, 244140625u, 1220703125u};
+    for (; n >= 27; n -= 27)
+    {
+        big_mul_small(b, 7450580596923828125u);  // 5^27
+    }
+    if (n >= 14)
+    {
+        big_mul_small(b, pow5[13]);
+        n -= 13;
+    }
+    if (n > 0)
+    {
+        big_mul_small(b, pow5[n]);
+    }
+}
+
+static void big_shl(big_int* b, int32_t bits)
+{
+    if (b->size == 0 || bits == 0)
+    {
+        return;
+    }
+    int32_t words = bits / 32;
+    int shift = bits % 32;
+    b->limbs[b->size + words] = 0;
+    for (int32_t i = b->size - 1; i >= 0; i--)
+    {
+        uint64_t wide = (uint64_t)b->limbs[i] << shift;
+        b->limbs[i + words + 1] |= (uint32_t)(wide >> 32);
+        b->limbs[i + words] = (uint32_t)wide;
+    }
+    memset(b->limbs, 0, sizeof(uint32_t) * (size_t)words);
+    b->size += words + 1;
+    while (b->size > 0 && b->limbs[b->size - 1] == 0)
+    {
+        b->size--;
+    }
+}
+
+// b >>= bits, returning whether any bit shifted out was set
+static bool big_shr(big_int* b, int32_t bits)
+{
+    int32_t words = bits / 32;
+    int shift = bits % 32;
+    if (words >= b->size)
+    {
+        bool lost = b->size != 0;
+        b->size = 0;
+        return lost;
+    }
+
+    bool lost = (b->limbs[words] & ((1u << shift) - 1)) != 0;
+    for (int32_t i = 0; i < words; i++)
+    {
+        lost |= b->limbs[i] != 0;
+    }
+    for (int32_t i = words; i < b->size; i++)
+    {
+        uint64_t next = i + 1 < b->size ? b->limbs[i + 1] : 0;
+        b->limbs[i - words] = (uint32_t)(((next << 32) | b->limbs[i]) >> shift);
+    }
+    b->size -= words;
+    while (b->size > 0 && b->limbs[b->size - 1] == 0)
+    {
+        b->size--;
+    }
+    return lost;
+}
+
+static int32_t big_bit_length(const big_int* b)
+{
+    if (b->size == 0)
+    {
+        return 0;
+    }
+    return b->size * 32 - __builtin_clz(b->limbs[b->size - 1]);
+}
+
+// q = n / d, returning whether the remainder is non-zero. Long division a
+// limb at a time (Knuth's algorithm D), so the cost is the quotient's limbs
+// times the divisor's rather than one pass per quotient bit. n and d are
+// left normalized and unusable; d must be non-zero.
+static bool big_div(big_int* n, big_int* d, big_int* q)
+{
+    int32_t dn = d->size;
+    int32_t nn = n->size;
+    q->size = 0;
+    if (nn < dn)
+    {
+        return nn != 0;
+    }
+
+    if (dn == 1)
+    {
+        uint64_t remainder = 0;
+        for (int32_t i = nn - 1; i >= 0; i--)
+        {
+            uint64_t current = (remainder << 32) | n->limbs[i];
+            q->limbs[i] = (uint32_t)(current / d->limbs[0]);
+            remainder = current % d->limbs[0];
+        }
+        q->size = nn;
+        while (q->size > 0 && q->limbs[q->size - 1] == 0)
+        {
+            q->size--;
+        }
+        return remainder != 0;
+    }
+
+    // Normalize so the divisor's top limb has its high bit set; n gains a limb
+    int shift = __builtin_clz(d->limbs[dn - 1]);
+    uint32_t* v = d->limbs;
+    uint32_t* u = n->limbs;
+    for (int32_t i = dn - 1; i > 0; i--)
+    {
+        v[i] = (uint32_t)(((uint64_t)v[i] << shift) | ((uint64_t)v[i - 1] >> (32 - shift)));
+    }
+    v[0] <<= shift;
+    u[nn] = (uint32_t)((uint64_t)u[nn - 1] >> (32 - shift));
+    for (int32_t i = nn - 1; i > 0; i--)
+    {
+        u[i] = (uint32_t)(((uint64_t)u[i] << shift) | ((uint64_t)u[i - 1] >> (32 - shift)));
+    }
+    u[0] <<= shift;
+
+    for (int32_t j = nn - dn; j >= 0; j--)
+    {
+        // Estimate from the top two limbs; at most one too large after the correction
+        uint64_t top = ((uint64_t)u[j + dn] << 32) | u[j + dn - 1];
+        uint64_t qhat = top / v[dn - 1];
+        uint64_t rhat = top % v[dn - 1];
+        while ((qhat >> 32) != 0 || qhat * v[dn - 2] > ((rhat << 32) | u[j + dn - 2]))
+        {
+            qhat--;
+            rhat += v[dn - 1];
+            if ((rhat >> 32) != 0)
+            {
+                break;
+            }
+        }
+
+        int64_t borrow = 0;
+        for (int32_t i = 0; i < dn; i++)
+        {
+            uint64_t product = qhat * v[i];
+            int64_t difference = (int64_t)u[i + j] - borrow - (int64_t)(product & 0xffffffffu);
+            u[i + j] = (uint32_t)difference;
+            borrow = (int64_t)(product >> 32) - (difference >> 32);
+        }
+        int64_t difference = (int64_t)u[j + dn] - borrow;
+        u[j + dn] = (uint32_t)difference;
+
+        if (difference < 0)
+        {
+            // Estimate was one too large: add the divisor back
+            qhat--;
+            uint64_t carry = 0;
+            for (int32_t i = 0; i < dn; i++)
+            {
+                uint64_t sum = (uint64_t)u[i + j] + v[i] + carry;
+                u[i + j] = (uint32_t)sum;
+                carry = sum >> 32;
+            }
+            u[j + dn] += (uint32_t)carry;
+        }
+        q->limbs[j] = (uint32_t)qhat;
+    }
+
+    q->size = nn - dn + 1;
+    while (q->size > 0 && q->limbs[q->size - 1] == 0)
+    {
+        q->size--;
+    }
+    for (int32_t i = 0; i < dn; i++)
+    {
+        if (u[i] != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// b /= 10^9, returning the remainder
+static uint32_t big_divmod_1e9(big_int* b)
+{
+    uint64_t remainder = 0;
+    for (int32_t i = b->size - 1; i >= 0; i--)
+    {
+        uint64_t current = (remainder << 32) | b->limbs[i];
+        b->limbs[i] = (uint32_t)(current / 1000000000u);
+        remainder = current % 1000000000u;
+    }
+    while (b->size > 0 && b->limbs[b->size - 1] == 0)
+    {
+        b->size--;
+    }
+    return (uint32_t)remainder;
+}
+
+// The top 125 of length bits as a working significand, sticky in bit 0
+static rf_u128 big_top_bits(const big_int* b, int32_t length)
+{
+    if (length <= 125)
+    {
+        rf_u128 value = 0;
+        for (int32_t i = b->size - 1; i >= 0; i--)
+        {
+            value = (value << 32) | b->limbs[i];
+        }
+        return value << (125 - length);
+    }
+
+    int32_t start = length - 125;
+    int32_t word = start / 32;
+    int offset = start % 32;
+    rf_u128 value = 0;
+    for (int32_t i = b->size - 1; i > word; i--)
+    {
+        value = (value << 32) | b->limbs[i];
+    }
+    value = (value << (32 - offset)) | (b->limbs[word] >> offset);
+
+    bool sticky = offset != 0 && (b->limbs[word] & ((1u << offset) - 1)) != 0;
+    for (int32_t i = 0; i < word && !sticky; i++)
+    {
+        sticky = b->limbs[i] != 0;
+    }
+    return value | sticky;
+}
+
+static int decimal_digit_count(rf_u128 value)
+{
+    int count = 0;
+    for (; value != 0; value /= 10)
+    {
+        count++;
+    }
+    return count;
+}
+
+// |digits * 10^exponent| correctly rounded
+static rf_u128 decimal_to_bits(rf_u128 digits, int32_t exponent)
+{
+    if (digits == 0)
+    {
+        return 0;
+    }
+
+    // F128_MAX is 1.19e4932 and half the smallest subnormal 3.2e-4966
+    int32_t magnitude = exponent + decimal_digit_count(digits) - 1;
+    if (magnitude > 4932)
+    {
+        return F128_INF;
+    }
+    if (magnitude < -4967)
+    {
+        return 0;
+    }
+
+    big_int n;
+    big_set_u128(&n, digits);
+    if (exponent >= 0)
+    {
+        big_mul_pow5(&n, exponent);
+        big_shl(&n, exponent);
+        int32_t length = big_bit_length(&n);
+        return round_pack(false, length - 1 + F128_BIAS, big_top_bits(&n, length));
+    }
+
+    // q = floor(digits * 2^k / 10^-exponent), sized to land in [2^124, 2^126).
+    // 10^-exponent is 5^-exponent * 2^-exponent, so n is shifted that much less.
+    big_int divisor;
+    big_set_u128(&divisor, 1);
+    big_mul_pow5(&divisor, -exponent);
+    int32_t shift = 125 + big_bit_length(&divisor) - big_bit_length(&n);
+    int32_t k = shift - exponent;
+    big_shl(&n, shift);
+
+    big_int q;
+    bool sticky = big_div(&n, &divisor, &q);
+    rf_u128 quotient = 0;
+    for (int32_t i = q.size - 1; i >= 0; i--)
+    {
+        quotient = (quotient << 32) | q.limbs[i];
+    }
+
+    if (quotient >> 125)
+    {
+        sticky |= (quotient & 1) != 0;
+        quotient >>= 1;
+        k--;
+    }
+    return round_pack(false, 124 - k + F128_BIAS, quotient | sticky);
+}
+
+// Leading decimal digits of sig * 2^e2: 51 to 53 exact digits in window,
+// plus whether any digit past the window is non-zero
+static int exact_digits(rf_u128 sig, int32_t e2, char* window, int32_t* exponent10, bool* sticky)
+{
+    // The digits of sig * 2^e2, or of sig * 5^-e2 scaled by 10^e2, are first cut to
+    // floor(value / 10^drop). A lower bound on log10(value) from log10(2) and log10(5) in
+    // 2^-20 fixed point keeps the quotient at 51..53 digits, so only those are converted.
+    int32_t m = e2 < 0 ? -e2 : 0;
+    int32_t scale10 = e2 < 0 ? e2 : 0;
+    int32_t log2_sig = 127 - clz128(sig);
+    int64_t log10_floor =
+        ((int64_t)(log2_sig + (e2 > 0 ? e2 : 0)) * 315652 + (int64_t)m * 732923) >> 20;
+    int32_t drop = log10_floor > 50 ? (int32_t)log10_floor - 50 : 0;
+
+    big_int n;
+    big_set_u128(&n, sig);
+    if (e2 >= 0)
+    {
+        // sig * 2^(e2 - drop) / 5^drop
+        big_int divisor;
+        big_set_u128(&divisor, 1);
+        big_mul_pow5(&divisor, drop);
+        big_shl(&n, e2 - drop);
+        big_int q;
+        *sticky = big_div(&n, &divisor, &q);
+        n = q;
+    }
+    else
+    {
+        // sig * 5^(m - drop) / 2^drop: only a shift, as 5^drop divides 5^m
+        big_mul_pow5(&n, m - drop);
+        *sticky = big_shr(&n, drop);
+    }
+
+    // Nine digits at a time from the bottom
+    uint32_t chunks[6];
+    int32_t produced = 0;
+    while (n.size != 0)
+    {
+        chunks[produced++] = big_divmod_1e9(&n);
+    }
+
+    int count = 0;
+    uint32_t top = chunks[produced - 1];
+    char scratch[10];
+    int top_length = 0;
+    for (; top != 0; top /= 10)
+    {
+        scratch[top_length++] = (char)('0' + top % 10);
+    }
+    while (top_length > 0)
+    {
+        window[count++] = scratch[--top_length];
+    }
+    for (int32_t i = produced - 2; i >= 0; i--)
+    {
+        uint32_t chunk = chunks[i];
+        for (int d = 8; d >= 0; d--)
+        {
+            window[count + d] = (char)('0' + chunk % 10);
+            chunk /= 10;
+        }
+        count += 9;
+    }
+
+    *exponent10 = count - 1 + drop + scale10;
+    return count;
+}
+
+// Rounds window to precision digits, ties to even; returns the exponent10
+// of the rounded digits, which moves up when 9.99... carries out
+static int32_t round_digits(const char* window, int count, bool sticky, int precision,
+    int32_t exponent10, char* out)
+{
+    for (int i = 0; i < precision; i++)
+    {
+        out[i] = i < count ? window[i] : '0';
+    }
+    if (count <= precision)
+    {
+        return exponent10;
+    }
+
+    bool beyond = sticky;
+    for (int i = precision + 1; i < count && !beyond; i++)
+    {
+        beyond = window[i] != '0';
+    }
+    char next = window[precision];
+    bool up = next > '5' || (next == '5' && (beyond || ((out[precision - 1] - '0') & 1)));
+    if (!up)
+    {
+        return exponent10;
+    }
+
+    for (int i = precision - 1; i >= 0; i--)
+    {
+        if (out[i] != '9')
+        {
+            out[i]++;
+            return exponent10;
+        }
+        out[i] = '0';
+    }
+    out[0] = '1';
+    return exponent10 + 1;
+}
+
+size_t rf_f128_soft_to_chars(rf_u128 bits, char* buffer)
+{
+    size_t special = rf_f128_layout_special(bits, buffer);
+    if (special != 0)
+    {
+        return special;
+    }
+
+    f128_parts p;
+    unpack(bits, &p);
+    char window[64];
+    int32_t exponent10;
+    bool sticky;
+    int count = exact_digits(p.sig, p.exp - F128_BIAS - 112, window, &exponent10, &sticky);
+
+    // Shortest of 33..36 digits that reads back as the same value
+    char digits[RF_F128_MAX_ROUNDTRIP_DIGITS];
+    int precision = RF_F128_MIN_ROUNDTRIP_DIGITS;
+    int32_t rounded_exponent;
+    for (;; precision++)
+    {
+        rounded_exponent = round_digits(window, count, sticky, precision, exponent10, digits);
+        if (precision == RF_F128_MAX_ROUNDTRIP_DIGITS)
+        {
+            break;
+        }
+        rf_u128 value = 0;
+        for (int i = 0; i < precision; i++)
+        {
+            value = value * 10 + (rf_u128)(digits[i] - '0');
+        }
+        if (decimal_to_bits(value, rounded_exponent - (precision - 1)) == (bits & ~F128_SIGN))
+        {
+            break;
+        }
+    }
+    return rf_f128_layout(p.sign, digits, precision, rounded_exponent, precision, buffer);
+}
+
+int rf_f128_soft_parse(const char* text, size_t length, rf_u128* out)
+{
+    rf_f128_decimal decimal;
+    int status = rf_f128_scan(text, length, &decimal);
+    if (status != RF_PARSE_OK)
+    {
+        return status;
+    }
+
+    rf_u128 sign = decimal.negative ? F128_SIGN : 0;
+    if (decimal.kind == RF_F128_TEXT_INFINITE)
+    {
+        *out = sign | F128_INF;
+        return RF_PARSE_OK;
+    }
+    if (decimal.kind == RF_F128_TEXT_NAN)
+    {
+        *out = sign | F128_NAN;
+        return RF_PARSE_OK;
+    }
+
+    rf_u128 magnitude = decimal_to_bits(decimal.digits, decimal.exponent);
+    *out = sign | magnitude;
+    return magnitude == F128_INF ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+// ============================================================================
+// Text Grammar and Layout (shared with f128.c)
+// ============================================================================
+
+static bool match_word(const char* text, size_t length, const char* word)
+{
+    size_t word_length = strlen(word);
+    if (length != word_length)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        char c = text[i];
+        if (c >= 'A' && c <= 'Z')
+        {
+            c = (char)(c - 'A' + 'a');
+        }
+        if (c != word[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#define SCAN_KEPT_DIGITS 37
+#define SCAN_EXPONENT_LIMIT 1000000
+
+int rf_f128_scan(const char* text, size_t length, rf_f128_decimal* out)
+{
+    size_t pos = 0;
+    out->negative = false;
+    out->digits = 0;
+    out->exponent = 0;
+    out->kind = RF_F128_TEXT_FINITE;
+    if (pos < length && (text[pos] == '+' || text[pos] == '-'))
+    {
+        out->negative = text[pos] == '-';
+        pos++;
+    }
+
+    const char* rest = text + pos;
+    size_t rest_length = length - pos;
+    if (match_word(rest, rest_length, "inf") || match_word(rest, rest_length, "infinity"))
+    {
+        out->kind = RF_F128_TEXT_INFINITE;
+        return RF_PARSE_OK;
+    }
+    if (match_word(rest, rest_length, "nan"))
+    {
+        out->kind = RF_F128_TEXT_NAN;
+        return RF_PARSE_OK;
+    }
+
+    // Significand: leading zeros are dropped, digits past the 37th only
+    // shift the exponent and feed the sticky digit
+    int kept = 0;
+    int64_t exponent = 0;
+    bool any_digit = false;
+    bool sticky = false;
+    bool in_fraction = false;
+    for (; pos < length; pos++)
+    {
+        char c = text[pos];
+        if (c == '.' && !in_fraction)
+        {
+            in_fraction = true;
+            continue;
+        }
+        if (c < '0' || c > '9')
+        {
+            break;
+        }
+        any_digit = true;
+        int digit = c - '0';
+        if (kept == 0 && digit == 0)
+        {
+            exponent -= in_fraction;
+            continue;
+        }
+        if (kept < SCAN_KEPT_DIGITS)
+        {
+            out->digits = out->digits * 10 + (rf_u128)digit;
+            kept++;
+            exponent -= in_fraction;
+        }
+        else
+        {
+            sticky |= digit != 0;
+            exponent += !in_fraction;
+        }
+        if (exponent < -SCAN_EXPONENT_LIMIT || exponent > SCAN_EXPONENT_LIMIT)
+        {
+            exponent = exponent < 0 ? -SCAN_EXPONENT_LIMIT : SCAN_EXPONENT_LIMIT;
+        }
+    }
+    if (!any_digit)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    if (pos < length && (text[pos] == 'e' || text[pos] == 'E'))
+    {
+        pos++;
+        bool negative_exponent = false;
+        if (pos < length && (text[pos] == '+' || text[pos] == '-'))
+        {
+            negative_exponent = text[pos] == '-';
+            pos++;
+        }
+        if (pos >= length)
+        {
+            return RF_PARSE_INVALID;
+        }
+        int64_t written = 0;
+        for (; pos < length && text[pos] >= '0' && text[pos] <= '9'; pos++)
+        {
+            if (written < SCAN_EXPONENT_LIMIT)
+            {
+                written = written * 10 + (text[pos] - '0');
+            }
+        }
+        exponent += negative_exponent ? -written : written;
+    }
+    if (pos != length)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    if (sticky)
+    {
+        out->digits = out->digits * 10 + 1;
+        exponent--;
+    }
+    if (exponent < -2 * SCAN_EXPONENT_LIMIT)
+    {
+        exponent = -2 * SCAN_EXPONENT_LIMIT;
+    }
+    if (exponent > 2 * SCAN_EXPONENT_LIMIT)
+    {
+        exponent = 2 * SCAN_EXPONENT_LIMIT;
+    }
+    out->exponent = (int32_t)exponent;
+    return RF_PARSE_OK;
+}
+
+size_t rf_f128_layout(bool negative, const char* digits, int count, int32_t exponent10,
+    int precision, char* buffer)
+{
+    while (count > 1 && digits[count - 1] == '0')
+    {
+        count--;
+    }
+
+    size_t length = 0;
+    if (negative)
+    {
+        buffer[length++] = '-';
+    }
+
+    if (exponent10 < -4 || exponent10 >= precision)
+    {
+        buffer[length++] = digits[0];
+        if (count > 1)
+        {
+            buffer[length++] = '.';
+            memcpy(buffer + length, digits + 1, (size_t)count - 1);
+            length += (size_t)count - 1;
+        }
+        buffer[length++] = 'e';
+        buffer[length++] = exponent10 < 0 ? '-' : '+';
+        int32_t magnitude = exponent10 < 0 ? -exponent10 : exponent10;
+        char scratch[8];
+        int written = 0;
+        do
+        {
+            scratch[written++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0 || written < 2);
+        while (written > 0)
+        {
+            buffer[length++] = scratch[--written];
+        }
+    }
+    else if (exponent10 >= 0)
+    {
+        for (int32_t i = 0; i <= exponent10; i++)
+        {
+            buffer[length++] = i < count ? digits[i] : '0';
+        }
+        if (count > exponent10 + 1)
+        {
+            buffer[length++] = '.';
+            for (int i = exponent10 + 1; i < count; i++)
+            {
+                buffer[length++] = digits[i];
+            }
+        }
+    }
+    else
+    {
+        buffer[length++] = '0';
+        buffer[length++] = '.';
+        for (int32_t i = -1; i > exponent10; i--)
+        {
+            buffer[length++] = '0';
+        }
+        memcpy(buffer + length, digits, (size_t)count);
+        length += (size_t)count;
+    }
+
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t rf_f128_layout_special(rf_u128 bits, char* buffer)
+{
+    const char* text;
+    rf_u128 magnitude = bits & ~F128_SIGN;
+    if (magnitude == 0)
+    {
+        text = "0";
+    }
+    else if (magnitude == F128_INF)
+    {
+        text = "inf";
+    }
+    else if (magnitude > F128_INF)
+    {
+        text = "nan";
+    }
+    else
+    {
+        return 0;
+    }
+
+    size_t length = 0;
+    if (bits & F128_SIGN)
+    {
+        buffer[length++] = '-';
+    }
+    size_t text_length = strlen(text);
+    memcpy(buffer + length, text, text_length + 1);
+    return length + text_length;
+}
+
+#endif // RF_HAS_INT128
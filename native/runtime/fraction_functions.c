@@ -0,0 +1,672 @@
+/*
+ * RazorForge Runtime - Fraction Functions
+ * Exact rational arithmetic with an inline 64-bit fast path
+ *
+ * Small fractions keep their numerator/denominator inline and only promote to
+ * rf_bigint limbs when a result no longer fits. Normalization is lazy: add/sub
+ * results are stored unreduced and reduced only when the value is observed or
+ * when reduction is the only way to stay on the fast path.
+ *
+ * Promotion needs the LibTomMath backend (HAVE_LIBTOMMATH). Without it the
+ * rf_bigint stubs are 64-bit only, so a result that leaves the inline range
+ * aborts instead of silently wrapping.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "../include/razorforge_math.h"
+
+__extension__ typedef __int128 rf_fraction_wide;
+__extension__ typedef unsigned __int128 rf_fraction_uwide;
+
+// ============================================================================
+// Binary GCD
+// ============================================================================
+
+static uint64_t gcd_u64(uint64_t a, uint64_t b)
+{
+    if (a == 0) return b;
+    if (b == 0) return a;
+
+    int shift = __builtin_ctzll(a | b);
+    a >>= __builtin_ctzll(a);
+
+    while (b != 0)
+    {
+        b >>= __builtin_ctzll(b);
+        if (a > b)
+        {
+            uint64_t t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+    }
+
+    return a << shift;
+}
+
+static int ctz_u128(rf_fraction_uwide x)
+{
+    uint64_t lo = (uint64_t)x;
+    return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((uint64_t)(x >> 64));
+}
+
+static rf_fraction_uwide gcd_u128(rf_fraction_uwide a, rf_fraction_uwide b)
+{
+    // Drop to the 64-bit loop as soon as both operands fit
+    if ((a >> 64) == 0 && (b >> 64) == 0)
+    {
+        return gcd_u64((uint64_t)a, (uint64_t)b);
+    }
+    if (a == 0) return b;
+    if (b == 0) return a;
+
+    int shift = ctz_u128(a | b);
+    a >>= ctz_u128(a);
+
+    while (b != 0)
+    {
+        b >>= ctz_u128(b);
+        if (a > b)
+        {
+            rf_fraction_uwide t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+    }
+
+    return a << shift;
+}
+
+static uint64_t abs_u64(int64_t x)
+{
+    return x < 0 ? 0 - (uint64_t)x : (uint64_t)x;
+}
+
+static rf_fraction_uwide abs_u128(rf_fraction_wide x)
+{
+    return x < 0 ? 0 - (rf_fraction_uwide)x : (rf_fraction_uwide)x;
+}
+
+// Small values use the symmetric range [-INT64_MAX, INT64_MAX] so negation never overflows
+static int fits_small(rf_fraction_wide x)
+{
+    return x <= INT64_MAX && x >= -INT64_MAX;
+}
+
+// ============================================================================
+// Representation Helpers
+// ============================================================================
+
+// Called on every path that would move a value out of the inline range
+static void require_big_backend(void)
+{
+#ifndef HAVE_LIBTOMMATH
+    fprintf(stderr, "RazorForge Runtime Error: Fraction overflow; values beyond 64 bits "
+                    "need the runtime built with LibTomMath\n");
+    abort();
+#endif
+}
+
+static void release_big(rf_fraction* f)
+{
+    if (f->big_num)
+    {
+        rf_bigint_clear(f->big_num);
+        f->big_num = NULL;
+    }
+    if (f->big_den)
+    {
+        rf_bigint_clear(f->big_den);
+        f->big_den = NULL;
+    }
+}
+
+static void store_small(rf_fraction* f, int64_t num, int64_t den, int32_t reduced)
+{
+    release_big(f);
+    f->num = num;
+    f->den = den;
+    f->reduced = reduced;
+}
+
+static void set_big_wide(rf_bigint* out, rf_fraction_wide value)
+{
+    rf_fraction_uwide magnitude = abs_u128(value);
+    uint64_t high = (uint64_t)(magnitude >> 64);
+    rf_bigint_set_u64(out, (uint64_t)magnitude);
+
+    if (high != 0)
+    {
+        rf_bigint* upper = rf_bigint_new();
+        rf_bigint_set_u64(upper, high);
+        rf_bigint_shl(upper, upper, 64);
+        rf_bigint_add(out, out, upper);
+        rf_bigint_clear(upper);
+    }
+
+    if (value < 0)
+    {
+        rf_bigint_neg(out, out);
+    }
+}
+
+// Load either representation into freshly allocated bigints
+static void load_big(const rf_fraction* f, rf_bigint** num, rf_bigint** den)
+{
+    *num = rf_bigint_new();
+    *den = rf_bigint_new();
+
+    if (f->big_num)
+    {
+        rf_bigint_copy(*num, f->big_num);
+        rf_bigint_copy(*den, f->big_den);
+    }
+    else
+    {
+        rf_bigint_set_i64(*num, f->num);
+        rf_bigint_set_i64(*den, f->den);
+    }
+}
+
+static int big_fits_small(rf_bigint* x)
+{
+    return rf_bigint_cmp_i64(x, INT64_MAX) <= 0 && rf_bigint_cmp_i64(x, -INT64_MAX) >= 0;
+}
+
+/*
+ * Takes ownership of num/den, reduces them and demotes to the inline
+ * representation when both halves fit again.
+ */
+static void store_big(rf_fraction* f, rf_bigint* num, rf_bigint* den)
+{
+    if (rf_bigint_is_neg(den))
+    {
+        rf_bigint_neg(num, num);
+        rf_bigint_neg(den, den);
+    }
+
+    rf_bigint* g = rf_bigint_new();
+    rf_bigint_gcd(g, num, den);
+    if (rf_bigint_cmp_i64(g, 1) > 0)
+    {
+        rf_bigint* rem = rf_bigint_new();
+        rf_bigint_div(num, rem, num, g);
+        rf_bigint_div(den, rem, den, g);
+        rf_bigint_clear(rem);
+    }
+    rf_bigint_clear(g);
+
+    if (big_fits_small(num) && big_fits_small(den))
+    {
+        store_small(f, rf_bigint_get_i64(num), rf_bigint_get_i64(den), 1);
+        rf_bigint_clear(num);
+        rf_bigint_clear(den);
+        return;
+    }
+
+    require_big_backend();
+    release_big(f);
+    f->big_num = num;
+    f->big_den = den;
+    f->num = 0;
+    f->den = 1;
+    f->reduced = 1;
+}
+
+/*
+ * Stores a 128-bit intermediate result, reducing it only when that keeps the
+ * value on the fast path; otherwise promotes to bigint limbs.
+ */
+static void store_wide(rf_fraction* f, rf_fraction_wide num, rf_fraction_wide den, int32_t reduced)
+{
+    if (den < 0)
+    {
+        num = -num;
+        den = -den;
+    }
+
+    if (fits_small(num) && fits_small(den))
+    {
+        store_small(f, (int64_t)num, (int64_t)den, reduced);
+        return;
+    }
+
+    if (!reduced)
+    {
+        rf_fraction_uwide g = gcd_u128(abs_u128(num), (rf_fraction_uwide)den);
+        if (g > 1)
+        {
+            num /= (rf_fraction_wide)g;
+            den /= (rf_fraction_wide)g;
+        }
+
+        if (fits_small(num) && fits_small(den))
+        {
+            store_small(f, (int64_t)num, (int64_t)den, 1);
+            return;
+        }
+    }
+
+    require_big_backend();
+    rf_bigint* big_num = rf_bigint_new();
+    rf_bigint* big_den = rf_bigint_new();
+    set_big_wide(big_num, num);
+    set_big_wide(big_den, den);
+    store_big(f, big_num, big_den);
+}
+
+static int is_big(const rf_fraction* f)
+{
+    return f->big_num != NULL;
+}
+
+// ============================================================================
+// Lifecycle Management
+// ============================================================================
+
+rf_fraction* rf_fraction_new(void)
+{
+    rf_fraction* f = (rf_fraction*)malloc(sizeof(rf_fraction));
+    if (f)
+    {
+        memset(f, 0, sizeof(rf_fraction));
+        f->den = 1;
+        f->reduced = 1;
+    }
+    return f;
+}
+
+void rf_fraction_free(rf_fraction* f)
+{
+    if (f)
+    {
+        release_big(f);
+        free(f);
+    }
+}
+
+int rf_fraction_copy(rf_fraction* dest, const rf_fraction* src)
+{
+    if (!dest || !src) return -1;
+    if (dest == src) return 0;
+
+    if (is_big(src))
+    {
+        rf_bigint* num;
+        rf_bigint* den;
+        load_big(src, &num, &den);
+        release_big(dest);
+        dest->big_num = num;
+        dest->big_den = den;
+        dest->num = 0;
+        dest->den = 1;
+        dest->reduced = src->reduced;
+        return 0;
+    }
+
+    store_small(dest, src->num, src->den, src->reduced);
+    return 0;
+}
+
+// ============================================================================
+// Initialization
+// ============================================================================
+
+int rf_fraction_set_i64(rf_fraction* f, int64_t num, int64_t den)
+{
+    if (den == 0) return -1;
+    store_wide(f, num, den, den == 1 || den == -1);
+    return 0;
+}
+
+int rf_fraction_set_bigint(rf_fraction* f, rf_bigint* num, rf_bigint* den)
+{
+    if (rf_bigint_is_zero(den)) return -1;
+
+    rf_bigint* n = rf_bigint_new();
+    rf_bigint* d = rf_bigint_new();
+    rf_bigint_copy(n, num);
+    rf_bigint_copy(d, den);
+    store_big(f, n, d);
+    return 0;
+}
+
+// Parses "n", "n/d" or "-n/d" in base 10
+int rf_fraction_set_str(rf_fraction* f, const char* str)
+{
+    if (!str) return -1;
+
+    const char* slash = strchr(str, '/');
+    if (!slash)
+    {
+        rf_bigint* n = rf_bigint_new();
+        if (rf_bigint_set_str(n, str, 10) != 0)
+        {
+            rf_bigint_clear(n);
+            return -1;
+        }
+        rf_bigint* d = rf_bigint_new();
+        rf_bigint_set_i64(d, 1);
+        store_big(f, n, d);
+        return 0;
+    }
+
+    size_t num_len = (size_t)(slash - str);
+    char* num_str = (char*)malloc(num_len + 1);
+    if (!num_str) return -1;
+    memcpy(num_str, str, num_len);
+    num_str[num_len] = '\0';
+
+    rf_bigint* n = rf_bigint_new();
+    rf_bigint* d = rf_bigint_new();
+    int status = rf_bigint_set_str(n, num_str, 10);
+    free(num_str);
+    if (status == 0) status = rf_bigint_set_str(d, slash + 1, 10);
+
+    if (status != 0 || rf_bigint_is_zero(d))
+    {
+        rf_bigint_clear(n);
+        rf_bigint_clear(d);
+        return -1;
+    }
+
+    store_big(f, n, d);
+    return 0;
+}
+
+// ============================================================================
+// Normalization
+// ============================================================================
+
+void rf_fraction_normalize(rf_fraction* f)
+{
+    if (f->reduced || is_big(f)) return;
+
+    uint64_t g = gcd_u64(abs_u64(f->num), (uint64_t)f->den);
+    if (g > 1)
+    {
+        f->num /= (int64_t)g;
+        f->den /= (int64_t)g;
+    }
+    f->reduced = 1;
+}
+
+int rf_fraction_is_big(const rf_fraction* f)
+{
+    return is_big(f);
+}
+
+// ============================================================================
+// Arithmetic Operations
+// ============================================================================
+
+int rf_fraction_add(rf_fraction* result, rf_fraction* a, rf_fraction* b)
+{
+    if (!is_big(a) && !is_big(b))
+    {
+        if (a->den == b->den)
+        {
+            store_wide(result, (rf_fraction_wide)a->num + b->num, a->den, 0);
+            return 0;
+        }
+
+        // a/b + c/d with 128-bit intermediates: cannot overflow for 63-bit operands
+        rf_fraction_wide num = (rf_fraction_wide)a->num * b->den + (rf_fraction_wide)b->num * a->den;
+        store_wide(result, num, (rf_fraction_wide)a->den * b->den, 0);
+        return 0;
+    }
+
+    rf_bigint *an, *ad, *bn, *bd;
+    load_big(a, &an, &ad);
+    load_big(b, &bn, &bd);
+    rf_bigint_mul(an, an, bd);
+    rf_bigint_mul(bn, bn, ad);
+    rf_bigint_add(an, an, bn);
+    rf_bigint_mul(ad, ad, bd);
+    rf_bigint_clear(bn);
+    rf_bigint_clear(bd);
+    store_big(result, an, ad);
+    return 0;
+}
+
+int rf_fraction_sub(rf_fraction* result, rf_fraction* a, rf_fraction* b)
+{
+    rf_fraction neg_b = {0};
+    neg_b.den = 1;
+    rf_fraction_neg(&neg_b, b);
+    int status = rf_fraction_add(result, a, &neg_b);
+    release_big(&neg_b);
+    return status;
+}
+
+int rf_fraction_mul(rf_fraction* result, rf_fraction* a, rf_fraction* b)
+{
+    if (!is_big(a) && !is_big(b))
+    {
+        // Cross-cancel before multiplying: keeps products small and the result
+        // reduced whenever both inputs were reduced
+        uint64_t g1 = gcd_u64(abs_u64(a->num), (uint64_t)b->den);
+        uint64_t g2 = gcd_u64(abs_u64(b->num), (uint64_t)a->den);
+        if (g1 == 0) g1 = 1;
+        if (g2 == 0) g2 = 1;
+
+        int64_t an = a->num / (int64_t)g1;
+        int64_t bd = b->den / (int64_t)g1;
+        int64_t bn = b->num / (int64_t)g2;
+        int64_t ad = a->den / (int64_t)g2;
+
+        int64_t num, den;
+        int32_t reduced = a->reduced && b->reduced;
+        if (!__builtin_mul_overflow(an, bn, &num) && !__builtin_mul_overflow(ad, bd, &den) &&
+            num != INT64_MIN)
+        {
+            store_small(result, num, den, reduced);
+            return 0;
+        }
+
+        store_wide(result, (rf_fraction_wide)an * bn, (rf_fraction_wide)ad * bd, reduced);
+        return 0;
+    }
+
+    rf_bigint *an, *ad, *bn, *bd;
+    load_big(a, &an, &ad);
+    load_big(b, &bn, &bd);
+    rf_bigint_mul(an, an, bn);
+    rf_bigint_mul(ad, ad, bd);
+    rf_bigint_clear(bn);
+    rf_bigint_clear(bd);
+    store_big(result, an, ad);
+    return 0;
+}
+
+int rf_fraction_div(rf_fraction* result, rf_fraction* a, rf_fraction* b)
+{
+    if (rf_fraction_is_zero(b)) return -1;
+
+    rf_fraction reciprocal = {0};
+    rf_fraction_inv(&reciprocal, b);
+    int status = rf_fraction_mul(result, a, &reciprocal);
+    release_big(&reciprocal);
+    return status;
+}
+
+int rf_fraction_neg(rf_fraction* result, rf_fraction* a)
+{
+    if (!is_big(a))
+    {
+        store_small(result, -a->num, a->den, a->reduced);
+        return 0;
+    }
+
+    rf_bigint *n, *d;
+    load_big(a, &n, &d);
+    rf_bigint_neg(n, n);
+    release_big(result);
+    result->big_num = n;
+    result->big_den = d;
+    result->reduced = a->reduced;
+    return 0;
+}
+
+int rf_fraction_abs(rf_fraction* result, rf_fraction* a)
+{
+    if (rf_fraction_is_neg(a))
+    {
+        return rf_fraction_neg(result, a);
+    }
+    return rf_fraction_copy(result, a);
+}
+
+int rf_fraction_inv(rf_fraction* result, rf_fraction* a)
+{
+    if (rf_fraction_is_zero(a)) return -1;
+
+    if (!is_big(a))
+    {
+        int64_t num = a->num < 0 ? -a->den : a->den;
+        int64_t den = a->num < 0 ? -a->num : a->num;
+        store_small(result, num, den, a->reduced);
+        return 0;
+    }
+
+    rf_bigint *n, *d;
+    load_big(a, &n, &d);
+    store_big(result, d, n);
+    return 0;
+}
+
+// ============================================================================
+// Comparison
+// ============================================================================
+
+int rf_fraction_cmp(rf_fraction* a, rf_fraction* b)
+{
+    if (!is_big(a) && !is_big(b))
+    {
+        // Cross-multiplied comparison; no normalization needed
+        rf_fraction_wide lhs = (rf_fraction_wide)a->num * b->den;
+        rf_fraction_wide rhs = (rf_fraction_wide)b->num * a->den;
+        return (lhs > rhs) - (lhs < rhs);
+    }
+
+    rf_bigint *an, *ad, *bn, *bd;
+    load_big(a, &an, &ad);
+    load_big(b, &bn, &bd);
+    rf_bigint_mul(an, an, bd);
+    rf_bigint_mul(bn, bn, ad);
+    int result = rf_bigint_cmp(an, bn);
+    rf_bigint_clear(an);
+    rf_bigint_clear(ad);
+    rf_bigint_clear(bn);
+    rf_bigint_clear(bd);
+    return result;
+}
+
+int rf_fraction_is_zero(const rf_fraction* f)
+{
+    return is_big(f) ? rf_bigint_is_zero(f->big_num) : f->num == 0;
+}
+
+int rf_fraction_is_neg(const rf_fraction* f)
+{
+    return is_big(f) ? rf_bigint_is_neg(f->big_num) : f->num < 0;
+}
+
+int rf_fraction_is_integer(rf_fraction* f)
+{
+    rf_fraction_normalize(f);
+    return is_big(f) ? rf_bigint_cmp_i64(f->big_den, 1) == 0 : f->den == 1;
+}
+
+// ============================================================================
+// Conversion
+// ============================================================================
+
+// Numerator/denominator accessors normalize first so callers see lowest terms
+int rf_fraction_get_num(rf_fraction* f, rf_bigint* out)
+{
+    rf_fraction_normalize(f);
+    if (is_big(f)) return rf_bigint_copy(out, f->big_num);
+    return rf_bigint_set_i64(out, f->num);
+}
+
+int rf_fraction_get_den(rf_fraction* f, rf_bigint* out)
+{
+    rf_fraction_normalize(f);
+    if (is_big(f)) return rf_bigint_copy(out, f->big_den);
+    return rf_bigint_set_i64(out, f->den);
+}
+
+// Inline accessors; only meaningful while rf_fraction_is_big() is false
+int64_t rf_fraction_num_i64(rf_fraction* f)
+{
+    rf_fraction_normalize(f);
+    return is_big(f) ? 0 : f->num;
+}
+
+int64_t rf_fraction_den_i64(rf_fraction* f)
+{
+    rf_fraction_normalize(f);
+    return is_big(f) ? 1 : f->den;
+}
+
+double rf_fraction_get_f64(rf_fraction* f)
+{
+    rf_fraction_normalize(f);
+    if (!is_big(f))
+    {
+        return (double)f->num / (double)f->den;
+    }
+
+    char* num = rf_bigint_get_str(f->big_num, 10);
+    char* den = rf_bigint_get_str(f->big_den, 10);
+    double result = (num && den) ? strtod(num, NULL) / strtod(den, NULL) : 0.0;
+    free(num);
+    free(den);
+    return result;
+}
+
+// Returns a malloc'd "n/d" string in lowest terms ("n" for integers)
+char* rf_fraction_get_str(rf_fraction* f)
+{
+    rf_fraction_normalize(f);
+
+    if (!is_big(f))
+    {
+        char* result = (char*)malloc(48);
+        if (!result) return NULL;
+        if (f->den == 1)
+        {
+            snprintf(result, 48, "%lld", (long long)f->num);
+        }
+        else
+        {
+            snprintf(result, 48, "%lld/%lld", (long long)f->num, (long long)f->den);
+        }
+        return result;
+    }
+
+    char* num = rf_bigint_get_str(f->big_num, 10);
+    char* den = rf_bigint_get_str(f->big_den, 10);
+    if (!num || !den)
+    {
+        free(num);
+        free(den);
+        return NULL;
+    }
+
+    size_t len = strlen(num) + strlen(den) + 2;
+    char* result = (char*)malloc(len);
+    if (result)
+    {
+        snprintf(result, len, "%s/%s", num, den);
+    }
+    free(num);
+    free(den);
+    return result;
+}
@@ -0,0 +1,119 @@
+/*
+ * RazorForge Runtime - Half Precision
+ * Out-of-line f16 conversions and arithmetic, f16 transcendentals, and the
+ * bulk f16<->f32 conversion kernels
+ */
+
+#include <math.h>
+#include <stdbool.h>
+
+// Emit the header's helpers with external linkage instead of static inline
+#define RF_HALF_API
+
+#include "../include/razorforge_half.h"
+#include "../include/razorforge_cpu.h"
+
+rf_f16 rf_f16_sqrt(rf_f16 x)
+{
+    return rf_f32_to_f16(sqrtf(rf_f16_to_f32(x)));
+}
+
+rf_f16 rf_f16_sin(rf_f16 x)
+{
+    return rf_f32_to_f16(sinf(rf_f16_to_f32(x)));
+}
+
+rf_f16 rf_f16_cos(rf_f16 x)
+{
+    return rf_f32_to_f16(cosf(rf_f16_to_f32(x)));
+}
+
+rf_f16 rf_f16_exp(rf_f16 x)
+{
+    return rf_f32_to_f16(expf(rf_f16_to_f32(x)));
+}
+
+rf_f16 rf_f16_log(rf_f16 x)
+{
+    return rf_f32_to_f16(logf(rf_f16_to_f32(x)));
+}
+
+rf_f16 rf_f16_pow(rf_f16 base, rf_f16 exponent)
+{
+    return rf_f32_to_f16(powf(rf_f16_to_f32(base), rf_f16_to_f32(exponent)));
+}
+
+// ============================================================================
+// Bulk Conversion
+// ============================================================================
+
+#ifdef RF_HALF_HAS_F16C
+// half_f16c.c, compiled with -mf16c
+void rf_f16_to_f32_batch_f16c(const rf_f16* src, float* dest, size_t count);
+void rf_f32_to_f16_batch_f16c(const float* src, rf_f16* dest, size_t count);
+#endif
+
+static void f16_to_f32_portable(const rf_f16* src, float* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = rf_f16_to_f32(src[i]);
+    }
+}
+
+static void f32_to_f16_portable(const float* src, rf_f16* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = rf_f32_to_f16(src[i]);
+    }
+}
+
+typedef void (*rf_widen_fn)(const rf_f16*, float*, size_t);
+typedef void (*rf_narrow_fn)(const float*, rf_f16*, size_t);
+
+static rf_widen_fn widen_kernel = NULL;
+static rf_narrow_fn narrow_kernel = NULL;
+
+static void bind_conversion_kernels(void)
+{
+    rf_widen_fn widen = f16_to_f32_portable;
+    rf_narrow_fn narrow = f32_to_f16_portable;
+#ifdef RF_HALF_HAS_F16C
+    if (rf_cpu_has_f16c())
+    {
+        widen = rf_f16_to_f32_batch_f16c;
+        narrow = rf_f32_to_f16_batch_f16c;
+    }
+#endif
+    __atomic_store_n(&narrow_kernel, narrow, __ATOMIC_RELEASE);
+    __atomic_store_n(&widen_kernel, widen, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_conversion_kernels(void)
+{
+    bind_conversion_kernels();
+}
+
+void rf_f16_to_f32_batch(const rf_f16* src, float* dest, size_t count)
+{
+    rf_widen_fn widen = __atomic_load_n(&widen_kernel, __ATOMIC_ACQUIRE);
+    if (widen == NULL)
+    {
+        bind_conversion_kernels();
+        widen = __atomic_load_n(&widen_kernel, __ATOMIC_ACQUIRE);
+    }
+    widen(src, dest, count);
+}
+
+void rf_f32_to_f16_batch(const float* src, rf_f16* dest, size_t count)
+{
+    rf_narrow_fn narrow = __atomic_load_n(&narrow_kernel, __ATOMIC_ACQUIRE);
+    if (narrow == NULL)
+    {
+        bind_conversion_kernels();
+        narrow = __atomic_load_n(&narrow_kernel, __ATOMIC_ACQUIRE);
+    }
+    narrow(src, dest, count);
+}
@@ -0,0 +1,55 @@
+/*
+ * RazorForge Runtime - Half Precision, F16C kernels
+ * Eight conversions per instruction; only called after rf_cpu_has_f16c()
+ */
+
+#include <immintrin.h>
+#include <string.h>
+#include "../include/razorforge_half.h"
+
+#ifndef __F16C__
+    #error "half_f16c.c must be compiled with -mf16c"
+#endif
+
+void rf_f16_to_f32_batch_f16c(const rf_f16* src, float* dest, size_t count);
+void rf_f32_to_f16_batch_f16c(const float* src, rf_f16* dest, size_t count);
+
+void rf_f16_to_f32_batch_f16c(const rf_f16* src, float* dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm256_storeu_ps(dest + i, _mm256_cvtph_ps(halves));
+    }
+    if (i < count)
+    {
+        // Tail through a zero-padded vector so it rounds like the body
+        rf_f16 tail_in[8] = {0};
+        float tail_out[8];
+        memcpy(tail_in, src + i, (count - i) * sizeof(rf_f16));
+        _mm256_storeu_ps(tail_out, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)tail_in)));
+        memcpy(dest + i, tail_out, (count - i) * sizeof(float));
+    }
+    _mm256_zeroupper();
+}
+
+void rf_f32_to_f16_batch_f16c(const float* src, rf_f16* dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)(dest + i), halves);
+    }
+    if (i < count)
+    {
+        float tail_in[8] = {0};
+        rf_f16 tail_out[8];
+        memcpy(tail_in, src + i, (count - i) * sizeof(float));
+        __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(tail_in), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i*)tail_out, halves);
+        memcpy(dest + i, tail_out, (count - i) * sizeof(rf_f16));
+    }
+    _mm256_zeroupper();
+}
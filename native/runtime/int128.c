@@ -0,0 +1,425 @@
+/*
+ * RazorForge Runtime - 128-bit Integer Support
+ * Division, decimal formatting and parsing for s128/u128
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "../include/razorforge_int.h"
+
+#ifdef RF_HAS_INT128
+
+// ============================================================================
+// Division
+// ============================================================================
+
+/*
+ * Divides the 128-bit value hi:lo by d. Requires hi < d so that the quotient
+ * fits in 64 bits - a single divq on x86-64, two 32-bit digit steps elsewhere
+ * (Hacker's Delight divlu). Both avoid the generic __udivti3 loop.
+ */
+static uint64_t div_128_by_64(uint64_t hi, uint64_t lo, uint64_t d, uint64_t* rem)
+{
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    uint64_t q;
+    uint64_t r;
+    __asm__("divq %4" : "=a"(q), "=d"(r) : "a"(lo), "d"(hi), "rm"(d));
+    *rem = r;
+    return q;
+#else
+    const uint64_t base = (uint64_t)1 << 32;
+    int shift = __builtin_clzll(d);
+
+    d <<= shift;
+    uint64_t vn1 = d >> 32;
+    uint64_t vn0 = d & 0xFFFFFFFFu;
+    uint64_t un32 = shift ? (hi << shift) | (lo >> (64 - shift)) : hi;
+    uint64_t un10 = lo << shift;
+    uint64_t un1 = un10 >> 32;
+    uint64_t un0 = un10 & 0xFFFFFFFFu;
+
+    uint64_t q1 = un32 / vn1;
+    uint64_t rhat = un32 - q1 * vn1;
+    while (q1 >= base || q1 * vn0 > base * rhat + un1)
+    {
+        q1--;
+        rhat += vn1;
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+
+    uint64_t un21 = un32 * base + un1 - q1 * d;
+    uint64_t q0 = un21 / vn1;
+    rhat = un21 - q0 * vn1;
+    while (q0 >= base || q0 * vn0 > base * rhat + un0)
+    {
+        q0--;
+        rhat += vn1;
+        if (rhat >= base)
+        {
+            break;
+        }
+    }
+
+    *rem = (un21 * base + un0 - q0 * d) >> shift;
+    return q1 * base + q0;
+#endif
+}
+
+rf_u128 rf_u128_div_u64(rf_u128 n, uint64_t d, uint64_t* rem)
+{
+    uint64_t n_hi = (uint64_t)(n >> 64);
+    uint64_t n_lo = (uint64_t)n;
+    uint64_t r;
+
+    if (n_hi == 0)
+    {
+        r = n_lo % d;
+        if (rem)
+        {
+            *rem = r;
+        }
+        return n_lo / d;
+    }
+
+    // Divide the high word first so the second step satisfies hi < d
+    uint64_t q_hi = n_hi / d;
+    uint64_t q_lo = div_128_by_64(n_hi - q_hi * d, n_lo, d, &r);
+    if (rem)
+    {
+        *rem = r;
+    }
+    return ((rf_u128)q_hi << 64) | q_lo;
+}
+
+rf_u128 rf_u128_divmod(rf_u128 n, rf_u128 d, rf_u128* rem)
+{
+    uint64_t d_hi = (uint64_t)(d >> 64);
+
+    if (d_hi == 0)
+    {
+        uint64_t r;
+        rf_u128 q = rf_u128_div_u64(n, (uint64_t)d, &r);
+        if (rem)
+        {
+            *rem = r;
+        }
+        return q;
+    }
+
+    if (n < d)
+    {
+        if (rem)
+        {
+            *rem = n;
+        }
+        return 0;
+    }
+
+    /*
+     * Divisor has a high word, so the quotient fits in 64 bits. Estimate it
+     * from the normalized top word of d (Hacker's Delight divdu); the estimate
+     * is at most one too large after the decrement, fixed by one correction.
+     */
+    int shift = __builtin_clzll(d_hi);
+    uint64_t d_top = (uint64_t)((d << shift) >> 64);
+    rf_u128 half = n >> 1;
+    uint64_t unused;
+    uint64_t q = div_128_by_64((uint64_t)(half >> 64), (uint64_t)half, d_top, &unused);
+
+    q >>= 63 - shift;
+    if (q != 0)
+    {
+        q--;
+    }
+
+    rf_u128 r = n - (rf_u128)q * d;
+    if (r >= d)
+    {
+        q++;
+        r -= d;
+    }
+
+    if (rem)
+    {
+        *rem = r;
+    }
+    return q;
+}
+
+rf_u128 rf_u128_div(rf_u128 n, rf_u128 d)
+{
+    return rf_u128_divmod(n, d, NULL);
+}
+
+rf_u128 rf_u128_rem(rf_u128 n, rf_u128 d)
+{
+    rf_u128 r;
+    rf_u128_divmod(n, d, &r);
+    return r;
+}
+
+// Truncating signed division; MIN / -1 wraps to MIN like the _wrap kernels
+rf_i128 rf_i128_divmod(rf_i128 n, rf_i128 d, rf_i128* rem)
+{
+    rf_u128 un = n < 0 ? 0 - (rf_u128)n : (rf_u128)n;
+    rf_u128 ud = d < 0 ? 0 - (rf_u128)d : (rf_u128)d;
+    rf_u128 ur;
+    rf_u128 uq = rf_u128_divmod(un, ud, &ur);
+
+    if (rem)
+    {
+        *rem = (rf_i128)(n < 0 ? 0 - ur : ur);
+    }
+    return (rf_i128)((n < 0) != (d < 0) ? 0 - uq : uq);
+}
+
+rf_i128 rf_i128_div(rf_i128 n, rf_i128 d)
+{
+    return rf_i128_divmod(n, d, NULL);
+}
+
+rf_i128 rf_i128_rem(rf_i128 n, rf_i128 d)
+{
+    rf_i128 r;
+    rf_i128_divmod(n, d, &r);
+    return r;
+}
+
+// ============================================================================
+// Decimal Formatting
+// ============================================================================
+
+#define RF_POW10_19 UINT64_C(10000000000000000000)
+
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Writes v backwards ending at end; returns the first digit written
+static char* write_u64(char* end, uint64_t v)
+{
+    while (v >= 100)
+    {
+        unsigned pair = (unsigned)(v % 100) * 2;
+        v /= 100;
+        *--end = digit_pairs[pair + 1];
+        *--end = digit_pairs[pair];
+    }
+
+    if (v >= 10)
+    {
+        unsigned pair = (unsigned)v * 2;
+        *--end = digit_pairs[pair + 1];
+        *--end = digit_pairs[pair];
+    }
+    else
+    {
+        *--end = (char)('0' + v);
+    }
+    return end;
+}
+
+// Writes exactly 19 digits (a zero-padded 10^19 chunk) ending at end
+static char* write_chunk19(char* end, uint64_t v)
+{
+    char* start = end - 19;
+    char* p = write_u64(end, v);
+    while (p > start)
+    {
+        *--p = '0';
+    }
+    return start;
+}
+
+/*
+ * u128 has at most 39 digits: split into at most three 10^19 chunks so that
+ * every digit is produced by 64-bit arithmetic.
+ */
+size_t rf_u128_to_chars(rf_u128 value, char* buffer)
+{
+    char digits[RF_U128_MAX_DIGITS];
+    char* end = digits + sizeof(digits);
+    char* p;
+
+    if ((value >> 64) == 0)
+    {
+        p = write_u64(end, (uint64_t)value);
+    }
+    else
+    {
+        uint64_t low;
+        rf_u128 upper = rf_u128_div_u64(value, RF_POW10_19, &low);
+        p = write_chunk19(end, low);
+
+        if ((upper >> 64) == 0)
+        {
+            p = write_u64(p, (uint64_t)upper);
+        }
+        else
+        {
+            uint64_t mid;
+            uint64_t top = (uint64_t)rf_u128_div_u64(upper, RF_POW10_19, &mid);
+            p = write_chunk19(p, mid);
+            p = write_u64(p, top);
+        }
+    }
+
+    size_t length = (size_t)(end - p);
+    memcpy(buffer, p, length);
+    buffer[length] = '\0';
+    return length;
+}
+
+size_t rf_i128_to_chars(rf_i128 value, char* buffer)
+{
+    if (value >= 0)
+    {
+        return rf_u128_to_chars((rf_u128)value, buffer);
+    }
+
+    buffer[0] = '-';
+    return 1 + rf_u128_to_chars(0 - (rf_u128)value, buffer + 1);
+}
+
+// Returns a malloc'd NUL-terminated string (caller must free)
+char* rf_u128_to_cstr(rf_u128 value)
+{
+    char* str = (char*)malloc(RF_U128_MAX_DIGITS + 1);
+    if (str)
+    {
+        rf_u128_to_chars(value, str);
+    }
+    return str;
+}
+
+char* rf_i128_to_cstr(rf_i128 value)
+{
+    char* str = (char*)malloc(RF_U128_MAX_DIGITS + 2);
+    if (str)
+    {
+        rf_i128_to_chars(value, str);
+    }
+    return str;
+}
+
+// ============================================================================
+// Decimal Parsing
+// ============================================================================
+
+static const uint64_t pow10_u64[20] = {
+    UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000),
+    UINT64_C(100000), UINT64_C(1000000), UINT64_C(10000000), UINT64_C(100000000),
+    UINT64_C(1000000000), UINT64_C(10000000000), UINT64_C(100000000000),
+    UINT64_C(1000000000000), UINT64_C(10000000000000), UINT64_C(100000000000000),
+    UINT64_C(1000000000000000), UINT64_C(10000000000000000),
+    UINT64_C(100000000000000000), UINT64_C(1000000000000000000), RF_POW10_19
+};
+
+/*
+ * Parses unsigned decimal digits. Digits are accumulated 19 at a time in a
+ * u64 and folded into the u128 with one multiply-add per chunk.
+ */
+static int parse_magnitude(const char* text, size_t length, rf_u128* out)
+{
+    if (length == 0)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    rf_u128 value = 0;
+    bool overflow = false;
+    size_t i = 0;
+
+    while (i < length)
+    {
+        size_t chunk_length = length - i < 19 ? length - i : 19;
+        uint64_t chunk = 0;
+
+        for (size_t k = 0; k < chunk_length; k++)
+        {
+            unsigned digit = (unsigned)(unsigned char)text[i + k] - '0';
+            if (digit > 9)
+            {
+                return RF_PARSE_INVALID;
+            }
+            chunk = chunk * 10 + digit;
+        }
+
+        // Keep scanning after an overflow so malformed text still reports invalid
+        overflow = overflow || __builtin_mul_overflow(value, pow10_u64[chunk_length], &value) ||
+                   __builtin_add_overflow(value, chunk, &value);
+        i += chunk_length;
+    }
+
+    *out = value;
+    return overflow ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+int rf_u128_parse(const char* text, size_t length, rf_u128* out)
+{
+    if (length > 0 && text[0] == '+')
+    {
+        text++;
+        length--;
+    }
+    return parse_magnitude(text, length, out);
+}
+
+int rf_i128_parse(const char* text, size_t length, rf_i128* out)
+{
+    bool negative = length > 0 && text[0] == '-';
+    if (length > 0 && (text[0] == '-' || text[0] == '+'))
+    {
+        text++;
+        length--;
+    }
+
+    rf_u128 magnitude;
+    int status = parse_magnitude(text, length, &magnitude);
+    if (status != RF_PARSE_OK)
+    {
+        return status;
+    }
+
+    rf_u128 limit = (rf_u128)RF_I128_MAX + (negative ? 1 : 0);
+    if (magnitude > limit)
+    {
+        return RF_PARSE_OVERFLOW;
+    }
+
+    *out = (rf_i128)(negative ? 0 - magnitude : magnitude);
+    return RF_PARSE_OK;
+}
+
+// C string entry points for the stdlib: status first, then the value (0 on failure)
+int32_t rf_u128_parse_status(const char* text)
+{
+    rf_u128 value;
+    return rf_u128_parse(text, strlen(text), &value);
+}
+
+rf_u128 rf_u128_from_cstr(const char* text)
+{
+    rf_u128 value = 0;
+    return rf_u128_parse(text, strlen(text), &value) == RF_PARSE_OK ? value : 0;
+}
+
+int32_t rf_i128_parse_status(const char* text)
+{
+    rf_i128 value;
+    return rf_i128_parse(text, strlen(text), &value);
+}
+
+rf_i128 rf_i128_from_cstr(const char* text)
+{
+    rf_i128 value = 0;
+    return rf_i128_parse(text, strlen(text), &value) == RF_PARSE_OK ? value : 0;
+}
+
+#endif // RF_HAS_INT128
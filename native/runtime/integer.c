@@ -0,0 +1,9 @@
+/*
+ * RazorForge Runtime - Fixed-Width Integer Kernels
+ * Out-of-line instances of the razorforge_int.h template for FFI callers
+ */
+
+// Emit every kernel with external linkage instead of static inline
+#define RF_INT_API
+
+#include "../include/razorforge_int.h"
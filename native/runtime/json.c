@@ -0,0 +1,1317 @@
+/*
+ * RazorForge Runtime - JSON
+ * Stage 1 dispatch and the scalar classifier, stage 2 (tape construction),
+ * value parsing shared by the tape and lazy modes, and the accessors.
+ *
+ * Tape layout: one 64-bit word per value, type character in the top byte.
+ *   '{' '['  payload = element count << 32 | tape index after the close
+ *   '}' ']'  payload = tape index of the open
+ *   '"'      payload = byte offset (bit 55: in the arena copy, else in src);
+ *            the next word holds the length
+ *   'l' 'u' 'd'  the next word holds the i64, u64 or f64 bits
+ *   't' 'f' 'n'  no payload
+ * In lazy mode rf_json_value.at indexes the stage 1 structurals instead.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/razorforge_arena.h"
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_json.h"
+#include "../include/razorforge_parse.h"
+#include "json_internal.h"
+
+// ============================================================================
+// Stage 1: scalar classification and dispatch
+// ============================================================================
+
+#define CLASS_QUOTE 1
+#define CLASS_BACKSLASH 2
+#define CLASS_OP 4
+#define CLASS_WHITESPACE 8
+
+static const uint8_t char_class[256] = {
+    ['"'] = CLASS_QUOTE,     ['\\'] = CLASS_BACKSLASH,  ['{'] = CLASS_OP,
+    ['}'] = CLASS_OP,        ['['] = CLASS_OP,          [']'] = CLASS_OP,
+    [':'] = CLASS_OP,        [','] = CLASS_OP,          [' '] = CLASS_WHITESPACE,
+    ['\t'] = CLASS_WHITESPACE, ['\n'] = CLASS_WHITESPACE, ['\r'] = CLASS_WHITESPACE,
+};
+
+static inline void json_classify(const uint8_t* block, rf_json_masks* masks)
+{
+    masks->quote = masks->backslash = masks->op = masks->whitespace = masks->control = masks->non_ascii = 0;
+    for (int i = 0; i < 64; i++)
+    {
+        uint8_t c = char_class[block[i]];
+        uint64_t bit = UINT64_C(1) << i;
+        masks->quote |= (c & CLASS_QUOTE) ? bit : 0;
+        masks->backslash |= (c & CLASS_BACKSLASH) ? bit : 0;
+        masks->op |= (c & CLASS_OP) ? bit : 0;
+        masks->whitespace |= (c & CLASS_WHITESPACE) ? bit : 0;
+        masks->control |= block[i] < 0x20 ? bit : 0;
+        masks->non_ascii |= block[i] >= 0x80 ? bit : 0;
+    }
+}
+
+#define RF_JSON_STAGE1 rf_json_stage1_scalar
+#include "json_stage1.h"
+
+static rf_json_stage1_fn active_stage1 = NULL;
+
+static void bind_json_kernels(void)
+{
+    rf_json_stage1_fn stage1 = rf_json_stage1_scalar;
+#ifdef RF_JSON_HAS_X86
+    if (rf_cpu_active_level() >= RF_CPU_AVX2)
+    {
+        stage1 = rf_json_stage1_avx2;
+    }
+    else if (rf_cpu_active_level() >= RF_CPU_SSE2)
+    {
+        stage1 = rf_json_stage1_sse2;
+    }
+#endif
+    __atomic_store_n(&active_stage1, stage1, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_json_kernels(void)
+{
+    bind_json_kernels();
+}
+
+static inline rf_json_stage1_fn json_stage1(void)
+{
+    rf_json_stage1_fn stage1 = __atomic_load_n(&active_stage1, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(stage1 == NULL, 0))
+    {
+        bind_json_kernels();
+        stage1 = __atomic_load_n(&active_stage1, __ATOMIC_ACQUIRE);
+    }
+    return stage1;
+}
+
+// ============================================================================
+// Document
+// ============================================================================
+
+struct rf_json_document
+{
+    rf_arena* arena;  // owns everything below
+    const uint8_t* src;
+    size_t length;
+    uint32_t* index;  // stage 1 structurals
+    size_t index_count;
+    uint64_t* tape;  // NULL in lazy mode
+    size_t tape_length;
+    uint8_t* strings;  // decoded escaped strings (tape mode)
+    size_t strings_used;
+    int error;
+    size_t error_offset;
+};
+
+#define TAPE_PAYLOAD_MASK ((UINT64_C(1) << 56) - 1)
+#define TAPE_DECODED (UINT64_C(1) << 55)
+#define TAPE_COUNT_MAX 0xFFFFFF
+
+static inline uint64_t tape_word(uint8_t type, uint64_t payload)
+{
+    return (uint64_t)type << 56 | payload;
+}
+
+static inline uint8_t tape_type(uint64_t word)
+{
+    return (uint8_t)(word >> 56);
+}
+
+static inline int fail(rf_json_document* document, int error, size_t offset)
+{
+    if (document->error == RF_JSON_OK)
+    {
+        document->error = error;
+        document->error_offset = offset;
+    }
+    return error;
+}
+
+// Offset of structural `at`, or the end of the document past the last one
+static inline size_t offset_of(const rf_json_document* document, size_t at)
+{
+    return at < document->index_count ? document->index[at] : document->length;
+}
+
+// Character at structural `at`; 0 past the end
+static inline uint8_t char_at(const rf_json_document* document, size_t at)
+{
+    return at < document->index_count ? document->src[document->index[at]] : 0;
+}
+
+// ============================================================================
+// UTF-8 validation (only run when stage 1 saw a byte >= 0x80)
+// ============================================================================
+
+static bool utf8_valid(const uint8_t* src, size_t length, size_t* bad)
+{
+    size_t i = 0;
+    while (i < length)
+    {
+        if (i + 8 <= length)
+        {
+            uint64_t word;
+            memcpy(&word, src + i, 8);
+            if ((word & UINT64_C(0x8080808080808080)) == 0)
+            {
+                i += 8;
+                continue;
+            }
+        }
+        uint8_t c = src[i];
+        if (c < 0x80)
+        {
+            i++;
+            continue;
+        }
+        size_t extra;
+        uint32_t min;
+        uint32_t code;
+        if ((c & 0xE0) == 0xC0)
+        {
+            extra = 1, min = 0x80, code = c & 0x1F;
+        }
+        else if ((c & 0xF0) == 0xE0)
+        {
+            extra = 2, min = 0x800, code = c & 0x0F;
+        }
+        else if ((c & 0xF8) == 0xF0)
+        {
+            extra = 3, min = 0x10000, code = c & 0x07;
+        }
+        else
+        {
+            *bad = i;
+            return false;
+        }
+        if (length - i <= extra)
+        {
+            *bad = i;
+            return false;
+        }
+        for (size_t k = 1; k <= extra; k++)
+        {
+            if ((src[i + k] & 0xC0) != 0x80)
+            {
+                *bad = i;
+                return false;
+            }
+            code = code << 6 | (src[i + k] & 0x3F);
+        }
+        // Overlong forms, surrogates and code points past U+10FFFF
+        if (code < min || (code >= 0xD800 && code <= 0xDFFF) || code > 0x10FFFF)
+        {
+            *bad = i;
+            return false;
+        }
+        i += extra + 1;
+    }
+    return true;
+}
+
+// ============================================================================
+// Value parsing, shared by stage 2 and lazy access
+// ============================================================================
+
+// Byte just past the scalar at structural `at`. A scalar runs until
+// whitespace or an operator, and anything else after whitespace starts the
+// next structural, so only whitespace lies between its end and that one.
+static inline size_t scalar_end(const rf_json_document* document, size_t at)
+{
+    size_t end = offset_of(document, at + 1);
+    while (char_class[document->src[end - 1]] & CLASS_WHITESPACE)
+    {
+        end--;
+    }
+    return end;
+}
+
+// The string at structural `at`: its body is src[*begin..*end). Stage 1 has
+// rejected unclosed strings and control characters, and only whitespace can
+// separate a closing quote from the next structural, so the close is found
+// by stepping back from that structural.
+static inline bool string_span(const rf_json_document* document, size_t at, size_t* begin, size_t* end)
+{
+    const uint8_t* src = document->src;
+    size_t close = offset_of(document, at + 1) - 1;
+    while (char_class[src[close]] & CLASS_WHITESPACE)
+    {
+        close--;
+    }
+    *begin = document->index[at] + 1;
+    *end = close;
+    return memchr(src + *begin, '\\', close - *begin) != NULL;
+}
+
+static int hex4(const uint8_t* p, uint32_t* out)
+{
+    uint32_t value = 0;
+    for (int k = 0; k < 4; k++)
+    {
+        uint8_t c = p[k];
+        uint32_t digit = c >= '0' && c <= '9'   ? (uint32_t)(c - '0')
+                         : (c | 0x20) >= 'a' && (c | 0x20) <= 'f' ? (uint32_t)((c | 0x20) - 'a' + 10)
+                                                                 : 16;
+        if (digit > 15)
+        {
+            return 0;
+        }
+        value = value << 4 | digit;
+    }
+    *out = value;
+    return 1;
+}
+
+// Decodes the escapes of the string body src[begin..end) into dest, which
+// has room for end - begin bytes (decoding never grows a string)
+static int string_decode(rf_json_document* document, size_t begin, size_t end, uint8_t* dest, size_t* written)
+{
+    const uint8_t* src = document->src;
+    uint8_t* out = dest;
+    size_t i = begin;
+    while (i < end)
+    {
+        const uint8_t* backslash = memchr(src + i, '\\', end - i);
+        size_t run = backslash ? (size_t)(backslash - (src + i)) : end - i;
+        memcpy(out, src + i, run);
+        out += run;
+        i += run;
+        if (i >= end)
+        {
+            break;
+        }
+
+        uint8_t escape = src[i + 1];
+        i += 2;
+        switch (escape)
+        {
+        case '"': *out++ = '"'; break;
+        case '\\': *out++ = '\\'; break;
+        case '/': *out++ = '/'; break;
+        case 'b': *out++ = '\b'; break;
+        case 'f': *out++ = '\f'; break;
+        case 'n': *out++ = '\n'; break;
+        case 'r': *out++ = '\r'; break;
+        case 't': *out++ = '\t'; break;
+        case 'u':
+        {
+            uint32_t code;
+            if (end - i < 4 || !hex4(src + i, &code))
+            {
+                return fail(document, RF_JSON_ERROR_STRING, i - 2);
+            }
+            i += 4;
+            if (code >= 0xD800 && code <= 0xDBFF)
+            {
+                // High surrogate: a \u low surrogate must follow
+                uint32_t low;
+                if (end - i < 6 || src[i] != '\\' || src[i + 1] != 'u' || !hex4(src + i + 2, &low) ||
+                    low < 0xDC00 || low > 0xDFFF)
+                {
+                    return fail(document, RF_JSON_ERROR_STRING, i - 6);
+                }
+                i += 6;
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            }
+            else if (code >= 0xDC00 && code <= 0xDFFF)
+            {
+                return fail(document, RF_JSON_ERROR_STRING, i - 6);
+            }
+
+            if (code < 0x80)
+            {
+                *out++ = (uint8_t)code;
+            }
+            else if (code < 0x800)
+            {
+                *out++ = (uint8_t)(0xC0 | code >> 6);
+                *out++ = (uint8_t)(0x80 | (code & 0x3F));
+            }
+            else if (code < 0x10000)
+            {
+                *out++ = (uint8_t)(0xE0 | code >> 12);
+                *out++ = (uint8_t)(0x80 | (code >> 6 & 0x3F));
+                *out++ = (uint8_t)(0x80 | (code & 0x3F));
+            }
+            else
+            {
+                *out++ = (uint8_t)(0xF0 | code >> 18);
+                *out++ = (uint8_t)(0x80 | (code >> 12 & 0x3F));
+                *out++ = (uint8_t)(0x80 | (code >> 6 & 0x3F));
+                *out++ = (uint8_t)(0x80 | (code & 0x3F));
+            }
+            break;
+        }
+        default:
+            return fail(document, RF_JSON_ERROR_STRING, i - 2);
+        }
+    }
+    *written = (size_t)(out - dest);
+    return RF_JSON_OK;
+}
+
+// The number at structural `at`: JSON grammar first, then the runtime
+// parsers. Integers stay integers while they fit in i64 (or u64 when
+// positive); up to 18 digits are accumulated by the grammar pass itself.
+static int parse_number(rf_json_document* document, size_t at, rf_json_type* type, uint64_t* bits)
+{
+    const uint8_t* src = document->src;
+    size_t start = document->index[at];
+    size_t end = scalar_end(document, at);
+    size_t p = start;
+    bool negative = src[p] == '-';
+    bool is_float = false;
+    uint64_t mantissa = 0;
+    p += negative;
+    if (p < end && src[p] == '0')
+    {
+        p++;
+    }
+    else if (p < end && src[p] >= '1' && src[p] <= '9')
+    {
+        while (p < end && src[p] >= '0' && src[p] <= '9')
+        {
+            mantissa = mantissa * 10 + (uint64_t)(src[p] - '0');  // wraps harmlessly past 19 digits
+            p++;
+        }
+    }
+    else
+    {
+        return fail(document, RF_JSON_ERROR_NUMBER, start);
+    }
+    size_t digits = p - start - negative;
+    if (p < end && src[p] == '.')
+    {
+        is_float = true;
+        if (++p >= end || src[p] < '0' || src[p] > '9')
+        {
+            return fail(document, RF_JSON_ERROR_NUMBER, start);
+        }
+        while (p < end && src[p] >= '0' && src[p] <= '9')
+        {
+            p++;
+        }
+    }
+    if (p < end && (src[p] | 0x20) == 'e')
+    {
+        is_float = true;
+        p++;
+        p += p < end && (src[p] == '+' || src[p] == '-');
+        if (p >= end || src[p] < '0' || src[p] > '9')
+        {
+            return fail(document, RF_JSON_ERROR_NUMBER, start);
+        }
+        while (p < end && src[p] >= '0' && src[p] <= '9')
+        {
+            p++;
+        }
+    }
+    if (p != end)
+    {
+        return fail(document, RF_JSON_ERROR_NUMBER, start);
+    }
+
+    if (!is_float && digits <= 18)
+    {
+        *type = RF_JSON_INTEGER;
+        *bits = negative ? (uint64_t)-(int64_t)mantissa : mantissa;
+        return RF_JSON_OK;
+    }
+    const char* text = (const char*)src + start;
+    size_t length = end - start;
+    if (!is_float)
+    {
+        int64_t integer;
+        if (rf_i64_parse_letter8(text, length, &integer) == RF_PARSE_OK)
+        {
+            *type = RF_JSON_INTEGER;
+            *bits = (uint64_t)integer;
+            return RF_JSON_OK;
+        }
+        if (!negative && rf_u64_parse_letter8(text, length, bits) == RF_PARSE_OK)
+        {
+            *type = RF_JSON_UNSIGNED;
+            return RF_JSON_OK;
+        }
+    }
+    double value;
+    if (rf_f64_parse_letter8(text, length, &value) != RF_PARSE_OK)
+    {
+        return fail(document, RF_JSON_ERROR_NUMBER, start);
+    }
+    *type = RF_JSON_FLOAT;
+    memcpy(bits, &value, sizeof(value));
+    return RF_JSON_OK;
+}
+
+static int parse_literal(rf_json_document* document, size_t at, rf_json_type* type, bool* value)
+{
+    size_t start = document->index[at];
+    size_t length = scalar_end(document, at) - start;
+    const char* text = (const char*)document->src + start;
+    if (length == 4 && memcmp(text, "true", 4) == 0)
+    {
+        *type = RF_JSON_BOOL;
+        *value = true;
+    }
+    else if (length == 5 && memcmp(text, "false", 5) == 0)
+    {
+        *type = RF_JSON_BOOL;
+        *value = false;
+    }
+    else if (length == 4 && memcmp(text, "null", 4) == 0)
+    {
+        *type = RF_JSON_NULL;
+        *value = false;
+    }
+    else
+    {
+        return fail(document, RF_JSON_ERROR_LITERAL, start);
+    }
+    return RF_JSON_OK;
+}
+
+// ============================================================================
+// Stage 2: tape construction
+// ============================================================================
+
+typedef struct
+{
+    uint32_t open;  // tape index of the '{' or '['
+    uint32_t count;
+} tape_frame;
+
+static int tape_string(rf_json_document* document, size_t at, uint64_t** write)
+{
+    size_t begin;
+    size_t end;
+    bool escaped = string_span(document, at, &begin, &end);
+    uint64_t* tape = *write;
+    if (!escaped)
+    {
+        tape[0] = tape_word('"', begin);
+        tape[1] = end - begin;
+    }
+    else
+    {
+        if (document->strings == NULL)
+        {
+            document->strings = rf_arena_alloc(document->arena, document->length);
+            if (document->strings == NULL)
+            {
+                return fail(document, RF_JSON_ERROR_CAPACITY, begin - 1);
+            }
+        }
+        size_t written;
+        int status = string_decode(document, begin, end, document->strings + document->strings_used, &written);
+        if (status != RF_JSON_OK)
+        {
+            return status;
+        }
+        tape[0] = tape_word('"', TAPE_DECODED | document->strings_used);
+        tape[1] = written;
+        document->strings_used += written;
+    }
+    *write = tape + 2;
+    return RF_JSON_OK;
+}
+
+static int build_tape(rf_json_document* document)
+{
+    const uint8_t* src = document->src;
+    const uint32_t* index = document->index;
+    size_t count = document->index_count;
+    uint64_t* tape = document->tape;
+    uint64_t* write = tape;
+    tape_frame* stack = rf_arena_alloc(document->arena, RF_JSON_MAX_DEPTH * sizeof(tape_frame));
+    if (stack == NULL)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, 0);
+    }
+    size_t depth = 0;
+    size_t i = 0;
+    uint8_t c;
+    int status;
+
+value:
+    if (i >= count)
+    {
+        return fail(document, RF_JSON_ERROR_SYNTAX, document->length);
+    }
+    c = src[index[i]];
+    switch (c)
+    {
+    case '{':
+    case '[':
+        if (depth == RF_JSON_MAX_DEPTH)
+        {
+            return fail(document, RF_JSON_ERROR_DEPTH, index[i]);
+        }
+        stack[depth].open = (uint32_t)(write - tape);
+        stack[depth].count = 0;
+        depth++;
+        *write++ = tape_word(c, 0);
+        i++;
+        if (char_at(document, i) == c + 2)  // '}' and ']' are two above their opens
+        {
+            i++;
+            goto close;
+        }
+        if (c == '{')
+        {
+            goto key;
+        }
+        goto value;
+    case '"':
+        status = tape_string(document, i, &write);
+        if (status != RF_JSON_OK)
+        {
+            return status;
+        }
+        break;
+    case 't':
+    case 'f':
+    case 'n':
+    {
+        rf_json_type type;
+        bool value;
+        status = parse_literal(document, i, &type, &value);
+        if (status != RF_JSON_OK)
+        {
+            return status;
+        }
+        *write++ = tape_word(type == RF_JSON_NULL ? 'n' : value ? 't' : 'f', 0);
+        break;
+    }
+    default:
+    {
+        rf_json_type type;
+        uint64_t bits;
+        if (c != '-' && (c < '0' || c > '9'))
+        {
+            return fail(document, RF_JSON_ERROR_SYNTAX, index[i]);
+        }
+        status = parse_number(document, i, &type, &bits);
+        if (status != RF_JSON_OK)
+        {
+            return status;
+        }
+        write[0] = tape_word(type == RF_JSON_INTEGER ? 'l' : type == RF_JSON_UNSIGNED ? 'u' : 'd', 0);
+        write[1] = bits;
+        write += 2;
+        break;
+    }
+    }
+    i++;
+
+after_value:
+    if (depth == 0)
+    {
+        if (i != count)
+        {
+            return fail(document, RF_JSON_ERROR_SYNTAX, index[i]);
+        }
+        document->tape_length = (size_t)(write - tape);
+        return RF_JSON_OK;
+    }
+    stack[depth - 1].count++;
+    c = char_at(document, i);
+    i++;
+    if (c == ',')
+    {
+        if (tape[stack[depth - 1].open] >> 56 == '{')
+        {
+            goto key;
+        }
+        goto value;
+    }
+    if (c == (tape[stack[depth - 1].open] >> 56) + 2)
+    {
+        goto close;
+    }
+    return fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, i - 1));
+
+key:
+    if (char_at(document, i) != '"')
+    {
+        return fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, i));
+    }
+    status = tape_string(document, i, &write);
+    if (status != RF_JSON_OK)
+    {
+        return status;
+    }
+    if (char_at(document, i + 1) != ':')
+    {
+        return fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, i + 1));
+    }
+    i += 2;
+    goto value;
+
+close:
+{
+    tape_frame frame = stack[--depth];
+    uint8_t open = tape_type(tape[frame.open]);
+    uint64_t elements = frame.count < TAPE_COUNT_MAX ? frame.count : TAPE_COUNT_MAX;
+    *write++ = tape_word((uint8_t)(open + 2), frame.open);
+    tape[frame.open] = tape_word(open, elements << 32 | (uint64_t)(write - tape));
+    goto after_value;
+}
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+// Error path only: the raw control character inside a string that stage 1
+// reported, found by tracking quotes and escapes byte by byte
+static size_t find_string_control(const uint8_t* src, size_t length)
+{
+    bool in_string = false;
+    for (size_t i = 0; i < length; i++)
+    {
+        if (in_string && src[i] == '\\')
+        {
+            i++;
+        }
+        else if (src[i] == '"')
+        {
+            in_string = !in_string;
+        }
+        else if (in_string && src[i] < 0x20)
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
+// Lazy mode: the structural just past the root value, or SIZE_MAX when the
+// root is not a value or its brackets never close. Stage 2 does this check in
+// tape mode; lazy mode needs it so trailing data is not silently ignored.
+static size_t lazy_root_end(const rf_json_document* document)
+{
+    uint8_t c = char_at(document, 0);
+    if (c == '}' || c == ']' || c == ',' || c == ':')
+    {
+        return 0;
+    }
+    if (c != '{' && c != '[')
+    {
+        return 1;
+    }
+    size_t depth = 0;
+    for (size_t at = 0; at < document->index_count; at++)
+    {
+        c = char_at(document, at);
+        if (c == '{' || c == '[')
+        {
+            depth++;
+        }
+        else if ((c == '}' || c == ']') && --depth == 0)
+        {
+            return at + 1;
+        }
+    }
+    return SIZE_MAX;
+}
+
+// Runs both stages over src into a document whose arena is empty
+static int parse_into(rf_json_document* document, const char* src, size_t length, int flags)
+{
+    rf_arena* arena = document->arena;
+    memset(document, 0, sizeof(*document));
+    document->arena = arena;
+    document->src = (const uint8_t*)src;
+    document->length = length;
+
+    if (length >= UINT32_MAX)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, 0);
+    }
+    document->index = rf_arena_alloc(arena, (length + 4) * sizeof(uint32_t));
+    if (document->index == NULL)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, 0);
+    }
+
+    bool non_ascii;
+    size_t count = json_stage1()(document->src, length, document->index, &non_ascii);
+    if (count == RF_JSON_STAGE1_CONTROL)
+    {
+        return fail(document, RF_JSON_ERROR_STRING, find_string_control(document->src, length));
+    }
+    if (count == RF_JSON_STAGE1_UNCLOSED)
+    {
+        // The last quote opened a string; find it for the error offset
+        const uint8_t* quote = document->src + length;
+        while (quote > document->src && *--quote != '"')
+        {
+        }
+        return fail(document, RF_JSON_ERROR_STRING, (size_t)(quote - document->src));
+    }
+    size_t bad;
+    if (non_ascii && !utf8_valid(document->src, length, &bad))
+    {
+        return fail(document, RF_JSON_ERROR_UTF8, bad);
+    }
+    if (count == 0)
+    {
+        return fail(document, RF_JSON_ERROR_EMPTY, 0);
+    }
+    document->index_count = count;
+    if (flags & RF_JSON_LAZY)
+    {
+        size_t end = lazy_root_end(document);
+        if (end != count)
+        {
+            int status = fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, end));
+            document->index_count = 0;
+            return status;
+        }
+        return RF_JSON_OK;
+    }
+
+    // Two words per structural bound the tape; tape indexes are 32-bit
+    if (2 * (uint64_t)count + 2 > UINT32_MAX)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, 0);
+    }
+    document->tape = rf_arena_alloc(arena, (2 * count + 2) * sizeof(uint64_t));
+    if (document->tape == NULL)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, 0);
+    }
+    int status = build_tape(document);
+    if (status != RF_JSON_OK)
+    {
+        document->tape_length = 0;
+    }
+    return status;
+}
+
+rf_json_document* rf_json_parse(const char* src, size_t length, int flags)
+{
+    rf_json_document* document = malloc(sizeof(rf_json_document));
+    if (document == NULL)
+    {
+        return NULL;
+    }
+    document->arena = rf_arena_new(0);
+    if (document->arena == NULL)
+    {
+        free(document);
+        return NULL;
+    }
+    parse_into(document, src, length, flags);
+    return document;
+}
+
+int rf_json_reparse(rf_json_document* document, const char* src, size_t length, int flags)
+{
+    if (document == NULL)
+    {
+        return RF_JSON_ERROR_CAPACITY;
+    }
+    // Reset keeps the blocks, so a document of similar shape parses without
+    // touching the allocator or faulting in fresh pages
+    rf_arena_reset(document->arena);
+    return parse_into(document, src, length, flags);
+}
+
+void rf_json_free(rf_json_document* document)
+{
+    if (document)
+    {
+        rf_arena_free(document->arena);
+        free(document);
+    }
+}
+
+int rf_json_error(const rf_json_document* document)
+{
+    return document ? document->error : RF_JSON_ERROR_CAPACITY;
+}
+
+size_t rf_json_error_offset(const rf_json_document* document)
+{
+    return document ? document->error_offset : 0;
+}
+
+// ============================================================================
+// Accessors
+// ============================================================================
+
+// A failed parse leaves an empty tape and index, so every value is stale
+static inline bool usable(rf_json_value value)
+{
+    const rf_json_document* document = value.document;
+    return document != NULL && value.at < (document->tape ? document->tape_length : document->index_count);
+}
+
+rf_json_value rf_json_root(rf_json_document* document)
+{
+    rf_json_value root = {document, 0};
+    return root;
+}
+
+// Lazy mode: the structural just past the value at `at`, walking nested
+// containers by depth; index_count when the brackets do not balance
+static size_t lazy_skip(const rf_json_document* document, size_t at)
+{
+    uint8_t c = char_at(document, at);
+    if (c != '{' && c != '[')
+    {
+        return at + 1;
+    }
+    size_t depth = 0;
+    for (; at < document->index_count; at++)
+    {
+        c = char_at(document, at);
+        if (c == '{' || c == '[')
+        {
+            depth++;
+        }
+        else if ((c == '}' || c == ']') && --depth == 0)
+        {
+            return at + 1;
+        }
+    }
+    return document->index_count;
+}
+
+static inline size_t tape_skip(const rf_json_document* document, size_t at)
+{
+    uint64_t word = document->tape[at];
+    switch (tape_type(word))
+    {
+    case '{':
+    case '[':
+        return (size_t)(word & UINT32_MAX);
+    case '"':
+    case 'l':
+    case 'u':
+    case 'd':
+        return at + 2;
+    default:
+        return at + 1;
+    }
+}
+
+rf_json_type rf_json_type_of(rf_json_value value)
+{
+    if (!usable(value))
+    {
+        return RF_JSON_INVALID;
+    }
+    rf_json_document* document = value.document;
+    if (document->tape)
+    {
+        switch (tape_type(document->tape[value.at]))
+        {
+        case 'n': return RF_JSON_NULL;
+        case 't':
+        case 'f': return RF_JSON_BOOL;
+        case 'l': return RF_JSON_INTEGER;
+        case 'u': return RF_JSON_UNSIGNED;
+        case 'd': return RF_JSON_FLOAT;
+        case '"': return RF_JSON_STRING;
+        case '[': return RF_JSON_ARRAY;
+        case '{': return RF_JSON_OBJECT;
+        default: return RF_JSON_INVALID;
+        }
+    }
+
+    size_t offset = document->index[value.at];
+    switch (document->src[offset])
+    {
+    case '{': return RF_JSON_OBJECT;
+    case '[': return RF_JSON_ARRAY;
+    case '"': return RF_JSON_STRING;
+    case 't':
+    case 'f':
+    case 'n':
+    {
+        rf_json_type type;
+        bool ignored;
+        return parse_literal(document, value.at, &type, &ignored) == RF_JSON_OK ? type : RF_JSON_INVALID;
+    }
+    default:
+    {
+        rf_json_type type;
+        uint64_t ignored;
+        return parse_number(document, value.at, &type, &ignored) == RF_JSON_OK ? type : RF_JSON_INVALID;
+    }
+    }
+}
+
+// Number bits and type of a numeric value in either mode
+static int number_of(rf_json_value value, rf_json_type* type, uint64_t* bits)
+{
+    if (!usable(value))
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_document* document = value.document;
+    if (document->tape)
+    {
+        uint8_t tag = tape_type(document->tape[value.at]);
+        if (tag != 'l' && tag != 'u' && tag != 'd')
+        {
+            return RF_JSON_ERROR_TYPE;
+        }
+        *type = tag == 'l' ? RF_JSON_INTEGER : tag == 'u' ? RF_JSON_UNSIGNED : RF_JSON_FLOAT;
+        *bits = document->tape[value.at + 1];
+        return RF_JSON_OK;
+    }
+    uint8_t c = char_at(document, value.at);
+    if (c != '-' && (c < '0' || c > '9'))
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    return parse_number(document, value.at, type, bits);
+}
+
+int rf_json_get_bool(rf_json_value value, bool* out)
+{
+    if (!usable(value))
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_document* document = value.document;
+    if (document->tape)
+    {
+        uint8_t tag = tape_type(document->tape[value.at]);
+        if (tag != 't' && tag != 'f')
+        {
+            return RF_JSON_ERROR_TYPE;
+        }
+        *out = tag == 't';
+        return RF_JSON_OK;
+    }
+    uint8_t c = char_at(document, value.at);
+    if (c != 't' && c != 'f')
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_type type;
+    return parse_literal(document, value.at, &type, out);
+}
+
+int rf_json_get_i64(rf_json_value value, int64_t* out)
+{
+    rf_json_type type;
+    uint64_t bits;
+    int status = number_of(value, &type, &bits);
+    if (status != RF_JSON_OK)
+    {
+        return status;
+    }
+    if (type != RF_JSON_INTEGER)
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    *out = (int64_t)bits;
+    return RF_JSON_OK;
+}
+
+int rf_json_get_u64(rf_json_value value, uint64_t* out)
+{
+    rf_json_type type;
+    uint64_t bits;
+    int status = number_of(value, &type, &bits);
+    if (status != RF_JSON_OK)
+    {
+        return status;
+    }
+    if (type == RF_JSON_FLOAT || (type == RF_JSON_INTEGER && (int64_t)bits < 0))
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    *out = bits;
+    return RF_JSON_OK;
+}
+
+int rf_json_get_f64(rf_json_value value, double* out)
+{
+    rf_json_type type;
+    uint64_t bits;
+    int status = number_of(value, &type, &bits);
+    if (status != RF_JSON_OK)
+    {
+        return status;
+    }
+    if (type == RF_JSON_INTEGER)
+    {
+        *out = (double)(int64_t)bits;
+    }
+    else if (type == RF_JSON_UNSIGNED)
+    {
+        *out = (double)bits;
+    }
+    else
+    {
+        memcpy(out, &bits, sizeof(*out));
+    }
+    return RF_JSON_OK;
+}
+
+int rf_json_get_string(rf_json_value value, const char** data, size_t* length)
+{
+    if (!usable(value))
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_document* document = value.document;
+    if (document->tape)
+    {
+        uint64_t word = document->tape[value.at];
+        if (tape_type(word) != '"')
+        {
+            return RF_JSON_ERROR_TYPE;
+        }
+        uint64_t payload = word & TAPE_PAYLOAD_MASK;
+        const uint8_t* base = (payload & TAPE_DECODED) ? document->strings : document->src;
+        *data = (const char*)base + (payload & ~TAPE_DECODED);
+        *length = (size_t)document->tape[value.at + 1];
+        return RF_JSON_OK;
+    }
+
+    if (char_at(document, value.at) != '"')
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    size_t begin;
+    size_t end;
+    if (!string_span(document, value.at, &begin, &end))
+    {
+        *data = (const char*)document->src + begin;
+        *length = end - begin;
+        return RF_JSON_OK;
+    }
+    // Each lazy read of an escaped string decodes a fresh arena copy
+    uint8_t* decoded = rf_arena_alloc(document->arena, end - begin);
+    if (decoded == NULL)
+    {
+        return fail(document, RF_JSON_ERROR_CAPACITY, begin - 1);
+    }
+    *data = (const char*)decoded;
+    return string_decode(document, begin, end, decoded, length);
+}
+
+rf_json_bool_result rf_json_bool_of(rf_json_value value)
+{
+    rf_json_bool_result result = {false, RF_JSON_OK};
+    result.status = rf_json_get_bool(value, &result.value);
+    if (result.status != RF_JSON_OK)
+    {
+        result.value = false;
+    }
+    return result;
+}
+
+rf_json_i64_result rf_json_i64_of(rf_json_value value)
+{
+    rf_json_i64_result result = {0, RF_JSON_OK};
+    result.status = rf_json_get_i64(value, &result.value);
+    if (result.status != RF_JSON_OK)
+    {
+        result.value = 0;
+    }
+    return result;
+}
+
+rf_json_u64_result rf_json_u64_of(rf_json_value value)
+{
+    rf_json_u64_result result = {0, RF_JSON_OK};
+    result.status = rf_json_get_u64(value, &result.value);
+    if (result.status != RF_JSON_OK)
+    {
+        result.value = 0;
+    }
+    return result;
+}
+
+rf_json_f64_result rf_json_f64_of(rf_json_value value)
+{
+    rf_json_f64_result result = {0.0, RF_JSON_OK};
+    result.status = rf_json_get_f64(value, &result.value);
+    if (result.status != RF_JSON_OK)
+    {
+        result.value = 0.0;
+    }
+    return result;
+}
+
+rf_json_string_result rf_json_string_of(rf_json_value value)
+{
+    rf_json_string_result result = {NULL, 0, RF_JSON_OK};
+    result.status = rf_json_get_string(value, &result.data, &result.length);
+    if (result.status != RF_JSON_OK)
+    {
+        result.data = NULL;
+        result.length = 0;
+    }
+    return result;
+}
+
+// Positions of the first element (or key) of a container; false when empty
+static bool container_first(rf_json_value container, uint8_t open, rf_json_value* first)
+{
+    if (!usable(container))
+    {
+        return false;
+    }
+    rf_json_document* document = container.document;
+    first->document = document;
+    first->at = container.at + 1;
+    if (document->tape)
+    {
+        return tape_type(document->tape[container.at]) == open &&
+               tape_type(document->tape[first->at]) != open + 2;
+    }
+    return char_at(document, container.at) == open && char_at(document, first->at) != open + 2;
+}
+
+// Moves past the value at `at` to the next element of a container closed by
+// `close`; false at the end of the container
+static bool container_next(rf_json_document* document, size_t at, uint8_t close, size_t* next)
+{
+    if (document->tape)
+    {
+        *next = tape_skip(document, at);
+        return tape_type(document->tape[*next]) != close;
+    }
+    size_t after = lazy_skip(document, at);
+    uint8_t c = char_at(document, after);
+    if (c != ',')
+    {
+        if (c != close)
+        {
+            fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, after));
+        }
+        return false;
+    }
+    *next = after + 1;
+    return true;
+}
+
+bool rf_json_array_first(rf_json_value array, rf_json_value* element)
+{
+    return container_first(array, '[', element);
+}
+
+bool rf_json_array_next(rf_json_value* element)
+{
+    return usable(*element) && container_next(element->document, element->at, ']', &element->at);
+}
+
+int rf_json_array_at(rf_json_value array, size_t index, rf_json_value* out)
+{
+    if (rf_json_type_of(array) != RF_JSON_ARRAY)
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_value element;
+    for (bool more = rf_json_array_first(array, &element); more; more = rf_json_array_next(&element))
+    {
+        if (index-- == 0)
+        {
+            *out = element;
+            return RF_JSON_OK;
+        }
+    }
+    return RF_JSON_ERROR_NOT_FOUND;
+}
+
+static bool field_at(rf_json_document* document, size_t key_at, rf_json_value* key, rf_json_value* value)
+{
+    key->document = value->document = document;
+    key->at = key_at;
+    value->at = key_at + 2;  // past the key's two tape words, or the key and ':'
+    if (!document->tape && (char_at(document, key_at) != '"' || char_at(document, key_at + 1) != ':'))
+    {
+        fail(document, RF_JSON_ERROR_SYNTAX, offset_of(document, key_at));
+        return false;
+    }
+    return true;
+}
+
+bool rf_json_object_first(rf_json_value object, rf_json_value* key, rf_json_value* value)
+{
+    rf_json_value first;
+    return container_first(object, '{', &first) && field_at(first.document, first.at, key, value);
+}
+
+bool rf_json_object_next(rf_json_value* key, rf_json_value* value)
+{
+    size_t next;
+    return usable(*value) && container_next(value->document, value->at, '}', &next) &&
+           field_at(value->document, next, key, value);
+}
+
+int rf_json_object_find(rf_json_value object, const char* name, size_t name_length, rf_json_value* out)
+{
+    if (rf_json_type_of(object) != RF_JSON_OBJECT)
+    {
+        return RF_JSON_ERROR_TYPE;
+    }
+    rf_json_value key;
+    rf_json_value value;
+    for (bool more = rf_json_object_first(object, &key, &value); more; more = rf_json_object_next(&key, &value))
+    {
+        const char* data;
+        size_t length;
+        if (rf_json_get_string(key, &data, &length) == RF_JSON_OK && length == name_length &&
+            memcmp(data, name, length) == 0)
+        {
+            *out = value;
+            return RF_JSON_OK;
+        }
+    }
+    return RF_JSON_ERROR_NOT_FOUND;
+}
+
+size_t rf_json_count(rf_json_value container)
+{
+    rf_json_type type = rf_json_type_of(container);
+    if (type != RF_JSON_ARRAY && type != RF_JSON_OBJECT)
+    {
+        return 0;
+    }
+    rf_json_document* document = container.document;
+    if (document->tape)
+    {
+        size_t count = (size_t)(document->tape[container.at] >> 32 & TAPE_COUNT_MAX);
+        if (count < TAPE_COUNT_MAX)
+        {
+            return count;
+        }
+    }
+    size_t count = 0;
+    rf_json_value key;
+    rf_json_value value;
+    if (type == RF_JSON_ARRAY)
+    {
+        for (bool more = rf_json_array_first(container, &value); more; more = rf_json_array_next(&value))
+        {
+            count++;
+        }
+    }
+    else
+    {
+        for (bool more = rf_json_object_first(container, &key, &value); more;
+             more = rf_json_object_next(&key, &value))
+        {
+            count++;
+        }
+    }
+    return count;
+}
@@ -0,0 +1,46 @@
+/*
+ * RazorForge Runtime - JSON stage 1, AVX2 classification
+ * simdjson's table lookups: one vpshufb on the low nibble finds whitespace,
+ * another on (byte | 0x20) finds the operators, each confirmed by an equality
+ * compare. Only selected at RF_CPU_AVX2.
+ */
+
+#include <immintrin.h>
+#include "json_internal.h"
+
+#ifndef __AVX2__
+    #error "json_avx2.c must be compiled with -mavx2"
+#endif
+
+static inline uint64_t mask32(__m256i matches, int half)
+{
+    return (uint64_t)(uint32_t)_mm256_movemask_epi8(matches) << (32 * half);
+}
+
+static inline void json_classify(const uint8_t* block, rf_json_masks* masks)
+{
+    // Entries whose low nibble differs from their index never match
+    const __m256i whitespace_table = _mm256_setr_epi8(
+        ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r', 100, 100,
+        ' ', 100, 100, 100, 17, 100, 113, 2, 100, '\t', '\n', 112, 100, '\r', 100, 100);
+    const __m256i op_table = _mm256_setr_epi8(
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '{', ',', '}', 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '{', ',', '}', 0, 0);
+    masks->quote = masks->backslash = masks->op = masks->whitespace = masks->control = masks->non_ascii = 0;
+    for (int half = 0; half < 2; half++)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(block + 32 * half));
+        __m256i curled = _mm256_or_si256(input, _mm256_set1_epi8(0x20));
+        __m256i whitespace = _mm256_cmpeq_epi8(input, _mm256_shuffle_epi8(whitespace_table, input));
+        __m256i op = _mm256_cmpeq_epi8(curled, _mm256_shuffle_epi8(op_table, curled));
+        masks->quote |= mask32(_mm256_cmpeq_epi8(input, _mm256_set1_epi8('"')), half);
+        masks->backslash |= mask32(_mm256_cmpeq_epi8(input, _mm256_set1_epi8('\\')), half);
+        masks->op |= mask32(op, half);
+        masks->whitespace |= mask32(whitespace, half);
+        masks->control |= mask32(_mm256_cmpeq_epi8(_mm256_min_epu8(input, _mm256_set1_epi8(0x1F)), input), half);
+        masks->non_ascii |= mask32(input, half);
+    }
+}
+
+#define RF_JSON_STAGE1 rf_json_stage1_avx2
+#include "json_stage1.h"
@@ -0,0 +1,43 @@
+/*
+ * RazorForge Runtime - JSON (internal)
+ * Stage 1 (json_stage1.h, one copy per SIMD level) indexes every structural
+ * character, string start and scalar start; stage 2 (json.c) walks that
+ * index to build the tape, or to answer lazy accesses directly.
+ */
+
+#ifndef RAZORFORGE_JSON_INTERNAL_H
+#define RAZORFORGE_JSON_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+// 64-byte block classification produced by each kernel's json_classify
+typedef struct
+{
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t op;  // { } [ ] : ,
+    uint64_t whitespace;
+    uint64_t control;  // below 0x20
+    uint64_t non_ascii;
+} rf_json_masks;
+
+// Stage 1: offsets of the structurals in src[0..length) written to out
+// (room for length + 4 entries); returns the count, RF_JSON_STAGE1_UNCLOSED
+// when a string is still open at the end, or RF_JSON_STAGE1_CONTROL when a
+// string holds a raw control character. *non_ascii reports any byte >= 0x80.
+#define RF_JSON_STAGE1_UNCLOSED SIZE_MAX
+#define RF_JSON_STAGE1_CONTROL (SIZE_MAX - 1)
+
+typedef size_t (*rf_json_stage1_fn)(const uint8_t* src, size_t length, uint32_t* out, bool* non_ascii);
+
+size_t rf_json_stage1_scalar(const uint8_t* src, size_t length, uint32_t* out, bool* non_ascii);
+
+#ifdef RF_JSON_HAS_X86
+// json_sse2.c and json_avx2.c (-mavx2)
+size_t rf_json_stage1_sse2(const uint8_t* src, size_t length, uint32_t* out, bool* non_ascii);
+size_t rf_json_stage1_avx2(const uint8_t* src, size_t length, uint32_t* out, bool* non_ascii);
+#endif
+
+#endif // RAZORFORGE_JSON_INTERNAL_H
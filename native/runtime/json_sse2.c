@@ -0,0 +1,38 @@
+/*
+ * RazorForge Runtime - JSON stage 1, SSE2 classification
+ * Four 16-byte compares per character class; '{' '}' and '[' ']' share a
+ * compare after OR-ing in 0x20. Part of the x86-64 baseline.
+ */
+
+#include <emmintrin.h>
+#include "json_internal.h"
+
+static inline uint64_t mask16(__m128i matches, int lane)
+{
+    return (uint64_t)(uint16_t)_mm_movemask_epi8(matches) << (16 * lane);
+}
+
+static inline void json_classify(const uint8_t* block, rf_json_masks* masks)
+{
+    masks->quote = masks->backslash = masks->op = masks->whitespace = masks->control = masks->non_ascii = 0;
+    for (int lane = 0; lane < 4; lane++)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(block + 16 * lane));
+        __m128i curled = _mm_or_si128(input, _mm_set1_epi8(0x20));
+        __m128i op = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(curled, _mm_set1_epi8('{')), _mm_cmpeq_epi8(curled, _mm_set1_epi8('}'))),
+            _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8(':')), _mm_cmpeq_epi8(input, _mm_set1_epi8(','))));
+        __m128i whitespace = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(input, _mm_set1_epi8('\t'))),
+            _mm_or_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(input, _mm_set1_epi8('\r'))));
+        masks->quote |= mask16(_mm_cmpeq_epi8(input, _mm_set1_epi8('"')), lane);
+        masks->backslash |= mask16(_mm_cmpeq_epi8(input, _mm_set1_epi8('\\')), lane);
+        masks->op |= mask16(op, lane);
+        masks->whitespace |= mask16(whitespace, lane);
+        masks->control |= mask16(_mm_cmpeq_epi8(_mm_min_epu8(input, _mm_set1_epi8(0x1F)), input), lane);
+        masks->non_ascii |= mask16(input, lane);
+    }
+}
+
+#define RF_JSON_STAGE1 rf_json_stage1_sse2
+#include "json_stage1.h"
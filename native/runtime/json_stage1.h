@@ -0,0 +1,114 @@
+/*
+ * RazorForge Runtime - JSON stage 1
+ * The structural index of simdjson (Langdale and Lemire): classify 64 bytes
+ * at a time into bit masks, then resolve escapes, string interiors and
+ * scalar starts with carries between blocks, using only 64-bit word
+ * operations. The final partial block is padded with spaces. Raw control
+ * characters inside strings are rejected here, so stage 2 never rescans a
+ * string that has no escapes.
+ *
+ * Included by json.c, json_sse2.c and json_avx2.c after they define
+ *   static inline void json_classify(const uint8_t* block, rf_json_masks* masks)
+ * with RF_JSON_STAGE1 naming the function it defines.
+ */
+
+#include <string.h>
+#include "json_internal.h"
+
+#ifndef RF_JSON_STAGE1
+    #error "define RF_JSON_STAGE1 before including json_stage1.h"
+#endif
+
+// Bits that are escaped by an odd run of backslashes ending just before
+// them; *carry is whether the previous block ended mid-escape
+static inline uint64_t json_find_escaped(uint64_t backslash, uint64_t* carry)
+{
+    const uint64_t even_bits = UINT64_C(0x5555555555555555);
+    backslash &= ~*carry;
+    uint64_t follows_escape = backslash << 1 | *carry;
+    uint64_t odd_starts = backslash & ~even_bits & ~follows_escape;
+    uint64_t even_starts;
+    *carry = __builtin_add_overflow(odd_starts, backslash, &even_starts);
+    uint64_t invert = even_starts << 1;
+    return (even_bits ^ invert) & follows_escape;
+}
+
+// Bit i set when an odd number of bits at or below i are set
+static inline uint64_t json_prefix_xor(uint64_t bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Writes the offsets four at a time without checking how many are left, so
+// the loop branch is taken once per four structurals; out needs 3 entries of
+// slack past the real count
+static inline uint32_t* json_flatten(uint32_t* out, uint64_t bits, uint32_t base)
+{
+    uint32_t* end = out + __builtin_popcountll(bits);
+    while (bits != 0)
+    {
+        out[0] = base + (uint32_t)__builtin_ctzll(bits);
+        bits &= bits - 1;
+        out[1] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out[2] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out[3] = base + (uint32_t)__builtin_ctzll(bits | UINT64_C(1) << 63);
+        bits &= bits - 1;
+        out += 4;
+    }
+    return end;
+}
+
+size_t RF_JSON_STAGE1(const uint8_t* src, size_t length, uint32_t* out, bool* non_ascii)
+{
+    uint32_t* write = out;
+    uint64_t escape_carry = 0;
+    uint64_t in_string_carry = 0;  // all ones while a string is open
+    uint64_t scalar_carry = 0;     // last byte of the previous block was a scalar
+    uint64_t any_high = 0;
+    uint64_t string_control = 0;
+    uint8_t tail[64];
+
+    for (size_t base = 0; base < length; base += 64)
+    {
+        const uint8_t* block = src + base;
+        if (length - base < 64)
+        {
+            memset(tail, ' ', sizeof(tail));
+            memcpy(tail, block, length - base);
+            block = tail;
+        }
+        rf_json_masks masks;
+        json_classify(block, &masks);
+        any_high |= masks.non_ascii;
+
+        uint64_t escaped = json_find_escaped(masks.backslash, &escape_carry);
+        uint64_t quote = masks.quote & ~escaped;
+        uint64_t in_string = json_prefix_xor(quote) ^ in_string_carry;
+        in_string_carry = (uint64_t)((int64_t)in_string >> 63);
+        uint64_t string_tail = in_string ^ quote;  // interior and closing quote
+        string_control |= in_string & masks.control;
+
+        // A scalar starts at any non-operator, non-space byte that does not
+        // follow another one; opening quotes count as scalar starts
+        uint64_t scalar = ~(masks.op | masks.whitespace);
+        uint64_t follows_scalar = (scalar & ~quote) << 1 | scalar_carry;
+        scalar_carry = (scalar & ~quote) >> 63;
+        uint64_t structural = (masks.op | (scalar & ~follows_scalar)) & ~string_tail;
+
+        write = json_flatten(write, structural, (uint32_t)base);
+    }
+    *non_ascii = any_high != 0;
+    if (in_string_carry != 0)
+    {
+        return RF_JSON_STAGE1_UNCLOSED;
+    }
+    return string_control != 0 ? RF_JSON_STAGE1_CONTROL : (size_t)(write - out);
+}
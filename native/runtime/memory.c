@@ -8,11 +8,87 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_memory.h"
+#include "memory_internal.h"
 
 // Type aliases for RazorForge integration
 typedef uintptr_t uaddr;
 typedef size_t rf_size_t;
 
+/*
+ * Streaming tier: kernels and the size they start at. The threshold is 0
+ * until bound; SIZE_MAX (with NULL kernels) when streaming is unavailable.
+ */
+static rf_stream_copy_fn stream_copy_kernel = NULL;
+static rf_stream_fill_fn stream_fill_kernel = NULL;
+static size_t stream_threshold = 0;
+
+static void bind_stream_kernels(void)
+{
+    size_t threshold = SIZE_MAX;
+#ifdef RF_MEMORY_HAS_X86
+    if (rf_cpu_active_level() >= RF_CPU_SSE2)
+    {
+        __atomic_store_n(&stream_copy_kernel, rf_stream_copy_sse2, __ATOMIC_RELAXED);
+        __atomic_store_n(&stream_fill_kernel, rf_stream_fill_sse2, __ATOMIC_RELAXED);
+        threshold = rf_cpu_cache_size();
+    }
+#endif
+    __atomic_store_n(&stream_threshold, threshold, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_stream_kernels(void)
+{
+    bind_stream_kernels();
+}
+
+static inline size_t current_stream_threshold(void)
+{
+    size_t threshold = __atomic_load_n(&stream_threshold, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(threshold == 0, 0))
+    {
+        bind_stream_kernels();
+        threshold = __atomic_load_n(&stream_threshold, __ATOMIC_ACQUIRE);
+    }
+    return threshold;
+}
+
+size_t rf_memory_stream_threshold(void)
+{
+    return current_stream_threshold();
+}
+
+size_t rf_memory_set_stream_threshold(size_t bytes)
+{
+    size_t previous = current_stream_threshold();
+    if (__atomic_load_n(&stream_copy_kernel, __ATOMIC_RELAXED) == NULL)
+    {
+        return previous;  // nothing to stream with; stays SIZE_MAX
+    }
+    if (bytes == 0)
+    {
+        bytes = rf_cpu_cache_size();
+    }
+    // The kernels need 64 bytes to do anything beyond their head and tail
+    __atomic_store_n(&stream_threshold, bytes < 64 ? 64 : bytes, __ATOMIC_RELEASE);
+    return previous;
+}
+
+// memory_fill and memory_zero
+static void fill_bytes(uint8_t* dst, uint8_t value, size_t bytes)
+{
+    if (bytes >= current_stream_threshold())
+    {
+        stream_fill_kernel(dst, value, bytes);
+    }
+    else
+    {
+        memset(dst, value, bytes);
+    }
+}
+
 /*
  * Stack allocation using alloca equivalent
  * In LLVM, this will be replaced with alloca instruction
@@ -77,7 +153,7 @@ uaddr heap_realloc(uaddr address, uaddr new_bytes)
 }
 
 /*
- * Generic memory copy operation
+ * Generic memory copy operation; regions may overlap
  */
 void memory_copy(uaddr src_address, uaddr dst_address, uaddr bytes)
 {
@@ -86,10 +162,31 @@ void memory_copy(uaddr src_address, uaddr dst_address, uaddr bytes)
         return;
     }
 
-    void* src = (void*)src_address;
-    void* dst = (void*)dst_address;
+    uint8_t* src = (uint8_t*)src_address;
+    uint8_t* dst = (uint8_t*)dst_address;
 
-    memmove(dst, src, bytes); // Use memmove for overlapping regions
+    if (bytes >= current_stream_threshold() && (dst_address + bytes <= src_address ||
+                                                     src_address + bytes <= dst_address))
+    {
+        stream_copy_kernel(dst, src, bytes);
+    }
+    else
+    {
+        memmove(dst, src, bytes);
+    }
+}
+
+/*
+ * CSubsystem.rf spellings of memory_copy and memory_zero
+ */
+void copy_memory(uaddr dst_address, uaddr src_address, uaddr bytes)
+{
+    memory_copy(src_address, dst_address, bytes);
+}
+
+void zero_memory(uaddr address, uaddr bytes)
+{
+    memory_zero(address, bytes);
 }
 
 /*
@@ -213,7 +310,179 @@ void write_as_bytes(uaddr address, const void* input, uaddr bytes)
 }
 
 /*
- * Volatile read for memory-mapped I/O (danger! only)
+ * Volatile access for memory-mapped I/O (danger! only)
+ * Each call is exactly one load or store of the named width; the compiler
+ * may neither split, merge nor drop it. The address must be aligned.
+ */
+uint8_t volatile_read_u8(uaddr address)
+{
+    return *(volatile uint8_t*)address;
+}
+
+uint16_t volatile_read_u16(uaddr address)
+{
+    return *(volatile uint16_t*)address;
+}
+
+uint32_t volatile_read_u32(uaddr address)
+{
+    return *(volatile uint32_t*)address;
+}
+
+uint64_t volatile_read_u64(uaddr address)
+{
+    return *(volatile uint64_t*)address;
+}
+
+void volatile_write_u8(uaddr address, uint8_t value)
+{
+    *(volatile uint8_t*)address = value;
+}
+
+void volatile_write_u16(uaddr address, uint16_t value)
+{
+    *(volatile uint16_t*)address = value;
+}
+
+void volatile_write_u32(uaddr address, uint32_t value)
+{
+    *(volatile uint32_t*)address = value;
+}
+
+void volatile_write_u64(uaddr address, uint64_t value)
+{
+    *(volatile uint64_t*)address = value;
+}
+
+static bool valid_access(uaddr address, uaddr width)
+{
+    return (width == 1 || width == 2 || width == 4 || width == 8) && address % width == 0;
+}
+
+/*
+ * count accesses of width bytes between device memory at address and a
+ * normal buffer. stride is width for a block and 0 for a FIFO register read
+ * or written in place. The buffer side is memcpy'd, so it needs no alignment.
+ */
+static void volatile_read_run(uaddr address, uint8_t* output, uaddr count, uaddr width, uaddr stride)
+{
+    for (uaddr i = 0; i < count; i++, address += stride, output += width)
+    {
+        switch (width)
+        {
+        case 1:
+            *output = volatile_read_u8(address);
+            break;
+        case 2:
+        {
+            uint16_t value = volatile_read_u16(address);
+            memcpy(output, &value, 2);
+            break;
+        }
+        case 4:
+        {
+            uint32_t value = volatile_read_u32(address);
+            memcpy(output, &value, 4);
+            break;
+        }
+        default:
+        {
+            uint64_t value = volatile_read_u64(address);
+            memcpy(output, &value, 8);
+            break;
+        }
+        }
+    }
+}
+
+static void volatile_write_run(uaddr address, const uint8_t* input, uaddr count, uaddr width, uaddr stride)
+{
+    for (uaddr i = 0; i < count; i++, address += stride, input += width)
+    {
+        switch (width)
+        {
+        case 1:
+            volatile_write_u8(address, *input);
+            break;
+        case 2:
+        {
+            uint16_t value;
+            memcpy(&value, input, 2);
+            volatile_write_u16(address, value);
+            break;
+        }
+        case 4:
+        {
+            uint32_t value;
+            memcpy(&value, input, 4);
+            volatile_write_u32(address, value);
+            break;
+        }
+        default:
+        {
+            uint64_t value;
+            memcpy(&value, input, 8);
+            volatile_write_u64(address, value);
+            break;
+        }
+        }
+    }
+}
+
+uaddr volatile_read_block(uaddr address, void* output, uaddr count, uaddr width)
+{
+    if (address == 0 || output == NULL || count == 0 || !valid_access(address, width))
+    {
+        return 0;
+    }
+    volatile_read_run(address, output, count, width, width);
+    return count * width;
+}
+
+uaddr volatile_write_block(uaddr address, const void* input, uaddr count, uaddr width)
+{
+    if (address == 0 || input == NULL || count == 0 || !valid_access(address, width))
+    {
+        return 0;
+    }
+    volatile_write_run(address, input, count, width, width);
+    return count * width;
+}
+
+uaddr volatile_read_repeat(uaddr address, void* output, uaddr count, uaddr width)
+{
+    if (address == 0 || output == NULL || count == 0 || !valid_access(address, width))
+    {
+        return 0;
+    }
+    volatile_read_run(address, output, count, width, 0);
+    return count * width;
+}
+
+uaddr volatile_write_repeat(uaddr address, const void* input, uaddr count, uaddr width)
+{
+    if (address == 0 || input == NULL || count == 0 || !valid_access(address, width))
+    {
+        return 0;
+    }
+    volatile_write_run(address, input, count, width, 0);
+    return count * width;
+}
+
+// Widest naturally aligned access for the next part of a bytes copy
+static uaddr widest_access(uaddr address, uaddr remaining)
+{
+    uaddr width = 8;
+    while (width > 1 && (address % width != 0 || remaining < width))
+    {
+        width >>= 1;
+    }
+    return width;
+}
+
+/*
+ * Volatile copy of a byte range with no required width: single bytes up to
+ * alignment, then the widest aligned accesses that fit
  */
 void volatile_read_bytes(uaddr address, void* output, uaddr bytes)
 {
@@ -221,28 +490,33 @@ void volatile_read_bytes(uaddr address, void* output, uaddr bytes)
     {
         return;
     }
-    volatile char* src = (volatile char*)address;
-    char* dst = (char*)output;
-    for (uaddr i = 0; i < bytes; i++)
+    uint8_t* dst = output;
+    while (bytes > 0)
     {
-        dst[i] = src[i];
+        uaddr width = widest_access(address, bytes);
+        uaddr count = width == 8 ? bytes / 8 : 1;
+        volatile_read_run(address, dst, count, width, width);
+        address += count * width;
+        dst += count * width;
+        bytes -= count * width;
     }
 }
 
-/*
- * Volatile write for memory-mapped I/O (danger! only)
- */
 void volatile_write_bytes(uaddr address, const void* input, uaddr bytes)
 {
     if (address == 0 || input == NULL || bytes == 0)
     {
         return;
     }
-    volatile char* dst = (volatile char*)address;
-    const char* src = (const char*)input;
-    for (uaddr i = 0; i < bytes; i++)
+    const uint8_t* src = input;
+    while (bytes > 0)
     {
-        dst[i] = src[i];
+        uaddr width = widest_access(address, bytes);
+        uaddr count = width == 8 ? bytes / 8 : 1;
+        volatile_write_run(address, src, count, width, width);
+        address += count * width;
+        src += count * width;
+        bytes -= count * width;
     }
 }
 
@@ -274,7 +548,7 @@ void memory_fill(uaddr address, uaddr pattern_byte, uaddr bytes)
     {
         return;
     }
-    memset((void*)address, (int)(pattern_byte & 0xFF), bytes);
+    fill_bytes((uint8_t*)address, (uint8_t)(pattern_byte & 0xFF), bytes);
 }
 
 /*
@@ -286,7 +560,7 @@ void memory_zero(uaddr address, uaddr bytes)
     {
         return;
     }
-    memset((void*)address, 0, bytes);
+    fill_bytes((uint8_t*)address, 0, bytes);
 }
 
 /*
@@ -0,0 +1,43 @@
+/*
+ * RazorForge Runtime - Memory operations (internal)
+ * Streaming copy and fill kernels for the large-size tier of memory.c.
+ * They take at least 64 bytes, never overlapping for copies, and end with a
+ * store fence so the non-temporal stores are ordered before later ones.
+ *
+ * Search kernels for memory_search.c, one set per SIMD level, for what libc
+ * has no (or no fast) equivalent of. Positions are byte offsets;
+ * RF_MEMORY_NOT_FOUND when there is no match, and mismatch returns length
+ * when the ranges are equal.
+ */
+
+#ifndef RAZORFORGE_MEMORY_INTERNAL_H
+#define RAZORFORGE_MEMORY_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../include/razorforge_memory.h"
+
+typedef void (*rf_stream_copy_fn)(uint8_t* dest, const uint8_t* src, size_t length);
+typedef void (*rf_stream_fill_fn)(uint8_t* dest, uint8_t value, size_t length);
+
+#ifdef RF_MEMORY_HAS_X86
+// memory_stream_sse2.c; SSE2 is part of the x86-64 baseline
+void rf_stream_copy_sse2(uint8_t* dest, const uint8_t* src, size_t length);
+void rf_stream_fill_sse2(uint8_t* dest, uint8_t value, size_t length);
+#endif
+
+typedef struct
+{
+    size_t (*mismatch)(const uint8_t* a, const uint8_t* b, size_t length);
+    // pattern_length is at least 2 and at most length
+    size_t (*find)(const uint8_t* data, size_t length, const uint8_t* pattern, size_t pattern_length);
+    size_t (*count_byte)(const uint8_t* data, size_t length, uint8_t value);
+} rf_search_kernels;
+
+#ifdef RF_MEMORY_HAS_X86
+// memory_search_sse2.c and memory_search_avx2.c (-mavx2)
+extern const rf_search_kernels rf_search_kernels_sse2;
+extern const rf_search_kernels rf_search_kernels_avx2;
+#endif
+
+#endif // RAZORFORGE_MEMORY_INTERNAL_H
@@ -0,0 +1,191 @@
+/*
+ * RazorForge Runtime - Memory comparison and search
+ * Entry points for razorforge_memory.h over raw ranges (DynamicSlice
+ * address and size). Mismatch, substring search and byte counting have
+ * SIMD kernels in memory_search_sse2.c and memory_search_avx2.c. Ordering,
+ * equality and single-byte search go to memcmp and memchr, whose libc
+ * versions measured 1.5-2x faster than the same loops here (memory_bench).
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_memory.h"
+#include "memory_internal.h"
+
+// ============================================================================
+// Portable kernels
+// ============================================================================
+
+static inline uint64_t load_word(const uint8_t* p)
+{
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+static size_t scalar_mismatch(const uint8_t* a, const uint8_t* b, size_t length)
+{
+    size_t i = 0;
+    for (; i + 8 <= length; i += 8)
+    {
+        uint64_t difference = load_word(a + i) ^ load_word(b + i);
+        if (difference != 0)
+        {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return i + (size_t)__builtin_clzll(difference) / 8;
+#else
+            return i + (size_t)__builtin_ctzll(difference) / 8;
+#endif
+        }
+    }
+    for (; i < length; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
+static size_t scalar_find(const uint8_t* data, size_t length, const uint8_t* pattern, size_t pattern_length)
+{
+    const size_t starts = length - pattern_length + 1;
+    size_t i = 0;
+    while (i < starts)
+    {
+        const uint8_t* first = memchr(data + i, pattern[0], starts - i);
+        if (first == NULL)
+        {
+            break;
+        }
+        i = (size_t)(first - data);
+        if (memcmp(data + i + 1, pattern + 1, pattern_length - 1) == 0)
+        {
+            return i;
+        }
+        i++;
+    }
+    return RF_MEMORY_NOT_FOUND;
+}
+
+static size_t scalar_count_byte(const uint8_t* data, size_t length, uint8_t value)
+{
+    size_t total = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+static const rf_search_kernels scalar_kernels = {
+    scalar_mismatch,
+    scalar_find,
+    scalar_count_byte,
+};
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+static const rf_search_kernels* active_kernels = NULL;
+
+static void bind_search_kernels(void)
+{
+    const rf_search_kernels* kernels = &scalar_kernels;
+#ifdef RF_MEMORY_HAS_X86
+    if (rf_cpu_active_level() >= RF_CPU_AVX2)
+    {
+        kernels = &rf_search_kernels_avx2;
+    }
+    else if (rf_cpu_active_level() >= RF_CPU_SSE2)
+    {
+        kernels = &rf_search_kernels_sse2;
+    }
+#endif
+    __atomic_store_n(&active_kernels, kernels, __ATOMIC_RELEASE);
+}
+
+__attribute__((constructor))
+static void init_search_kernels(void)
+{
+    bind_search_kernels();
+}
+
+static inline const rf_search_kernels* search_kernels(void)
+{
+    const rf_search_kernels* kernels = __atomic_load_n(&active_kernels, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(kernels == NULL, 0))
+    {
+        bind_search_kernels();
+        kernels = __atomic_load_n(&active_kernels, __ATOMIC_ACQUIRE);
+    }
+    return kernels;
+}
+
+// ============================================================================
+// Public API
+// ============================================================================
+
+size_t rf_memory_mismatch(const void* a, const void* b, size_t length)
+{
+    if (length == 0 || a == b)
+    {
+        return length;
+    }
+    return search_kernels()->mismatch(a, b, length);
+}
+
+int rf_memory_equal(const void* a, const void* b, size_t length)
+{
+    return length == 0 || memcmp(a, b, length) == 0;
+}
+
+int rf_memory_compare(const void* a, const void* b, size_t length)
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+    int order = memcmp(a, b, length);
+    return (order > 0) - (order < 0);
+}
+
+int32_t compare_memory(uintptr_t a_address, uintptr_t b_address, uintptr_t bytes)
+{
+    return rf_memory_compare((const void*)a_address, (const void*)b_address, bytes);
+}
+
+size_t rf_memory_find_byte(const void* data, size_t length, uint8_t value)
+{
+    const uint8_t* found = length != 0 ? memchr(data, value, length) : NULL;
+    return found != NULL ? (size_t)(found - (const uint8_t*)data) : RF_MEMORY_NOT_FOUND;
+}
+
+size_t rf_memory_find(const void* data, size_t length, const void* pattern, size_t pattern_length)
+{
+    if (pattern_length == 0)
+    {
+        return 0;
+    }
+    if (pattern_length > length)
+    {
+        return RF_MEMORY_NOT_FOUND;
+    }
+    if (pattern_length == 1)
+    {
+        return rf_memory_find_byte(data, length, *(const uint8_t*)pattern);
+    }
+    return search_kernels()->find(data, length, pattern, pattern_length);
+}
+
+size_t rf_memory_count_byte(const void* data, size_t length, uint8_t value)
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+    return search_kernels()->count_byte(data, length, value);
+}
@@ -0,0 +1,65 @@
+/*
+ * RazorForge Runtime - Memory search, AVX2 kernels
+ * The SSE2 kernels at 32 bytes per compare. Only selected at RF_CPU_AVX2.
+ */
+
+#include <immintrin.h>
+#include "memory_internal.h"
+
+#ifndef __AVX2__
+    #error "memory_search_avx2.c must be compiled with -mavx2"
+#endif
+
+#define RF_SEARCH_WIDTH 32
+
+typedef __m256i rf_vec;
+
+static inline rf_vec vec_load(const uint8_t* p)
+{
+    return _mm256_loadu_si256((const __m256i*)p);
+}
+
+static inline rf_vec vec_splat(uint8_t value)
+{
+    return _mm256_set1_epi8((char)value);
+}
+
+static inline rf_vec vec_eq(rf_vec a, rf_vec b)
+{
+    return _mm256_cmpeq_epi8(a, b);
+}
+
+static inline rf_vec vec_and(rf_vec a, rf_vec b)
+{
+    return _mm256_and_si256(a, b);
+}
+
+static inline rf_vec vec_or(rf_vec a, rf_vec b)
+{
+    return _mm256_or_si256(a, b);
+}
+
+static inline uint32_t vec_mask(rf_vec v)
+{
+    return (uint32_t)_mm256_movemask_epi8(v);
+}
+
+static inline rf_vec vec_zero(void)
+{
+    return _mm256_setzero_si256();
+}
+
+static inline rf_vec vec_sub(rf_vec a, rf_vec b)
+{
+    return _mm256_sub_epi8(a, b);
+}
+
+static inline uint64_t vec_sum_bytes(rf_vec v)
+{
+    __m256i sums = _mm256_sad_epu8(v, _mm256_setzero_si256());
+    __m128i pairs = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+    return (uint64_t)_mm_cvtsi128_si64(pairs) + (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(pairs, pairs));
+}
+
+#define RF_SEARCH_KERNELS rf_search_kernels_avx2
+#include "memory_search_kernels.h"
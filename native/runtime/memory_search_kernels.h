@@ -0,0 +1,151 @@
+/*
+ * RazorForge Runtime - Memory search kernels
+ * One vector compare per RF_SEARCH_WIDTH bytes, reduced to a bit mask whose
+ * lowest set bit is the answer; mismatch combines four compares before
+ * testing, so its loop branches once per four vectors. The last partial vector is re-read
+ * overlapping the previous one rather than handled a byte at a time; the
+ * bytes it repeats are known not to match. Pattern search is the first and
+ * last byte filter of Wojciech Muła's SIMD-friendly substring search: only
+ * positions where both ends match are compared in full.
+ *
+ * Included by memory_search_sse2.c and memory_search_avx2.c after they
+ * define RF_SEARCH_WIDTH, rf_vec, vec_load, vec_splat, vec_eq, vec_and,
+ * vec_or, vec_mask (one bit per byte), vec_zero, vec_sub and vec_sum_bytes, with
+ * RF_SEARCH_KERNELS naming the kernel table this defines.
+ */
+
+#include <string.h>
+#include "memory_internal.h"
+
+#ifndef RF_SEARCH_KERNELS
+    #error "define RF_SEARCH_KERNELS before including memory_search_kernels.h"
+#endif
+
+#define FULL_MASK ((uint32_t)(((uint64_t)1 << RF_SEARCH_WIDTH) - 1))
+
+// Offset of the first zero bit in masks of RF_SEARCH_WIDTH bits each
+static inline size_t first_clear(uint32_t m0, uint32_t m1, uint32_t m2, uint32_t m3)
+{
+    if (m0 != FULL_MASK)
+    {
+        return (size_t)__builtin_ctz(~m0 & FULL_MASK);
+    }
+    if (m1 != FULL_MASK)
+    {
+        return RF_SEARCH_WIDTH + (size_t)__builtin_ctz(~m1 & FULL_MASK);
+    }
+    if (m2 != FULL_MASK)
+    {
+        return 2 * RF_SEARCH_WIDTH + (size_t)__builtin_ctz(~m2 & FULL_MASK);
+    }
+    return 3 * RF_SEARCH_WIDTH + (size_t)__builtin_ctz(~m3 & FULL_MASK);
+}
+
+static size_t search_mismatch(const uint8_t* a, const uint8_t* b, size_t length)
+{
+    size_t i = 0;
+    for (; i + 4 * RF_SEARCH_WIDTH <= length; i += 4 * RF_SEARCH_WIDTH)
+    {
+        rf_vec e0 = vec_eq(vec_load(a + i), vec_load(b + i));
+        rf_vec e1 = vec_eq(vec_load(a + i + RF_SEARCH_WIDTH), vec_load(b + i + RF_SEARCH_WIDTH));
+        rf_vec e2 = vec_eq(vec_load(a + i + 2 * RF_SEARCH_WIDTH), vec_load(b + i + 2 * RF_SEARCH_WIDTH));
+        rf_vec e3 = vec_eq(vec_load(a + i + 3 * RF_SEARCH_WIDTH), vec_load(b + i + 3 * RF_SEARCH_WIDTH));
+        if (vec_mask(vec_and(vec_and(e0, e1), vec_and(e2, e3))) != FULL_MASK)
+        {
+            return i + first_clear(vec_mask(e0), vec_mask(e1), vec_mask(e2), vec_mask(e3));
+        }
+    }
+    for (; i + RF_SEARCH_WIDTH <= length; i += RF_SEARCH_WIDTH)
+    {
+        uint32_t equal = vec_mask(vec_eq(vec_load(a + i), vec_load(b + i)));
+        if (equal != FULL_MASK)
+        {
+            return i + (size_t)__builtin_ctz(~equal & FULL_MASK);
+        }
+    }
+    if (i < length && length >= RF_SEARCH_WIDTH)
+    {
+        size_t last = length - RF_SEARCH_WIDTH;
+        uint32_t equal = vec_mask(vec_eq(vec_load(a + last), vec_load(b + last)));
+        return equal != FULL_MASK ? last + (size_t)__builtin_ctz(~equal & FULL_MASK) : length;
+    }
+    for (; i < length; i++)
+    {
+        if (a[i] != b[i])
+        {
+            return i;
+        }
+    }
+    return length;
+}
+
+static size_t search_find(const uint8_t* data, size_t length, const uint8_t* pattern, size_t pattern_length)
+{
+    const rf_vec first = vec_splat(pattern[0]);
+    const rf_vec last = vec_splat(pattern[pattern_length - 1]);
+    const size_t starts = length - pattern_length + 1;
+    const size_t inner = pattern_length - 2;
+
+    // i + RF_SEARCH_WIDTH <= starts keeps the second load, which ends at
+    // i + pattern_length - 1 + RF_SEARCH_WIDTH, inside data
+    size_t i = 0;
+    for (; i + RF_SEARCH_WIDTH <= starts; i += RF_SEARCH_WIDTH)
+    {
+        uint32_t candidates = vec_mask(vec_eq(vec_load(data + i), first)) &
+                              vec_mask(vec_eq(vec_load(data + i + pattern_length - 1), last));
+        while (candidates != 0)
+        {
+            size_t at = i + (size_t)__builtin_ctz(candidates);
+            if (memcmp(data + at + 1, pattern + 1, inner) == 0)
+            {
+                return at;
+            }
+            candidates &= candidates - 1;
+        }
+    }
+    for (; i < starts; i++)
+    {
+        if (data[i] == pattern[0] && data[i + pattern_length - 1] == pattern[pattern_length - 1] &&
+            memcmp(data + i + 1, pattern + 1, inner) == 0)
+        {
+            return i;
+        }
+    }
+    return RF_MEMORY_NOT_FOUND;
+}
+
+static size_t search_count_byte(const uint8_t* data, size_t length, uint8_t value)
+{
+    // Matches are 0xFF, so subtracting them counts up per byte lane; lanes
+    // are summed before they can wrap at 255
+    const rf_vec target = vec_splat(value);
+    size_t total = 0;
+    size_t i = 0;
+    while (i + RF_SEARCH_WIDTH <= length)
+    {
+        size_t vectors = (length - i) / RF_SEARCH_WIDTH;
+        if (vectors > 255)
+        {
+            vectors = 255;
+        }
+        rf_vec counts = vec_zero();
+        for (size_t v = 0; v < vectors; v++, i += RF_SEARCH_WIDTH)
+        {
+            counts = vec_sub(counts, vec_eq(vec_load(data + i), target));
+        }
+        total += vec_sum_bytes(counts);
+    }
+    for (; i < length; i++)
+    {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+const rf_search_kernels RF_SEARCH_KERNELS = {
+    search_mismatch,
+    search_find,
+    search_count_byte,
+};
+
+#undef FULL_MASK
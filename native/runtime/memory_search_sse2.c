@@ -0,0 +1,61 @@
+/*
+ * RazorForge Runtime - Memory search, SSE2 kernels
+ * 16 bytes per compare; pcmpeqb and pmovmskb give the match mask, psadbw
+ * sums the per-lane match counts. Part of the x86-64 baseline.
+ */
+
+#include <emmintrin.h>
+#include "memory_internal.h"
+
+#define RF_SEARCH_WIDTH 16
+
+typedef __m128i rf_vec;
+
+static inline rf_vec vec_load(const uint8_t* p)
+{
+    return _mm_loadu_si128((const __m128i*)p);
+}
+
+static inline rf_vec vec_splat(uint8_t value)
+{
+    return _mm_set1_epi8((char)value);
+}
+
+static inline rf_vec vec_eq(rf_vec a, rf_vec b)
+{
+    return _mm_cmpeq_epi8(a, b);
+}
+
+static inline rf_vec vec_and(rf_vec a, rf_vec b)
+{
+    return _mm_and_si128(a, b);
+}
+
+static inline rf_vec vec_or(rf_vec a, rf_vec b)
+{
+    return _mm_or_si128(a, b);
+}
+
+static inline uint32_t vec_mask(rf_vec v)
+{
+    return (uint32_t)_mm_movemask_epi8(v);
+}
+
+static inline rf_vec vec_zero(void)
+{
+    return _mm_setzero_si128();
+}
+
+static inline rf_vec vec_sub(rf_vec a, rf_vec b)
+{
+    return _mm_sub_epi8(a, b);
+}
+
+static inline uint64_t vec_sum_bytes(rf_vec v)
+{
+    __m128i sums = _mm_sad_epu8(v, _mm_setzero_si128());
+    return (uint64_t)_mm_cvtsi128_si64(sums) + (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums));
+}
+
+#define RF_SEARCH_KERNELS rf_search_kernels_sse2
+#include "memory_search_kernels.h"
@@ -0,0 +1,74 @@
+/*
+ * RazorForge Runtime - Memory operations, SSE2 streaming stores
+ * movntdq writes 64 bytes at a time around the caches once the destination
+ * is 16-byte aligned; the unaligned head and the tail below 64 bytes use
+ * ordinary stores. The source is prefetched a page ahead into the outer
+ * cache levels only; prefetchnta measured far slower, as the hardware
+ * prefetcher no longer runs ahead of it. Wider vectors do not help: the
+ * copy is bound by memory bandwidth, not by store width.
+ */
+
+#include <emmintrin.h>
+#include <string.h>
+#include "memory_internal.h"
+
+#define PREFETCH_DISTANCE 4096
+
+static inline void copy_line(uint8_t* dest, const uint8_t* src)
+{
+    __m128i a = _mm_loadu_si128((const __m128i*)src);
+    __m128i b = _mm_loadu_si128((const __m128i*)(src + 16));
+    __m128i c = _mm_loadu_si128((const __m128i*)(src + 32));
+    __m128i d = _mm_loadu_si128((const __m128i*)(src + 48));
+    _mm_stream_si128((__m128i*)dest, a);
+    _mm_stream_si128((__m128i*)(dest + 16), b);
+    _mm_stream_si128((__m128i*)(dest + 32), c);
+    _mm_stream_si128((__m128i*)(dest + 48), d);
+}
+
+// Bytes to store normally before dest reaches a 16-byte boundary
+static inline size_t head_bytes(const uint8_t* dest)
+{
+    return (16 - ((uintptr_t)dest & 15)) & 15;
+}
+
+void rf_stream_copy_sse2(uint8_t* dest, const uint8_t* src, size_t length)
+{
+    size_t head = head_bytes(dest);
+    _mm_storeu_si128((__m128i*)dest, _mm_loadu_si128((const __m128i*)src));
+    dest += head;
+    src += head;
+    length -= head;
+
+    while (length >= 64)
+    {
+        _mm_prefetch((const char*)src + PREFETCH_DISTANCE, _MM_HINT_T2);
+        copy_line(dest, src);
+        src += 64;
+        dest += 64;
+        length -= 64;
+    }
+    _mm_sfence();
+    memcpy(dest, src, length);
+}
+
+void rf_stream_fill_sse2(uint8_t* dest, uint8_t value, size_t length)
+{
+    __m128i pattern = _mm_set1_epi8((char)value);
+    size_t head = head_bytes(dest);
+    _mm_storeu_si128((__m128i*)dest, pattern);
+    dest += head;
+    length -= head;
+
+    while (length >= 64)
+    {
+        _mm_stream_si128((__m128i*)dest, pattern);
+        _mm_stream_si128((__m128i*)(dest + 16), pattern);
+        _mm_stream_si128((__m128i*)(dest + 32), pattern);
+        _mm_stream_si128((__m128i*)(dest + 48), pattern);
+        dest += 64;
+        length -= 64;
+    }
+    _mm_sfence();
+    memset(dest, value, length);
+}
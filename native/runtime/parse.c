@@ -0,0 +1,808 @@
+/*
+ * RazorForge Runtime - Number parsing
+ * Integers, binary floats and BID decimals straight from letter buffers.
+ * parse_text.h holds the scanners, instantiated once per letter width; this
+ * file holds the width-independent conversions:
+ *   floats   - Clinger's exact fast path, Eisel-Lemire on a 128-bit power
+ *              of five (as in fast_float), and for inputs whose 19-digit
+ *              truncation leaves the rounding undecided, exact decimal
+ *              shifting after Go's strconv
+ *   decimals - round half to even on the scanned digits, then BID packing
+ */
+
+#include <float.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "../include/razorforge_parse.h"
+#include "parse_pow5.h"
+
+#define RF_PARSE_CAT_(a, b) a##_##b
+#define RF_PARSE_CAT(a, b) RF_PARSE_CAT_(a, b)
+
+#define RF_PARSE_SLOW (-1)  // internal: Eisel-Lemire could not decide
+
+#define RF_SCAN_FINITE 0
+#define RF_SCAN_INF 1
+#define RF_SCAN_NAN 2
+
+#define RF_EXPONENT_LIMIT 0x10000000  // explicit exponents saturate here
+#define RF_DECIMAL_DIGITS 800         // enough for any f64 halfway point
+
+typedef struct
+{
+    bool negative;
+    int special;
+    bool too_many;  // w holds only the first 19 significant digits
+    uint64_t w;
+    int64_t q;
+} rf_number_scan;
+
+// 0.digits[0..count) * 10^point; digits past the scan capacity are dropped
+// and noted in truncated, but still counted in total
+typedef struct
+{
+    bool negative;
+    int special;
+    bool truncated;
+    size_t count;
+    int64_t total;
+    int64_t point;
+    uint8_t digits[RF_DECIMAL_DIGITS];
+} rf_parse_decimal;
+
+// ============================================================================
+// Eight digits at a time (letter8 only)
+// ============================================================================
+
+static inline uint64_t rf_read8(const unsigned char* p)
+{
+    return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 |
+           (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 |
+           (uint64_t)p[7] << 56;
+}
+
+static inline bool rf_is_eight_digits(uint64_t v)
+{
+    return (((v + UINT64_C(0x4646464646464646)) | (v - UINT64_C(0x3030303030303030))) &
+            UINT64_C(0x8080808080808080)) == 0;
+}
+
+// Pairs, then quads, then the whole octet, with two multiplies
+static inline uint32_t rf_eight_digits(uint64_t v)
+{
+    const uint64_t mask = UINT64_C(0x000000FF000000FF);
+    const uint64_t mul1 = UINT64_C(0x000F424000000064);  // 100 + (1000000 << 32)
+    const uint64_t mul2 = UINT64_C(0x0000271000000001);  // 1 + (10000 << 32)
+    v -= UINT64_C(0x3030303030303030);
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+
+// ============================================================================
+// Binary floats
+// ============================================================================
+
+typedef struct
+{
+    int mantissa_bits;  // explicit
+    int exponent_bits;
+    int minimum_exponent;  // -bias
+    int infinite_power;
+    int smallest_power_of_ten;  // below: always zero
+    int largest_power_of_ten;   // above: always infinity
+    int min_round_to_even;      // range of q where a product can be exact
+    int max_round_to_even;
+} rf_float_format;
+
+static const rf_float_format f64_format = {52, 11, -1023, 0x7FF, -342, 308, -4, 23};
+static const rf_float_format f32_format = {23, 8, -127, 0xFF, -64, 38, -17, 10};
+
+typedef struct
+{
+    uint64_t mantissa;
+    int32_t power2;  // biased; infinite_power for overflow
+} rf_adjusted_mantissa;
+
+static inline uint64_t mul_64x64(uint64_t a, uint64_t b, uint64_t* high)
+{
+#ifdef RF_HAS_INT128
+    rf_u128 product = (rf_u128)a * b;
+    *high = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+    *high = a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+    return (cross << 32) | (uint32_t)lo_lo;
+#endif
+}
+
+// floor(log2(10^q)) + 63, exact over the table range
+static inline int32_t power_of_ten_exponent(int32_t q)
+{
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+// Eisel-Lemire: w * 10^q from the truncated 128-bit 5^q, which is always
+// precise enough for a 64-bit w (Mushtak and Lemire, 2023)
+static rf_adjusted_mantissa compute_float(int64_t q, uint64_t w, const rf_float_format* f)
+{
+    rf_adjusted_mantissa answer = {0, 0};
+    if (w == 0 || q < f->smallest_power_of_ten)
+    {
+        return answer;
+    }
+    if (q > f->largest_power_of_ten)
+    {
+        answer.power2 = f->infinite_power;
+        return answer;
+    }
+
+    int leading_zeros = __builtin_clzll(w);
+    w <<= leading_zeros;
+
+    const uint64_t* power = rf_pow5_128[q - RF_POW5_MIN];
+    uint64_t high;
+    uint64_t low = mul_64x64(w, power[0], &high);
+    uint64_t precision_mask = UINT64_MAX >> (f->mantissa_bits + 3);
+    if ((high & precision_mask) == precision_mask)
+    {
+        // Low bits all ones: the truncated product may be off by one there
+        uint64_t second_high;
+        mul_64x64(w, power[1], &second_high);
+        low += second_high;
+        high += second_high > low;
+    }
+
+    int upper_bit = (int)(high >> 63);
+    int shift = upper_bit + 64 - f->mantissa_bits - 3;
+    answer.mantissa = high >> shift;
+    answer.power2 = power_of_ten_exponent((int32_t)q) + upper_bit - leading_zeros - f->minimum_exponent;
+
+    if (answer.power2 <= 0)
+    {
+        // Subnormal
+        if (-answer.power2 + 1 >= 64)
+        {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+        answer.power2 = answer.mantissa < (UINT64_C(1) << f->mantissa_bits) ? 0 : 1;
+        return answer;
+    }
+
+    // An exact product halfway between two floats rounds to even rather
+    // than up; exactness is only possible for small q
+    if (low <= 1 && q >= f->min_round_to_even && q <= f->max_round_to_even &&
+        (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == high)
+    {
+        answer.mantissa &= ~UINT64_C(1);
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+    if (answer.mantissa >= (UINT64_C(2) << f->mantissa_bits))
+    {
+        answer.mantissa = UINT64_C(1) << f->mantissa_bits;
+        answer.power2++;
+    }
+    answer.mantissa &= ~(UINT64_C(1) << f->mantissa_bits);
+    if (answer.power2 >= f->infinite_power)
+    {
+        answer.mantissa = 0;
+        answer.power2 = f->infinite_power;
+    }
+    return answer;
+}
+
+static inline uint64_t float_bits(rf_adjusted_mantissa am, bool negative, const rf_float_format* f)
+{
+    return am.mantissa | (uint64_t)am.power2 << f->mantissa_bits |
+           (uint64_t)negative << (f->mantissa_bits + f->exponent_bits);
+}
+
+// RF_PARSE_OVERFLOW when rounding reached infinity
+static inline int float_status(rf_adjusted_mantissa am, const rf_float_format* f)
+{
+    return am.power2 == f->infinite_power ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+static uint64_t special_bits(const rf_number_scan* scan, const rf_float_format* f)
+{
+    rf_adjusted_mantissa am = {0, f->infinite_power};
+    if (scan->special == RF_SCAN_NAN)
+    {
+        am.mantissa = UINT64_C(1) << (f->mantissa_bits - 1);  // quiet
+    }
+    return float_bits(am, scan->negative, f);
+}
+
+// Bits for w * 10^q, or RF_PARSE_SLOW when digits past the 19th could
+// change the rounding (w and w + 1 round differently)
+static int bits_from_scan(const rf_number_scan* scan, const rf_float_format* f, uint64_t* bits)
+{
+    rf_adjusted_mantissa am = compute_float(scan->q, scan->w, f);
+    if (scan->too_many)
+    {
+        rf_adjusted_mantissa above = compute_float(scan->q, scan->w + 1, f);
+        if (am.mantissa != above.mantissa || am.power2 != above.power2)
+        {
+            return RF_PARSE_SLOW;
+        }
+    }
+    *bits = float_bits(am, scan->negative, f);
+    return float_status(am, f);
+}
+
+static const double exact_powers_f64[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                          1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                          1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+static const float exact_powers_f32[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                         1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+static int f64_from_scan(const rf_number_scan* scan, double* out)
+{
+    uint64_t bits;
+    int status = RF_PARSE_OK;
+    if (scan->special != RF_SCAN_FINITE)
+    {
+        bits = special_bits(scan, &f64_format);
+    }
+#if FLT_EVAL_METHOD == 0
+    // Clinger: both operands exact, so one IEEE operation rounds correctly
+    else if (!scan->too_many && scan->q >= -22 && scan->q <= 22 && scan->w <= UINT64_C(1) << 53)
+    {
+        double value = (double)scan->w;
+        value = scan->q < 0 ? value / exact_powers_f64[-scan->q] : value * exact_powers_f64[scan->q];
+        *out = scan->negative ? -value : value;
+        return RF_PARSE_OK;
+    }
+#endif
+    else
+    {
+        status = bits_from_scan(scan, &f64_format, &bits);
+        if (status == RF_PARSE_SLOW)
+        {
+            return status;
+        }
+    }
+    memcpy(out, &bits, sizeof(*out));
+    return status;
+}
+
+static int f32_from_scan(const rf_number_scan* scan, float* out)
+{
+    uint64_t bits;
+    int status = RF_PARSE_OK;
+    if (scan->special != RF_SCAN_FINITE)
+    {
+        bits = special_bits(scan, &f32_format);
+    }
+#if FLT_EVAL_METHOD == 0
+    else if (!scan->too_many && scan->q >= -10 && scan->q <= 10 && scan->w <= UINT64_C(1) << 24)
+    {
+        float value = (float)scan->w;
+        value = scan->q < 0 ? value / exact_powers_f32[-scan->q] : value * exact_powers_f32[scan->q];
+        *out = scan->negative ? -value : value;
+        return RF_PARSE_OK;
+    }
+#endif
+    else
+    {
+        status = bits_from_scan(scan, &f32_format, &bits);
+        if (status == RF_PARSE_SLOW)
+        {
+            return status;
+        }
+    }
+    uint32_t narrow = (uint32_t)bits;
+    memcpy(out, &narrow, sizeof(*out));
+    return status;
+}
+
+// ============================================================================
+// Binary floats, slow path: exact decimal arithmetic (Go's strconv decimal)
+// Repeatedly shifts the decimal by powers of two until it lies in [1/2, 1),
+// then reads off the mantissa with round-half-even on the remaining digits.
+// ============================================================================
+
+#define RF_MAX_SHIFT 60  // n * 10 + 9 must fit in 64 bits while shifting
+
+static void decimal_trim(rf_parse_decimal* d)
+{
+    while (d->count > 0 && d->digits[d->count - 1] == 0)
+    {
+        d->count--;
+    }
+    if (d->count == 0)
+    {
+        d->point = 0;
+    }
+}
+
+static void decimal_right_shift(rf_parse_decimal* d, unsigned k)
+{
+    size_t read = 0;
+    size_t write = 0;
+    uint64_t n = 0;
+    for (; (n >> k) == 0; read++)
+    {
+        if (read >= d->count)
+        {
+            if (n == 0)
+            {
+                d->count = 0;
+                return;
+            }
+            while ((n >> k) == 0)
+            {
+                n *= 10;
+                read++;
+            }
+            break;
+        }
+        n = n * 10 + d->digits[read];
+    }
+    d->point -= (int64_t)read - 1;
+
+    uint64_t mask = (UINT64_C(1) << k) - 1;
+    for (; read < d->count; read++)
+    {
+        uint64_t digit = n >> k;
+        n &= mask;
+        d->digits[write++] = (uint8_t)digit;
+        n = n * 10 + d->digits[read];
+    }
+    while (n > 0)
+    {
+        uint64_t digit = n >> k;
+        n &= mask;
+        if (write < RF_DECIMAL_DIGITS)
+        {
+            d->digits[write++] = (uint8_t)digit;
+        }
+        else if (digit > 0)
+        {
+            d->truncated = true;
+        }
+        n *= 10;
+    }
+    d->count = write;
+    decimal_trim(d);
+}
+
+// Multiplies right to left into a scratch buffer; the carry out of the top
+// digit becomes the new leading digits
+static void decimal_left_shift(rf_parse_decimal* d, unsigned k)
+{
+    if (d->count == 0)
+    {
+        return;
+    }
+    uint8_t buffer[RF_DECIMAL_DIGITS + 20];
+    size_t start = sizeof(buffer);
+    uint64_t carry = 0;
+    for (size_t read = d->count; read-- > 0;)
+    {
+        uint64_t n = ((uint64_t)d->digits[read] << k) + carry;
+        carry = n / 10;
+        buffer[--start] = (uint8_t)(n % 10);
+    }
+    while (carry > 0)
+    {
+        buffer[--start] = (uint8_t)(carry % 10);
+        carry /= 10;
+    }
+
+    size_t produced = sizeof(buffer) - start;
+    d->point += (int64_t)(produced - d->count);
+    size_t keep = produced < RF_DECIMAL_DIGITS ? produced : RF_DECIMAL_DIGITS;
+    for (size_t i = keep; i < produced; i++)
+    {
+        d->truncated = d->truncated || buffer[start + i] != 0;
+    }
+    memcpy(d->digits, buffer + start, keep);
+    d->count = keep;
+    decimal_trim(d);
+}
+
+static void decimal_shift(rf_parse_decimal* d, int k)
+{
+    for (; k > RF_MAX_SHIFT; k -= RF_MAX_SHIFT)
+    {
+        decimal_left_shift(d, RF_MAX_SHIFT);
+    }
+    for (; k < -RF_MAX_SHIFT; k += RF_MAX_SHIFT)
+    {
+        decimal_right_shift(d, RF_MAX_SHIFT);
+    }
+    if (k > 0)
+    {
+        decimal_left_shift(d, (unsigned)k);
+    }
+    else if (k < 0)
+    {
+        decimal_right_shift(d, (unsigned)-k);
+    }
+}
+
+// Whether dropping digits from position `at` on rounds up (half to even)
+static bool decimal_round_up(const rf_parse_decimal* d, int64_t at)
+{
+    if (at < 0 || (size_t)at >= d->count)
+    {
+        return false;
+    }
+    if (d->digits[at] == 5 && (size_t)at + 1 == d->count)
+    {
+        return d->truncated || (at > 0 && (d->digits[at - 1] & 1));
+    }
+    return d->digits[at] >= 5;
+}
+
+static uint64_t decimal_rounded_integer(const rf_parse_decimal* d)
+{
+    if (d->point > 20)
+    {
+        return UINT64_MAX;
+    }
+    uint64_t n = 0;
+    int64_t i = 0;
+    for (; i < d->point && (size_t)i < d->count; i++)
+    {
+        n = n * 10 + d->digits[i];
+    }
+    for (; i < d->point; i++)
+    {
+        n *= 10;
+    }
+    return n + decimal_round_up(d, d->point);
+}
+
+// Bits of the decimal in format f; *overflow when it rounds to infinity
+static uint64_t decimal_float_bits(rf_parse_decimal* d, const rf_float_format* f, bool* overflow)
+{
+    // Binary exponent steps that keep the decimal point moving by about
+    // one place per step: powers[n] bits cover n decimal places
+    static const int powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+    const int power_count = (int)(sizeof(powers) / sizeof(powers[0]));
+    const int bias = f->minimum_exponent;
+    const int exponent_limit = (1 << f->exponent_bits) - 1;
+    rf_adjusted_mantissa am = {0, 0};
+    *overflow = false;
+
+    decimal_trim(d);
+    if (d->count == 0 || d->point < -330)
+    {
+        return float_bits(am, d->negative, f);
+    }
+    if (d->point > 310)
+    {
+        goto overflow;
+    }
+
+    int exponent = 0;
+    while (d->point > 0)
+    {
+        int n = d->point >= power_count ? 27 : powers[d->point];
+        decimal_shift(d, -n);
+        exponent += n;
+    }
+    while (d->point < 0 || (d->point == 0 && d->digits[0] < 5))
+    {
+        int n = -d->point >= power_count ? 27 : powers[-d->point];
+        decimal_shift(d, n);
+        exponent -= n;
+    }
+
+    // Now in [1/2, 1); the float's mantissa is in [1, 2)
+    exponent--;
+    if (exponent < bias + 1)
+    {
+        int n = bias + 1 - exponent;
+        decimal_shift(d, -n);
+        exponent += n;
+    }
+    if (exponent - bias >= exponent_limit)
+    {
+        goto overflow;
+    }
+
+    decimal_shift(d, 1 + f->mantissa_bits);
+    uint64_t mantissa = decimal_rounded_integer(d);
+    if (mantissa == UINT64_C(2) << f->mantissa_bits)
+    {
+        mantissa >>= 1;
+        exponent++;
+        if (exponent - bias >= exponent_limit)
+        {
+            goto overflow;
+        }
+    }
+    if ((mantissa & (UINT64_C(1) << f->mantissa_bits)) == 0)
+    {
+        exponent = bias;  // subnormal
+    }
+    am.mantissa = mantissa & ((UINT64_C(1) << f->mantissa_bits) - 1);
+    am.power2 = exponent - bias;
+    return float_bits(am, d->negative, f);
+
+overflow:
+    *overflow = true;
+    am.power2 = f->infinite_power;
+    return float_bits(am, d->negative, f);
+}
+
+static int f64_from_decimal(rf_parse_decimal* d, double* out)
+{
+    bool overflow;
+    uint64_t bits = decimal_float_bits(d, &f64_format, &overflow);
+    memcpy(out, &bits, sizeof(*out));
+    return overflow ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+static int f32_from_decimal(rf_parse_decimal* d, float* out)
+{
+    bool overflow;
+    uint32_t bits = (uint32_t)decimal_float_bits(d, &f32_format, &overflow);
+    memcpy(out, &bits, sizeof(*out));
+    return overflow ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+// ============================================================================
+// Decimal floats (IEEE 754 BID)
+// ============================================================================
+
+typedef struct
+{
+    int precision;  // coefficient digits
+    int64_t min_exponent;  // of the coefficient's last digit
+    int64_t max_exponent;
+    int64_t bias;
+} rf_decimal_format;
+
+static const rf_decimal_format d32_format = {7, -101, 90, 101};
+static const rf_decimal_format d64_format = {16, -398, 369, 398};
+#ifdef RF_HAS_INT128
+static const rf_decimal_format d128_format = {34, -6176, 6111, 6176};
+#endif
+
+// Rounds the scanned digits to a coefficient of at most f->precision digits
+// (left in d->digits[0..d->count)) at an exponent inside the format's range,
+// returned; RF_PARSE_OVERFLOW when the value is too large for any exponent
+static int decimal_round(rf_parse_decimal* d, const rf_decimal_format* f, int64_t* exponent)
+{
+    if (d->total == 0)
+    {
+        // Zero keeps its exponent, clamped ("0.00" is 0E-2)
+        d->count = 0;
+        *exponent = d->point < f->min_exponent   ? f->min_exponent
+                    : d->point > f->max_exponent ? f->max_exponent
+                                                 : d->point;
+        return RF_PARSE_OK;
+    }
+
+    int64_t keep = d->total < f->precision ? d->total : f->precision;
+    int64_t q = d->point - keep;
+    if (q < f->min_exponent)
+    {
+        keep -= f->min_exponent - q;
+        q = f->min_exponent;
+    }
+
+    // keep < 0 leaves less than a tenth of the smallest step: rounds to zero
+    int round_digit = 0;
+    bool sticky = d->truncated || keep < 0;
+    if (keep < 0)
+    {
+        keep = 0;
+    }
+    else if ((size_t)keep < d->count)
+    {
+        round_digit = d->digits[keep];
+        for (size_t i = (size_t)keep + 1; i < d->count; i++)
+        {
+            sticky = sticky || d->digits[i] != 0;
+        }
+    }
+    size_t n = (size_t)keep;
+
+    bool odd = n > 0 && (d->digits[n - 1] & 1);
+    if (round_digit > 5 || (round_digit == 5 && (sticky || odd)))
+    {
+        size_t i = n;
+        while (i > 0 && d->digits[i - 1] == 9)
+        {
+            d->digits[--i] = 0;
+        }
+        if (i > 0)
+        {
+            d->digits[i - 1]++;
+        }
+        else
+        {
+            // 99..9 + 1 = 10..0, one digit longer
+            d->digits[n] = 0;
+            d->digits[0] = 1;
+            if ((int64_t)n + 1 > f->precision)
+            {
+                q++;
+            }
+            else
+            {
+                n++;
+            }
+        }
+    }
+
+    // Too large an exponent: trade it for trailing zeros while they fit
+    while (q > f->max_exponent && (int64_t)n < f->precision)
+    {
+        d->digits[n++] = 0;
+        q--;
+    }
+    d->count = n;
+    *exponent = q;
+    return q > f->max_exponent ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+static uint64_t decimal_coefficient_u64(const rf_parse_decimal* d)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < d->count; i++)
+    {
+        value = value * 10 + d->digits[i];
+    }
+    return value;
+}
+
+static int d32_from_decimal(rf_parse_decimal* d, uint32_t* out)
+{
+    uint32_t sign = (uint32_t)d->negative << 31;
+    if (d->special != RF_SCAN_FINITE)
+    {
+        *out = sign | (d->special == RF_SCAN_NAN ? UINT32_C(0x7C000000) : UINT32_C(0x78000000));
+        return RF_PARSE_OK;
+    }
+    int64_t q;
+    if (decimal_round(d, &d32_format, &q) != RF_PARSE_OK)
+    {
+        *out = sign | UINT32_C(0x78000000);
+        return RF_PARSE_OVERFLOW;
+    }
+    uint32_t coefficient = (uint32_t)decimal_coefficient_u64(d);
+    uint32_t biased = (uint32_t)(q + d32_format.bias);
+    if (coefficient < (UINT32_C(1) << 23))
+    {
+        *out = sign | biased << 23 | coefficient;
+    }
+    else
+    {
+        // Coefficient 0b100xxx..: implicit prefix, exponent shifted down
+        *out = sign | UINT32_C(3) << 29 | biased << 21 | (coefficient & UINT32_C(0x1FFFFF));
+    }
+    return RF_PARSE_OK;
+}
+
+static int d64_from_decimal(rf_parse_decimal* d, uint64_t* out)
+{
+    uint64_t sign = (uint64_t)d->negative << 63;
+    if (d->special != RF_SCAN_FINITE)
+    {
+        *out = sign | (d->special == RF_SCAN_NAN ? UINT64_C(0x7C00000000000000)
+                                                 : UINT64_C(0x7800000000000000));
+        return RF_PARSE_OK;
+    }
+    int64_t q;
+    if (decimal_round(d, &d64_format, &q) != RF_PARSE_OK)
+    {
+        *out = sign | UINT64_C(0x7800000000000000);
+        return RF_PARSE_OVERFLOW;
+    }
+    uint64_t coefficient = decimal_coefficient_u64(d);
+    uint64_t biased = (uint64_t)(q + d64_format.bias);
+    if (coefficient < (UINT64_C(1) << 53))
+    {
+        *out = sign | biased << 53 | coefficient;
+    }
+    else
+    {
+        *out = sign | UINT64_C(3) << 61 | biased << 51 | (coefficient & ((UINT64_C(1) << 51) - 1));
+    }
+    return RF_PARSE_OK;
+}
+
+#ifdef RF_HAS_INT128
+// 34 digits stay below 2^113, so the short coefficient form always applies
+static int d128_from_decimal(rf_parse_decimal* d, rf_u128* out)
+{
+    rf_u128 sign = (rf_u128)d->negative << 127;
+    if (d->special != RF_SCAN_FINITE)
+    {
+        *out = sign | (rf_u128)(d->special == RF_SCAN_NAN ? UINT64_C(0x7C00000000000000)
+                                                          : UINT64_C(0x7800000000000000))
+                          << 64;
+        return RF_PARSE_OK;
+    }
+    int64_t q;
+    if (decimal_round(d, &d128_format, &q) != RF_PARSE_OK)
+    {
+        *out = sign | (rf_u128)UINT64_C(0x7800000000000000) << 64;
+        return RF_PARSE_OVERFLOW;
+    }
+    rf_u128 coefficient = 0;
+    for (size_t i = 0; i < d->count; i++)
+    {
+        coefficient = coefficient * 10 + d->digits[i];
+    }
+    *out = sign | (rf_u128)(uint64_t)(q + d128_format.bias) << 113 | coefficient;
+    return RF_PARSE_OK;
+}
+#endif
+
+// ============================================================================
+// Instantiations
+// ============================================================================
+
+#define RF_PARSE_LETTER unsigned char
+#define RF_PARSE_TEXT char
+#define RF_PARSE_SUFFIX letter8
+#define RF_PARSE_SWAR 1
+#include "parse_text.h"
+
+#define RF_PARSE_LETTER uint16_t
+#define RF_PARSE_TEXT uint16_t
+#define RF_PARSE_SUFFIX letter16
+#define RF_PARSE_SWAR 0
+#include "parse_text.h"
+
+#define RF_PARSE_LETTER uint32_t
+#define RF_PARSE_TEXT uint32_t
+#define RF_PARSE_SUFFIX letter32
+#define RF_PARSE_SWAR 0
+#include "parse_text.h"
+
+// Letter width chosen at run time, for callers generic over the letter type
+#define RF_PARSE_DEFINE_LETTERS(N, T)                                                        \
+    int rf_##N##_parse_letters(const void* text, size_t length, size_t letter_size, T* out) \
+    {                                                                                        \
+        switch (letter_size)                                                                 \
+        {                                                                                    \
+        case 1:                                                                              \
+            return rf_##N##_parse_letter8((const char*)text, length, out);                   \
+        case 2:                                                                              \
+            return rf_##N##_parse_letter16((const uint16_t*)text, length, out);              \
+        case 4:                                                                              \
+            return rf_##N##_parse_letter32((const uint32_t*)text, length, out);              \
+        default:                                                                             \
+            return RF_PARSE_INVALID;                                                         \
+        }                                                                                    \
+    }
+
+RF_PARSE_DEFINE_LETTERS(i8, int8_t)
+RF_PARSE_DEFINE_LETTERS(i16, int16_t)
+RF_PARSE_DEFINE_LETTERS(i32, int32_t)
+RF_PARSE_DEFINE_LETTERS(i64, int64_t)
+RF_PARSE_DEFINE_LETTERS(u8, uint8_t)
+RF_PARSE_DEFINE_LETTERS(u16, uint16_t)
+RF_PARSE_DEFINE_LETTERS(u32, uint32_t)
+RF_PARSE_DEFINE_LETTERS(u64, uint64_t)
+RF_PARSE_DEFINE_LETTERS(f32, float)
+RF_PARSE_DEFINE_LETTERS(f64, double)
+RF_PARSE_DEFINE_LETTERS(d32, uint32_t)
+RF_PARSE_DEFINE_LETTERS(d64, uint64_t)
+#ifdef RF_HAS_INT128
+RF_PARSE_DEFINE_LETTERS(i128, rf_i128)
+RF_PARSE_DEFINE_LETTERS(u128, rf_u128)
+RF_PARSE_DEFINE_LETTERS(d128, rf_u128)
+#endif
@@ -0,0 +1,464 @@
+/*
+ * RazorForge Runtime - Number parsing, per-letter-width scanners
+ * The text-facing half of parse.c: syntax checks and digit accumulation,
+ * written once and instantiated for each letter width. Everything after the
+ * scan (rounding, Eisel-Lemire, BID packing) is width-independent and lives
+ * in parse.c.
+ *
+ * Included by parse.c three times with
+ *   RF_PARSE_LETTER  unsigned letter type read from the buffer
+ *   RF_PARSE_TEXT    letter type in the public signatures
+ *   RF_PARSE_SUFFIX  suffix of the public names (letter8, ...)
+ *   RF_PARSE_SWAR    1 to take eight ASCII digits per step
+ */
+
+#if !defined(RF_PARSE_LETTER) || !defined(RF_PARSE_TEXT) || !defined(RF_PARSE_SUFFIX)
+    #error "define RF_PARSE_LETTER, RF_PARSE_TEXT and RF_PARSE_SUFFIX before including parse_text.h"
+#endif
+
+#define RF_PARSE_FN(name) RF_PARSE_CAT(name, RF_PARSE_SUFFIX)
+#define L RF_PARSE_LETTER
+
+// Digit value, or something above 9 for any other letter
+static inline uint32_t RF_PARSE_FN(digit)(L c)
+{
+    return (uint32_t)c - '0';
+}
+
+// ASCII-only case folding: c | 0x20 equals a lowercase letter only for that
+// letter and its uppercase form, whatever the width of c
+static inline bool RF_PARSE_FN(letter_is)(L c, char lower)
+{
+    return ((uint32_t)c | 0x20) == (uint32_t)lower;
+}
+
+// "inf", "infinity" or "nan" filling [p, end)
+static bool RF_PARSE_FN(scan_special)(const L* p, const L* end, int* special)
+{
+    static const char infinity[] = "infinity";
+    size_t length = (size_t)(end - p);
+    if (length == 3 && RF_PARSE_FN(letter_is)(p[0], 'n') && RF_PARSE_FN(letter_is)(p[1], 'a') &&
+        RF_PARSE_FN(letter_is)(p[2], 'n'))
+    {
+        *special = RF_SCAN_NAN;
+        return true;
+    }
+    if (length != 3 && length != 8)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++)
+    {
+        if (!RF_PARSE_FN(letter_is)(p[i], infinity[i]))
+        {
+            return false;
+        }
+    }
+    *special = RF_SCAN_INF;
+    return true;
+}
+
+// Exponent suffix starting at *p ('e' already matched); saturates far beyond
+// any representable exponent so huge inputs cannot overflow
+static bool RF_PARSE_FN(scan_exponent)(const L** cursor, const L* end, int64_t* exponent)
+{
+    const L* p = *cursor;
+    bool negative = false;
+    if (p != end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        p++;
+    }
+    if (p == end || RF_PARSE_FN(digit)(*p) > 9)
+    {
+        return false;
+    }
+    int64_t value = 0;
+    for (; p != end && RF_PARSE_FN(digit)(*p) <= 9; p++)
+    {
+        if (value < RF_EXPONENT_LIMIT)
+        {
+            value = value * 10 + RF_PARSE_FN(digit)(*p);
+        }
+    }
+    *exponent = negative ? -value : value;
+    *cursor = p;
+    return true;
+}
+
+// ============================================================================
+// Float scan: the first 19 significant digits as an integer w and a power
+// of ten q, as fast_float's parse_number_string
+// ============================================================================
+
+static int RF_PARSE_FN(scan_number)(const L* text, size_t length, rf_number_scan* scan)
+{
+    const L* p = text;
+    const L* end = text + length;
+    scan->negative = false;
+    scan->special = RF_SCAN_FINITE;
+    scan->too_many = false;
+    if (p != end && (*p == '-' || *p == '+'))
+    {
+        scan->negative = *p == '-';
+        p++;
+    }
+    if (p != end && RF_PARSE_FN(digit)(*p) > 9 && *p != '.')
+    {
+        return RF_PARSE_FN(scan_special)(p, end, &scan->special) ? RF_PARSE_OK : RF_PARSE_INVALID;
+    }
+
+    const L* integer_start = p;
+    uint64_t w = 0;
+#if RF_PARSE_SWAR
+    while (end - p >= 8 && rf_is_eight_digits(rf_read8(p)))
+    {
+        w = w * 100000000 + rf_eight_digits(rf_read8(p));
+        p += 8;
+    }
+#endif
+    for (; p != end && RF_PARSE_FN(digit)(*p) <= 9; p++)
+    {
+        w = w * 10 + RF_PARSE_FN(digit)(*p);
+    }
+    const L* integer_end = p;
+
+    const L* fraction_start = p;
+    int64_t exponent = 0;
+    if (p != end && *p == '.')
+    {
+        fraction_start = ++p;
+#if RF_PARSE_SWAR
+        while (end - p >= 8 && rf_is_eight_digits(rf_read8(p)))
+        {
+            w = w * 100000000 + rf_eight_digits(rf_read8(p));
+            p += 8;
+        }
+#endif
+        for (; p != end && RF_PARSE_FN(digit)(*p) <= 9; p++)
+        {
+            w = w * 10 + RF_PARSE_FN(digit)(*p);
+        }
+        exponent = fraction_start - p;
+    }
+    const L* fraction_end = p;
+    size_t digit_count = (size_t)(integer_end - integer_start) + (size_t)(fraction_end - fraction_start);
+    if (digit_count == 0)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    int64_t explicit_exponent = 0;
+    if (p != end && RF_PARSE_FN(letter_is)(*p, 'e'))
+    {
+        p++;
+        if (!RF_PARSE_FN(scan_exponent)(&p, end, &explicit_exponent))
+        {
+            return RF_PARSE_INVALID;
+        }
+    }
+    if (p != end)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    if (digit_count > 19)
+    {
+        // Leading zeros do not count; if 19 significant digits remain, w has
+        // wrapped and is rebuilt from the first 19 of them
+        for (const L* s = integer_start; s != fraction_end && (*s == '0' || *s == '.'); s++)
+        {
+            digit_count -= *s == '0';
+        }
+        if (digit_count > 19)
+        {
+            const uint64_t nineteen_digits = UINT64_C(1000000000000000000);
+            scan->too_many = true;
+            w = 0;
+            p = integer_start;
+            for (; w < nineteen_digits && p != integer_end; p++)
+            {
+                w = w * 10 + RF_PARSE_FN(digit)(*p);
+            }
+            if (w >= nineteen_digits)
+            {
+                exponent = integer_end - p;
+            }
+            else
+            {
+                for (p = fraction_start; w < nineteen_digits && p != fraction_end; p++)
+                {
+                    w = w * 10 + RF_PARSE_FN(digit)(*p);
+                }
+                exponent = fraction_start - p;
+            }
+        }
+    }
+
+    scan->w = w;
+    scan->q = exponent + explicit_exponent;
+    return RF_PARSE_OK;
+}
+
+// ============================================================================
+// Exact scan: every significant digit (up to capacity) for the decimal
+// types and the float slow path
+// ============================================================================
+
+static int RF_PARSE_FN(scan_digits)(const L* text, size_t length, rf_parse_decimal* d, size_t capacity)
+{
+    const L* p = text;
+    const L* end = text + length;
+    d->negative = false;
+    d->special = RF_SCAN_FINITE;
+    d->count = 0;
+    d->total = 0;
+    d->truncated = false;
+    if (p != end && (*p == '-' || *p == '+'))
+    {
+        d->negative = *p == '-';
+        p++;
+    }
+    if (p != end && RF_PARSE_FN(digit)(*p) > 9 && *p != '.')
+    {
+        return RF_PARSE_FN(scan_special)(p, end, &d->special) ? RF_PARSE_OK : RF_PARSE_INVALID;
+    }
+
+    bool saw_digit = false;
+    bool saw_point = false;
+    int64_t digits_before_point = 0;
+    int64_t leading_fraction_zeros = 0;
+    for (; p != end; p++)
+    {
+        if (*p == '.')
+        {
+            if (saw_point)
+            {
+                return RF_PARSE_INVALID;
+            }
+            saw_point = true;
+            digits_before_point = d->total;
+            continue;
+        }
+        uint32_t digit = RF_PARSE_FN(digit)(*p);
+        if (digit > 9)
+        {
+            break;
+        }
+        saw_digit = true;
+        if (d->total == 0 && digit == 0)
+        {
+            leading_fraction_zeros += saw_point;
+            continue;
+        }
+        if (d->count < capacity)
+        {
+            d->digits[d->count++] = (uint8_t)digit;
+        }
+        else if (digit != 0)
+        {
+            d->truncated = true;
+        }
+        d->total++;
+    }
+    if (!saw_digit)
+    {
+        return RF_PARSE_INVALID;
+    }
+
+    int64_t exponent = 0;
+    if (p != end && RF_PARSE_FN(letter_is)(*p, 'e'))
+    {
+        p++;
+        if (!RF_PARSE_FN(scan_exponent)(&p, end, &exponent))
+        {
+            return RF_PARSE_INVALID;
+        }
+    }
+    if (p != end)
+    {
+        return RF_PARSE_INVALID;
+    }
+    d->point = (saw_point ? digits_before_point : d->total) - leading_fraction_zeros + exponent;
+    return RF_PARSE_OK;
+}
+
+// ============================================================================
+// Integer scan: optional sign, then digits accumulated with overflow checks
+// (scanning continues after an overflow so malformed text reports invalid)
+// ============================================================================
+
+static const L* RF_PARSE_FN(scan_sign)(const L* text, size_t length, bool allow_negative, bool* negative)
+{
+    *negative = false;
+    if (length > 0 && (text[0] == '+' || (allow_negative && text[0] == '-')))
+    {
+        *negative = text[0] == '-';
+        return text + 1;
+    }
+    return text;
+}
+
+static int RF_PARSE_FN(scan_u64)(const L* text, size_t length, bool allow_negative, bool* negative,
+                                 uint64_t* out)
+{
+    const L* end = text + length;
+    const L* p = RF_PARSE_FN(scan_sign)(text, length, allow_negative, negative);
+    if (p == end)
+    {
+        return RF_PARSE_INVALID;
+    }
+    uint64_t value = 0;
+    bool overflow = false;
+#if RF_PARSE_SWAR
+    while (end - p >= 8 && rf_is_eight_digits(rf_read8(p)))
+    {
+        overflow = overflow || __builtin_mul_overflow(value, UINT64_C(100000000), &value) ||
+                   __builtin_add_overflow(value, rf_eight_digits(rf_read8(p)), &value);
+        p += 8;
+    }
+#endif
+    for (; p != end; p++)
+    {
+        uint32_t digit = RF_PARSE_FN(digit)(*p);
+        if (digit > 9)
+        {
+            return RF_PARSE_INVALID;
+        }
+        overflow = overflow || __builtin_mul_overflow(value, UINT64_C(10), &value) ||
+                   __builtin_add_overflow(value, digit, &value);
+    }
+    *out = value;
+    return overflow ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+
+#ifdef RF_HAS_INT128
+static int RF_PARSE_FN(scan_u128)(const L* text, size_t length, bool allow_negative, bool* negative,
+                                  rf_u128* out)
+{
+    const L* end = text + length;
+    const L* p = RF_PARSE_FN(scan_sign)(text, length, allow_negative, negative);
+    if (p == end)
+    {
+        return RF_PARSE_INVALID;
+    }
+    rf_u128 value = 0;
+    bool overflow = false;
+#if RF_PARSE_SWAR
+    while (end - p >= 8 && rf_is_eight_digits(rf_read8(p)))
+    {
+        overflow = overflow || __builtin_mul_overflow(value, (rf_u128)100000000, &value) ||
+                   __builtin_add_overflow(value, (rf_u128)rf_eight_digits(rf_read8(p)), &value);
+        p += 8;
+    }
+#endif
+    for (; p != end; p++)
+    {
+        uint32_t digit = RF_PARSE_FN(digit)(*p);
+        if (digit > 9)
+        {
+            return RF_PARSE_INVALID;
+        }
+        overflow = overflow || __builtin_mul_overflow(value, (rf_u128)10, &value) ||
+                   __builtin_add_overflow(value, (rf_u128)digit, &value);
+    }
+    *out = value;
+    return overflow ? RF_PARSE_OVERFLOW : RF_PARSE_OK;
+}
+#endif
+
+// ============================================================================
+// Public entry points
+// ============================================================================
+
+#define RF_PARSE_DEFINE_SIGNED(N, T, MAX, SCAN, UT)                                          \
+    int RF_PARSE_FN(rf_##N##_parse)(const RF_PARSE_TEXT* text, size_t length, T* out)        \
+    {                                                                                        \
+        bool negative;                                                                       \
+        UT magnitude;                                                                        \
+        int status = RF_PARSE_FN(SCAN)((const L*)text, length, true, &negative, &magnitude); \
+        if (status == RF_PARSE_OK && magnitude > (UT)(MAX) + negative)                       \
+        {                                                                                    \
+            status = RF_PARSE_OVERFLOW;                                                      \
+        }                                                                                    \
+        if (status == RF_PARSE_OK)                                                           \
+        {                                                                                    \
+            *out = (T)(negative ? 0 - magnitude : magnitude);                                \
+        }                                                                                    \
+        return status;                                                                       \
+    }
+
+#define RF_PARSE_DEFINE_UNSIGNED(N, T, MAX, SCAN, UT)                                         \
+    int RF_PARSE_FN(rf_##N##_parse)(const RF_PARSE_TEXT* text, size_t length, T* out)         \
+    {                                                                                         \
+        bool negative;                                                                        \
+        UT magnitude;                                                                         \
+        int status = RF_PARSE_FN(SCAN)((const L*)text, length, false, &negative, &magnitude); \
+        if (status == RF_PARSE_OK && magnitude > (MAX))                                       \
+        {                                                                                     \
+            status = RF_PARSE_OVERFLOW;                                                       \
+        }                                                                                     \
+        if (status == RF_PARSE_OK)                                                            \
+        {                                                                                     \
+            *out = (T)magnitude;                                                              \
+        }                                                                                     \
+        return status;                                                                        \
+    }
+
+#define RF_PARSE_DEFINE_FLOAT(N, T)                                                      \
+    int RF_PARSE_FN(rf_##N##_parse)(const RF_PARSE_TEXT* text, size_t length, T* out)    \
+    {                                                                                    \
+        rf_number_scan scan;                                                             \
+        int status = RF_PARSE_FN(scan_number)((const L*)text, length, &scan);            \
+        if (status != RF_PARSE_OK)                                                       \
+        {                                                                                \
+            return status;                                                               \
+        }                                                                                \
+        status = N##_from_scan(&scan, out);                                              \
+        if (status == RF_PARSE_SLOW)                                                     \
+        {                                                                                \
+            rf_parse_decimal decimal;                                                    \
+            RF_PARSE_FN(scan_digits)((const L*)text, length, &decimal, RF_DECIMAL_DIGITS); \
+            status = N##_from_decimal(&decimal, out);                                    \
+        }                                                                                \
+        return status;                                                                   \
+    }
+
+#define RF_PARSE_DEFINE_DECIMAL(N, T)                                                              \
+    int RF_PARSE_FN(rf_##N##_parse)(const RF_PARSE_TEXT* text, size_t length, T* out)              \
+    {                                                                                              \
+        rf_parse_decimal decimal;                                                                  \
+        int status = RF_PARSE_FN(scan_digits)((const L*)text, length, &decimal,                    \
+                                              (size_t)N##_format.precision + 1);                   \
+        return status == RF_PARSE_OK ? N##_from_decimal(&decimal, out) : status;                   \
+    }
+
+RF_PARSE_DEFINE_SIGNED(i8, int8_t, INT8_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_SIGNED(i16, int16_t, INT16_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_SIGNED(i32, int32_t, INT32_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_SIGNED(i64, int64_t, INT64_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_UNSIGNED(u8, uint8_t, UINT8_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_UNSIGNED(u16, uint16_t, UINT16_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_UNSIGNED(u32, uint32_t, UINT32_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_UNSIGNED(u64, uint64_t, UINT64_MAX, scan_u64, uint64_t)
+RF_PARSE_DEFINE_FLOAT(f32, float)
+RF_PARSE_DEFINE_FLOAT(f64, double)
+RF_PARSE_DEFINE_DECIMAL(d32, uint32_t)
+RF_PARSE_DEFINE_DECIMAL(d64, uint64_t)
+
+#ifdef RF_HAS_INT128
+RF_PARSE_DEFINE_SIGNED(i128, rf_i128, RF_I128_MAX, scan_u128, rf_u128)
+RF_PARSE_DEFINE_UNSIGNED(u128, rf_u128, RF_U128_MAX, scan_u128, rf_u128)
+RF_PARSE_DEFINE_DECIMAL(d128, rf_u128)
+#endif
+
+#undef RF_PARSE_DEFINE_SIGNED
+#undef RF_PARSE_DEFINE_UNSIGNED
+#undef RF_PARSE_DEFINE_FLOAT
+#undef RF_PARSE_DEFINE_DECIMAL
+#undef L
+#undef RF_PARSE_FN
+#undef RF_PARSE_LETTER
+#undef RF_PARSE_TEXT
+#undef RF_PARSE_SUFFIX
+#undef RF_PARSE_SWAR
@@ -0,0 +1,467 @@
+/*
+ * RazorForge Runtime - Random
+ * Seeding, streams, single draws and the dispatch for bulk fills
+ * (random_kernels.h holds the SIMD fill kernels); PCG32 at the end.
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/razorforge_cpu.h"
+#include "random_internal.h"
+
+#ifdef _WIN32
+    #define RF_THREAD_LOCAL __declspec(thread)
+#else
+    #define RF_THREAD_LOCAL __thread
+#endif
+
+// ============================================================================
+// Dispatch
+// ============================================================================
+
+static const rf_rng_table* rng_active = NULL;
+
+static const rf_rng_table* rng_select_table(void)
+{
+    switch (rf_cpu_active_level())
+    {
+#ifdef RF_VM_HAS_X86_VARIANTS
+        case RF_CPU_AVX512: return &rf_rng_table_avx512;
+        case RF_CPU_AVX2: return &rf_rng_table_avx2;
+#endif
+        default: return &rf_rng_table_base;
+    }
+}
+
+// Bound at load time; the lazy path only covers calls from other constructors
+__attribute__((constructor))
+static void rng_bind_table(void)
+{
+    rf_random_zig_init();
+    __atomic_store_n(&rng_active, rng_select_table(), __ATOMIC_RELEASE);
+}
+
+static inline const rf_rng_table* rng_table(void)
+{
+    const rf_rng_table* table = __atomic_load_n(&rng_active, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(table == NULL, 0))
+    {
+        rf_random_zig_init();
+        table = rng_select_table();
+        __atomic_store_n(&rng_active, table, __ATOMIC_RELEASE);
+    }
+    return table;
+}
+
+// ============================================================================
+// Seeding and Streams
+// ============================================================================
+
+static uint64_t splitmix64(uint64_t* state)
+{
+    uint64_t z = (*state += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+void rf_random_seed(rf_random* rng, uint64_t seed)
+{
+    uint64_t mix = seed;
+    for (int lane = 0; lane < RF_RANDOM_LANES; lane++)
+    {
+        for (int word = 0; word < 4; word++)
+        {
+            rng->state[word][lane] = splitmix64(&mix);
+        }
+    }
+    rng->lane = 0;
+}
+
+rf_random* rf_random_new(uint64_t seed)
+{
+    rf_random* rng = (rf_random*)malloc(sizeof(rf_random));
+    if (rng)
+    {
+        rf_random_seed(rng, seed);
+    }
+    return rng;
+}
+
+void rf_random_free(rf_random* rng)
+{
+    free(rng);
+}
+
+// Vigna's jump polynomials for xoshiro256: 2^128 and 2^192 steps
+static const uint64_t JUMP[4] = {
+    UINT64_C(0x180EC6D33CFD0ABA), UINT64_C(0xD5A61266F0C9392C),
+    UINT64_C(0xA9582618E03FC9AA), UINT64_C(0x39ABDC4529B1661C),
+};
+static const uint64_t LONG_JUMP[4] = {
+    UINT64_C(0x76E15D3EFEFDCBBF), UINT64_C(0xC5004E441C522FB3),
+    UINT64_C(0x77710069854EE241), UINT64_C(0x39109BB02ACBE635),
+};
+
+static void rng_jump(rf_random* rng, const uint64_t polynomial[4])
+{
+    for (uint32_t lane = 0; lane < RF_RANDOM_LANES; lane++)
+    {
+        uint64_t s[4] = {0, 0, 0, 0};
+        for (int i = 0; i < 4; i++)
+        {
+            for (int bit = 0; bit < 64; bit++)
+            {
+                if (polynomial[i] & (UINT64_C(1) << bit))
+                {
+                    for (int word = 0; word < 4; word++)
+                    {
+                        s[word] ^= rng->state[word][lane];
+                    }
+                }
+                rf_random_lane_next(rng, lane);
+            }
+        }
+        for (int word = 0; word < 4; word++)
+        {
+            rng->state[word][lane] = s[word];
+        }
+    }
+}
+
+void rf_random_jump(rf_random* rng)
+{
+    rng_jump(rng, JUMP);
+}
+
+void rf_random_long_jump(rf_random* rng)
+{
+    rng_jump(rng, LONG_JUMP);
+}
+
+rf_random* rf_random_split(rf_random* rng)
+{
+    rf_random* child = (rf_random*)malloc(sizeof(rf_random));
+    if (child)
+    {
+        *child = *rng;
+        rf_random_jump(rng);
+    }
+    return child;
+}
+
+// Process-wide base that hands out one jump-separated stream per thread
+static rf_random thread_base;
+static bool thread_base_seeded = false;
+static bool thread_base_lock = false;
+
+static RF_THREAD_LOCAL rf_random thread_rng;
+static RF_THREAD_LOCAL bool thread_rng_ready = false;
+
+static void thread_base_acquire(void)
+{
+    while (__atomic_test_and_set(&thread_base_lock, __ATOMIC_ACQUIRE))
+    {
+    }
+}
+
+static void thread_base_release(void)
+{
+    __atomic_clear(&thread_base_lock, __ATOMIC_RELEASE);
+}
+
+rf_random* rf_random_thread(void)
+{
+    if (__builtin_expect(!thread_rng_ready, 0))
+    {
+        thread_base_acquire();
+        if (!thread_base_seeded)
+        {
+            uint64_t entropy = (uint64_t)time(NULL) ^ ((uint64_t)clock() << 32) ^
+                               (uint64_t)(uintptr_t)&thread_rng;
+            rf_random_seed(&thread_base, entropy);
+            thread_base_seeded = true;
+        }
+        thread_rng = thread_base;
+        rf_random_jump(&thread_base);
+        thread_base_release();
+        thread_rng_ready = true;
+    }
+    return &thread_rng;
+}
+
+void rf_random_seed_threads(uint64_t seed)
+{
+    thread_base_acquire();
+    rf_random_seed(&thread_base, seed);
+    thread_base_seeded = true;
+    thread_base_release();
+}
+
+// ============================================================================
+// Single Draws
+// ============================================================================
+
+static inline uint32_t rng_take_lane(rf_random* rng)
+{
+    uint32_t lane = rng->lane;
+    rng->lane = (lane + 1) % RF_RANDOM_LANES;
+    return lane;
+}
+
+uint64_t rf_random_next_u64(rf_random* rng)
+{
+    uint32_t lane = rng_take_lane(rng);
+    return rf_random_lane_next(rng, lane);
+}
+
+uint64_t rf_random_below_from(rf_random* rng, uint32_t lane, uint64_t x, uint64_t bound)
+{
+    uint64_t low;
+    uint64_t result = rf_random_mul_wide(x, bound, &low);
+    if (low < bound)
+    {
+        uint64_t threshold = (0 - bound) % bound;
+        while (low < threshold)
+        {
+            result = rf_random_mul_wide(rf_random_lane_next(rng, lane), bound, &low);
+        }
+    }
+    return result;
+}
+
+uint64_t rf_random_next_below(rf_random* rng, uint64_t bound)
+{
+    uint32_t lane = rng_take_lane(rng);
+    return rf_random_below_from(rng, lane, rf_random_lane_next(rng, lane), bound);
+}
+
+double rf_random_next_f64(rf_random* rng)
+{
+    return rf_random_bits_to_f64(rf_random_next_u64(rng));
+}
+
+float rf_random_next_f32(rf_random* rng)
+{
+    return rf_random_bits_to_f32(rf_random_next_u64(rng));
+}
+
+double rf_random_next_normal(rf_random* rng)
+{
+    rf_random_zig_init();
+    uint32_t lane = rng_take_lane(rng);
+    return rf_random_normal_from(rng, lane, rf_random_lane_next(rng, lane));
+}
+
+// ============================================================================
+// Ziggurat
+// ============================================================================
+
+#define ZIG_R 3.6541528853610088     // start of the tail
+#define ZIG_V 0.00492867323399       // area of each layer
+
+double rf_random_zig_x[RF_ZIGGURAT_LAYERS + 1];
+double rf_random_zig_ratio[RF_ZIGGURAT_LAYERS];
+static bool zig_ready = false;
+
+// Idempotent: concurrent first callers compute and store identical values
+void rf_random_zig_init(void)
+{
+    if (__atomic_load_n(&zig_ready, __ATOMIC_ACQUIRE))
+    {
+        return;
+    }
+
+    double f = exp(-0.5 * ZIG_R * ZIG_R);
+    rf_random_zig_x[0] = ZIG_V / f;  // pseudo-width of the base layer with its tail
+    rf_random_zig_x[1] = ZIG_R;
+    rf_random_zig_x[RF_ZIGGURAT_LAYERS] = 0.0;
+    for (int i = 2; i < RF_ZIGGURAT_LAYERS; i++)
+    {
+        rf_random_zig_x[i] = sqrt(-2.0 * log(ZIG_V / rf_random_zig_x[i - 1] + f));
+        f = exp(-0.5 * rf_random_zig_x[i] * rf_random_zig_x[i]);
+    }
+    for (int i = 0; i < RF_ZIGGURAT_LAYERS; i++)
+    {
+        rf_random_zig_ratio[i] = rf_random_zig_x[i + 1] / rf_random_zig_x[i];
+    }
+    __atomic_store_n(&zig_ready, true, __ATOMIC_RELEASE);
+}
+
+// Marsaglia's tail method beyond ZIG_R
+static double zig_tail(rf_random* rng, uint32_t lane, bool negative)
+{
+    double x;
+    double y;
+    do
+    {
+        x = log(1.0 - rf_random_bits_to_f64(rf_random_lane_next(rng, lane))) / ZIG_R;
+        y = log(1.0 - rf_random_bits_to_f64(rf_random_lane_next(rng, lane)));
+    } while (-2.0 * y < x * x);
+    return negative ? x - ZIG_R : ZIG_R - x;
+}
+
+double rf_random_normal_from(rf_random* rng, uint32_t lane, uint64_t x)
+{
+    for (;;)
+    {
+        uint32_t layer = (uint32_t)(x & (RF_ZIGGURAT_LAYERS - 1));
+        double u = rf_random_bits_to_signed(x);
+        if (fabs(u) < rf_random_zig_ratio[layer])
+        {
+            return u * rf_random_zig_x[layer];
+        }
+        if (layer == 0)
+        {
+            return zig_tail(rng, lane, u < 0.0);
+        }
+
+        // Wedge between this layer's rectangle and the curve
+        double candidate = u * rf_random_zig_x[layer];
+        double inner = rf_random_zig_x[layer + 1];
+        double outer = rf_random_zig_x[layer];
+        double f0 = exp(-0.5 * (outer * outer - candidate * candidate));
+        double f1 = exp(-0.5 * (inner * inner - candidate * candidate));
+        double v = rf_random_bits_to_f64(rf_random_lane_next(rng, lane));
+        if (f1 + v * (f0 - f1) < 1.0)
+        {
+            return candidate;
+        }
+        x = rf_random_lane_next(rng, lane);
+    }
+}
+
+// ============================================================================
+// Bulk Fills
+// Single draws up to lane 0, whole blocks in the kernel, single draws for
+// the rest: the same sequence as drawing every value separately
+// ============================================================================
+
+#define RNG_FILL(rng, dest, count, SINGLE, KERNEL, ...)                             \
+    do                                                                              \
+    {                                                                               \
+        size_t i = 0;                                                               \
+        for (; i < (count) && (rng)->lane != 0; i++)                                \
+        {                                                                           \
+            (dest)[i] = SINGLE;                                                     \
+        }                                                                           \
+        size_t blocks = ((count) - i) / RF_RANDOM_LANES;                            \
+        if (blocks != 0)                                                            \
+        {                                                                           \
+            rng_table()->KERNEL((rng), (dest) + i, blocks, ##__VA_ARGS__);          \
+            i += blocks * RF_RANDOM_LANES;                                          \
+        }                                                                           \
+        for (; i < (count); i++)                                                    \
+        {                                                                           \
+            (dest)[i] = SINGLE;                                                     \
+        }                                                                           \
+    } while (0)
+
+void rf_random_fill_u64(rf_random* rng, uint64_t* dest, size_t count)
+{
+    RNG_FILL(rng, dest, count, rf_random_next_u64(rng), fill_u64);
+}
+
+void rf_random_fill_below(rf_random* rng, uint64_t* dest, size_t count, uint64_t bound)
+{
+    RNG_FILL(rng, dest, count, rf_random_next_below(rng, bound), fill_below, bound);
+}
+
+void rf_random_fill_f64(rf_random* rng, double* dest, size_t count)
+{
+    RNG_FILL(rng, dest, count, rf_random_next_f64(rng), fill_f64);
+}
+
+void rf_random_fill_f32(rf_random* rng, float* dest, size_t count)
+{
+    RNG_FILL(rng, dest, count, rf_random_next_f32(rng), fill_f32);
+}
+
+void rf_random_fill_normal_f64(rf_random* rng, double* dest, size_t count)
+{
+    RNG_FILL(rng, dest, count, rf_random_next_normal(rng), fill_normal_f64);
+}
+
+void rf_random_fill_normal_f32(rf_random* rng, float* dest, size_t count)
+{
+    RNG_FILL(rng, dest, count, (float)rf_random_next_normal(rng), fill_normal_f32);
+}
+
+// ============================================================================
+// PCG32
+// ============================================================================
+
+#define PCG_MULTIPLIER UINT64_C(6364136223846793005)
+
+void rf_pcg32_seed(rf_pcg32* rng, uint64_t seed, uint64_t stream)
+{
+    rng->state = 0;
+    rng->increment = (stream << 1) | 1;
+    rf_pcg32_next(rng);
+    rng->state += seed;
+    rf_pcg32_next(rng);
+}
+
+uint32_t rf_pcg32_next(rf_pcg32* rng)
+{
+    uint64_t old = rng->state;
+    rng->state = old * PCG_MULTIPLIER + rng->increment;
+    uint32_t shifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rotation = (uint32_t)(old >> 59);
+    return (shifted >> rotation) | (shifted << ((0u - rotation) & 31));
+}
+
+uint32_t rf_pcg32_next_below(rf_pcg32* rng, uint32_t bound)
+{
+    uint64_t product = (uint64_t)rf_pcg32_next(rng) * bound;
+    uint32_t low = (uint32_t)product;
+    if (low < bound)
+    {
+        uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold)
+        {
+            product = (uint64_t)rf_pcg32_next(rng) * bound;
+            low = (uint32_t)product;
+        }
+    }
+    return (uint32_t)(product >> 32);
+}
+
+double rf_pcg32_next_f64(rf_pcg32* rng)
+{
+    uint64_t high = rf_pcg32_next(rng);
+    uint64_t low = rf_pcg32_next(rng);
+    return rf_random_bits_to_f64((high << 32) | low);
+}
+
+// Brown's "Random number generation with arbitrary strides": composes the
+// LCG step with itself in O(log delta)
+void rf_pcg32_advance(rf_pcg32* rng, uint64_t delta)
+{
+    uint64_t multiplier = PCG_MULTIPLIER;
+    uint64_t increment = rng->increment;
+    uint64_t total_multiplier = 1;
+    uint64_t total_increment = 0;
+    while (delta > 0)
+    {
+        if (delta & 1)
+        {
+            total_multiplier *= multiplier;
+            total_increment = total_increment * multiplier + increment;
+        }
+        increment = (multiplier + 1) * increment;
+        multiplier *= multiplier;
+        delta >>= 1;
+    }
+    rng->state = total_multiplier * rng->state + total_increment;
+}
+
+void rf_pcg32_fill_u32(rf_pcg32* rng, uint32_t* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = rf_pcg32_next(rng);
+    }
+}
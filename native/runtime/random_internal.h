@@ -0,0 +1,143 @@
+/*
+ * RazorForge Runtime - Random (internal)
+ * Lane stepping, bit-to-float mappings and the ziggurat tables shared by the
+ * scalar draws (random.c) and the SIMD fill kernels (random_kernels.h). Both
+ * sides must map bits to values identically for fills to equal single draws.
+ */
+
+#ifndef RAZORFORGE_RANDOM_INTERNAL_H
+#define RAZORFORGE_RANDOM_INTERNAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "../include/razorforge_int.h"
+#include "../include/razorforge_random.h"
+
+static inline uint64_t rf_random_rotl(uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// One xoshiro256++ step of a single lane
+static inline uint64_t rf_random_lane_next(rf_random* rng, uint32_t lane)
+{
+    uint64_t s0 = rng->state[0][lane];
+    uint64_t s1 = rng->state[1][lane];
+    uint64_t s2 = rng->state[2][lane];
+    uint64_t s3 = rng->state[3][lane];
+    uint64_t result = rf_random_rotl(s0 + s3, 23) + s0;
+    uint64_t t = s1 << 17;
+    s2 ^= s0;
+    s3 ^= s1;
+    s1 ^= s2;
+    s0 ^= s3;
+    s2 ^= t;
+    s3 = rf_random_rotl(s3, 45);
+    rng->state[0][lane] = s0;
+    rng->state[1][lane] = s1;
+    rng->state[2][lane] = s2;
+    rng->state[3][lane] = s3;
+    return result;
+}
+
+// ============================================================================
+// Bits to Values
+// Exponent-stuffing instead of int->float conversion, which SSE2/AVX2 lack
+// for unsigned 64-bit lanes
+// ============================================================================
+
+#define RF_RANDOM_F64_ONE UINT64_C(0x3FF0000000000000)  // 1.0: [1, 2) - 1
+#define RF_RANDOM_F64_TWO UINT64_C(0x4000000000000000)  // 2.0: [2, 4) - 3
+#define RF_RANDOM_F32_ONE UINT32_C(0x3F800000)
+
+static inline double rf_random_bits_to_f64(uint64_t x)
+{
+    uint64_t bits = (x >> 12) | RF_RANDOM_F64_ONE;
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value - 1.0;
+}
+
+static inline float rf_random_bits_to_f32(uint64_t x)
+{
+    uint32_t bits = (uint32_t)(x >> 41) | RF_RANDOM_F32_ONE;
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value - 1.0f;
+}
+
+// [-1, 1) from the top 52 bits; the ziggurat takes its layer from the low 8
+static inline double rf_random_bits_to_signed(uint64_t x)
+{
+    uint64_t bits = (x >> 12) | RF_RANDOM_F64_TWO;
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value - 3.0;
+}
+
+// Lemire's multiply-shift: high half of x * bound, with the low half for the
+// rejection test
+static inline uint64_t rf_random_mul_wide(uint64_t a, uint64_t b, uint64_t* low)
+{
+#ifdef RF_HAS_INT128
+    rf_u128 product = (rf_u128)a * b;
+    *low = (uint64_t)product;
+    return (uint64_t)(product >> 64);
+#else
+    uint64_t a_lo = (uint32_t)a;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t)b;
+    uint64_t b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+    *low = (cross << 32) | (uint32_t)lo_lo;
+    return a_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+#endif
+}
+
+// Unbiased [0, bound) from a first draw x, redrawing from the same lane
+uint64_t rf_random_below_from(rf_random* rng, uint32_t lane, uint64_t x, uint64_t bound);
+
+// ============================================================================
+// Ziggurat (Marsaglia & Tsang, 256 layers, Doornik's ZIGNOR form)
+// A draw is accepted on the fast path when |u| < ratio[layer] (~99%);
+// everything else goes through rf_random_normal_from.
+// ============================================================================
+
+#define RF_ZIGGURAT_LAYERS 256
+
+extern double rf_random_zig_x[RF_ZIGGURAT_LAYERS + 1];
+extern double rf_random_zig_ratio[RF_ZIGGURAT_LAYERS];
+
+// Builds the tables once; every normal entry point calls it first
+void rf_random_zig_init(void);
+
+// Standard normal from a first draw x, redrawing from the same lane
+double rf_random_normal_from(rf_random* rng, uint32_t lane, uint64_t x);
+
+// ============================================================================
+// Fill Kernels
+// Whole blocks of RF_RANDOM_LANES values, starting at lane 0
+// ============================================================================
+
+typedef struct
+{
+    void (*fill_u64)(rf_random* rng, uint64_t* dest, size_t blocks);
+    void (*fill_below)(rf_random* rng, uint64_t* dest, size_t blocks, uint64_t bound);
+    void (*fill_f64)(rf_random* rng, double* dest, size_t blocks);
+    void (*fill_f32)(rf_random* rng, float* dest, size_t blocks);
+    void (*fill_normal_f64)(rf_random* rng, double* dest, size_t blocks);
+    void (*fill_normal_f32)(rf_random* rng, float* dest, size_t blocks);
+} rf_rng_table;
+
+extern const rf_rng_table rf_rng_table_base;
+
+#ifdef RF_VM_HAS_X86_VARIANTS
+extern const rf_rng_table rf_rng_table_avx2;
+extern const rf_rng_table rf_rng_table_avx512;
+#endif
+
+#endif // RAZORFORGE_RANDOM_INTERNAL_H
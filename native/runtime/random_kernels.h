@@ -0,0 +1,234 @@
+/*
+ * RazorForge Runtime - Random Fill Kernels
+ * Steps all RF_RANDOM_LANES xoshiro256++ lanes together in SIMD registers
+ * (4 vectors on SSE2/NEON, 2 on AVX2, 1 on AVX-512) and maps the outputs
+ * with the same bit tricks as the scalar draws in random.c, so a fill
+ * produces exactly the values single draws would.
+ *
+ * Rare slow cases (ziggurat rejections, Lemire rejections) spill the state,
+ * finish the affected lanes with the scalar code, and reload.
+ *
+ * Included by each vector_math_<isa>.c after vector_math_kernels.h, with
+ * RF_RNG_TABLE naming the table it defines.
+ */
+
+#include "random_internal.h"
+
+#ifndef RF_RNG_TABLE
+    #error "define RF_RNG_TABLE before including random_kernels.h"
+#endif
+
+#define RF_RNG_VECTORS (RF_RANDOM_LANES / RF_VF64_LANES)
+
+typedef uint32_t rf_vu32_half __attribute__((vector_size(RF_VM_BYTES / 2)));
+
+typedef struct
+{
+    rf_vu64 s[4][RF_RNG_VECTORS];
+} rng_lanes;
+
+static inline void rng_load(const rf_random* rng, rng_lanes* lanes)
+{
+    for (int word = 0; word < 4; word++)
+    {
+        for (int k = 0; k < RF_RNG_VECTORS; k++)
+        {
+            memcpy(&lanes->s[word][k], &rng->state[word][k * RF_VF64_LANES], sizeof(rf_vu64));
+        }
+    }
+}
+
+static inline void rng_store(rf_random* rng, const rng_lanes* lanes)
+{
+    for (int word = 0; word < 4; word++)
+    {
+        for (int k = 0; k < RF_RNG_VECTORS; k++)
+        {
+            memcpy(&rng->state[word][k * RF_VF64_LANES], &lanes->s[word][k], sizeof(rf_vu64));
+        }
+    }
+}
+
+static inline rf_vu64 rng_rotl(rf_vu64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// One xoshiro256++ step of every lane
+static inline void rng_step(rng_lanes* lanes, rf_vu64 out[RF_RNG_VECTORS])
+{
+    for (int k = 0; k < RF_RNG_VECTORS; k++)
+    {
+        rf_vu64 s0 = lanes->s[0][k];
+        rf_vu64 s1 = lanes->s[1][k];
+        rf_vu64 s2 = lanes->s[2][k];
+        rf_vu64 s3 = lanes->s[3][k];
+        out[k] = rng_rotl(s0 + s3, 23) + s0;
+        rf_vu64 t = s1 << 17;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        lanes->s[0][k] = s0;
+        lanes->s[1][k] = s1;
+        lanes->s[2][k] = s2;
+        lanes->s[3][k] = rng_rotl(s3, 45);
+    }
+}
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+static void rng_fill_u64(rf_random* rng, uint64_t* dest, size_t blocks)
+{
+    rng_lanes lanes;
+    rng_load(rng, &lanes);
+    for (size_t block = 0; block < blocks; block++, dest += RF_RANDOM_LANES)
+    {
+        rf_vu64 x[RF_RNG_VECTORS];
+        rng_step(&lanes, x);
+        memcpy(dest, x, sizeof(x));
+    }
+    rng_store(rng, &lanes);
+    RF_VM_LEAVE();
+}
+
+static void rng_fill_below(rf_random* rng, uint64_t* dest, size_t blocks, uint64_t bound)
+{
+    rng_lanes lanes;
+    rng_load(rng, &lanes);
+    for (size_t block = 0; block < blocks; block++, dest += RF_RANDOM_LANES)
+    {
+        rf_vu64 x[RF_RNG_VECTORS];
+        rng_step(&lanes, x);
+        uint64_t draws[RF_RANDOM_LANES];
+        memcpy(draws, x, sizeof(draws));
+
+        bool rejected = false;
+        for (int lane = 0; lane < RF_RANDOM_LANES; lane++)
+        {
+            uint64_t low;
+            dest[lane] = rf_random_mul_wide(draws[lane], bound, &low);
+            rejected |= low < bound;
+        }
+        if (__builtin_expect(rejected, 0))
+        {
+            rng_store(rng, &lanes);
+            for (uint32_t lane = 0; lane < RF_RANDOM_LANES; lane++)
+            {
+                dest[lane] = rf_random_below_from(rng, lane, draws[lane], bound);
+            }
+            rng_load(rng, &lanes);
+        }
+    }
+    rng_store(rng, &lanes);
+    RF_VM_LEAVE();
+}
+
+static void rng_fill_f64(rf_random* rng, double* dest, size_t blocks)
+{
+    rng_lanes lanes;
+    rng_load(rng, &lanes);
+    for (size_t block = 0; block < blocks; block++, dest += RF_RANDOM_LANES)
+    {
+        rf_vu64 x[RF_RNG_VECTORS];
+        rng_step(&lanes, x);
+        for (int k = 0; k < RF_RNG_VECTORS; k++)
+        {
+            rf_vf64 value = (rf_vf64)((x[k] >> 12) | RF_RANDOM_F64_ONE) - 1.0;
+            memcpy(dest + k * RF_VF64_LANES, &value, sizeof(value));
+        }
+    }
+    rng_store(rng, &lanes);
+    RF_VM_LEAVE();
+}
+
+static void rng_fill_f32(rf_random* rng, float* dest, size_t blocks)
+{
+    rng_lanes lanes;
+    rng_load(rng, &lanes);
+    for (size_t block = 0; block < blocks; block++, dest += RF_RANDOM_LANES)
+    {
+        rf_vu64 x[RF_RNG_VECTORS];
+        rng_step(&lanes, x);
+        for (int k = 0; k < RF_RNG_VECTORS; k++)
+        {
+            rf_vu32_half bits = __builtin_convertvector(x[k] >> 41, rf_vu32_half);
+            rf_vf32_half value = (rf_vf32_half)(bits | RF_RANDOM_F32_ONE) - 1.0f;
+            memcpy(dest + k * RF_VF64_LANES, &value, sizeof(value));
+        }
+    }
+    rng_store(rng, &lanes);
+    RF_VM_LEAVE();
+}
+
+// Fast ziggurat path for a whole block into values[]; false if any lane
+// needs rf_random_normal_from
+static inline bool rng_normal_block(rng_lanes* lanes, uint64_t draws[RF_RANDOM_LANES],
+                                    double values[RF_RANDOM_LANES])
+{
+    rf_vu64 x[RF_RNG_VECTORS];
+    rng_step(lanes, x);
+    memcpy(draws, x, sizeof(x));
+
+    rf_vi64 rejected = (rf_vi64){0};
+    for (int k = 0; k < RF_RNG_VECTORS; k++)
+    {
+        rf_vf64 ratio;
+        rf_vf64 width;
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            uint32_t layer = (uint32_t)(x[k][lane] & (RF_ZIGGURAT_LAYERS - 1));
+            ratio[lane] = rf_random_zig_ratio[layer];
+            width[lane] = rf_random_zig_x[layer];
+        }
+        rf_vf64 u = (rf_vf64)((x[k] >> 12) | RF_RANDOM_F64_TWO) - 3.0;
+        rejected |= ~(vm_abs_f64(u) < ratio);
+        rf_vf64 value = u * width;
+        memcpy(values + k * RF_VF64_LANES, &value, sizeof(value));
+    }
+    return !vm_any_f64(rejected);
+}
+
+#define RF_RNG_DEFINE_NORMAL(NAME, T)                                                  \
+    static void NAME(rf_random* rng, T* dest, size_t blocks)                           \
+    {                                                                                  \
+        rng_lanes lanes;                                                               \
+        rng_load(rng, &lanes);                                                         \
+        for (size_t block = 0; block < blocks; block++, dest += RF_RANDOM_LANES)       \
+        {                                                                              \
+            uint64_t draws[RF_RANDOM_LANES];                                           \
+            double values[RF_RANDOM_LANES];                                            \
+            if (__builtin_expect(!rng_normal_block(&lanes, draws, values), 0))         \
+            {                                                                          \
+                /* Redo every lane on the scalar path: accepted lanes return */        \
+                /* the same value without drawing again */                             \
+                rng_store(rng, &lanes);                                                \
+                for (uint32_t lane = 0; lane < RF_RANDOM_LANES; lane++)                \
+                {                                                                      \
+                    values[lane] = rf_random_normal_from(rng, lane, draws[lane]);      \
+                }                                                                      \
+                rng_load(rng, &lanes);                                                 \
+            }                                                                          \
+            for (int lane = 0; lane < RF_RANDOM_LANES; lane++)                         \
+            {                                                                          \
+                dest[lane] = (T)values[lane];                                          \
+            }                                                                          \
+        }                                                                              \
+        rng_store(rng, &lanes);                                                        \
+        RF_VM_LEAVE();                                                                 \
+    }
+
+RF_RNG_DEFINE_NORMAL(rng_fill_normal_f64, double)
+RF_RNG_DEFINE_NORMAL(rng_fill_normal_f32, float)
+
+const rf_rng_table RF_RNG_TABLE = {
+    .fill_u64 = rng_fill_u64,
+    .fill_below = rng_fill_below,
+    .fill_f64 = rng_fill_f64,
+    .fill_f32 = rng_fill_f32,
+    .fill_normal_f64 = rng_fill_normal_f64,
+    .fill_normal_f32 = rng_fill_normal_f32,
+};
@@ -1,5 +1,7 @@
 // runtime.c - Minimal operations for v0.0.1
 
+#include "../include/razorforge_slice.h"
+
 // Memory operations
 rf_MemorySlice rf_alloc(rf_usys size)
 {
@@ -22,25 +24,25 @@ void rf_free(rf_MemorySlice slice)
     free(slice.data);
 }
 
-// MemorySlice operations
+// MemorySlice operations (unaligned-safe; razorforge_slice.h has every width)
 rf_u8 rf_slice_read_u8(rf_MemorySlice slice, rf_usys offset)
 {
-    return slice.data[offset];
+    return rf_load_u8(slice.data + offset);
 }
 
 void rf_slice_write_u8(rf_MemorySlice slice, rf_usys offset, rf_u8 value)
 {
-    slice.data[offset] = value;
+    rf_store_u8(slice.data + offset, value);
 }
 
 rf_i32 rf_slice_read_i32(rf_MemorySlice slice, rf_usys offset)
 {
-    return *(rf_i32*)(slice.data + offset);
+    return rf_load_i32(slice.data + offset);
 }
 
 void rf_slice_write_i32(rf_MemorySlice slice, rf_usys offset, rf_i32 value)
 {
-    *(rf_i32*)(slice.data + offset) = value;
+    rf_store_i32(slice.data + offset, value);
 }
 
 // Variant operations
@@ -0,0 +1,52 @@
+/*
+ * RazorForge Runtime - Typed Slice Access
+ * Out-of-line copies of the razorforge_slice.h accessors, the bounds
+ * failure they report through, and the memory_read_T/memory_write_T
+ * entry points the code generator calls for DynamicSlice.read/write
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Emit the header's accessors with external linkage instead of static inline
+#define RF_SLICE_API
+
+#include "../include/razorforge_slice.h"
+
+void rf_slice_out_of_bounds(uintptr_t offset, uintptr_t bytes, uintptr_t size)
+{
+    fprintf(stderr, "RazorForge Runtime Error: %zu bytes at offset %zu out of bounds for slice (size %zu)\n",
+            (size_t)bytes, (size_t)offset, (size_t)size);
+    abort();
+}
+
+#define RF_DEFINE_SLICE_ENTRY(NAME, N, T)                                       \
+    T memory_read_##NAME(const rf_slice* slice, uintptr_t offset)               \
+    {                                                                           \
+        return rf_slice_read_##N(slice, offset);                                \
+    }                                                                           \
+    void memory_write_##NAME(const rf_slice* slice, uintptr_t offset, T value)  \
+    {                                                                           \
+        rf_slice_write_##N(slice, offset, value);                               \
+    }
+
+RF_DEFINE_SLICE_ENTRY(s8, i8, rf_i8)
+RF_DEFINE_SLICE_ENTRY(s16, i16, rf_i16)
+RF_DEFINE_SLICE_ENTRY(s32, i32, rf_i32)
+RF_DEFINE_SLICE_ENTRY(s64, i64, rf_i64)
+RF_DEFINE_SLICE_ENTRY(u8, u8, rf_u8)
+RF_DEFINE_SLICE_ENTRY(u16, u16, rf_u16)
+RF_DEFINE_SLICE_ENTRY(u32, u32, rf_u32)
+RF_DEFINE_SLICE_ENTRY(u64, u64, rf_u64)
+RF_DEFINE_SLICE_ENTRY(f16, f16, rf_f16)
+RF_DEFINE_SLICE_ENTRY(f32, f32, float)
+RF_DEFINE_SLICE_ENTRY(f64, f64, double)
+RF_DEFINE_SLICE_ENTRY(d32, d32, uint32_t)
+RF_DEFINE_SLICE_ENTRY(d64, d64, uint64_t)
+
+#ifdef RF_HAS_INT128
+RF_DEFINE_SLICE_ENTRY(s128, i128, rf_i128)
+RF_DEFINE_SLICE_ENTRY(u128, u128, rf_u128)
+RF_DEFINE_SLICE_ENTRY(f128, f128, rf_f128)
+RF_DEFINE_SLICE_ENTRY(d128, d128, d128_t)
+#endif
@@ -93,6 +93,16 @@ void __rf_init_symbol_tables(
     rf_type_table_count = type_count;
 }
 
+// ============================================================================
+// Runtime Entry
+// ============================================================================
+
+// Called first in every generated main. The kernel tables bind themselves in
+// constructors, so there is nothing else to set up yet.
+void rf_runtime_init(void)
+{
+}
+
 // ============================================================================
 // Stack Frame Push/Pop
 // ============================================================================
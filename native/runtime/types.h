@@ -15,7 +15,7 @@ using rf_u64 = uint64_t;
 // llvm u128 to rf_u128
 using rf_usys = uintptr_t;
 
-// llvm half to rf_f16
+using rf_f16 = uint16_t;  // IEEE binary16 bits; arithmetic promotes to f32
 using rf_f32 = float;
 using rf_f64 = double;
 // llvm float128 to rf_f128
@@ -0,0 +1,186 @@
+/*
+ * RazorForge Runtime - Vector Math
+ * Public batch entry points, dispatched to the widest kernel variant the CPU
+ * supports (vector_math_kernels.h holds the kernels themselves)
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_math.h"
+#include "vector_math_dispatch.h"
+
+// ============================================================================
+// Strict mode: one libm call per element. Slower, but carries libm's accuracy
+// instead of the kernels' few-ULP bounds (--strict-math programs)
+// ============================================================================
+
+#define RF_VM_DEFINE_LIBM_UNARY(NAME, T, FN)                  \
+    static void NAME(const T* src, T* dest, size_t count)      \
+    {                                                          \
+        for (size_t i = 0; i < count; i++)                     \
+        {                                                      \
+            dest[i] = FN(src[i]);                              \
+        }                                                      \
+    }
+
+#define RF_VM_DEFINE_LIBM_BINARY(NAME, T, FN)                               \
+    static void NAME(const T* src_a, const T* src_b, T* dest, size_t count) \
+    {                                                                       \
+        for (size_t i = 0; i < count; i++)                                  \
+        {                                                                   \
+            dest[i] = FN(src_a[i], src_b[i]);                               \
+        }                                                                   \
+    }
+
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_sin, double, sin)
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_cos, double, cos)
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_exp, double, exp)
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_log, double, log)
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_tanh, double, tanh)
+RF_VM_DEFINE_LIBM_BINARY(libm_f64_pow, double, pow)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_sin, float, sinf)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_cos, float, cosf)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_exp, float, expf)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_log, float, logf)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_tanh, float, tanhf)
+RF_VM_DEFINE_LIBM_BINARY(libm_f32_pow, float, powf)
+RF_VM_DEFINE_LIBM_UNARY(libm_f64_sqrt, double, sqrt)
+RF_VM_DEFINE_LIBM_UNARY(libm_f32_sqrt, float, sqrtf)
+
+static const rf_vm_table vm_table_strict = {
+    .f64_sin = libm_f64_sin,
+    .f64_cos = libm_f64_cos,
+    .f64_exp = libm_f64_exp,
+    .f64_log = libm_f64_log,
+    .f64_sqrt = libm_f64_sqrt,
+    .f64_tanh = libm_f64_tanh,
+    .f64_pow = libm_f64_pow,
+    .f32_sin = libm_f32_sin,
+    .f32_cos = libm_f32_cos,
+    .f32_exp = libm_f32_exp,
+    .f32_log = libm_f32_log,
+    .f32_sqrt = libm_f32_sqrt,
+    .f32_tanh = libm_f32_tanh,
+    .f32_pow = libm_f32_pow,
+};
+
+static const rf_vm_table* vm_active = NULL;
+static bool vm_strict = false;
+
+static const rf_vm_table* vm_select_table(void)
+{
+    if (__atomic_load_n(&vm_strict, __ATOMIC_ACQUIRE))
+    {
+        return &vm_table_strict;
+    }
+
+    switch (rf_cpu_active_level())
+    {
+#ifdef RF_VM_HAS_X86_VARIANTS
+        case RF_CPU_AVX512: return &rf_vm_table_avx512;
+        case RF_CPU_AVX2: return &rf_vm_table_avx2;
+#endif
+        default: return &rf_vm_table_base;
+    }
+}
+
+// Bound at load time; the lazy path only covers calls from other constructors
+__attribute__((constructor))
+static void vm_bind_table(void)
+{
+    __atomic_store_n(&vm_active, vm_select_table(), __ATOMIC_RELEASE);
+}
+
+static inline const rf_vm_table* vm_table(void)
+{
+    const rf_vm_table* table = __atomic_load_n(&vm_active, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(table == NULL, 0))
+    {
+        table = vm_select_table();
+        __atomic_store_n(&vm_active, table, __ATOMIC_RELEASE);
+    }
+    return table;
+}
+
+void rf_math_set_strict(bool strict)
+{
+    __atomic_store_n(&vm_strict, strict, __ATOMIC_RELEASE);
+    __atomic_store_n(&vm_active, vm_select_table(), __ATOMIC_RELEASE);
+}
+
+bool rf_math_is_strict(void)
+{
+    return __atomic_load_n(&vm_strict, __ATOMIC_ACQUIRE);
+}
+
+void rf_f64_sin_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_sin(src, dest, count);
+}
+
+void rf_f64_cos_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_cos(src, dest, count);
+}
+
+void rf_f64_exp_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_exp(src, dest, count);
+}
+
+void rf_f64_log_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_log(src, dest, count);
+}
+
+void rf_f64_sqrt_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_sqrt(src, dest, count);
+}
+
+void rf_f64_tanh_batch(const double* src, double* dest, size_t count)
+{
+    vm_table()->f64_tanh(src, dest, count);
+}
+
+void rf_f64_pow_batch(const double* base, const double* exponent, double* dest, size_t count)
+{
+    vm_table()->f64_pow(base, exponent, dest, count);
+}
+
+void rf_f32_sin_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_sin(src, dest, count);
+}
+
+void rf_f32_cos_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_cos(src, dest, count);
+}
+
+void rf_f32_exp_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_exp(src, dest, count);
+}
+
+void rf_f32_log_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_log(src, dest, count);
+}
+
+void rf_f32_sqrt_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_sqrt(src, dest, count);
+}
+
+void rf_f32_tanh_batch(const float* src, float* dest, size_t count)
+{
+    vm_table()->f32_tanh(src, dest, count);
+}
+
+void rf_f32_pow_batch(const float* base, const float* exponent, float* dest, size_t count)
+{
+    vm_table()->f32_pow(base, exponent, dest, count);
+}
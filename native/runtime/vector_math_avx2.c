@@ -0,0 +1,16 @@
+/*
+ * RazorForge Runtime - Vector Math, AVX2 variant
+ * 32-byte vectors; only called after razorforge_cpu reports AVX2
+ */
+
+#ifndef __AVX2__
+    #error "vector_math_avx2.c must be compiled with -mavx2"
+#endif
+
+#define RF_VM_BYTES 32
+#define RF_VM_TABLE rf_vm_table_avx2
+#define RF_VR_TABLE rf_vr_table_avx2
+#define RF_RNG_TABLE rf_rng_table_avx2
+#include "vector_math_kernels.h"
+#include "vector_reduce_kernels.h"
+#include "random_kernels.h"
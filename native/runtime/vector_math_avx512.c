@@ -0,0 +1,16 @@
+/*
+ * RazorForge Runtime - Vector Math, AVX-512 variant
+ * 64-byte vectors; only called after razorforge_cpu reports AVX-512F/DQ
+ */
+
+#if !defined(__AVX512F__) || !defined(__AVX512DQ__)
+    #error "vector_math_avx512.c must be compiled with -mavx512f -mavx512dq"
+#endif
+
+#define RF_VM_BYTES 64
+#define RF_VM_TABLE rf_vm_table_avx512
+#define RF_VR_TABLE rf_vr_table_avx512
+#define RF_RNG_TABLE rf_rng_table_avx512
+#include "vector_math_kernels.h"
+#include "vector_reduce_kernels.h"
+#include "random_kernels.h"
@@ -0,0 +1,12 @@
+/*
+ * RazorForge Runtime - Vector Math, baseline variant
+ * 16-byte vectors, built with the target's default flags
+ */
+
+#define RF_VM_BYTES 16
+#define RF_VM_TABLE rf_vm_table_base
+#define RF_VR_TABLE rf_vr_table_base
+#define RF_RNG_TABLE rf_rng_table_base
+#include "vector_math_kernels.h"
+#include "vector_reduce_kernels.h"
+#include "random_kernels.h"
@@ -0,0 +1,74 @@
+/*
+ * RazorForge Runtime - Vector Math Dispatch Table
+ * One table per compiled ISA variant; vector_math.c binds the best one
+ * the CPU supports (see razorforge_cpu.h).
+ */
+
+#ifndef RAZORFORGE_VECTOR_MATH_DISPATCH_H
+#define RAZORFORGE_VECTOR_MATH_DISPATCH_H
+
+#include <stddef.h>
+
+typedef void (*rf_vm_unary_f64)(const double* src, double* dest, size_t count);
+typedef void (*rf_vm_binary_f64)(const double* src_a, const double* src_b, double* dest,
+                                 size_t count);
+typedef void (*rf_vm_unary_f32)(const float* src, float* dest, size_t count);
+typedef void (*rf_vm_binary_f32)(const float* src_a, const float* src_b, float* dest,
+                                 size_t count);
+
+typedef struct
+{
+    rf_vm_unary_f64 f64_sin;
+    rf_vm_unary_f64 f64_cos;
+    rf_vm_unary_f64 f64_exp;
+    rf_vm_unary_f64 f64_log;
+    rf_vm_unary_f64 f64_sqrt;
+    rf_vm_unary_f64 f64_tanh;
+    rf_vm_binary_f64 f64_pow;
+    rf_vm_unary_f32 f32_sin;
+    rf_vm_unary_f32 f32_cos;
+    rf_vm_unary_f32 f32_exp;
+    rf_vm_unary_f32 f32_log;
+    rf_vm_unary_f32 f32_sqrt;
+    rf_vm_unary_f32 f32_tanh;
+    rf_vm_binary_f32 f32_pow;
+} rf_vm_table;
+
+// Reductions (vector_reduce_kernels.h) accumulate into a fixed number of
+// logical lanes, independent of the vector width, so every variant agrees
+#define RF_VR_LANES 8
+
+typedef struct
+{
+    double sum[RF_VR_LANES];
+    double comp[RF_VR_LANES];  // accumulated rounding error of each lane
+} rf_vr_acc;
+
+typedef struct
+{
+    void (*f64_sum)(const double* src, size_t count, rf_vr_acc* out);
+    void (*f64_dot)(const double* src_a, const double* src_b, size_t count, rf_vr_acc* out);
+    void (*f64_moments)(const double* src, size_t count, double shift, double scale,
+                        rf_vr_acc* first, rf_vr_acc* second);
+    void (*f64_extrema)(const double* src, size_t count, double lowest[RF_VR_LANES],
+                        double highest[RF_VR_LANES]);
+    void (*f32_sum)(const float* src, size_t count, rf_vr_acc* out);
+    void (*f32_dot)(const float* src_a, const float* src_b, size_t count, rf_vr_acc* out);
+    void (*f32_moments)(const float* src, size_t count, double shift, double scale,
+                        rf_vr_acc* first, rf_vr_acc* second);
+    void (*f32_extrema)(const float* src, size_t count, double lowest[RF_VR_LANES],
+                        double highest[RF_VR_LANES]);
+} rf_vr_table;
+
+// 16-byte vectors: SSE2 on x86-64, NEON on AArch64, generic elsewhere
+extern const rf_vm_table rf_vm_table_base;
+extern const rf_vr_table rf_vr_table_base;
+
+#ifdef RF_VM_HAS_X86_VARIANTS
+extern const rf_vm_table rf_vm_table_avx2;
+extern const rf_vm_table rf_vm_table_avx512;
+extern const rf_vr_table rf_vr_table_avx2;
+extern const rf_vr_table rf_vr_table_avx512;
+#endif
+
+#endif // RAZORFORGE_VECTOR_MATH_DISPATCH_H
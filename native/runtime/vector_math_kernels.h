@@ -0,0 +1,755 @@
+/*
+ * RazorForge Runtime - Vector Math Kernels
+ * Batch elementwise kernels over f32/f64 slices
+ *
+ * Each kernel evaluates a branch-free polynomial on a whole SIMD vector
+ * (GCC/Clang vector extensions, RF_VM_BYTES wide) instead of calling libm
+ * once per element. Lanes outside a kernel's fast domain (NaN, infinities, huge
+ * trig arguments, non-positive log inputs, ...) are recomputed with scalar
+ * libm, so results match libm semantics at every input.
+ *
+ * Accuracy against the correctly rounded result, on the vector path:
+ *   f64  exp, log, sqrt       <= 1 ULP (sqrt is exact)
+ *   f64  sin, cos             <= 1 ULP for |x| <= 1.6e6
+ *   f64  pow                  <= 1 ULP
+ *   f64  tanh                 <= 4 ULP
+ *   f32  exp, log, pow, sqrt  <= 1 ULP (pow is evaluated in f64)
+ *   f32  sin, cos             <= 2.5 ULP for |x| <= 8192
+ *   f32  tanh                 <= 1.5 ULP
+ * The f64 trig reduction carries pi/2 to ~2^-120, leaving an absolute error
+ * below 1e-25 for results right next to a nonzero root.
+ *
+ * This file is a template: each vector_math_<isa>.c defines RF_VM_BYTES and
+ * RF_VM_TABLE, includes it once, and is compiled with that ISA's -m flags.
+ * Variants round identically (FMA contraction is off), apart from f64 pow,
+ * which only the 64-byte variant vectorizes.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "vector_math_dispatch.h"
+
+#if !defined(RF_VM_BYTES) || !defined(RF_VM_TABLE)
+    #error "define RF_VM_BYTES and RF_VM_TABLE before including vector_math_kernels.h"
+#endif
+
+typedef double rf_vf64 __attribute__((vector_size(RF_VM_BYTES)));
+typedef int64_t rf_vi64 __attribute__((vector_size(RF_VM_BYTES)));
+typedef uint64_t rf_vu64 __attribute__((vector_size(RF_VM_BYTES)));
+typedef float rf_vf32 __attribute__((vector_size(RF_VM_BYTES)));
+typedef int32_t rf_vi32 __attribute__((vector_size(RF_VM_BYTES)));
+typedef float rf_vf32_half __attribute__((vector_size(RF_VM_BYTES / 2)));
+
+#define RF_VF64_LANES (RF_VM_BYTES / 8)
+#define RF_VF32_LANES (RF_VM_BYTES / 4)
+
+// ============================================================================
+// Lane Helpers
+// Comparisons yield all-ones/zero integer lanes; select and sign tricks work
+// on the bit patterns so that everything stays in vector registers.
+// ============================================================================
+
+#define RF_F64_SIGN ((int64_t)INT64_MIN)
+#define RF_F32_SIGN ((int32_t)INT32_MIN)
+
+// Adding 1.5 * 2^52 (2^23) rounds to an integer held in the low mantissa bits
+#define RF_F64_ROUND_MAGIC 0x1.8p52
+#define RF_F32_ROUND_MAGIC 0x1.8p23f
+
+static inline rf_vf64 vm_select_f64(rf_vi64 mask, rf_vf64 a, rf_vf64 b)
+{
+    return (rf_vf64)(((rf_vi64)a & mask) | ((rf_vi64)b & ~mask));
+}
+
+static inline rf_vf32 vm_select_f32(rf_vi32 mask, rf_vf32 a, rf_vf32 b)
+{
+    return (rf_vf32)(((rf_vi32)a & mask) | ((rf_vi32)b & ~mask));
+}
+
+static inline rf_vf64 vm_abs_f64(rf_vf64 x)
+{
+    return (rf_vf64)((rf_vi64)x & ~RF_F64_SIGN);
+}
+
+static inline rf_vf32 vm_abs_f32(rf_vf32 x)
+{
+    return (rf_vf32)((rf_vi32)x & ~RF_F32_SIGN);
+}
+
+static inline bool vm_any_f64(rf_vi64 mask)
+{
+    int64_t any = 0;
+    for (int lane = 0; lane < RF_VF64_LANES; lane++)
+    {
+        any |= mask[lane];
+    }
+    return any != 0;
+}
+
+static inline bool vm_any_f32(rf_vi32 mask)
+{
+    int32_t any = 0;
+    for (int lane = 0; lane < RF_VF32_LANES; lane++)
+    {
+        any |= mask[lane];
+    }
+    return any != 0;
+}
+
+// Small integer held in a double/float (|v| < 2^51 / 2^22) to its integer lanes
+static inline rf_vi64 vm_round_bits_f64(rf_vf64 v, rf_vf64* rounded)
+{
+    rf_vf64 t = v + RF_F64_ROUND_MAGIC;
+    *rounded = t - RF_F64_ROUND_MAGIC;
+    return (rf_vi64)t - (rf_vi64)((rf_vf64){0} + RF_F64_ROUND_MAGIC);
+}
+
+static inline rf_vi32 vm_round_bits_f32(rf_vf32 v, rf_vf32* rounded)
+{
+    rf_vf32 t = v + RF_F32_ROUND_MAGIC;
+    *rounded = t - RF_F32_ROUND_MAGIC;
+    return (rf_vi32)t - (rf_vi32)((rf_vf32){0} + RF_F32_ROUND_MAGIC);
+}
+
+static inline rf_vf64 vm_int_to_f64(rf_vi64 n)
+{
+    rf_vf64 magic = (rf_vf64){0} + RF_F64_ROUND_MAGIC;
+    return (rf_vf64)(n + (rf_vi64)magic) - magic;
+}
+
+static inline rf_vf32 vm_int_to_f32(rf_vi32 n)
+{
+    rf_vf32 magic = (rf_vf32){0} + RF_F32_ROUND_MAGIC;
+    return (rf_vf32)(n + (rf_vi32)magic) - magic;
+}
+
+// Error-free product a * b = hi + lo (Dekker; no FMA required)
+static inline rf_vf64 vm_split_f64(rf_vf64 a, rf_vf64* low)
+{
+    rf_vf64 c = a * 134217729.0;
+    rf_vf64 high = c - (c - a);
+    *low = a - high;
+    return high;
+}
+
+static inline rf_vf64 vm_two_prod_f64(rf_vf64 a, rf_vf64 b, rf_vf64* lo)
+{
+    rf_vf64 a_lo;
+    rf_vf64 b_lo;
+    rf_vf64 a_hi = vm_split_f64(a, &a_lo);
+    rf_vf64 b_hi = vm_split_f64(b, &b_lo);
+    rf_vf64 hi = a * b;
+    *lo = ((a_hi * b_hi - hi) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+    return hi;
+}
+
+// ============================================================================
+// f64 Kernels (fdlibm polynomials)
+// ============================================================================
+
+#define RF_LN2_HI 6.93147180369123816490e-01
+#define RF_LN2_LO 1.90821492927058770002e-10
+#define RF_INV_LN2 1.44269504088896338700e+00
+#define RF_SQRT2 1.41421356237309504880
+
+// exp(hi + lo) for |hi| <= 708; lo is a tail below one ULP of hi
+static inline rf_vf64 vm_exp_core_f64(rf_vf64 x, rf_vf64 tail)
+{
+    rf_vf64 kd;
+    rf_vi64 k = vm_round_bits_f64(x * RF_INV_LN2, &kd);
+
+    rf_vf64 hi = x - kd * RF_LN2_HI;
+    rf_vf64 lo = kd * RF_LN2_LO - tail;
+    rf_vf64 r = hi - lo;
+    rf_vf64 z = r * r;
+    rf_vf64 c = r - z * (1.66666666666666019037e-01 +
+                         z * (-2.77777777770155933842e-03 +
+                              z * (6.61375632143793436117e-05 +
+                                   z * (-1.65339022054652515390e-06 +
+                                        z * 4.13813679705723846039e-08))));
+    rf_vf64 y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+
+    return y * (rf_vf64)((k + 1023) << 52);
+}
+
+// Splits a positive normal x into 2^e * m with m in [sqrt(2)/2, sqrt(2)]
+static inline rf_vf64 vm_frexp_f64(rf_vf64 x, rf_vf64* e)
+{
+    rf_vi64 bits = (rf_vi64)x;
+    rf_vi64 exponent = (rf_vi64)((rf_vu64)bits >> 52) - 1023;
+    rf_vf64 m = (rf_vf64)((bits & INT64_C(0x000FFFFFFFFFFFFF)) | INT64_C(0x3FF0000000000000));
+    rf_vi64 big = m > RF_SQRT2;
+    m = vm_select_f64(big, m * 0.5, m);
+    *e = vm_int_to_f64(exponent - big);
+    return m;
+}
+
+// log(1 + f) - f + f^2/2 pieces shared by log and pow: returns s * (hfsq + R)
+static inline rf_vf64 vm_log_poly_f64(rf_vf64 f, rf_vf64 hfsq)
+{
+    rf_vf64 s = f / (2.0 + f);
+    rf_vf64 z = s * s;
+    rf_vf64 w = z * z;
+    rf_vf64 t1 = w * (3.999999999940941908e-01 +
+                      w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+    rf_vf64 t2 = z * (6.666666666666735130e-01 +
+                      w * (2.857142874366239149e-01 +
+                           w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+    return s * (hfsq + t1 + t2);
+}
+
+static inline rf_vf64 vm_log_core_f64(rf_vf64 x)
+{
+    rf_vf64 dk;
+    rf_vf64 f = vm_frexp_f64(x, &dk) - 1.0;
+    rf_vf64 hfsq = 0.5 * f * f;
+    rf_vf64 t = vm_log_poly_f64(f, hfsq);
+    return dk * RF_LN2_HI - ((hfsq - (t + dk * RF_LN2_LO)) - f);
+}
+
+// Double-double log(x) = hi + lo, accurate to ~2^-62 relative (for pow)
+static inline rf_vf64 vm_log_wide_f64(rf_vf64 x, rf_vf64* lo)
+{
+    rf_vf64 dk;
+    rf_vf64 f = vm_frexp_f64(x, &dk) - 1.0;
+
+    // f^2/2 exactly, and s = f / (2 + f) with its rounding error s_lo
+    rf_vf64 ff_lo;
+    rf_vf64 ff_hi = vm_two_prod_f64(f, f, &ff_lo);
+    rf_vf64 h_hi = 0.5 * ff_hi;
+    rf_vf64 h_lo = 0.5 * ff_lo;
+    rf_vf64 d = 2.0 + f;
+    rf_vf64 d_lo = (2.0 - d) + f;
+    rf_vf64 s = f / d;
+    rf_vf64 sd_lo;
+    rf_vf64 sd = vm_two_prod_f64(s, d, &sd_lo);
+    rf_vf64 s_lo = (((f - sd) - sd_lo) - s * d_lo) / d;
+
+    // R(z) = sum 2 z^k / (2k + 1) with z = (s + s_lo)^2: the Taylor series to
+    // z^12, with the leading 2/3 * z term in double-double
+    rf_vf64 z_lo;
+    rf_vf64 z = vm_two_prod_f64(s, s, &z_lo);
+    z_lo = z_lo + 2.0 * s * s_lo;
+    rf_vf64 r_lo;
+    rf_vf64 r = vm_two_prod_f64((rf_vf64){0} + 0x1.5555555555555p-1, z, &r_lo);
+    rf_vf64 series =
+        2.0 / 5 + z * (2.0 / 7 + z * (2.0 / 9 + z * (2.0 / 11 + z * (2.0 / 13 +
+        z * (2.0 / 15 + z * (2.0 / 17 + z * (2.0 / 19 + z * (2.0 / 21 +
+        z * (2.0 / 23 + z * (2.0 / 25))))))))));
+    r_lo = r_lo + 0x1.5555555555555p-55 * z + 0x1.5555555555555p-1 * z_lo + z * z * series;
+
+    // log(m) = f - f^2/2 + s * (f^2/2 + R), keeping s * f^2/2 exact
+    rf_vf64 u_hi = h_hi + r;
+    rf_vf64 u_lo = (h_hi - u_hi) + r + h_lo + r_lo;
+    rf_vf64 t_lo;
+    rf_vf64 t_hi = vm_two_prod_f64(s, u_hi, &t_lo);
+    t_lo = t_lo + s * u_lo + s_lo * u_hi;
+    rf_vf64 a_hi = f - h_hi;
+    rf_vf64 a_lo = (f - a_hi) - h_hi;
+    rf_vf64 m_hi = a_hi + t_hi;
+    rf_vf64 m_lo = (t_hi - (m_hi - a_hi)) + a_lo - h_lo + t_lo;
+
+    // Fold in k * ln2 (k * LN2_HI is exact)
+    rf_vf64 k_hi = dk * RF_LN2_HI;
+    rf_vf64 sum = k_hi + m_hi;
+    rf_vf64 bv = sum - k_hi;
+    rf_vf64 sum_lo = ((k_hi - (sum - bv)) + (m_hi - bv)) + (m_lo + dk * RF_LN2_LO);
+
+    rf_vf64 hi = sum + sum_lo;
+    *lo = sum_lo - (hi - sum);
+    return hi;
+}
+
+#define RF_TRIG_LIMIT_F64 1.6e6
+#define RF_INV_PIO2 6.36619772367581382433e-01
+#define RF_PIO2_1 1.57079632673412561417e+00
+#define RF_PIO2_2 6.07710050630396597660e-11
+#define RF_PIO2_3 2.02226624871116645580e-21
+
+// sin(r + tail) and cos(r + tail) for |r| <= pi/4 (fdlibm __kernel_sin/__kernel_cos)
+static inline rf_vf64 vm_ksin_f64(rf_vf64 r, rf_vf64 tail)
+{
+    rf_vf64 z = r * r;
+    rf_vf64 v = z * r;
+    rf_vf64 p = 8.33333333332248946124e-03 +
+                z * (-1.98412698298579493134e-04 +
+                     z * (2.75573137070700676789e-06 +
+                          z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)));
+    return r - ((z * (0.5 * tail - v * p) - tail) - v * -1.66666666666666324348e-01);
+}
+
+static inline rf_vf64 vm_kcos_f64(rf_vf64 r, rf_vf64 tail)
+{
+    rf_vf64 z = r * r;
+    rf_vf64 p = z * (4.16666666666666019037e-02 +
+                     z * (-1.38888888888741095749e-03 +
+                          z * (2.48015872894767294178e-05 +
+                               z * (-2.75573143513906633035e-07 +
+                                    z * (2.08757232129817482790e-09 +
+                                         z * -1.13596475577881948265e-11)))));
+    rf_vf64 hz = 0.5 * z;
+    rf_vf64 w = 1.0 - hz;
+    return w + (((1.0 - w) - hz) + (z * p - r * tail));
+}
+
+// Reduces x to r + tail in [-pi/4, pi/4]; returns the quadrant count n.
+// n * PIO2_1 and n * PIO2_2 are exact for |n| < 2^20, and the rounding error
+// of the second subtraction is carried into the tail.
+static inline rf_vi64 vm_reduce_pio2_f64(rf_vf64 x, rf_vf64* r, rf_vf64* tail)
+{
+    rf_vf64 nd;
+    rf_vi64 n = vm_round_bits_f64(x * RF_INV_PIO2, &nd);
+
+    rf_vf64 a = x - nd * RF_PIO2_1;
+    rf_vf64 w = nd * RF_PIO2_2;
+    rf_vf64 b = a - w;
+    rf_vf64 bv = a - b;
+    rf_vf64 b_err = (a - (b + bv)) + (bv - w);
+    rf_vf64 c = nd * RF_PIO2_3 - b_err;
+
+    *r = b - c;
+    *tail = (b - *r) - c;
+    return n;
+}
+
+static inline rf_vf64 vm_sin_f64(rf_vf64 x)
+{
+    rf_vf64 r;
+    rf_vf64 tail;
+    rf_vi64 n = vm_reduce_pio2_f64(x, &r, &tail);
+    rf_vf64 y = vm_select_f64(-(n & 1), vm_kcos_f64(r, tail), vm_ksin_f64(r, tail));
+    y = (rf_vf64)((rf_vi64)y ^ ((n & 2) << 62));
+
+    // sin(-0) is -0; lanes the fast path cannot reduce go to libm
+    y = vm_select_f64(x == 0.0, x, y);
+    rf_vi64 slow = ~(vm_abs_f64(x) <= RF_TRIG_LIMIT_F64);
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = sin(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf64 vm_cos_f64(rf_vf64 x)
+{
+    rf_vf64 r;
+    rf_vf64 tail;
+    rf_vi64 n = vm_reduce_pio2_f64(x, &r, &tail);
+    rf_vf64 y = vm_select_f64(-(n & 1), vm_ksin_f64(r, tail), vm_kcos_f64(r, tail));
+    y = (rf_vf64)((rf_vi64)y ^ (((n + 1) & 2) << 62));
+
+    rf_vi64 slow = ~(vm_abs_f64(x) <= RF_TRIG_LIMIT_F64);
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = cos(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf64 vm_exp_f64(rf_vf64 x)
+{
+    rf_vi64 slow = ~(vm_abs_f64(x) <= 708.0);
+    rf_vf64 y = vm_exp_core_f64(vm_select_f64(slow, (rf_vf64){0}, x), (rf_vf64){0});
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = exp(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf64 vm_log_f64(rf_vf64 x)
+{
+    rf_vi64 slow = ~((x >= 0x1p-1022) & (x <= 0x1.fffffffffffffp1023));
+    rf_vf64 y = vm_log_core_f64(vm_select_f64(slow, (rf_vf64){0} + 1.0, x));
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = log(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf64 vm_pow_f64(rf_vf64 x, rf_vf64 y)
+{
+    rf_vi64 slow = ~((x >= 0x1p-1022) & (x <= 0x1.fffffffffffffp1023) &
+                     (vm_abs_f64(y) <= 0x1p900));
+    rf_vf64 one = (rf_vf64){0} + 1.0;
+    rf_vf64 safe_x = vm_select_f64(slow, one, x);
+    rf_vf64 safe_y = vm_select_f64(slow, one, y);
+
+    rf_vf64 log_lo;
+    rf_vf64 log_hi = vm_log_wide_f64(safe_x, &log_lo);
+    rf_vf64 p_lo;
+    rf_vf64 p_hi = vm_two_prod_f64(safe_y, log_hi, &p_lo);
+    p_lo = p_lo + safe_y * log_lo;
+
+    slow |= ~(vm_abs_f64(p_hi) <= 708.0);
+    rf_vf64 result = vm_exp_core_f64(vm_select_f64(slow, (rf_vf64){0}, p_hi),
+                                     vm_select_f64(slow, (rf_vf64){0}, p_lo));
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) result[lane] = pow(x[lane], y[lane]);
+        }
+    }
+    return result;
+}
+
+#define RF_EXPM1_SMALL 0.3466
+
+// tanh(|x|) = e / (e + 2) with e = expm1(2|x|); Taylor expm1 below ln2/2
+static inline rf_vf64 vm_tanh_f64(rf_vf64 x)
+{
+    rf_vf64 a = vm_abs_f64(x);
+    rf_vf64 t = 2.0 * vm_select_f64(a < 22.0, a, (rf_vf64){0} + 22.0);
+
+    rf_vf64 series =
+        t * (1.0 + t * (1.0 / 2 + t * (1.0 / 6 + t * (1.0 / 24 + t * (1.0 / 120 +
+        t * (1.0 / 720 + t * (1.0 / 5040 + t * (1.0 / 40320 + t * (1.0 / 362880 +
+        t * (1.0 / 3628800 + t * (1.0 / 39916800 + t * (1.0 / 479001600 +
+        t * (1.0 / 6227020800.0)))))))))))));
+    rf_vf64 em = vm_select_f64(t < RF_EXPM1_SMALL, series,
+                               vm_exp_core_f64(t, (rf_vf64){0}) - 1.0);
+    rf_vf64 y = em / (em + 2.0);
+    y = (rf_vf64)((rf_vi64)y | ((rf_vi64)x & RF_F64_SIGN));
+
+    rf_vi64 slow = x != x;
+    if (vm_any_f64(slow))
+    {
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = x[lane];
+        }
+    }
+    return y;
+}
+
+// ============================================================================
+// f32 Kernels (Cephes polynomials)
+// ============================================================================
+
+#define RF_LN2_HI_F32 0.693359375f
+#define RF_LN2_LO_F32 -2.12194440e-4f
+#define RF_INV_LN2_F32 1.44269504088896341f
+#define RF_SQRT2_F32 1.41421356237309504880f
+
+static inline rf_vf32 vm_exp_core_f32(rf_vf32 x)
+{
+    rf_vf32 kd;
+    rf_vi32 k = vm_round_bits_f32(x * RF_INV_LN2_F32, &kd);
+
+    rf_vf32 r = x - kd * RF_LN2_HI_F32 - kd * RF_LN2_LO_F32;
+    rf_vf32 z = r * r;
+    rf_vf32 y = ((((1.9875691500E-4f * r + 1.3981999507E-3f) * r + 8.3334519073E-3f) * r +
+                  4.1665795894E-2f) * r + 1.6666665459E-1f) * r + 5.0000001201E-1f;
+    y = y * z + r + 1.0f;
+
+    return y * (rf_vf32)((k + 127) << 23);
+}
+
+static inline rf_vf32 vm_log_core_f32(rf_vf32 x)
+{
+    rf_vi32 bits = (rf_vi32)x;
+    rf_vi32 exponent = (bits >> 23) - 127;
+    rf_vf32 m = (rf_vf32)((bits & 0x007FFFFF) | 0x3F800000);
+    rf_vi32 big = m > RF_SQRT2_F32;
+    m = vm_select_f32(big, m * 0.5f, m);
+    rf_vf32 e = vm_int_to_f32(exponent - big);
+
+    rf_vf32 f = m - 1.0f;
+    rf_vf32 z = f * f;
+    rf_vf32 y = ((((((((7.0376836292E-2f * f - 1.1514610310E-1f) * f + 1.1676998740E-1f) * f -
+                     1.2420140846E-1f) * f + 1.4249322787E-1f) * f - 1.6668057665E-1f) * f +
+                  2.0000714765E-1f) * f - 2.4999993993E-1f) * f + 3.3333331174E-1f) * f * z;
+    y = y + e * RF_LN2_LO_F32 - 0.5f * z;
+    return f + y + e * RF_LN2_HI_F32;
+}
+
+#define RF_TRIG_LIMIT_F32 8192.0f
+#define RF_INV_PIO2_F32 0.636619772367581343f
+// pi/2 split into three 11-bit parts and a full tail: n * part is exact for
+// |n| < 2^13, so only the last subtraction rounds
+#define RF_PIO2_1_F32 0x1.92p+0f
+#define RF_PIO2_2_F32 0x1.fb4p-12f
+#define RF_PIO2_3_F32 0x1.444p-24f
+#define RF_PIO2_4_F32 0x1.68c234p-39f
+
+static inline rf_vf32 vm_ksin_f32(rf_vf32 r)
+{
+    rf_vf32 z = r * r;
+    return ((-1.9515295891E-4f * z + 8.3321608736E-3f) * z - 1.6666654611E-1f) * z * r + r;
+}
+
+static inline rf_vf32 vm_kcos_f32(rf_vf32 r)
+{
+    rf_vf32 z = r * r;
+    return ((2.443315711809948E-5f * z - 1.388731625493765E-3f) * z + 4.166664568298827E-2f) *
+           z * z - 0.5f * z + 1.0f;
+}
+
+static inline rf_vi32 vm_reduce_pio2_f32(rf_vf32 x, rf_vf32* r)
+{
+    rf_vf32 nd;
+    rf_vi32 n = vm_round_bits_f32(x * RF_INV_PIO2_F32, &nd);
+    *r = (((x - nd * RF_PIO2_1_F32) - nd * RF_PIO2_2_F32) - nd * RF_PIO2_3_F32) -
+         nd * RF_PIO2_4_F32;
+    return n;
+}
+
+static inline rf_vf32 vm_sin_f32(rf_vf32 x)
+{
+    rf_vf32 r;
+    rf_vi32 n = vm_reduce_pio2_f32(x, &r);
+    rf_vf32 y = vm_select_f32(-(n & 1), vm_kcos_f32(r), vm_ksin_f32(r));
+    y = (rf_vf32)((rf_vi32)y ^ ((n & 2) << 30));
+
+    y = vm_select_f32(x == 0.0f, x, y);
+    rf_vi32 slow = ~(vm_abs_f32(x) <= RF_TRIG_LIMIT_F32);
+    if (vm_any_f32(slow))
+    {
+        for (int lane = 0; lane < RF_VF32_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = sinf(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf32 vm_cos_f32(rf_vf32 x)
+{
+    rf_vf32 r;
+    rf_vi32 n = vm_reduce_pio2_f32(x, &r);
+    rf_vf32 y = vm_select_f32(-(n & 1), vm_ksin_f32(r), vm_kcos_f32(r));
+    y = (rf_vf32)((rf_vi32)y ^ (((n + 1) & 2) << 30));
+
+    rf_vi32 slow = ~(vm_abs_f32(x) <= RF_TRIG_LIMIT_F32);
+    if (vm_any_f32(slow))
+    {
+        for (int lane = 0; lane < RF_VF32_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = cosf(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf32 vm_exp_f32(rf_vf32 x)
+{
+    rf_vi32 slow = ~(vm_abs_f32(x) <= 87.0f);
+    rf_vf32 y = vm_exp_core_f32(vm_select_f32(slow, (rf_vf32){0}, x));
+    if (vm_any_f32(slow))
+    {
+        for (int lane = 0; lane < RF_VF32_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = expf(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf32 vm_log_f32(rf_vf32 x)
+{
+    rf_vi32 slow = ~((x >= 0x1p-126f) & (x <= 0x1.fffffep127f));
+    rf_vf32 y = vm_log_core_f32(vm_select_f32(slow, (rf_vf32){0} + 1.0f, x));
+    if (vm_any_f32(slow))
+    {
+        for (int lane = 0; lane < RF_VF32_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = logf(x[lane]);
+        }
+    }
+    return y;
+}
+
+static inline rf_vf32 vm_tanh_f32(rf_vf32 x)
+{
+    rf_vf32 a = vm_abs_f32(x);
+    rf_vf32 t = 2.0f * vm_select_f32(a < 9.0f, a, (rf_vf32){0} + 9.0f);
+
+    rf_vf32 em = vm_exp_core_f32(t) - 1.0f;
+    rf_vf32 y = em / (em + 2.0f);
+
+    // Below 0.625 the quotient's roundings add up to over 3 ULP; the odd
+    // polynomial (Cephes tanhf) stays near 1
+    rf_vf32 z = a * a;
+    rf_vf32 odd = ((((-5.70498872745E-3f * z + 2.06390887954E-2f) * z - 5.37397155531E-2f) * z +
+                    1.33314422036E-1f) * z - 3.33332819422E-1f) * z * a + a;
+    y = vm_select_f32(a < 0.625f, odd, y);
+    y = (rf_vf32)((rf_vi32)y | ((rf_vi32)x & RF_F32_SIGN));
+
+    rf_vi32 slow = x != x;
+    if (vm_any_f32(slow))
+    {
+        for (int lane = 0; lane < RF_VF32_LANES; lane++)
+        {
+            if (slow[lane]) y[lane] = x[lane];
+        }
+    }
+    return y;
+}
+
+// Single-precision pow runs the f64 kernel on widened lanes: exp(y * log x)
+// in double keeps the f32 result within 1 ULP without a wide log
+static inline rf_vf32 vm_pow_f32(rf_vf32 x, rf_vf32 y)
+{
+    rf_vf32 result;
+    for (int half = 0; half < RF_VF32_LANES; half += RF_VF64_LANES)
+    {
+        rf_vf32_half x_half;
+        rf_vf32_half y_half;
+        memcpy(&x_half, (const float*)&x + half, sizeof(x_half));
+        memcpy(&y_half, (const float*)&y + half, sizeof(y_half));
+        rf_vf64 wide_x = __builtin_convertvector(x_half, rf_vf64);
+        rf_vf64 wide_y = __builtin_convertvector(y_half, rf_vf64);
+
+        rf_vi64 slow = ~((wide_x > 0.0) & (wide_x <= 0x1.fffffep127) &
+                         (vm_abs_f64(wide_y) <= 0x1.fffffep127));
+        rf_vf64 one = (rf_vf64){0} + 1.0;
+        rf_vf64 product = vm_select_f64(slow, one, wide_y) *
+                          vm_log_core_f64(vm_select_f64(slow, one, wide_x));
+        slow |= ~(vm_abs_f64(product) <= 708.0);
+        rf_vf64 wide = vm_exp_core_f64(vm_select_f64(slow, (rf_vf64){0}, product), (rf_vf64){0});
+
+        rf_vf32_half narrow = __builtin_convertvector(wide, rf_vf32_half);
+        for (int lane = 0; lane < RF_VF64_LANES; lane++)
+        {
+            result[half + lane] = slow[lane] ? powf(x[half + lane], y[half + lane])
+                                             : narrow[lane];
+        }
+    }
+    return result;
+}
+
+// ============================================================================
+// Batch Entry Points
+// Full vectors are loaded/stored unaligned; the tail runs through a padded
+// vector so every element takes the same kernel. dest may alias src.
+// ============================================================================
+
+// Optimized builds clear the upper AVX state on return by themselves; do it
+// explicitly so unoptimized builds do not slow down the caller's SSE code
+#ifdef __AVX__
+    #define RF_VM_LEAVE() __builtin_ia32_vzeroupper()
+#else
+    #define RF_VM_LEAVE() ((void)0)
+#endif
+
+#define RF_VM_DEFINE_UNARY(NAME, T, VT, LANES, KERNEL)                  \
+    static void NAME(const T* src, T* dest, size_t count)               \
+    {                                                                   \
+        size_t i = 0;                                                   \
+        for (; i + LANES <= count; i += LANES)                          \
+        {                                                               \
+            VT v;                                                       \
+            memcpy(&v, src + i, sizeof(v));                             \
+            v = KERNEL(v);                                              \
+            memcpy(dest + i, &v, sizeof(v));                            \
+        }                                                               \
+        if (i < count)                                                  \
+        {                                                               \
+            VT v = (VT){0} + (T)1;                                      \
+            memcpy(&v, src + i, (count - i) * sizeof(T));               \
+            v = KERNEL(v);                                              \
+            memcpy(dest + i, &v, (count - i) * sizeof(T));              \
+        }                                                               \
+        RF_VM_LEAVE();                                                  \
+    }
+
+#define RF_VM_DEFINE_BINARY(NAME, T, VT, LANES, KERNEL)                      \
+    static void NAME(const T* src_a, const T* src_b, T* dest, size_t count)  \
+    {                                                                        \
+        size_t i = 0;                                                        \
+        for (; i + LANES <= count; i += LANES)                               \
+        {                                                                    \
+            VT a;                                                            \
+            VT b;                                                            \
+            memcpy(&a, src_a + i, sizeof(a));                                \
+            memcpy(&b, src_b + i, sizeof(b));                                \
+            a = KERNEL(a, b);                                                \
+            memcpy(dest + i, &a, sizeof(a));                                 \
+        }                                                                    \
+        if (i < count)                                                       \
+        {                                                                    \
+            VT a = (VT){0} + (T)1;                                           \
+            VT b = (VT){0} + (T)1;                                           \
+            memcpy(&a, src_a + i, (count - i) * sizeof(T));                  \
+            memcpy(&b, src_b + i, (count - i) * sizeof(T));                  \
+            a = KERNEL(a, b);                                                \
+            memcpy(dest + i, &a, (count - i) * sizeof(T));                   \
+        }                                                                    \
+        RF_VM_LEAVE();                                                       \
+    }
+
+RF_VM_DEFINE_UNARY(vm_f64_sin_batch, double, rf_vf64, RF_VF64_LANES, vm_sin_f64)
+RF_VM_DEFINE_UNARY(vm_f64_cos_batch, double, rf_vf64, RF_VF64_LANES, vm_cos_f64)
+RF_VM_DEFINE_UNARY(vm_f64_exp_batch, double, rf_vf64, RF_VF64_LANES, vm_exp_f64)
+RF_VM_DEFINE_UNARY(vm_f64_log_batch, double, rf_vf64, RF_VF64_LANES, vm_log_f64)
+RF_VM_DEFINE_UNARY(vm_f64_tanh_batch, double, rf_vf64, RF_VF64_LANES, vm_tanh_f64)
+#if RF_VM_BYTES >= 64
+RF_VM_DEFINE_BINARY(vm_f64_pow_batch, double, rf_vf64, RF_VF64_LANES, vm_pow_f64)
+#else
+// Below eight lanes the double-double log costs more than libm pow
+static void vm_f64_pow_batch(const double* src_a, const double* src_b, double* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = pow(src_a[i], src_b[i]);
+    }
+}
+#endif
+
+RF_VM_DEFINE_UNARY(vm_f32_sin_batch, float, rf_vf32, RF_VF32_LANES, vm_sin_f32)
+RF_VM_DEFINE_UNARY(vm_f32_cos_batch, float, rf_vf32, RF_VF32_LANES, vm_cos_f32)
+RF_VM_DEFINE_UNARY(vm_f32_exp_batch, float, rf_vf32, RF_VF32_LANES, vm_exp_f32)
+RF_VM_DEFINE_UNARY(vm_f32_log_batch, float, rf_vf32, RF_VF32_LANES, vm_log_f32)
+RF_VM_DEFINE_UNARY(vm_f32_tanh_batch, float, rf_vf32, RF_VF32_LANES, vm_tanh_f32)
+RF_VM_DEFINE_BINARY(vm_f32_pow_batch, float, rf_vf32, RF_VF32_LANES, vm_pow_f32)
+
+// Hardware square root is correctly rounded; built with -fno-math-errno so
+// these loops compile to packed sqrt instructions
+static void vm_f64_sqrt_batch(const double* src, double* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = sqrt(src[i]);
+    }
+}
+
+static void vm_f32_sqrt_batch(const float* src, float* dest, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] = sqrtf(src[i]);
+    }
+}
+
+const rf_vm_table RF_VM_TABLE = {
+    .f64_sin = vm_f64_sin_batch,
+    .f64_cos = vm_f64_cos_batch,
+    .f64_exp = vm_f64_exp_batch,
+    .f64_log = vm_f64_log_batch,
+    .f64_sqrt = vm_f64_sqrt_batch,
+    .f64_tanh = vm_f64_tanh_batch,
+    .f64_pow = vm_f64_pow_batch,
+    .f32_sin = vm_f32_sin_batch,
+    .f32_cos = vm_f32_cos_batch,
+    .f32_exp = vm_f32_exp_batch,
+    .f32_log = vm_f32_log_batch,
+    .f32_sqrt = vm_f32_sqrt_batch,
+    .f32_tanh = vm_f32_tanh_batch,
+    .f32_pow = vm_f32_pow_batch,
+};
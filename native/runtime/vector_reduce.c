@@ -0,0 +1,256 @@
+/*
+ * RazorForge Runtime - Vector Reductions
+ * Public reduction entry points. The kernels (vector_reduce_kernels.h) return
+ * per-lane partial results; this file folds them in one fixed order, so the
+ * answer does not depend on which ISA variant ran.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include "../include/razorforge_cpu.h"
+#include "../include/razorforge_math.h"
+#include "vector_math_dispatch.h"
+
+// ============================================================================
+// Dispatch
+// Reductions have no fast/strict split: every variant rounds the same way
+// ============================================================================
+
+static const rf_vr_table* vr_active = NULL;
+
+static const rf_vr_table* vr_select_table(void)
+{
+    switch (rf_cpu_active_level())
+    {
+#ifdef RF_VM_HAS_X86_VARIANTS
+        case RF_CPU_AVX512: return &rf_vr_table_avx512;
+        case RF_CPU_AVX2: return &rf_vr_table_avx2;
+#endif
+        default: return &rf_vr_table_base;
+    }
+}
+
+// Bound at load time; the lazy path only covers calls from other constructors
+__attribute__((constructor))
+static void vr_bind_table(void)
+{
+    __atomic_store_n(&vr_active, vr_select_table(), __ATOMIC_RELEASE);
+}
+
+static inline const rf_vr_table* vr_table(void)
+{
+    const rf_vr_table* table = __atomic_load_n(&vr_active, __ATOMIC_ACQUIRE);
+    if (__builtin_expect(table == NULL, 0))
+    {
+        table = vr_select_table();
+        __atomic_store_n(&vr_active, table, __ATOMIC_RELEASE);
+    }
+    return table;
+}
+
+// ============================================================================
+// Lane Folding
+// ============================================================================
+
+// Folds compensated lanes into one double. Infinities and NaN come back
+// exactly as plain summation would produce them.
+static double vr_fold(const rf_vr_acc* acc)
+{
+    double sum = 0.0;
+    double comp = 0.0;
+    for (int lane = 0; lane < RF_VR_LANES; lane++)
+    {
+        double t = sum + acc->sum[lane];
+        double bv = t - sum;
+        comp += (sum - (t - bv)) + (acc->sum[lane] - bv);
+        comp += acc->comp[lane];
+        sum = t;
+    }
+
+    return isfinite(sum) ? sum + comp : sum;
+}
+
+static double vr_fold_min(const double lanes[RF_VR_LANES])
+{
+    double result = lanes[0];
+    for (int lane = 1; lane < RF_VR_LANES; lane++)
+    {
+        if (lanes[lane] < result || lanes[lane] != lanes[lane]) result = lanes[lane];
+    }
+    return result;
+}
+
+static double vr_fold_max(const double lanes[RF_VR_LANES])
+{
+    double result = lanes[0];
+    for (int lane = 1; lane < RF_VR_LANES; lane++)
+    {
+        if (lanes[lane] > result || lanes[lane] != lanes[lane]) result = lanes[lane];
+    }
+    return result;
+}
+
+// Corrected two-pass variance: sum (x - mean)^2 minus the error the rounded
+// mean leaves in sum (x - mean)
+static double vr_variance(const rf_vr_acc* first, const rf_vr_acc* second, size_t count,
+                          size_t ddof)
+{
+    double s1 = vr_fold(first);
+    double s2 = vr_fold(second);
+    double result = (s2 - s1 * s1 / (double)count) / (double)(count - ddof);
+    return result < 0.0 ? 0.0 : result;
+}
+
+// ============================================================================
+// f64
+// ============================================================================
+
+double rf_f64_sum(const double* src, size_t count)
+{
+    rf_vr_acc acc;
+    vr_table()->f64_sum(src, count, &acc);
+    return vr_fold(&acc);
+}
+
+double rf_f64_dot(const double* a, const double* b, size_t count)
+{
+    rf_vr_acc acc;
+    vr_table()->f64_dot(a, b, count, &acc);
+    return vr_fold(&acc);
+}
+
+double rf_f64_min(const double* src, size_t count)
+{
+    double lowest[RF_VR_LANES];
+    double highest[RF_VR_LANES];
+    vr_table()->f64_extrema(src, count, lowest, highest);
+    return vr_fold_min(lowest);
+}
+
+double rf_f64_max(const double* src, size_t count)
+{
+    double lowest[RF_VR_LANES];
+    double highest[RF_VR_LANES];
+    vr_table()->f64_extrema(src, count, lowest, highest);
+    return vr_fold_max(highest);
+}
+
+double rf_f64_mean(const double* src, size_t count)
+{
+    return count == 0 ? NAN : rf_f64_sum(src, count) / (double)count;
+}
+
+double rf_f64_variance(const double* src, size_t count, size_t ddof)
+{
+    if (count <= ddof)
+    {
+        return NAN;
+    }
+    rf_vr_acc first;
+    rf_vr_acc second;
+    vr_table()->f64_moments(src, count, rf_f64_mean(src, count), 1.0, &first, &second);
+    return vr_variance(&first, &second, count, ddof);
+}
+
+// Scales by a power of two near 1 / max|x| first, so squares neither
+// overflow nor underflow
+double rf_f64_norm(const double* src, size_t count)
+{
+    double lowest[RF_VR_LANES];
+    double highest[RF_VR_LANES];
+    vr_table()->f64_extrema(src, count, lowest, highest);
+    double low = vr_fold_min(lowest);
+    double high = vr_fold_max(highest);
+    if (count == 0)
+    {
+        return 0.0;
+    }
+    if (isnan(low) || isnan(high))
+    {
+        return NAN;
+    }
+    if (isinf(low) || isinf(high))
+    {
+        return INFINITY;
+    }
+
+    double largest = fmax(-low, high);
+    if (largest == 0.0)
+    {
+        return 0.0;
+    }
+    int exponent = ilogb(largest);
+    exponent = exponent < -1000 ? -1000 : exponent > 1000 ? 1000 : exponent;
+
+    rf_vr_acc first;
+    rf_vr_acc second;
+    vr_table()->f64_moments(src, count, 0.0, ldexp(1.0, -exponent), &first, &second);
+    return ldexp(sqrt(vr_fold(&second)), exponent);
+}
+
+// ============================================================================
+// f32 (accumulated in f64, rounded once)
+// ============================================================================
+
+float rf_f32_sum(const float* src, size_t count)
+{
+    rf_vr_acc acc;
+    vr_table()->f32_sum(src, count, &acc);
+    return (float)vr_fold(&acc);
+}
+
+float rf_f32_dot(const float* a, const float* b, size_t count)
+{
+    rf_vr_acc acc;
+    vr_table()->f32_dot(a, b, count, &acc);
+    return (float)vr_fold(&acc);
+}
+
+float rf_f32_min(const float* src, size_t count)
+{
+    double lowest[RF_VR_LANES];
+    double highest[RF_VR_LANES];
+    vr_table()->f32_extrema(src, count, lowest, highest);
+    return (float)vr_fold_min(lowest);
+}
+
+float rf_f32_max(const float* src, size_t count)
+{
+    double lowest[RF_VR_LANES];
+    double highest[RF_VR_LANES];
+    vr_table()->f32_extrema(src, count, lowest, highest);
+    return (float)vr_fold_max(highest);
+}
+
+static double vr_f32_mean(const float* src, size_t count)
+{
+    rf_vr_acc acc;
+    vr_table()->f32_sum(src, count, &acc);
+    return vr_fold(&acc) / (double)count;
+}
+
+float rf_f32_mean(const float* src, size_t count)
+{
+    return count == 0 ? NAN : (float)vr_f32_mean(src, count);
+}
+
+float rf_f32_variance(const float* src, size_t count, size_t ddof)
+{
+    if (count <= ddof)
+    {
+        return NAN;
+    }
+    rf_vr_acc first;
+    rf_vr_acc second;
+    vr_table()->f32_moments(src, count, vr_f32_mean(src, count), 1.0, &first, &second);
+    return (float)vr_variance(&first, &second, count, ddof);
+}
+
+// Squares of f32 values cannot overflow or underflow in f64, so no scaling
+float rf_f32_norm(const float* src, size_t count)
+{
+    rf_vr_acc first;
+    rf_vr_acc second;
+    vr_table()->f32_moments(src, count, 0.0, 1.0, &first, &second);
+    return (float)sqrt(vr_fold(&second));
+}
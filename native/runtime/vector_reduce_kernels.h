@@ -0,0 +1,240 @@
+/*
+ * RazorForge Runtime - Vector Reduction Kernels
+ * Sum, dot, moments and extrema over f32/f64 slices
+ *
+ * Every kernel accumulates into RF_VR_LANES logical lanes, however many
+ * hardware vectors that takes (4 on SSE2/NEON, 2 on AVX2, 1 on AVX-512).
+ * Element i always lands in lane i % RF_VR_LANES in the same order, so all
+ * variants return bit-identical lanes; vector_reduce.c folds them in one
+ * fixed order.
+ *
+ * Sums are compensated: each lane carries the exact rounding error of every
+ * addition (Knuth's TwoSum) and dot products add the exact product error
+ * (Dekker), which makes the result as accurate as summing in twice the
+ * precision. f32 input is widened to f64 first, where products are exact.
+ *
+ * Included by each vector_math_<isa>.c after vector_math_kernels.h, with
+ * RF_VR_TABLE naming the table it defines.
+ */
+
+#include "vector_math_dispatch.h"
+
+#ifndef RF_VR_TABLE
+    #error "define RF_VR_TABLE before including vector_reduce_kernels.h"
+#endif
+
+#define RF_VR_VECTORS (RF_VR_LANES / RF_VF64_LANES)
+
+// ============================================================================
+// Lane Helpers
+// ============================================================================
+
+// s + x = t + e exactly, with e folded into the compensation lane
+static inline void vr_two_sum(rf_vf64* sum, rf_vf64* comp, rf_vf64 x)
+{
+    rf_vf64 t = *sum + x;
+    rf_vf64 bv = t - *sum;
+    *comp += (*sum - (t - bv)) + (x - bv);
+    *sum = t;
+}
+
+static inline void vr_load_f64(const double* src, rf_vf64 v[RF_VR_VECTORS])
+{
+    for (int k = 0; k < RF_VR_VECTORS; k++)
+    {
+        memcpy(&v[k], src + k * RF_VF64_LANES, sizeof(rf_vf64));
+    }
+}
+
+static inline void vr_load_f32(const float* src, rf_vf64 v[RF_VR_VECTORS])
+{
+    for (int k = 0; k < RF_VR_VECTORS; k++)
+    {
+        rf_vf32_half narrow;
+        memcpy(&narrow, src + k * RF_VF64_LANES, sizeof(narrow));
+        v[k] = __builtin_convertvector(narrow, rf_vf64);
+    }
+}
+
+static inline void vr_store(const rf_vf64 v[RF_VR_VECTORS], double lanes[RF_VR_LANES])
+{
+    for (int k = 0; k < RF_VR_VECTORS; k++)
+    {
+        memcpy(lanes + k * RF_VF64_LANES, &v[k], sizeof(rf_vf64));
+    }
+}
+
+// The last partial block runs in scalar code on the stored lanes: element i
+// still lands in lane i % RF_VR_LANES with the same operations
+static inline void vr_two_sum_scalar(double* sum, double* comp, double x)
+{
+    double t = *sum + x;
+    double bv = t - *sum;
+    *comp += (*sum - (t - bv)) + (x - bv);
+    *sum = t;
+}
+
+static inline double vr_two_prod_scalar(double a, double b, double* error)
+{
+    rf_vf64 lo;
+    rf_vf64 hi = vm_two_prod_f64((rf_vf64){0} + a, (rf_vf64){0} + b, &lo);
+    *error = lo[0];
+    return hi[0];
+}
+
+// ============================================================================
+// Kernels
+// ============================================================================
+
+#define RF_VR_DEFINE_SUM(NAME, T, LOAD)                                 \
+    static void NAME(const T* src, size_t count, rf_vr_acc* out)        \
+    {                                                                   \
+        rf_vf64 sum[RF_VR_VECTORS] = {0};                               \
+        rf_vf64 comp[RF_VR_VECTORS] = {0};                              \
+        size_t i = 0;                                                   \
+        for (; i + RF_VR_LANES <= count; i += RF_VR_LANES)              \
+        {                                                               \
+            rf_vf64 x[RF_VR_VECTORS];                                   \
+            LOAD(src + i, x);                                           \
+            for (int k = 0; k < RF_VR_VECTORS; k++)                     \
+            {                                                           \
+                vr_two_sum(&sum[k], &comp[k], x[k]);                    \
+            }                                                           \
+        }                                                               \
+        vr_store(sum, out->sum);                                        \
+        vr_store(comp, out->comp);                                      \
+        for (size_t lane = 0; i + lane < count; lane++)                 \
+        {                                                               \
+            vr_two_sum_scalar(&out->sum[lane], &out->comp[lane],        \
+                              (double)src[i + lane]);                   \
+        }                                                               \
+        RF_VM_LEAVE();                                                  \
+    }
+
+// Products of widened f32 are exact, so only f64 needs the Dekker error term
+#define RF_VR_DEFINE_DOT(NAME, T, LOAD, EXACT_PRODUCTS)                            \
+    static void NAME(const T* src_a, const T* src_b, size_t count, rf_vr_acc* out) \
+    {                                                                              \
+        rf_vf64 sum[RF_VR_VECTORS] = {0};                                          \
+        rf_vf64 comp[RF_VR_VECTORS] = {0};                                         \
+        size_t i = 0;                                                              \
+        for (; i + RF_VR_LANES <= count; i += RF_VR_LANES)                         \
+        {                                                                          \
+            rf_vf64 a[RF_VR_VECTORS];                                              \
+            rf_vf64 b[RF_VR_VECTORS];                                              \
+            LOAD(src_a + i, a);                                                    \
+            LOAD(src_b + i, b);                                                    \
+            for (int k = 0; k < RF_VR_VECTORS; k++)                                \
+            {                                                                      \
+                rf_vf64 error = (rf_vf64){0};                                      \
+                rf_vf64 product = EXACT_PRODUCTS                                   \
+                                      ? a[k] * b[k]                                \
+                                      : vm_two_prod_f64(a[k], b[k], &error);       \
+                vr_two_sum(&sum[k], &comp[k], product);                            \
+                comp[k] += error;                                                  \
+            }                                                                      \
+        }                                                                          \
+        vr_store(sum, out->sum);                                                   \
+        vr_store(comp, out->comp);                                                 \
+        for (size_t lane = 0; i + lane < count; lane++)                            \
+        {                                                                          \
+            double error = 0.0;                                                    \
+            double a = (double)src_a[i + lane];                                    \
+            double b = (double)src_b[i + lane];                                    \
+            double product = EXACT_PRODUCTS ? a * b : vr_two_prod_scalar(a, b, &error); \
+            vr_two_sum_scalar(&out->sum[lane], &out->comp[lane], product);         \
+            out->comp[lane] += error;                                              \
+        }                                                                          \
+        RF_VM_LEAVE();                                                             \
+    }
+
+// Sums of d and d^2 for d = (x - shift) * scale: variance passes the mean as
+// shift, the norm a power-of-two scale
+#define RF_VR_DEFINE_MOMENTS(NAME, T, LOAD)                                               \
+    static void NAME(const T* src, size_t count, double shift, double scale,              \
+                     rf_vr_acc* first, rf_vr_acc* second)                                 \
+    {                                                                                     \
+        rf_vf64 sum1[RF_VR_VECTORS] = {0};                                                \
+        rf_vf64 comp1[RF_VR_VECTORS] = {0};                                               \
+        rf_vf64 sum2[RF_VR_VECTORS] = {0};                                                \
+        rf_vf64 comp2[RF_VR_VECTORS] = {0};                                               \
+        size_t i = 0;                                                                     \
+        for (; i + RF_VR_LANES <= count; i += RF_VR_LANES)                                \
+        {                                                                                 \
+            rf_vf64 x[RF_VR_VECTORS];                                                     \
+            LOAD(src + i, x);                                                             \
+            for (int k = 0; k < RF_VR_VECTORS; k++)                                       \
+            {                                                                             \
+                rf_vf64 d = (x[k] - shift) * scale;                                       \
+                vr_two_sum(&sum1[k], &comp1[k], d);                                       \
+                vr_two_sum(&sum2[k], &comp2[k], d * d);                                   \
+            }                                                                             \
+        }                                                                                 \
+        vr_store(sum1, first->sum);                                                       \
+        vr_store(comp1, first->comp);                                                     \
+        vr_store(sum2, second->sum);                                                      \
+        vr_store(comp2, second->comp);                                                    \
+        for (size_t lane = 0; i + lane < count; lane++)                                   \
+        {                                                                                 \
+            double d = ((double)src[i + lane] - shift) * scale;                           \
+            vr_two_sum_scalar(&first->sum[lane], &first->comp[lane], d);                  \
+            vr_two_sum_scalar(&second->sum[lane], &second->comp[lane], d * d);            \
+        }                                                                                 \
+        RF_VM_LEAVE();                                                                    \
+    }
+
+// A NaN element makes its lane's minimum and maximum NaN from then on
+#define RF_VR_DEFINE_EXTREMA(NAME, T, LOAD)                                                \
+    static void NAME(const T* src, size_t count, double lowest[RF_VR_LANES],               \
+                     double highest[RF_VR_LANES])                                          \
+    {                                                                                      \
+        rf_vf64 lo[RF_VR_VECTORS];                                                         \
+        rf_vf64 hi[RF_VR_VECTORS];                                                         \
+        for (int k = 0; k < RF_VR_VECTORS; k++)                                            \
+        {                                                                                  \
+            lo[k] = (rf_vf64){0} + (double)INFINITY;                                       \
+            hi[k] = (rf_vf64){0} - (double)INFINITY;                                       \
+        }                                                                                  \
+        size_t i = 0;                                                                      \
+        for (; i + RF_VR_LANES <= count; i += RF_VR_LANES)                                 \
+        {                                                                                  \
+            rf_vf64 x[RF_VR_VECTORS];                                                      \
+            LOAD(src + i, x);                                                              \
+            for (int k = 0; k < RF_VR_VECTORS; k++)                                        \
+            {                                                                              \
+                rf_vi64 nan = x[k] != x[k];                                                \
+                lo[k] = vm_select_f64((x[k] < lo[k]) | nan, x[k], lo[k]);                  \
+                hi[k] = vm_select_f64((x[k] > hi[k]) | nan, x[k], hi[k]);                  \
+            }                                                                              \
+        }                                                                                  \
+        vr_store(lo, lowest);                                                              \
+        vr_store(hi, highest);                                                             \
+        for (size_t lane = 0; i + lane < count; lane++)                                    \
+        {                                                                                  \
+            double x = (double)src[i + lane];                                              \
+            if (x < lowest[lane] || x != x) lowest[lane] = x;                              \
+            if (x > highest[lane] || x != x) highest[lane] = x;                            \
+        }                                                                                  \
+        RF_VM_LEAVE();                                                                     \
+    }
+
+RF_VR_DEFINE_SUM(vr_f64_sum, double, vr_load_f64)
+RF_VR_DEFINE_DOT(vr_f64_dot, double, vr_load_f64, 0)
+RF_VR_DEFINE_MOMENTS(vr_f64_moments, double, vr_load_f64)
+RF_VR_DEFINE_EXTREMA(vr_f64_extrema, double, vr_load_f64)
+
+RF_VR_DEFINE_SUM(vr_f32_sum, float, vr_load_f32)
+RF_VR_DEFINE_DOT(vr_f32_dot, float, vr_load_f32, 1)
+RF_VR_DEFINE_MOMENTS(vr_f32_moments, float, vr_load_f32)
+RF_VR_DEFINE_EXTREMA(vr_f32_extrema, float, vr_load_f32)
+
+const rf_vr_table RF_VR_TABLE = {
+    .f64_sum = vr_f64_sum,
+    .f64_dot = vr_f64_dot,
+    .f64_moments = vr_f64_moments,
+    .f64_extrema = vr_f64_extrema,
+    .f32_sum = vr_f32_sum,
+    .f32_dot = vr_f32_dot,
+    .f32_moments = vr_f32_moments,
+    .f32_extrema = vr_f32_extrema,
+};
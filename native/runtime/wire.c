@@ -0,0 +1,86 @@
+/*
+ * RazorForge Runtime - Zero-copy record messages
+ * Validation for the layout the code generator writes for Serializable
+ * records (LLVMCodeGenerator.Serialization.cs). Everything else, including
+ * field reads, is inline generated code.
+ */
+
+#include <stdint.h>
+#include "../include/razorforge_wire.h"
+
+static inline uint32_t load_le32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t load_le64(const uint8_t* p)
+{
+    return (uint64_t)load_le32(p) | (uint64_t)load_le32(p + 4) << 32;
+}
+
+int rf_wire_check(const void* data, size_t size, uint64_t schema, uint32_t fixed_size, uint32_t slots,
+                  uint32_t alignment)
+{
+    const uint8_t* message = data;
+    if (data == NULL || size < RF_WIRE_HEADER_SIZE)
+    {
+        return RF_WIRE_ERROR_TRUNCATED;
+    }
+    if (load_le32(message) != RF_WIRE_MAGIC)
+    {
+        return RF_WIRE_ERROR_FORMAT;
+    }
+    if (load_le64(message + 8) != schema || load_le32(message + 4) != fixed_size ||
+        ((uint32_t)message[20] | (uint32_t)message[21] << 8) != slots)
+    {
+        return RF_WIRE_ERROR_SCHEMA;
+    }
+    if (alignment > 1 && ((uintptr_t)message & (alignment - 1)) != 0)
+    {
+        return RF_WIRE_ERROR_ALIGNMENT;
+    }
+
+    uint64_t total = load_le32(message + 16);
+    uint64_t payload = (uint64_t)RF_WIRE_HEADER_SIZE + fixed_size;
+    if (total < payload || (uint64_t)slots * 8 > fixed_size)
+    {
+        return RF_WIRE_ERROR_FORMAT;
+    }
+    if (total > size)
+    {
+        return RF_WIRE_ERROR_TRUNCATED;
+    }
+
+    // Each payload lies after the fixed section, is aligned, and ends in the
+    // zero byte that lets Text fields be read in place
+    const uint8_t* slot = message + RF_WIRE_HEADER_SIZE;
+    for (uint32_t i = 0; i < slots; i++, slot += 8)
+    {
+        uint64_t offset = load_le32(slot);
+        uint64_t length = load_le32(slot + 4);
+        if (offset < payload || offset % RF_WIRE_PAYLOAD_ALIGNMENT != 0 || offset + length >= total ||
+            message[offset + length] != 0)
+        {
+            return RF_WIRE_ERROR_FORMAT;
+        }
+    }
+    return RF_WIRE_OK;
+}
+
+uint64_t rf_wire_schema(const void* data, size_t size)
+{
+    if (data == NULL || size < RF_WIRE_HEADER_SIZE || load_le32(data) != RF_WIRE_MAGIC)
+    {
+        return 0;
+    }
+    return load_le64((const uint8_t*)data + 8);
+}
+
+uint32_t rf_wire_size(const void* data, size_t size)
+{
+    if (data == NULL || size < RF_WIRE_HEADER_SIZE || load_le32(data) != RF_WIRE_MAGIC)
+    {
+        return 0;
+    }
+    return load_le32((const uint8_t*)data + 16);
+}
@@ -10,8 +10,32 @@ namespace Compilers;
 
 internal class Program
 {
+    // Float math mode for the whole compilation (--fast-math / --strict-math)
+    private static FloatMathMode _mathMode = FloatMathMode.Default;
+
     public static void Main(string[] args)
     {
+        // Compiler flags are taken out anywhere before "--"; everything after it belongs to the program
+        int separator = Array.IndexOf(array: args, value: "--");
+        string[] passthroughArgs = separator >= 0
+            ? args[(separator + 1)..]
+            : Array.Empty<string>();
+        string[] compilerArgs = separator >= 0
+            ? args[..separator]
+            : args;
+
+        if (compilerArgs.Contains(value: "--fast-math"))
+        {
+            _mathMode = FloatMathMode.Fast;
+        }
+        else if (compilerArgs.Contains(value: "--strict-math"))
+        {
+            _mathMode = FloatMathMode.Strict;
+        }
+
+        args = compilerArgs.Where(predicate: arg => arg is not ("--fast-math" or "--strict-math"))
+                           .ToArray();
+
         if (args.Length == 0)
         {
             PrintUsage();
@@ -49,7 +73,9 @@ internal class Program
             string sourceFile = args[1];
             string[] programArgs = args.Length > 2
                 ? args[2..]
-                : Array.Empty<string>();
+                   .Concat(second: passthroughArgs)
+                   .ToArray()
+                : passthroughArgs;
 
             switch (command)
             {
@@ -84,7 +110,7 @@ internal class Program
             value: "  RazorForge compile <source-file>                  - Compile file");
         Console.WriteLine(
             value:
-            "  RazorForge run <source-file> [args...]            - Compile and run file with optional arguments");
+            "  RazorForge run <source-file> [args...] [-- args...] - Compile and run file with optional arguments");
         Console.WriteLine(
             value:
             "  RazorForge compileandrun <source-file> [args...]  - Compile and run file with optional arguments");
@@ -97,6 +123,12 @@ internal class Program
             value: "  <source-file>: .rf file for RazorForge or .sf file for Suflae");
         Console.WriteLine(
             value: "  [args...]:     Optional arguments to pass to the compiled program");
+        Console.WriteLine(
+            value: "  -- args...:    Passed to the program as-is, including --fast-math/--strict-math");
+        Console.WriteLine(
+            value: "  --fast-math:   Allow reassociation, reciprocal and approximate math");
+        Console.WriteLine(
+            value: "  --strict-math: Bit-reproducible float math, libm-accurate runtime kernels");
     }
 
     private static void CompileFile(string sourceFile, bool executeAfter, string[] programArgs, bool noMain = false)
@@ -221,6 +253,7 @@ internal class Program
             // Generate LLVM IR
             var llvmCodeGen = new LLVMCodeGenerator(language: language, mode: mode);
             llvmCodeGen.SourceFileName = sourceFile;
+            llvmCodeGen.MathMode = _mathMode;
             llvmCodeGen.Generate(program: ast);
             string llvmFile = Path.ChangeExtension(path: sourceFile, extension: ".ll");
             File.WriteAllText(path: llvmFile, contents: llvmCodeGen.GetGeneratedCode());
@@ -283,62 +316,7 @@ internal class Program
     {
         try
         {
-            string executablePath = Path.ChangeExtension(path: llvmFile, extension: ".exe");
-
-            // Find the RazorForge runtime C source files
-            string? projectRoot = FindProjectRoot(startPath: llvmFile);
-            string runtimeSources = "";
-            if (projectRoot != null)
-            {
-                string runtimeDir = Path.Combine(path1: projectRoot, path2: "native", path3: "runtime");
-                string memoryC = Path.Combine(path1: runtimeDir, path2: "memory.c");
-                string stacktraceC = Path.Combine(path1: runtimeDir, path2: "stacktrace.c");
-
-                if (File.Exists(path: memoryC) && File.Exists(path: stacktraceC))
-                {
-                    runtimeSources = $"\"{memoryC}\" \"{stacktraceC}\"";
-                }
-            }
-
-            // Use clang to compile LLVM IR to executable
-            // On Windows, we need to link with legacy_stdio_definitions for printf/scanf
-            // On Unix-like systems, libc is linked automatically
-            string linkerFlags = OperatingSystem.IsWindows()
-                ? "-Wno-override-module -llegacy_stdio_definitions"
-                : "-Wno-override-module";
-
-            var clangProcess = new System.Diagnostics.ProcessStartInfo
-            {
-                FileName = "clang",
-                Arguments = $"\"{llvmFile}\" {runtimeSources} -o \"{executablePath}\" {linkerFlags}",
-                UseShellExecute = false,
-                RedirectStandardOutput = true,
-                RedirectStandardError = true,
-                CreateNoWindow = true
-            };
-
-            using var process = System.Diagnostics.Process.Start(startInfo: clangProcess);
-            if (process == null)
-            {
-                return null;
-            }
-
-            process.WaitForExit();
-
-            if (process.ExitCode == 0 && File.Exists(path: executablePath))
-            {
-                return executablePath;
-            }
-            else
-            {
-                string error = process.StandardError.ReadToEnd();
-                if (!string.IsNullOrEmpty(value: error))
-                {
-                    Console.WriteLine(value: $"Clang error: {error}");
-                }
-
-                return null;
-            }
+            return RuntimeLinker.BuildExecutable(llvmFile: llvmFile);
         }
         catch (Exception ex)
         {
@@ -381,29 +359,4 @@ internal class Program
             Console.WriteLine(value: $"Error running executable: {ex.Message}");
         }
     }
-
-    private static string? FindProjectRoot(string startPath)
-    {
-        // Walk up the directory tree looking for RazorForge.csproj or native/runtime directory
-        string? directory = Path.GetDirectoryName(path: startPath);
-        while (directory != null)
-        {
-            // Check for RazorForge.csproj
-            if (File.Exists(path: Path.Combine(path1: directory, path2: "RazorForge.csproj")))
-            {
-                return directory;
-            }
-
-            // Check for native/runtime directory
-            string runtimeDir = Path.Combine(path1: directory, path2: "native", path3: "runtime");
-            if (Directory.Exists(path: runtimeDir))
-            {
-                return directory;
-            }
-
-            directory = Path.GetDirectoryName(path: directory);
-        }
-
-        return null;
-    }
 }
@@ -0,0 +1,256 @@
+using System.Runtime.InteropServices;
+
+namespace Compilers;
+
+/// <summary>
+/// Turns generated LLVM IR into an executable with clang, compiling in the native runtime
+/// sources (native/runtime) that generated code calls. Mirrors native/CMakeLists.txt: a file
+/// built with ISA flags (-mavx2 and the like) is compiled to an object on its own, and the
+/// RF_*_HAS_X86 switches that enable those kernels are passed to every runtime file.
+/// </summary>
+internal static class RuntimeLinker
+{
+    /// <summary>
+    /// A runtime C file. <see cref="Flags"/> apply to this file only; <see cref="Define"/> is
+    /// passed to all runtime files whenever this one is linked.
+    /// </summary>
+    private sealed record RuntimeSource(
+        string File,
+        string Flags = "",
+        string Define = "",
+        bool X86Only = false);
+
+    private static readonly RuntimeSource[] Sources =
+    [
+        new(File: "memory.c"),
+        new(File: "stacktrace.c"),
+        // memory.c picks its streaming tier from the CPU level and cache size
+        new(File: "cpu_features.c"),
+        new(File: "memory_stream_sse2.c", Define: "RF_MEMORY_HAS_X86", X86Only: true),
+        // Loop-invariant dividers (LLVMCodeGenerator.Division.cs)
+        new(File: "divide.c"),
+        // Batch math and --strict-math's rf_math_set_strict; the kernel tables also hold the
+        // random generators, so random.c comes along
+        new(File: "vector_math.c"),
+        new(File: "vector_math_base.c", Flags: "-fno-math-errno -ffp-contract=off"),
+        new(File: "vector_math_avx2.c",
+            Flags: "-fno-math-errno -ffp-contract=off -mavx2",
+            Define: "RF_VM_HAS_X86_VARIANTS",
+            X86Only: true),
+        new(File: "vector_math_avx512.c",
+            Flags: "-fno-math-errno -ffp-contract=off -mavx512f -mavx512dq",
+            Define: "RF_VM_HAS_X86_VARIANTS",
+            X86Only: true),
+        new(File: "random.c"),
+        // fp128 math (rf_f128_*): libquadmath when it links, else the soft-float core
+        new(File: "f128.c"),
+        new(File: "f128_soft.c"),
+        // rf_wire_check behind wire_check<T> on Serializable records
+        new(File: "wire.c")
+    ];
+
+    /// <summary>
+    /// A system library runtime files use when it is installed, found as native/CMakeLists.txt
+    /// finds it: by linking <see cref="Probe"/>. When that works, <see cref="Define"/> is passed
+    /// to every runtime file and the library is linked.
+    /// </summary>
+    private sealed record OptionalLibrary(string Name, string Define, string Probe);
+
+    private static readonly OptionalLibrary[] OptionalLibraries =
+    [
+        new(Name: "quadmath",
+            Define: "RF_HAS_QUADMATH",
+            Probe: "#include <quadmath.h>\nint main(void) { __float128 x = sqrtq(2.0Q); return (int)x; }\n")
+    ];
+
+    // Probe results, kept for the life of the process
+    private static readonly Dictionary<string, bool> LibraryAvailable = new();
+
+    private static bool IsX86 => RuntimeInformation.ProcessArchitecture == Architecture.X64;
+
+    /// <summary>
+    /// Compiles <paramref name="llvmFile"/> with the runtime into an executable next to it.
+    /// The runtime is taken from <paramref name="projectRoot"/>, or from the first directory
+    /// above the IR file that has native/runtime. Returns the executable's path, or null when
+    /// clang is missing or fails (its errors are printed).
+    /// </summary>
+    public static string? BuildExecutable(string llvmFile, string? projectRoot = null)
+    {
+        string executablePath = Path.ChangeExtension(path: llvmFile, extension: ".exe");
+        projectRoot ??= FindProjectRoot(startPath: llvmFile);
+
+        List<RuntimeSource> sources = projectRoot == null
+            ? []
+            : Sources.Where(predicate: source => !source.X86Only || IsX86)
+                     .Where(predicate: source =>
+                          File.Exists(path: RuntimePath(projectRoot: projectRoot, source: source)))
+                     .ToList();
+        List<OptionalLibrary> libraries = sources.Count == 0
+            ? []
+            : OptionalLibraries.Where(predicate: IsAvailable)
+                               .ToList();
+        string defines = string.Join(separator: "",
+            values: sources.Where(predicate: source => source.Define != "")
+                           .Select(selector: source => $" -D{source.Define}")
+                           .Concat(second: libraries.Select(selector: library =>
+                                $" -D{library.Define}"))
+                           .Distinct());
+
+        string objectDirectory = Path.Combine(path1: Path.GetTempPath(),
+            path2: $"razorforge-runtime-{Guid.NewGuid():N}");
+        try
+        {
+            // Files with their own flags become objects first, one clang run per flag set
+            var inputs = new List<string>();
+            foreach (IGrouping<string, RuntimeSource> group in sources.GroupBy(keySelector: source =>
+                         source.Flags))
+            {
+                IEnumerable<string> paths = group.Select(selector: source =>
+                    $"\"{RuntimePath(projectRoot: projectRoot!, source: source)}\"");
+                if (group.Key == "")
+                {
+                    inputs.AddRange(collection: paths);
+                    continue;
+                }
+
+                Directory.CreateDirectory(path: objectDirectory);
+                if (!RunClang(arguments: $"-c -O2 {group.Key}{defines} {string.Join(separator: " ", values: paths)}",
+                        workingDirectory: objectDirectory))
+                {
+                    return null;
+                }
+
+                inputs.AddRange(collection: group.Select(selector: source =>
+                    $"\"{Path.Combine(path1: objectDirectory, path2: Path.ChangeExtension(path: source.File, extension: ".o"))}\""));
+            }
+
+            // Use clang to compile LLVM IR to executable
+            // On Windows, we need to link with legacy_stdio_definitions for printf/scanf
+            // On Unix-like systems, libc is linked automatically
+            string linkerFlags = OperatingSystem.IsWindows()
+                ? "-Wno-override-module -llegacy_stdio_definitions"
+                : "-Wno-override-module -lm";
+            linkerFlags += string.Join(separator: "",
+                values: libraries.Select(selector: library => $" -l{library.Name}"));
+
+            // Optimize so math loops vectorize; on x86-64 glibc, libm calls the vectorizer
+            // widens map onto libmvec (pulled in by -lm)
+            string optimizationFlags = OperatingSystem.IsLinux() && IsX86
+                ? "-O2 -fveclib=libmvec"
+                : "-O2";
+
+            bool linked = RunClang(
+                arguments:
+                $"\"{llvmFile}\" {string.Join(separator: " ", values: inputs)} {optimizationFlags}{defines} -o \"{executablePath}\" {linkerFlags}",
+                workingDirectory: null);
+            return linked && File.Exists(path: executablePath)
+                ? executablePath
+                : null;
+        }
+        finally
+        {
+            if (Directory.Exists(path: objectDirectory))
+            {
+                Directory.Delete(path: objectDirectory, recursive: true);
+            }
+        }
+    }
+
+    private static bool IsAvailable(OptionalLibrary library)
+    {
+        lock (LibraryAvailable)
+        {
+            if (LibraryAvailable.TryGetValue(key: library.Name, value: out bool available))
+            {
+                return available;
+            }
+
+            string probeFile = Path.Combine(path1: Path.GetTempPath(),
+                path2: $"razorforge-probe-{Guid.NewGuid():N}.c");
+            string probeExecutable = Path.ChangeExtension(path: probeFile, extension: ".exe");
+            try
+            {
+                File.WriteAllText(path: probeFile, contents: library.Probe);
+                available = RunClang(
+                    arguments: $"\"{probeFile}\" -o \"{probeExecutable}\" -l{library.Name}",
+                    workingDirectory: null,
+                    reportErrors: false);
+            }
+            finally
+            {
+                File.Delete(path: probeFile);
+                File.Delete(path: probeExecutable);
+            }
+
+            LibraryAvailable[key: library.Name] = available;
+            return available;
+        }
+    }
+
+    private static string RuntimePath(string projectRoot, RuntimeSource source)
+    {
+        return Path.Combine(path1: projectRoot, path2: "native", path3: "runtime", path4: source.File);
+    }
+
+    // Runs clang, printing its errors when it fails; false also when clang can't be started
+    private static bool RunClang(string arguments, string? workingDirectory,
+        bool reportErrors = true)
+    {
+        var clangProcess = new System.Diagnostics.ProcessStartInfo
+        {
+            FileName = "clang",
+            Arguments = arguments,
+            WorkingDirectory = workingDirectory ?? "",
+            UseShellExecute = false,
+            RedirectStandardOutput = true,
+            RedirectStandardError = true,
+            CreateNoWindow = true
+        };
+
+        using var process = System.Diagnostics.Process.Start(startInfo: clangProcess);
+        if (process == null)
+        {
+            return false;
+        }
+
+        // Drain stderr before waiting so a chatty compile can't fill the pipe and stall
+        string error = process.StandardError.ReadToEnd();
+        process.WaitForExit();
+        if (process.ExitCode == 0)
+        {
+            return true;
+        }
+
+        if (reportErrors && !string.IsNullOrEmpty(value: error))
+        {
+            Console.WriteLine(value: $"Clang error: {error}");
+        }
+
+        return false;
+    }
+
+    private static string? FindProjectRoot(string startPath)
+    {
+        // Walk up the directory tree looking for RazorForge.csproj or native/runtime directory
+        string? directory = Path.GetDirectoryName(path: Path.GetFullPath(path: startPath));
+        while (directory != null)
+        {
+            // Check for RazorForge.csproj
+            if (File.Exists(path: Path.Combine(path1: directory, path2: "RazorForge.csproj")))
+            {
+                return directory;
+            }
+
+            // Check for native/runtime directory
+            string runtimeDir = Path.Combine(path1: directory, path2: "native", path3: "runtime");
+            if (Directory.Exists(path: runtimeDir))
+            {
+                return directory;
+            }
+
+            directory = Path.GetDirectoryName(path: directory);
+        }
+
+        return null;
+    }
+}
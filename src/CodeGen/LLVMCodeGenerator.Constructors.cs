@@ -620,7 +620,9 @@ public partial class LLVMCodeGenerator
                     RazorForgeType: typeName);
                 return resultTemp;
 
+            // One store of the type's width, for device registers that reject split accesses
             case "volatile_write":
+            case "volatile_write_as":
                 string volWriteAddrTemp = node.Arguments[index: 0]
                                               .Accept(visitor: this);
                 string volWriteValueTemp = node.Arguments[index: 1]
@@ -633,6 +635,7 @@ public partial class LLVMCodeGenerator
                 return ""; // void return
 
             case "volatile_read":
+            case "volatile_read_as":
                 string volReadAddrTemp = node.Arguments[index: 0]
                                              .Accept(visitor: this);
                 _output.AppendLine(
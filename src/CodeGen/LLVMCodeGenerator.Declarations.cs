@@ -157,6 +157,12 @@ public partial class LLVMCodeGenerator
 
         _recordFields[key: typeName] = fields;
 
+        // Message layouts are generated for non-generic records only
+        if (typeSubstitutions == null && FollowsSerializable(node: node))
+        {
+            EmitWireFunctions(node: node, typeName: typeName, structFields: fields);
+        }
+
         return "";
     }
 
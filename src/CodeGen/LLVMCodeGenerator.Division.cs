@@ -0,0 +1,318 @@
+using Compilers.Shared.AST;
+
+namespace Compilers.Shared.CodeGen;
+
+/// <summary>
+/// Partial class containing loop-invariant division strength reduction.
+/// Unsigned division or modulo by a variable that the loop never reassigns is rewritten to a
+/// multiply-high and shift, using a divider computed once before the loop (razorforge_divide.h).
+/// The divider passes numerators through for a zero divisor, so each rewritten division traps on
+/// zero itself, as udiv/urem would.
+/// </summary>
+public partial class LLVMCodeGenerator
+{
+    // Divider for one hoisted divisor: magic multiplier plus the decoded shift/add bits
+    private record InvariantDivider(
+        string LLVMType,
+        string Divisor,
+        string Magic,
+        string Shift,
+        string HasAdd,
+        string IsShiftOnly,
+        string IsZero);
+
+    // Dividers visible in the loop currently being generated, keyed by divisor variable
+    private Dictionary<string, InvariantDivider> _invariantDividers = new();
+
+    /// <summary>
+    /// Emits divider setup for every invariant u32/u64 divisor in the loop, before the loop header.
+    /// Returns the enclosing loop's dividers so the caller can restore them afterwards.
+    /// </summary>
+    private Dictionary<string, InvariantDivider> HoistInvariantDividers(Expression condition,
+        Statement body)
+    {
+        Dictionary<string, InvariantDivider> outer = _invariantDividers;
+        _invariantDividers = new Dictionary<string, InvariantDivider>(dictionary: outer);
+
+        // A body containing a statement kind the walker does not know could write any divisor
+        var assigned = new HashSet<string>();
+        if (!CollectAssignedNames(statement: body, names: assigned))
+        {
+            return outer;
+        }
+
+        var divisors = new List<IdentifierExpression>();
+        CollectDivisors(expression: condition, divisors: divisors);
+        CollectDivisors(statement: body, divisors: divisors);
+
+        foreach (IdentifierExpression divisor in divisors)
+        {
+            if (assigned.Contains(item: divisor.Name) ||
+                _invariantDividers.ContainsKey(key: divisor.Name))
+            {
+                continue;
+            }
+
+            TypeInfo typeInfo = GetTypeInfo(expr: divisor);
+            if (!typeInfo.IsUnsigned || typeInfo.LLVMType is not ("i32" or "i64"))
+            {
+                continue;
+            }
+
+            string llvmType = typeInfo.LLVMType;
+            string width = llvmType[1..];
+            _mathDeclarations.Add(
+                item: $"declare {llvmType} @rf_divider_u{width}_magic({llvmType})");
+            _mathDeclarations.Add(item: $"declare i8 @rf_divider_u{width}_more({llvmType})");
+            _mathDeclarations.Add(item: "declare void @llvm.trap()");
+            string divisorTemp = divisor.Accept(visitor: this);
+            string magic = GetNextTemp();
+            string more = GetNextTemp();
+            string moreWide = GetNextTemp();
+            string shift = GetNextTemp();
+            string addBit = GetNextTemp();
+            string hasAdd = GetNextTemp();
+            string isShiftOnly = GetNextTemp();
+            string isZero = GetNextTemp();
+
+            _output.AppendLine(
+                handler:
+                $"  {magic} = call {llvmType} @rf_divider_u{width}_magic({llvmType} {divisorTemp})");
+            _output.AppendLine(
+                handler: $"  {more} = call i8 @rf_divider_u{width}_more({llvmType} {divisorTemp})");
+            _output.AppendLine(handler: $"  {moreWide} = zext i8 {more} to {llvmType}");
+            _output.AppendLine(handler: $"  {shift} = and {llvmType} {moreWide}, 63");
+            _output.AppendLine(handler: $"  {addBit} = and {llvmType} {moreWide}, 64");
+            _output.AppendLine(handler: $"  {hasAdd} = icmp ne {llvmType} {addBit}, 0");
+            _output.AppendLine(handler: $"  {isShiftOnly} = icmp eq {llvmType} {magic}, 0");
+            _output.AppendLine(handler: $"  {isZero} = icmp eq {llvmType} {divisorTemp}, 0");
+
+            _invariantDividers[key: divisor.Name] = new InvariantDivider(LLVMType: llvmType,
+                Divisor: divisorTemp,
+                Magic: magic,
+                Shift: shift,
+                HasAdd: hasAdd,
+                IsShiftOnly: isShiftOnly,
+                IsZero: isZero);
+        }
+
+        return outer;
+    }
+
+    /// <summary>
+    /// Tries to lower <c>left / right</c> or <c>left % right</c> through a hoisted divider.
+    /// Returns null when the divisor is not an invariant of an enclosing loop.
+    /// </summary>
+    private string? TryEmitInvariantDivision(BinaryExpression node, string left, string result,
+        TypeInfo leftTypeInfo)
+    {
+        if (node.Operator is not (BinaryOperator.Divide or BinaryOperator.Modulo) ||
+            node.Right is not IdentifierExpression divisor ||
+            !_invariantDividers.TryGetValue(key: divisor.Name,
+                value: out InvariantDivider? divider) ||
+            divider.LLVMType != leftTypeInfo.LLVMType || !leftTypeInfo.IsUnsigned)
+        {
+            return null;
+        }
+
+        string llvmType = divider.LLVMType;
+        int bits = GetIntegerBitWidth(llvmType: llvmType);
+        string wideType = $"i{bits * 2}";
+
+        // Checked here rather than before the loop: a division the loop never reaches must not trap
+        string trapLabel = $"trap.div.{_tempCounter}";
+        string contLabel = $"cont.div.{_tempCounter}";
+        _output.AppendLine(handler: $"  br i1 {divider.IsZero}, label %{trapLabel}, label %{contLabel}");
+        _output.AppendLine(handler: $"{trapLabel}:");
+        _output.AppendLine(value: $"  call void @llvm.trap()");
+        _output.AppendLine(value: $"  unreachable");
+        _output.AppendLine(handler: $"{contLabel}:");
+
+        // q = mulhi(magic, n)
+        string wideN = GetNextTemp();
+        string wideMagic = GetNextTemp();
+        string product = GetNextTemp();
+        string high = GetNextTemp();
+        string mulhi = GetNextTemp();
+        _output.AppendLine(handler: $"  {wideN} = zext {llvmType} {left} to {wideType}");
+        _output.AppendLine(
+            handler: $"  {wideMagic} = zext {llvmType} {divider.Magic} to {wideType}");
+        _output.AppendLine(handler: $"  {product} = mul {wideType} {wideN}, {wideMagic}");
+        _output.AppendLine(handler: $"  {high} = lshr {wideType} {product}, {bits}");
+        _output.AppendLine(handler: $"  {mulhi} = trunc {wideType} {high} to {llvmType}");
+
+        // Magic needing BITS+1 bits: ((n - q) >> 1) + q; power-of-two divisors shift n directly
+        string difference = GetNextTemp();
+        string half = GetNextTemp();
+        string fixedUp = GetNextTemp();
+        string estimate = GetNextTemp();
+        string shifted = GetNextTemp();
+        string quotient = node.Operator == BinaryOperator.Divide ? result : GetNextTemp();
+        _output.AppendLine(handler: $"  {difference} = sub {llvmType} {left}, {mulhi}");
+        _output.AppendLine(handler: $"  {half} = lshr {llvmType} {difference}, 1");
+        _output.AppendLine(handler: $"  {fixedUp} = add {llvmType} {half}, {mulhi}");
+        _output.AppendLine(
+            handler:
+            $"  {estimate} = select i1 {divider.HasAdd}, {llvmType} {fixedUp}, {llvmType} {mulhi}");
+        _output.AppendLine(
+            handler:
+            $"  {shifted} = select i1 {divider.IsShiftOnly}, {llvmType} {left}, {llvmType} {estimate}");
+        _output.AppendLine(handler: $"  {quotient} = lshr {llvmType} {shifted}, {divider.Shift}");
+
+        if (node.Operator == BinaryOperator.Modulo)
+        {
+            string multiple = GetNextTemp();
+            _output.AppendLine(
+                handler: $"  {multiple} = mul {llvmType} {quotient}, {divider.Divisor}");
+            _output.AppendLine(handler: $"  {result} = sub {llvmType} {left}, {multiple}");
+        }
+
+        _tempTypes[key: result] = leftTypeInfo;
+        return result;
+    }
+
+    // Names a loop body may write: assignment targets and variables, pattern bindings and
+    // handles declared inside it. Returns false for a statement kind it cannot see into.
+    private static bool CollectAssignedNames(Statement? statement, HashSet<string> names)
+    {
+        switch (statement)
+        {
+            case null:
+            case ExpressionStatement:
+            case ReturnStatement:
+            case ThrowStatement:
+            case AbsentStatement:
+            case BreakStatement:
+            case ContinueStatement:
+                return true;
+            case AssignmentStatement assignment:
+                if (assignment.Target is IdentifierExpression target)
+                {
+                    names.Add(item: target.Name);
+                }
+
+                return true;
+            case DeclarationStatement { Declaration: VariableDeclaration variable }:
+                names.Add(item: variable.Name);
+                return true;
+            case BlockStatement block:
+                return block.Statements.All(predicate: inner =>
+                    CollectAssignedNames(statement: inner, names: names));
+            case IfStatement ifStatement:
+                return CollectAssignedNames(statement: ifStatement.ThenStatement, names: names) &&
+                       CollectAssignedNames(statement: ifStatement.ElseStatement, names: names);
+            case WhileStatement whileStatement:
+                return CollectAssignedNames(statement: whileStatement.Body, names: names);
+            case ForStatement forStatement:
+                names.Add(item: forStatement.Variable);
+                return CollectAssignedNames(statement: forStatement.Body, names: names);
+            case WhenStatement whenStatement:
+                foreach (WhenClause clause in whenStatement.Clauses)
+                {
+                    switch (clause.Pattern)
+                    {
+                        case IdentifierPattern identifier:
+                            names.Add(item: identifier.Name);
+                            break;
+                        case TypePattern { VariableName: not null } typePattern:
+                            names.Add(item: typePattern.VariableName);
+                            break;
+                    }
+
+                    if (!CollectAssignedNames(statement: clause.Body, names: names))
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            case DangerStatement danger:
+                return CollectAssignedNames(statement: danger.Body, names: names);
+            case MayhemStatement mayhem:
+                return CollectAssignedNames(statement: mayhem.Body, names: names);
+            case ViewingStatement viewing:
+                names.Add(item: viewing.Handle);
+                return CollectAssignedNames(statement: viewing.Body, names: names);
+            case HijackingStatement hijacking:
+                names.Add(item: hijacking.Handle);
+                return CollectAssignedNames(statement: hijacking.Body, names: names);
+            case ObservingStatement observing:
+                names.Add(item: observing.Handle);
+                return CollectAssignedNames(statement: observing.Body, names: names);
+            case SeizingStatement seizing:
+                names.Add(item: seizing.Handle);
+                return CollectAssignedNames(statement: seizing.Body, names: names);
+            default:
+                return false;
+        }
+    }
+
+    private static void CollectDivisors(Statement? statement, List<IdentifierExpression> divisors)
+    {
+        switch (statement)
+        {
+            case ExpressionStatement expression:
+                CollectDivisors(expression: expression.Expression, divisors: divisors);
+                break;
+            case AssignmentStatement assignment:
+                CollectDivisors(expression: assignment.Value, divisors: divisors);
+                break;
+            case ReturnStatement { Value: not null } returnStatement:
+                CollectDivisors(expression: returnStatement.Value, divisors: divisors);
+                break;
+            case DeclarationStatement
+            {
+                Declaration: VariableDeclaration { Initializer: not null } variable
+            }:
+                CollectDivisors(expression: variable.Initializer, divisors: divisors);
+                break;
+            case BlockStatement block:
+                foreach (Statement inner in block.Statements)
+                {
+                    CollectDivisors(statement: inner, divisors: divisors);
+                }
+
+                break;
+            case IfStatement ifStatement:
+                CollectDivisors(expression: ifStatement.Condition, divisors: divisors);
+                CollectDivisors(statement: ifStatement.ThenStatement, divisors: divisors);
+                CollectDivisors(statement: ifStatement.ElseStatement, divisors: divisors);
+                break;
+            case DangerStatement danger:
+                CollectDivisors(statement: danger.Body, divisors: divisors);
+                break;
+        }
+    }
+
+    private static void CollectDivisors(Expression expression, List<IdentifierExpression> divisors)
+    {
+        switch (expression)
+        {
+            case BinaryExpression binary:
+                if (binary.Operator is BinaryOperator.Divide or BinaryOperator.Modulo &&
+                    binary.Right is IdentifierExpression divisor)
+                {
+                    divisors.Add(item: divisor);
+                }
+
+                CollectDivisors(expression: binary.Left, divisors: divisors);
+                CollectDivisors(expression: binary.Right, divisors: divisors);
+                break;
+            case UnaryExpression unary:
+                CollectDivisors(expression: unary.Operand, divisors: divisors);
+                break;
+            case CallExpression call:
+                foreach (Expression argument in call.Arguments)
+                {
+                    CollectDivisors(expression: argument, divisors: divisors);
+                }
+
+                break;
+            case ConditionalExpression conditional:
+                CollectDivisors(expression: conditional.Condition, divisors: divisors);
+                CollectDivisors(expression: conditional.TrueExpression, divisors: divisors);
+                CollectDivisors(expression: conditional.FalseExpression, divisors: divisors);
+                break;
+        }
+    }
+}
@@ -49,11 +49,15 @@ public partial class LLVMCodeGenerator
         string varName = $"%{node.Name}";
         _symbolTypes[key: node.Name] = type;
 
-        // Track RazorForge type for the variable
+        // Track RazorForge type for the variable; a redeclared name drops the old one
         if (node.Type != null)
         {
             _symbolRfTypes[key: node.Name] = node.Type.Name;
         }
+        else
+        {
+            _symbolRfTypes.Remove(key: node.Name);
+        }
 
         if (node.Initializer != null)
         {
@@ -120,6 +124,16 @@ public partial class LLVMCodeGenerator
         TypeInfo leftTypeInfo = GetTypeInfo(expr: node.Left);
         string operandType = leftTypeInfo.LLVMType;
 
+        // Division by a loop-invariant divisor becomes multiply-high and shift
+        string? invariantDivision = TryEmitInvariantDivision(node: node,
+            left: left,
+            result: result,
+            leftTypeInfo: leftTypeInfo);
+        if (invariantDivision != null)
+        {
+            return invariantDivision;
+        }
+
         string op = node.Operator switch
         {
             // Regular arithmetic
@@ -260,8 +274,13 @@ public partial class LLVMCodeGenerator
             }
         }
 
+        if (leftTypeInfo.IsFloatingPoint)
+        {
+            op = MapToFloatOp(op: op);
+        }
+
         // Generate the operation with proper type
-        if (op.StartsWith(value: "icmp"))
+        if (op.StartsWith(value: "icmp") || op.StartsWith(value: "fcmp"))
         {
             // Comparison operations return i1
             _output.AppendLine(handler: $"  {result} = {op} {operandType} {left}, {rightOperand}");
@@ -410,8 +429,6 @@ public partial class LLVMCodeGenerator
         string structTemp = GetNextTemp();
         string valueTemp = GetNextTemp();
         string didOverflowTemp = GetNextTemp();
-        string trapLabel = GetNextLabel();
-        string continueLabel = GetNextLabel();
 
         // Call overflow intrinsic which returns {result, overflow_flag}
         _output.AppendLine(
@@ -422,19 +439,26 @@ public partial class LLVMCodeGenerator
         _output.AppendLine(
             handler: $"  {didOverflowTemp} = extractvalue {{{llvmType}, i1}} {structTemp}, 1");
 
-        // Branch on overflow flag
-        _output.AppendLine(
-            handler: $"  br i1 {didOverflowTemp}, label %{trapLabel}, label %{continueLabel}");
+        if (!TryAccumulateStickyOverflow(overflowFlag: didOverflowTemp))
+        {
+            string trapLabel = GetNextLabel();
+            string continueLabel = GetNextLabel();
 
-        // Trap block - call panic/abort on overflow
-        _output.AppendLine(handler: $"{trapLabel}:");
-        _output.AppendLine(
-            value:
-            $"  call void @rf_crash(ptr getelementptr inbounds ([20 x i8], [20 x i8]* @.str_overflow, i32 0, i32 0))");
-        _output.AppendLine(value: $"  unreachable");
+            // Branch on overflow flag
+            _output.AppendLine(
+                handler: $"  br i1 {didOverflowTemp}, label %{trapLabel}, label %{continueLabel}");
+
+            // Trap block - call panic/abort on overflow
+            _output.AppendLine(handler: $"{trapLabel}:");
+            _output.AppendLine(
+                value:
+                $"  call void @rf_crash(ptr getelementptr inbounds ([20 x i8], [20 x i8]* @.str_overflow, i32 0, i32 0))");
+            _output.AppendLine(value: $"  unreachable");
+
+            // Continue block - normal execution
+            _output.AppendLine(handler: $"{continueLabel}:");
+        }
 
-        // Continue block - normal execution
-        _output.AppendLine(handler: $"{continueLabel}:");
         _output.AppendLine(
             handler: $"  {result} = add {llvmType} {valueTemp}, 0  ; propagate result");
 
@@ -647,6 +671,15 @@ public partial class LLVMCodeGenerator
                     resultTemp: result);
             }
 
+            // memory_copy!/fill!/zero! with a small literal size lower to llvm.mem* inline
+            if (TryEmitInlineMemoryOperation(functionName: identifierEarly.Name,
+                    arguments: node.Arguments,
+                    resultTemp: result,
+                    result: out string? memoryResult))
+            {
+                return memoryResult!;
+            }
+
             // Check for external function calls by identifier (e.g., rf_console_get_letters)
             // This handles direct calls to external C functions inside module function bodies
             if (TryHandleExternalFunctionCall(funcName: identifierEarly.Name,
@@ -791,7 +824,8 @@ public partial class LLVMCodeGenerator
                 string result = GetNextTemp();
                 if (operandType.IsFloatingPoint)
                 {
-                    _output.AppendLine(handler: $"  {result} = fneg {llvmType} {operand}");
+                    _output.AppendLine(
+                        handler: $"  {result} = {WithFloatFlags(opcode: "fneg")} {llvmType} {operand}");
                 }
                 else
                 {
@@ -184,11 +184,11 @@ public partial class LLVMCodeGenerator
     {
         return typeName switch
         {
-            "s8" or "u8" or "bool" => 1,
-            "s16" or "u16" => 2,
-            "s32" or "u32" or "f32" => 4,
+            "s8" or "u8" or "bool" or "letter8" => 1,
+            "s16" or "u16" or "f16" or "letter16" => 2,
+            "s32" or "u32" or "f32" or "letter" or "letter32" => 4,
             "s64" or "u64" or "f64" or "ptr" => 8,
-            "s128" or "u128" => 16,
+            "s128" or "u128" or "f128" => 16,
             _ => 8 // Default to 8-byte alignment
         };
     }
@@ -197,7 +197,8 @@ public partial class LLVMCodeGenerator
     {
         return functionName switch
         {
-            "write_as" or "read_as" or "volatile_write" or "volatile_read" => true,
+            "write_as" or "read_as" or "volatile_write" or "volatile_read" or "volatile_write_as"
+                or "volatile_read_as" => true,
             _ => false
         };
     }
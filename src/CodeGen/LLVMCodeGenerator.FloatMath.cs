@@ -0,0 +1,90 @@
+namespace Compilers.Shared.CodeGen;
+
+/// <summary>
+/// Floating-point semantics a module or routine is compiled with.
+/// </summary>
+public enum FloatMathMode
+{
+    /// <summary>IEEE operations as written; runtime batch math uses the vector kernels.</summary>
+    Default,
+
+    /// <summary>
+    /// Float operations and math calls carry <c>reassoc nnan arcp contract afn</c>, letting LLVM
+    /// reorder sums, use reciprocal estimates and approximate library calls.
+    /// </summary>
+    Fast,
+
+    /// <summary>
+    /// No fast-math flags and no optional fusion: <c>fmuladd</c> is emitted as a real
+    /// <c>fma</c>. As a module mode, runtime batch math also goes through libm instead of the
+    /// vector kernels; a <c>@strict_math</c> routine in a default module still uses the kernels.
+    /// </summary>
+    Strict
+}
+
+/// <summary>
+/// Partial class containing fast/strict float math mode handling.
+/// The module mode comes from the compiler flag; <c>@fast_math</c> and <c>@strict_math</c>
+/// override it for the float operations and math calls of a single routine. Runtime batch
+/// kernels (rf_*_batch) are switched only by the module flag.
+/// </summary>
+public partial class LLVMCodeGenerator
+{
+    private const string FastMathFlags = "reassoc nnan arcp contract afn";
+
+    /// <summary>Module-wide float math mode (--fast-math / --strict-math).</summary>
+    public FloatMathMode MathMode { get; set; } = FloatMathMode.Default;
+
+    // Mode of the routine being generated, or null outside routines
+    private FloatMathMode? _routineMathMode;
+
+    private FloatMathMode CurrentMathMode => _routineMathMode ?? MathMode;
+
+    /// <summary>
+    /// Picks the float math mode for a routine from its attributes.
+    /// Only the routine's own IR follows the override: batch kernel selection is process-wide,
+    /// so runtime batch math keeps the module mode set once at program start.
+    /// </summary>
+    private void BeginFloatMathScope(List<string> attributes)
+    {
+        _routineMathMode = attributes.Contains(item: "fast_math") ? FloatMathMode.Fast
+            : attributes.Contains(item: "strict_math") ? FloatMathMode.Strict
+            : MathMode;
+    }
+
+    /// <summary>
+    /// Float opcode with the current routine's fast-math flags: "fadd" or "fadd reassoc ...".
+    /// </summary>
+    private string WithFloatFlags(string opcode)
+    {
+        return CurrentMathMode == FloatMathMode.Fast
+            ? $"{opcode} {FastMathFlags}"
+            : opcode;
+    }
+
+    // Float counterparts of the integer opcodes VisitBinaryExpression selects
+    private string MapToFloatOp(string op)
+    {
+        return op switch
+        {
+            "add" => WithFloatFlags(opcode: "fadd"),
+            "sub" => WithFloatFlags(opcode: "fsub"),
+            "mul" => WithFloatFlags(opcode: "fmul"),
+            "fdiv" or "frem" => WithFloatFlags(opcode: op),
+            "icmp slt" => $"{WithFloatFlags(opcode: "fcmp")} olt",
+            "icmp sgt" => $"{WithFloatFlags(opcode: "fcmp")} ogt",
+            "icmp eq" => $"{WithFloatFlags(opcode: "fcmp")} oeq",
+            "icmp ne" => $"{WithFloatFlags(opcode: "fcmp")} une",
+            _ => op
+        };
+    }
+
+    private void EmitStrictMathRuntimeInit()
+    {
+        if (MathMode == FloatMathMode.Strict)
+        {
+            _mathDeclarations.Add(item: "declare void @rf_math_set_strict(i1)");
+            _output.AppendLine(value: "  call void @rf_math_set_strict(i1 true)");
+        }
+    }
+}
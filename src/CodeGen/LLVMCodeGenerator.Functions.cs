@@ -97,6 +97,15 @@ public partial class LLVMCodeGenerator
                     : "i32";
                 parameters.Add(item: $"{paramType} %{param.Name}");
                 _symbolTypes[key: param.Name] = paramType;
+                if (param.Type != null)
+                {
+                    _symbolRfTypes[key: param.Name] = param.Type.Name;
+                }
+                else
+                {
+                    _symbolRfTypes.Remove(key: param.Name);
+                }
+
                 _functionParameters.Add(item: param.Name); // Mark as parameter
             }
         }
@@ -110,6 +119,7 @@ public partial class LLVMCodeGenerator
         if (isMain)
         {
             _output.AppendLine(value: "  call void @rf_runtime_init()");
+            EmitStrictMathRuntimeInit();
         }
 
         // Register file and routine for stack trace support
@@ -128,6 +138,12 @@ public partial class LLVMCodeGenerator
             line: line,
             column: column);
 
+        // @sticky_overflow routines collect overflow in one flag instead of trapping per operation
+        BeginStickyOverflowScope(attributes: node.Attributes);
+
+        // @fast_math / @strict_math override the module's float math mode
+        BeginFloatMathScope(attributes: node.Attributes);
+
         // Reset return flag for this function
         _hasReturn = false;
 
@@ -146,6 +162,8 @@ public partial class LLVMCodeGenerator
         // Add default return if needed (only if no explicit return was generated)
         if (!_hasReturn)
         {
+            EmitStickyOverflowCheck();
+
             // Emit stack frame pop before return
             _stackTraceCodeGen?.EmitPopFrame();
 
@@ -159,6 +177,9 @@ public partial class LLVMCodeGenerator
             }
         }
 
+        _stickyOverflowFlag = null;
+        _routineMathMode = null;
+
         _output.AppendLine(value: "}");
         _output.AppendLine();
 
@@ -119,7 +119,7 @@ public partial class LLVMCodeGenerator
     {
         string intrinsicName = node.IntrinsicName;
         string llvmType = node.TypeArguments.Count > 0
-            ? MapRazorForgeTypeToLLVM(razorForgeType: node.TypeArguments[index: 0])
+            ? ResolveIntrinsicType(typeArgument: node.TypeArguments[index: 0])
             : "i32";
 
         // Determine if type is unsigned or signed
@@ -128,14 +128,22 @@ public partial class LLVMCodeGenerator
         bool isFloat = llvmType.Contains(value: "float") || llvmType.Contains(value: "double") ||
                        llvmType.Contains(value: "half") || llvmType.Contains(value: "fp128");
 
+        // neg/abs/shl/shr/div/rem with an explicit overflow policy
+        if (!isFloat && IsIntegerKernelIntrinsic(intrinsicName: intrinsicName))
+        {
+            return EmitIntegerKernelIntrinsic(node: node, resultTemp: resultTemp, llvmType: llvmType);
+        }
+
         // Handle unary neg operation
         if (intrinsicName == "neg")
         {
             string valueTemp = node.Arguments[index: 0]
                                    .Accept(visitor: this);
+            isUnsigned = isUnsigned || IsUnsignedIntrinsicOperand(operandTemp: valueTemp);
             if (isFloat)
             {
-                _output.AppendLine(handler: $"  {resultTemp} = fneg {llvmType} {valueTemp}");
+                _output.AppendLine(
+                    handler: $"  {resultTemp} = {WithFloatFlags(opcode: "fneg")} {llvmType} {valueTemp}");
             }
             else
             {
@@ -154,6 +162,7 @@ public partial class LLVMCodeGenerator
                               .Accept(visitor: this);
         string rightTemp = node.Arguments[index: 1]
                                .Accept(visitor: this);
+        isUnsigned = isUnsigned || IsUnsignedIntrinsicOperand(operandTemp: leftTemp);
 
         // Basic arithmetic (trapping on overflow for integers, IEEE for floats)
         // For integers, we use overflow intrinsics and trap if overflow occurs
@@ -162,7 +171,8 @@ public partial class LLVMCodeGenerator
             if (isFloat)
             {
                 _output.AppendLine(
-                    handler: $"  {resultTemp} = fadd {llvmType} {leftTemp}, {rightTemp}");
+                    handler:
+                    $"  {resultTemp} = {WithFloatFlags(opcode: "fadd")} {llvmType} {leftTemp}, {rightTemp}");
             }
             else
             {
@@ -181,15 +191,8 @@ public partial class LLVMCodeGenerator
                 _output.AppendLine(
                     handler:
                     $"  {overflowFlag} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 1");
-                // Trap on overflow
-                string trapLabel = $"trap.add.{_tempCounter}";
-                string contLabel = $"cont.add.{_tempCounter}";
-                _output.AppendLine(
-                    handler: $"  br i1 {overflowFlag}, label %{trapLabel}, label %{contLabel}");
-                _output.AppendLine(handler: $"{trapLabel}:");
-                _output.AppendLine(value: $"  call void @llvm.trap()");
-                _output.AppendLine(value: $"  unreachable");
-                _output.AppendLine(handler: $"{contLabel}:");
+                // Trap on overflow unless the routine accumulates it
+                EmitOverflowTrap(overflowFlag: overflowFlag, kind: "add");
             }
         }
         else if (intrinsicName == "sub")
@@ -197,7 +200,8 @@ public partial class LLVMCodeGenerator
             if (isFloat)
             {
                 _output.AppendLine(
-                    handler: $"  {resultTemp} = fsub {llvmType} {leftTemp}, {rightTemp}");
+                    handler:
+                    $"  {resultTemp} = {WithFloatFlags(opcode: "fsub")} {llvmType} {leftTemp}, {rightTemp}");
             }
             else
             {
@@ -215,14 +219,7 @@ public partial class LLVMCodeGenerator
                 _output.AppendLine(
                     handler:
                     $"  {overflowFlag} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 1");
-                string trapLabel = $"trap.sub.{_tempCounter}";
-                string contLabel = $"cont.sub.{_tempCounter}";
-                _output.AppendLine(
-                    handler: $"  br i1 {overflowFlag}, label %{trapLabel}, label %{contLabel}");
-                _output.AppendLine(handler: $"{trapLabel}:");
-                _output.AppendLine(value: $"  call void @llvm.trap()");
-                _output.AppendLine(value: $"  unreachable");
-                _output.AppendLine(handler: $"{contLabel}:");
+                EmitOverflowTrap(overflowFlag: overflowFlag, kind: "sub");
             }
         }
         else if (intrinsicName == "mul")
@@ -230,7 +227,8 @@ public partial class LLVMCodeGenerator
             if (isFloat)
             {
                 _output.AppendLine(
-                    handler: $"  {resultTemp} = fmul {llvmType} {leftTemp}, {rightTemp}");
+                    handler:
+                    $"  {resultTemp} = {WithFloatFlags(opcode: "fmul")} {llvmType} {leftTemp}, {rightTemp}");
             }
             else
             {
@@ -248,14 +246,7 @@ public partial class LLVMCodeGenerator
                 _output.AppendLine(
                     handler:
                     $"  {overflowFlag} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 1");
-                string trapLabel = $"trap.mul.{_tempCounter}";
-                string contLabel = $"cont.mul.{_tempCounter}";
-                _output.AppendLine(
-                    handler: $"  br i1 {overflowFlag}, label %{trapLabel}, label %{contLabel}");
-                _output.AppendLine(handler: $"{trapLabel}:");
-                _output.AppendLine(value: $"  call void @llvm.trap()");
-                _output.AppendLine(value: $"  unreachable");
-                _output.AppendLine(handler: $"{contLabel}:");
+                EmitOverflowTrap(overflowFlag: overflowFlag, kind: "mul");
             }
         }
         else if (intrinsicName == "sdiv")
@@ -283,29 +274,29 @@ public partial class LLVMCodeGenerator
         {
             _output.AppendLine(
                 handler:
-                $"  {resultTemp} = {(isFloat ? "fadd" : "add")} {llvmType} {leftTemp}, {rightTemp}");
+                $"  {resultTemp} = {(isFloat ? WithFloatFlags(opcode: "fadd") : "add")} {llvmType} {leftTemp}, {rightTemp}");
         }
         else if (intrinsicName == "sub.wrapping")
         {
             _output.AppendLine(
                 handler:
-                $"  {resultTemp} = {(isFloat ? "fsub" : "sub")} {llvmType} {leftTemp}, {rightTemp}");
+                $"  {resultTemp} = {(isFloat ? WithFloatFlags(opcode: "fsub") : "sub")} {llvmType} {leftTemp}, {rightTemp}");
         }
         else if (intrinsicName == "mul.wrapping")
         {
             _output.AppendLine(
                 handler:
-                $"  {resultTemp} = {(isFloat ? "fmul" : "mul")} {llvmType} {leftTemp}, {rightTemp}");
+                $"  {resultTemp} = {(isFloat ? WithFloatFlags(opcode: "fmul") : "mul")} {llvmType} {leftTemp}, {rightTemp}");
         }
         else if (intrinsicName == "div.wrapping")
         {
-            string divOp = isFloat ? "fdiv" : isUnsigned ? "udiv" : "sdiv";
+            string divOp = isFloat ? WithFloatFlags(opcode: "fdiv") : isUnsigned ? "udiv" : "sdiv";
             _output.AppendLine(
                 handler: $"  {resultTemp} = {divOp} {llvmType} {leftTemp}, {rightTemp}");
         }
         else if (intrinsicName == "rem.wrapping")
         {
-            string remOp = isFloat ? "frem" : isUnsigned ? "urem" : "srem";
+            string remOp = isFloat ? WithFloatFlags(opcode: "frem") : isUnsigned ? "urem" : "srem";
             _output.AppendLine(
                 handler: $"  {resultTemp} = {remOp} {llvmType} {leftTemp}, {rightTemp}");
         }
@@ -330,7 +321,9 @@ public partial class LLVMCodeGenerator
             _output.AppendLine(
                 handler: $"  {overflowTemp} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 1");
 
-            // For now, just return the value (tuple support would need more work)
+            // Without tuple destructuring the flag can't be handed back, so it is propagated
+            // like a checked operator's: folded into the sticky flag, or trapped on
+            EmitOverflowTrap(overflowFlag: overflowTemp, kind: op);
             _tempTypes[key: valueTemp] = new TypeInfo(LLVMType: llvmType,
                 IsUnsigned: isUnsigned,
                 IsFloatingPoint: isFloat,
@@ -358,18 +351,15 @@ public partial class LLVMCodeGenerator
         }
         else if (intrinsicName == "mul.saturating")
         {
-            // LLVM doesn't have direct saturating multiply, so we use overflow detection
-            // For now, use a placeholder that traps on overflow (TODO: implement proper saturation)
-            string llvmFunc = isUnsigned
-                ? $"@llvm.umul.with.overflow.{llvmType}"
-                : $"@llvm.smul.with.overflow.{llvmType}";
-            string structTemp = GetNextTemp();
-            _output.AppendLine(
-                handler:
-                $"  {structTemp} = call {{ {llvmType}, i1 }} {llvmFunc}({llvmType} {leftTemp}, {llvmType} {rightTemp})");
-            _output.AppendLine(
-                handler: $"  {resultTemp} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 0");
-            // TODO: Check overflow flag and saturate to MAX/MIN
+            // No llvm.*mul.sat for plain integers; clamp on the smul/umul overflow flag
+            GenerateSaturatingMultiply(left: leftTemp,
+                right: rightTemp,
+                result: resultTemp,
+                typeInfo: new TypeInfo(LLVMType: llvmType,
+                    IsUnsigned: isUnsigned,
+                    IsFloatingPoint: false,
+                    RazorForgeType: node.TypeArguments[index: 0]),
+                llvmType: llvmType);
         }
         else
         {
@@ -388,7 +378,7 @@ public partial class LLVMCodeGenerator
     {
         string intrinsicName = node.IntrinsicName;
         string llvmType = node.TypeArguments.Count > 0
-            ? MapRazorForgeTypeToLLVM(razorForgeType: node.TypeArguments[index: 0])
+            ? ResolveIntrinsicType(typeArgument: node.TypeArguments[index: 0])
             : "i32";
 
         string leftTemp = node.Arguments[index: 0]
@@ -410,7 +400,8 @@ public partial class LLVMCodeGenerator
         else if (cmpType == "fcmp")
         {
             _output.AppendLine(
-                handler: $"  {resultTemp} = fcmp {predicate} {llvmType} {leftTemp}, {rightTemp}");
+                handler:
+                $"  {resultTemp} = {WithFloatFlags(opcode: "fcmp")} {predicate} {llvmType} {leftTemp}, {rightTemp}");
         }
 
         _tempTypes[key: resultTemp] = new TypeInfo(LLVMType: "i1",
@@ -488,44 +479,151 @@ public partial class LLVMCodeGenerator
         return resultTemp;
     }
 
+    // Float math with a direct LLVM intrinsic: @intrinsic name -> (llvm.* base name, arity).
+    // The optimizer folds, inlines and vectorizes these; no runtime wrapper is involved.
+    private static readonly Dictionary<string, (string LLVMName, int Arity)>
+        LLVMMathIntrinsics = new()
+        {
+            [key: "sqrt"] = ("sqrt", 1),
+            [key: "fabs"] = ("fabs", 1),
+            [key: "floor"] = ("floor", 1),
+            [key: "ceil"] = ("ceil", 1),
+            [key: "trunc_float"] = ("trunc", 1),
+            [key: "round"] = ("round", 1),
+            [key: "roundeven"] = ("roundeven", 1),
+            [key: "rint"] = ("rint", 1),
+            [key: "nearbyint"] = ("nearbyint", 1),
+            [key: "exp"] = ("exp", 1),
+            [key: "exp2"] = ("exp2", 1),
+            [key: "log"] = ("log", 1),
+            [key: "log2"] = ("log2", 1),
+            [key: "log10"] = ("log10", 1),
+            [key: "sin"] = ("sin", 1),
+            [key: "cos"] = ("cos", 1),
+            [key: "copysign"] = ("copysign", 2),
+            [key: "pow"] = ("pow", 2),
+            [key: "fmin"] = ("minnum", 2),
+            [key: "fmax"] = ("maxnum", 2),
+            [key: "fma"] = ("fma", 3),
+            [key: "fmuladd"] = ("fmuladd", 3)
+        };
+
+    // Float math LLVM has no intrinsic for: called as plain libm functions declared without
+    // side effects, which the loop vectorizer maps onto the vector math library (libmvec/SVML)
+    private static readonly Dictionary<string, int> LibmMathFunctions = new()
+    {
+        [key: "tan"] = 1,
+        [key: "asin"] = 1,
+        [key: "acos"] = 1,
+        [key: "atan"] = 1,
+        [key: "atan2"] = 2,
+        [key: "sinh"] = 1,
+        [key: "cosh"] = 1,
+        [key: "tanh"] = 1,
+        [key: "asinh"] = 1,
+        [key: "acosh"] = 1,
+        [key: "atanh"] = 1,
+        [key: "expm1"] = 1,
+        [key: "log1p"] = 1,
+        [key: "cbrt"] = 1,
+        [key: "hypot"] = 2
+    };
+
+    // Quad routines the f128 runtime (razorforge_f128.h) provides. LLVM lowers llvm.*.f128 math to
+    // the long double libcalls (sqrtl, sinl), which are x87 extended precision on x86-64, so
+    // fp128 math that is not a plain bit operation never goes through an llvm.* intrinsic.
+    private static readonly HashSet<string> F128RuntimeMath = new(comparer: StringComparer.Ordinal)
+    {
+        "sqrt", "fma", "fmuladd", "exp", "log", "sin", "cos", "tan", "pow"
+    };
+
+    // Declarations for every math function the module calls, emitted once at the end
+    private readonly SortedSet<string> _mathDeclarations = new(comparer: StringComparer.Ordinal);
+
+    private static bool IsMathIntrinsic(string intrinsicName)
+    {
+        return intrinsicName is "abs" or "fmod" ||
+               LLVMMathIntrinsics.ContainsKey(key: intrinsicName) ||
+               LibmMathFunctions.ContainsKey(key: intrinsicName);
+    }
+
+    // Overload suffix LLVM uses for a scalar type: double -> f64, i32 -> i32
+    private static string GetIntrinsicTypeSuffix(string llvmType)
+    {
+        return llvmType switch
+        {
+            "half" => "f16",
+            "float" => "f32",
+            "double" => "f64",
+            "fp128" => "f128",
+            _ => llvmType
+        };
+    }
+
+    // Intrinsic type arguments are LLVM scalar names (sqrt<double>) or RazorForge ones (f64)
+    private string ResolveIntrinsicType(string typeArgument)
+    {
+        bool isLLVMInteger = typeArgument.Length > 1 && typeArgument[0] == 'i' &&
+                             typeArgument[1..].All(predicate: char.IsDigit);
+        return typeArgument is "half" or "float" or "double" or "fp128" || isLLVMInteger
+            ? typeArgument
+            : MapRazorForgeTypeToLLVM(razorForgeType: typeArgument);
+    }
+
     private string EmitMathIntrinsic(IntrinsicCallExpression node, string resultTemp)
     {
         string intrinsicName = node.IntrinsicName;
         string llvmType = node.TypeArguments.Count > 0
-            ? MapRazorForgeTypeToLLVM(razorForgeType: node.TypeArguments[index: 0])
+            ? ResolveIntrinsicType(typeArgument: node.TypeArguments[index: 0])
             : "double";
 
-        if (intrinsicName == "sqrt" || intrinsicName == "fabs" || intrinsicName == "floor" ||
-            intrinsicName == "ceil" || intrinsicName == "trunc_float" ||
-            intrinsicName == "round" || intrinsicName == "exp" || intrinsicName == "log" ||
-            intrinsicName == "log10" || intrinsicName == "sin" || intrinsicName == "cos")
+        List<string> operands = node.Arguments
+                                    .Select(selector: argument => argument.Accept(visitor: this))
+                                    .ToList();
+
+        if (intrinsicName == "abs")
         {
-            string valueTemp = node.Arguments[index: 0]
-                                   .Accept(visitor: this);
-            string llvmFunc = intrinsicName == "trunc_float"
-                ? "trunc"
-                : intrinsicName;
+            _mathDeclarations.Add(item: $"declare {llvmType} @llvm.abs.{llvmType}({llvmType}, i1)");
             _output.AppendLine(
                 handler:
-                $"  {resultTemp} = call {llvmType} @llvm.{llvmFunc}.{llvmType}({llvmType} {valueTemp})");
+                $"  {resultTemp} = call {llvmType} @llvm.abs.{llvmType}({llvmType} {operands[index: 0]}, i1 false)");
         }
-        else if (intrinsicName == "abs")
+        else if (intrinsicName == "fmod")
         {
-            string valueTemp = node.Arguments[index: 0]
-                                   .Accept(visitor: this);
             _output.AppendLine(
                 handler:
-                $"  {resultTemp} = call {llvmType} @llvm.abs.{llvmType}({llvmType} {valueTemp}, i1 false)");
+                $"  {resultTemp} = {WithFloatFlags(opcode: "frem")} {llvmType} {operands[index: 0]}, {operands[index: 1]}");
         }
-        else if (intrinsicName == "copysign" || intrinsicName == "pow")
+        else if (llvmType == "fp128" && F128RuntimeMath.Contains(item: intrinsicName))
         {
-            string leftTemp = node.Arguments[index: 0]
-                                  .Accept(visitor: this);
-            string rightTemp = node.Arguments[index: 1]
-                                   .Accept(visitor: this);
-            _output.AppendLine(
-                handler:
-                $"  {resultTemp} = call {llvmType} @llvm.{intrinsicName}.{llvmType}({llvmType} {leftTemp}, {llvmType} {rightTemp})");
+            string function = intrinsicName == "fmuladd" ? "rf_f128_fma" : $"rf_f128_{intrinsicName}";
+            EmitMathCall(function: function, llvmType: llvmType, arity: operands.Count,
+                operands: operands, resultTemp: resultTemp);
+        }
+        else if (LLVMMathIntrinsics.TryGetValue(key: intrinsicName,
+                     value: out (string LLVMName, int Arity) intrinsic) &&
+                 (llvmType != "fp128" || intrinsic.LLVMName is "fabs" or "copysign"))
+        {
+            // fmuladd fuses only where the target has FMA; strict code must round the same everywhere
+            string llvmName = intrinsic.LLVMName == "fmuladd" &&
+                              CurrentMathMode == FloatMathMode.Strict
+                ? "fma"
+                : intrinsic.LLVMName;
+            string function = $"llvm.{llvmName}.{GetIntrinsicTypeSuffix(llvmType: llvmType)}";
+            EmitMathCall(function: function, llvmType: llvmType, arity: intrinsic.Arity,
+                operands: operands, resultTemp: resultTemp);
+        }
+        else if (LibmMathFunctions.TryGetValue(key: intrinsicName, value: out int arity))
+        {
+            EmitLibmCall(name: intrinsicName, llvmType: llvmType, arity: arity,
+                operands: operands, resultTemp: resultTemp);
+        }
+        else if (LLVMMathIntrinsics.TryGetValue(key: intrinsicName, value: out intrinsic))
+        {
+            // The rest of fp128 math: floorf128, log2f128, fminf128...
+            string name = intrinsicName == "trunc_float" ? "trunc" : intrinsicName;
+            EmitLibmCall(name: name, llvmType: llvmType, arity: intrinsic.Arity,
+                operands: operands, resultTemp: resultTemp);
         }
         else
         {
@@ -535,11 +633,89 @@ public partial class LLVMCodeGenerator
 
         _tempTypes[key: resultTemp] = new TypeInfo(LLVMType: llvmType,
             IsUnsigned: false,
-            IsFloatingPoint: true,
+            IsFloatingPoint: intrinsicName != "abs",
             RazorForgeType: node.TypeArguments[index: 0]);
         return resultTemp;
     }
 
+    private void EmitMathCall(string function, string llvmType, int arity, List<string> operands,
+        string resultTemp)
+    {
+        if (operands.Count != arity)
+        {
+            throw new InvalidOperationException(
+                message: $"{function} expects {arity} arguments, got {operands.Count}");
+        }
+
+        string parameterTypes = string.Join(separator: ", ",
+            values: Enumerable.Repeat(element: llvmType, count: arity));
+        string arguments = string.Join(separator: ", ",
+            values: operands.Select(selector: operand => $"{llvmType} {operand}"));
+        string attributes = function.StartsWith(value: "llvm.")
+            ? ""
+            : " nounwind readnone willreturn";
+        _mathDeclarations.Add(
+            item: $"declare {llvmType} @{function}({parameterTypes}){attributes}");
+        _output.AppendLine(
+            handler: $"  {resultTemp} = {WithFloatFlags(opcode: "call")} {llvmType} @{function}({arguments})");
+    }
+
+    // libm names by width: tan, tanf, tanf128. There is no half libm, so f16 runs in float.
+    private void EmitLibmCall(string name, string llvmType, int arity, List<string> operands,
+        string resultTemp)
+    {
+        switch (llvmType)
+        {
+            case "double":
+                EmitMathCall(function: name, llvmType: llvmType, arity: arity,
+                    operands: operands, resultTemp: resultTemp);
+                break;
+            case "float":
+                EmitMathCall(function: $"{name}f", llvmType: llvmType, arity: arity,
+                    operands: operands, resultTemp: resultTemp);
+                break;
+            case "fp128":
+                EmitMathCall(function: $"{name}f128", llvmType: llvmType, arity: arity,
+                    operands: operands, resultTemp: resultTemp);
+                break;
+            case "half":
+            {
+                var widened = new List<string>();
+                foreach (string operand in operands)
+                {
+                    string wide = GetNextTemp();
+                    _output.AppendLine(handler: $"  {wide} = fpext half {operand} to float");
+                    widened.Add(item: wide);
+                }
+
+                string wideResult = GetNextTemp();
+                EmitMathCall(function: $"{name}f", llvmType: "float", arity: arity,
+                    operands: widened, resultTemp: wideResult);
+                _output.AppendLine(
+                    handler: $"  {resultTemp} = fptrunc float {wideResult} to half");
+                break;
+            }
+            default:
+                throw new NotImplementedException(
+                    message: $"Math intrinsic {name} not implemented for {llvmType}");
+        }
+    }
+
+    private void EmitMathDeclarations()
+    {
+        if (_mathDeclarations.Count == 0)
+        {
+            return;
+        }
+
+        _output.AppendLine();
+        _output.AppendLine(value: "; Math intrinsic and libm declarations");
+        foreach (string declaration in _mathDeclarations)
+        {
+            _output.AppendLine(value: declaration);
+        }
+    }
+
     private string EmitAtomicIntrinsic(IntrinsicCallExpression node, string resultTemp)
     {
         string intrinsicName = node.IntrinsicName;
@@ -636,4 +812,308 @@ public partial class LLVMCodeGenerator
     }
 
     #endregion
+
+    #region Integer Kernel Lowering
+
+    // {neg,abs,shl,shr,div,rem}.{wrapping,saturating,overflow} - mirrors razorforge_int.h
+    private static bool IsIntegerKernelIntrinsic(string intrinsicName)
+    {
+        string[] parts = intrinsicName.Split(separator: '.');
+        return parts.Length == 2 &&
+               parts[0] is "neg" or "abs" or "shl" or "shr" or "div" or "rem" &&
+               parts[1] is "wrapping" or "saturating" or "overflow";
+    }
+
+    // Intrinsic type arguments are LLVM types (i32 for both s32 and u32), so signedness
+    // has to come from the RazorForge type of the operand itself
+    private bool IsUnsignedIntrinsicOperand(string operandTemp)
+    {
+        if (_tempTypes.TryGetValue(key: operandTemp, value: out TypeInfo? typeInfo))
+        {
+            return typeInfo.IsUnsigned;
+        }
+
+        return operandTemp.StartsWith(value: '%') &&
+               _symbolRfTypes.TryGetValue(key: operandTemp[1..], value: out string? rfType) &&
+               GetTypeInfo(typeName: rfType).IsUnsigned;
+    }
+
+    private string EmitIntegerKernelIntrinsic(IntrinsicCallExpression node, string resultTemp,
+        string llvmType)
+    {
+        string[] parts = node.IntrinsicName.Split(separator: '.');
+        string op = parts[0];
+        string mode = parts[1];
+
+        string valueTemp = node.Arguments[index: 0]
+                               .Accept(visitor: this);
+        string otherTemp = node.Arguments.Count > 1
+            ? node.Arguments[index: 1]
+                  .Accept(visitor: this)
+            : "";
+
+        bool isUnsigned = node.TypeArguments[index: 0]
+                              .StartsWith(value: "u") ||
+                          IsUnsignedIntrinsicOperand(operandTemp: valueTemp);
+        var typeInfo = new TypeInfo(LLVMType: llvmType,
+            IsUnsigned: isUnsigned,
+            IsFloatingPoint: false,
+            RazorForgeType: node.TypeArguments[index: 0]);
+        (string maxValue, string minValue) =
+            GetSaturationBounds(typeInfo: typeInfo, llvmType: llvmType);
+        int bits = GetTypeBitWidth(llvmType: llvmType);
+
+        // Every kernel yields its wrapped value, the overflow flag and the value to clamp to
+        (string wrapped, string overflow, string saturated) = op switch
+        {
+            "neg" => EmitNegKernel(value: valueTemp,
+                llvmType: llvmType,
+                isUnsigned: isUnsigned,
+                maxValue: maxValue),
+            "abs" => EmitAbsKernel(value: valueTemp,
+                llvmType: llvmType,
+                isUnsigned: isUnsigned,
+                maxValue: maxValue,
+                minValue: minValue),
+            "shl" => EmitShlKernel(value: valueTemp,
+                amount: CoerceShiftAmount(amount: otherTemp, llvmType: llvmType),
+                llvmType: llvmType,
+                bits: bits,
+                isUnsigned: isUnsigned,
+                maxValue: maxValue,
+                minValue: minValue),
+            "shr" => EmitShrKernel(value: valueTemp,
+                amount: CoerceShiftAmount(amount: otherTemp, llvmType: llvmType),
+                llvmType: llvmType,
+                bits: bits,
+                isUnsigned: isUnsigned),
+            _ => EmitDivRemKernel(op: op,
+                left: valueTemp,
+                right: otherTemp,
+                llvmType: llvmType,
+                isUnsigned: isUnsigned,
+                maxValue: maxValue,
+                minValue: minValue)
+        };
+
+        if (mode != "saturating")
+        {
+            // Like add.overflow, the overflow mode propagates its flag; wrapping drops it
+            if (mode == "overflow")
+            {
+                EmitOverflowTrap(overflowFlag: overflow, kind: op);
+            }
+
+            _tempTypes[key: wrapped] = typeInfo;
+            return wrapped;
+        }
+
+        _output.AppendLine(
+            handler:
+            $"  {resultTemp} = select i1 {overflow}, {llvmType} {saturated}, {llvmType} {wrapped}");
+        _tempTypes[key: resultTemp] = typeInfo;
+        return resultTemp;
+    }
+
+    /// <summary>
+    /// Folds an overflow flag into the routine's sticky flag, or traps on it when the routine
+    /// has none. A constant "false" flag (unsigned abs) emits nothing.
+    /// </summary>
+    private void EmitOverflowTrap(string overflowFlag, string kind)
+    {
+        if (overflowFlag == "false" || TryAccumulateStickyOverflow(overflowFlag: overflowFlag))
+        {
+            return;
+        }
+
+        EmitTrapIf(condition: overflowFlag, kind: kind);
+    }
+
+    // Branches to an llvm.trap block when the condition holds
+    private void EmitTrapIf(string condition, string kind)
+    {
+        string trapLabel = $"trap.{kind}.{_tempCounter}";
+        string contLabel = $"cont.{kind}.{_tempCounter}";
+        _output.AppendLine(handler: $"  br i1 {condition}, label %{trapLabel}, label %{contLabel}");
+        _output.AppendLine(handler: $"{trapLabel}:");
+        _output.AppendLine(value: $"  call void @llvm.trap()");
+        _output.AppendLine(value: $"  unreachable");
+        _output.AppendLine(handler: $"{contLabel}:");
+        _mathDeclarations.Add(item: "declare void @llvm.trap()");
+    }
+
+    // Shift amounts arrive as u32; widen or narrow them to the shifted type
+    private string CoerceShiftAmount(string amount, string llvmType)
+    {
+        if (!_tempTypes.TryGetValue(key: amount, value: out TypeInfo? amountInfo) ||
+            amountInfo.LLVMType == llvmType)
+        {
+            return amount;
+        }
+
+        string coerced = GetNextTemp();
+        string castOp = GetIntegerBitWidth(llvmType: amountInfo.LLVMType) >
+                        GetIntegerBitWidth(llvmType: llvmType)
+            ? "trunc"
+            : "zext";
+        _output.AppendLine(
+            handler: $"  {coerced} = {castOp} {amountInfo.LLVMType} {amount} to {llvmType}");
+        return coerced;
+    }
+
+    private (string, string, string) EmitNegKernel(string value, string llvmType,
+        bool isUnsigned, string maxValue)
+    {
+        string structTemp = GetNextTemp();
+        string wrapped = GetNextTemp();
+        string overflow = GetNextTemp();
+        string llvmFunc = isUnsigned
+            ? $"@llvm.usub.with.overflow.{llvmType}"
+            : $"@llvm.ssub.with.overflow.{llvmType}";
+        _output.AppendLine(
+            handler:
+            $"  {structTemp} = call {{ {llvmType}, i1 }} {llvmFunc}({llvmType} 0, {llvmType} {value})");
+        _output.AppendLine(
+            handler: $"  {wrapped} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 0");
+        _output.AppendLine(
+            handler: $"  {overflow} = extractvalue {{ {llvmType}, i1 }} {structTemp}, 1");
+
+        // -MIN clamps to MAX; negating any non-zero unsigned clamps to 0
+        return (wrapped, overflow, isUnsigned ? "0" : maxValue);
+    }
+
+    private (string, string, string) EmitAbsKernel(string value, string llvmType,
+        bool isUnsigned, string maxValue, string minValue)
+    {
+        if (isUnsigned)
+        {
+            return (value, "false", value);
+        }
+
+        string wrapped = GetNextTemp();
+        string overflow = GetNextTemp();
+        _output.AppendLine(
+            handler:
+            $"  {wrapped} = call {llvmType} @llvm.abs.{llvmType}({llvmType} {value}, i1 false)");
+        _output.AppendLine(handler: $"  {overflow} = icmp eq {llvmType} {value}, {minValue}");
+        return (wrapped, overflow, maxValue);
+    }
+
+    private (string, string, string) EmitShlKernel(string value, string amount,
+        string llvmType, int bits, bool isUnsigned, string maxValue, string minValue)
+    {
+        // Masking keeps the shift defined; bits shifted out are detected by shifting back
+        string masked = GetNextTemp();
+        string wrapped = GetNextTemp();
+        string recovered = GetNextTemp();
+        string lostBits = GetNextTemp();
+        string tooWide = GetNextTemp();
+        string overflow = GetNextTemp();
+        _output.AppendLine(handler: $"  {masked} = and {llvmType} {amount}, {bits - 1}");
+        _output.AppendLine(handler: $"  {wrapped} = shl {llvmType} {value}, {masked}");
+        _output.AppendLine(
+            handler:
+            $"  {recovered} = {(isUnsigned ? "lshr" : "ashr")} {llvmType} {wrapped}, {masked}");
+        _output.AppendLine(handler: $"  {lostBits} = icmp ne {llvmType} {recovered}, {value}");
+        _output.AppendLine(handler: $"  {tooWide} = icmp uge {llvmType} {amount}, {bits}");
+        _output.AppendLine(handler: $"  {overflow} = or i1 {lostBits}, {tooWide}");
+
+        // Zero stays zero, otherwise clamp towards the sign of the input
+        string isZero = GetNextTemp();
+        string clamped = GetNextTemp();
+        string saturated = GetNextTemp();
+        if (isUnsigned)
+        {
+            _output.AppendLine(handler: $"  {clamped} = add {llvmType} {maxValue}, 0");
+        }
+        else
+        {
+            string isNegative = GetNextTemp();
+            _output.AppendLine(handler: $"  {isNegative} = icmp slt {llvmType} {value}, 0");
+            _output.AppendLine(
+                handler:
+                $"  {clamped} = select i1 {isNegative}, {llvmType} {minValue}, {llvmType} {maxValue}");
+        }
+
+        _output.AppendLine(handler: $"  {isZero} = icmp eq {llvmType} {value}, 0");
+        _output.AppendLine(
+            handler: $"  {saturated} = select i1 {isZero}, {llvmType} 0, {llvmType} {clamped}");
+        return (wrapped, overflow, saturated);
+    }
+
+    private (string, string, string) EmitShrKernel(string value, string amount,
+        string llvmType, int bits, bool isUnsigned)
+    {
+        string shiftOp = isUnsigned ? "lshr" : "ashr";
+        string masked = GetNextTemp();
+        string wrapped = GetNextTemp();
+        string overflow = GetNextTemp();
+        _output.AppendLine(handler: $"  {masked} = and {llvmType} {amount}, {bits - 1}");
+        _output.AppendLine(handler: $"  {wrapped} = {shiftOp} {llvmType} {value}, {masked}");
+        _output.AppendLine(handler: $"  {overflow} = icmp uge {llvmType} {amount}, {bits}");
+
+        // Shifting everything out leaves the sign fill: 0 or -1
+        if (isUnsigned)
+        {
+            return (wrapped, overflow, "0");
+        }
+
+        string saturated = GetNextTemp();
+        _output.AppendLine(handler: $"  {saturated} = ashr {llvmType} {value}, {bits - 1}");
+        return (wrapped, overflow, saturated);
+    }
+
+    private (string, string, string) EmitDivRemKernel(string op, string left, string right,
+        string llvmType, bool isUnsigned, string maxValue, string minValue)
+    {
+        // Division by zero has no wrapped or saturated answer, so every mode traps on it
+        string isZero = GetNextTemp();
+        _output.AppendLine(handler: $"  {isZero} = icmp eq {llvmType} {right}, 0");
+        EmitTrapIf(condition: isZero, kind: op);
+
+        string llvmOp = (op, isUnsigned) switch
+        {
+            ("div", true) => "udiv",
+            ("div", false) => "sdiv",
+            (_, true) => "urem",
+            _ => "srem"
+        };
+        string wrapped = GetNextTemp();
+        if (isUnsigned)
+        {
+            _output.AppendLine(handler: $"  {wrapped} = {llvmOp} {llvmType} {left}, {right}");
+            return (wrapped, "false", wrapped);
+        }
+
+        // MIN / -1 is UB, so a -1 divisor against MIN is replaced with 1 (MIN / 1 is the
+        // wrapped MIN); MIN % -1 is 0, and any x % -1 can skip the division
+        string isMin = GetNextTemp();
+        string isNegOne = GetNextTemp();
+        string minByNegOne = GetNextTemp();
+        _output.AppendLine(handler: $"  {isMin} = icmp eq {llvmType} {left}, {minValue}");
+        _output.AppendLine(handler: $"  {isNegOne} = icmp eq {llvmType} {right}, -1");
+        _output.AppendLine(handler: $"  {minByNegOne} = and i1 {isMin}, {isNegOne}");
+
+        string unsafeDivisor = op == "div" ? minByNegOne : isNegOne;
+        string safeDivisor = GetNextTemp();
+        _output.AppendLine(
+            handler:
+            $"  {safeDivisor} = select i1 {unsafeDivisor}, {llvmType} 1, {llvmType} {right}");
+        if (op == "rem")
+        {
+            string remainder = GetNextTemp();
+            _output.AppendLine(
+                handler: $"  {remainder} = {llvmOp} {llvmType} {left}, {safeDivisor}");
+            _output.AppendLine(
+                handler:
+                $"  {wrapped} = select i1 {isNegOne}, {llvmType} 0, {llvmType} {remainder}");
+            return (wrapped, "false", wrapped);
+        }
+
+        // MIN / -1 clamps to MAX
+        _output.AppendLine(handler: $"  {wrapped} = {llvmOp} {llvmType} {left}, {safeDivisor}");
+        return (wrapped, minByNegOne, maxValue);
+    }
+
+    #endregion
 }
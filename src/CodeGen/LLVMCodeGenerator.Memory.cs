@@ -0,0 +1,201 @@
+using System.Numerics;
+using Compilers.Shared.AST;
+
+namespace Compilers.Shared.CodeGen;
+
+/// <summary>
+/// Partial class lowering small constant-size <c>memory_copy!</c>, <c>memory_fill!</c> and
+/// <c>memory_zero!</c> calls inline. The runtime versions (native/runtime/memory.c) pick a tier
+/// by size at run time; when the size is a literal the generator knows the tier already, and
+/// <c>llvm.memmove</c>/<c>llvm.memset</c> with a constant length become a few loads and stores
+/// instead of two calls.
+/// </summary>
+public partial class LLVMCodeGenerator
+{
+    // Largest literal size lowered inline; bigger copies keep the runtime's tiers
+    private const int InlineMemoryLimit = 256;
+
+    // llvm.mem* declarations, shared with the Serializable writers, and the typed
+    // slice accessors DynamicSlice.read/write call
+    private readonly SortedSet<string> _memoryDeclarations = new(comparer: StringComparer.Ordinal);
+
+    /// <summary>
+    /// Emits <paramref name="functionName"/> inline when it is one of the memory operations and
+    /// its size argument is an integer literal no larger than <see cref="InlineMemoryLimit"/>.
+    /// A zero address still makes the call a no-op, as in the runtime.
+    /// </summary>
+    private bool TryEmitInlineMemoryOperation(string functionName, List<Expression> arguments,
+        string resultTemp, out string? result)
+    {
+        result = null;
+        string operation = functionName.TrimEnd(trimChar: '!');
+        int expectedArguments = operation switch
+        {
+            "memory_copy" or "memory_fill" => 3,
+            "memory_zero" => 2,
+            _ => 0
+        };
+        if (expectedArguments == 0 || arguments.Count != expectedArguments)
+        {
+            return false;
+        }
+
+        List<Expression> values = arguments
+                                  .Select(selector: a => a is NamedArgumentExpression named
+                                       ? named.Value
+                                       : a)
+                                  .ToList();
+        if (!TryGetLiteralSize(expression: values[index: values.Count - 1], size: out long size) ||
+            size > InlineMemoryLimit)
+        {
+            return false;
+        }
+
+        // Arguments are evaluated even when there is nothing to copy
+        var addresses = new List<string>();
+        string pattern = "0";
+        switch (operation)
+        {
+            case "memory_copy":
+                addresses.Add(item: values[index: 0]
+                   .Accept(visitor: this));
+                addresses.Add(item: values[index: 1]
+                   .Accept(visitor: this));
+                break;
+            case "memory_fill":
+                addresses.Add(item: values[index: 0]
+                   .Accept(visitor: this));
+                pattern = InlineMemoryPattern(value: values[index: 1]
+                   .Accept(visitor: this));
+                break;
+            default:
+                addresses.Add(item: values[index: 0]
+                   .Accept(visitor: this));
+                break;
+        }
+
+        result = resultTemp;
+        if (size == 0)
+        {
+            return true;
+        }
+
+        List<string> pointers = addresses.Select(selector: InlineMemoryPointer)
+                                         .ToList();
+        string skip = GetNextTemp();
+        _output.AppendLine(handler: $"  {skip} = icmp eq ptr {pointers[index: 0]}, null");
+        if (pointers.Count > 1)
+        {
+            string destinationNull = GetNextTemp();
+            string eitherNull = GetNextTemp();
+            _output.AppendLine(handler: $"  {destinationNull} = icmp eq ptr {pointers[index: 1]}, null");
+            _output.AppendLine(handler: $"  {eitherNull} = or i1 {skip}, {destinationNull}");
+            skip = eitherNull;
+        }
+
+        string bodyLabel = GetNextLabel();
+        string doneLabel = GetNextLabel();
+        _output.AppendLine(handler: $"  br i1 {skip}, label %{doneLabel}, label %{bodyLabel}");
+        _output.AppendLine(handler: $"{bodyLabel}:");
+        if (operation == "memory_copy")
+        {
+            _memoryDeclarations.Add(item: "declare void @llvm.memmove.p0.p0.i64(ptr, ptr, i64, i1)");
+            _output.AppendLine(
+                handler:
+                $"  call void @llvm.memmove.p0.p0.i64(ptr {pointers[index: 1]}, ptr {pointers[index: 0]}, i64 {size}, i1 false)");
+        }
+        else
+        {
+            _memoryDeclarations.Add(item: "declare void @llvm.memset.p0.i64(ptr, i8, i64, i1)");
+            _output.AppendLine(
+                handler:
+                $"  call void @llvm.memset.p0.i64(ptr {pointers[index: 0]}, i8 {pattern}, i64 {size}, i1 false)");
+        }
+
+        _output.AppendLine(handler: $"  br label %{doneLabel}");
+        _output.AppendLine(handler: $"{doneLabel}:");
+        return true;
+    }
+
+    private static bool TryGetLiteralSize(Expression expression, out long size)
+    {
+        size = 0;
+        if (expression is not LiteralExpression literal)
+        {
+            return false;
+        }
+
+        BigInteger? value = literal.Value switch
+        {
+            int v => v,
+            long v => v,
+            uint v => v,
+            ulong v => v,
+            short v => v,
+            ushort v => v,
+            byte v => v,
+            sbyte v => v,
+            BigInteger v => v,
+            _ => null
+        };
+        if (value == null || value < 0 || value > long.MaxValue)
+        {
+            return false;
+        }
+
+        size = (long)value.Value;
+        return true;
+    }
+
+    // Addresses are uaddr integers; a value already typed as a pointer passes through
+    private string InlineMemoryPointer(string address)
+    {
+        string type = _tempTypes.TryGetValue(key: address, value: out TypeInfo? info)
+            ? info.LLVMType
+            : "i64";
+        if (type == "ptr")
+        {
+            return address;
+        }
+
+        string pointer = GetNextTemp();
+        _output.AppendLine(handler: $"  {pointer} = inttoptr {type} {address} to ptr");
+        return pointer;
+    }
+
+    // memory_fill uses the low byte of the pattern, as the runtime does
+    private string InlineMemoryPattern(string value)
+    {
+        if (long.TryParse(s: value, result: out long constant))
+        {
+            return ((byte)(constant & 0xFF)).ToString();
+        }
+
+        string type = _tempTypes.TryGetValue(key: value, value: out TypeInfo? info)
+            ? info.LLVMType
+            : "i64";
+        if (type == "i8")
+        {
+            return value;
+        }
+
+        string low = GetNextTemp();
+        _output.AppendLine(handler: $"  {low} = trunc {type} {value} to i8");
+        return low;
+    }
+
+    private void EmitMemoryDeclarations()
+    {
+        if (_memoryDeclarations.Count == 0)
+        {
+            return;
+        }
+
+        _output.AppendLine();
+        _output.AppendLine(value: "; Memory intrinsic declarations");
+        foreach (string declaration in _memoryDeclarations)
+        {
+            _output.AppendLine(value: declaration);
+        }
+    }
+}
@@ -37,6 +37,14 @@ public partial class LLVMCodeGenerator
                     resultTemp: resultTemp);
             }
 
+            // Check for Serializable record message intrinsics
+            if (IsWireIntrinsic(functionName: functionName))
+            {
+                return HandleWireIntrinsic(node: node,
+                    functionName: functionName,
+                    resultTemp: resultTemp);
+            }
+
             // Check for user-defined generic function
             if (_genericFunctionTemplates.ContainsKey(key: functionName))
             {
@@ -84,11 +92,28 @@ public partial class LLVMCodeGenerator
         switch (node.MethodName)
         {
             case "read":
+                // Bounds-checked unaligned load (native/runtime/slice.c)
                 string offsetTemp = node.Arguments[index: 0]
                                         .Accept(visitor: this);
-                _output.AppendLine(
-                    handler:
-                    $"  {resultTemp} = call {llvmType} @memory_read_{typeArg.Name}(ptr {objectTemp}, i64 {offsetTemp})");
+                // rf_f16 is a uint16_t in C, returned in a GPR; `half` would come back in XMM0
+                if (llvmType == "half")
+                {
+                    string rawHalf = GetNextTemp();
+                    _memoryDeclarations.Add(item: "declare i16 @memory_read_f16(ptr, i64)");
+                    _output.AppendLine(
+                        handler:
+                        $"  {rawHalf} = call i16 @memory_read_f16(ptr {objectTemp}, i64 {offsetTemp})");
+                    _output.AppendLine(handler: $"  {resultTemp} = bitcast i16 {rawHalf} to half");
+                }
+                else
+                {
+                    _memoryDeclarations.Add(
+                        item: $"declare {llvmType} @memory_read_{typeArg.Name}(ptr, i64)");
+                    _output.AppendLine(
+                        handler:
+                        $"  {resultTemp} = call {llvmType} @memory_read_{typeArg.Name}(ptr {objectTemp}, i64 {offsetTemp})");
+                }
+
                 _tempTypes[key: resultTemp] = new TypeInfo(
                     LLVMType: MapRazorForgeTypeToLLVM(razorForgeType: typeArg.Name),
                     IsUnsigned: false,
@@ -101,9 +126,24 @@ public partial class LLVMCodeGenerator
                                              .Accept(visitor: this);
                 string valueTemp = node.Arguments[index: 1]
                                        .Accept(visitor: this);
-                _output.AppendLine(
-                    handler:
-                    $"  call void @memory_write_{typeArg.Name}(ptr {objectTemp}, i64 {writeOffsetTemp}, {llvmType} {valueTemp})");
+                if (llvmType == "half")
+                {
+                    string halfBits = GetNextTemp();
+                    _output.AppendLine(handler: $"  {halfBits} = bitcast half {valueTemp} to i16");
+                    _memoryDeclarations.Add(item: "declare void @memory_write_f16(ptr, i64, i16)");
+                    _output.AppendLine(
+                        handler:
+                        $"  call void @memory_write_f16(ptr {objectTemp}, i64 {writeOffsetTemp}, i16 {halfBits})");
+                }
+                else
+                {
+                    _memoryDeclarations.Add(
+                        item: $"declare void @memory_write_{typeArg.Name}(ptr, i64, {llvmType})");
+                    _output.AppendLine(
+                        handler:
+                        $"  call void @memory_write_{typeArg.Name}(ptr {objectTemp}, i64 {writeOffsetTemp}, {llvmType} {valueTemp})");
+                }
+
                 resultTemp = ""; // void return
                 break;
 
@@ -351,12 +391,16 @@ public partial class LLVMCodeGenerator
         {
             return EmitMemoryIntrinsic(node: node, resultTemp: resultTemp);
         }
-        // Arithmetic operations - both with suffixes (add.wrapping) and bare (add, sdiv, neg)
+        // Arithmetic operations - both with suffixes (add.wrapping, shl.saturating) and bare (add, sdiv, neg)
         else if (intrinsicName.StartsWith(value: "add.") ||
                  intrinsicName.StartsWith(value: "sub.") ||
                  intrinsicName.StartsWith(value: "mul.") ||
                  intrinsicName.StartsWith(value: "div.") ||
-                 intrinsicName.StartsWith(value: "rem.") || intrinsicName == "add" ||
+                 intrinsicName.StartsWith(value: "rem.") ||
+                 intrinsicName.StartsWith(value: "neg.") ||
+                 intrinsicName.StartsWith(value: "abs.") ||
+                 intrinsicName.StartsWith(value: "shl.") ||
+                 intrinsicName.StartsWith(value: "shr.") || intrinsicName == "add" ||
                  intrinsicName == "sub" || intrinsicName == "mul" || intrinsicName == "sdiv" ||
                  intrinsicName == "udiv" || intrinsicName == "srem" || intrinsicName == "urem" ||
                  intrinsicName == "neg")
@@ -381,12 +425,7 @@ public partial class LLVMCodeGenerator
         {
             return EmitConversionIntrinsic(node: node, resultTemp: resultTemp);
         }
-        else if (intrinsicName == "sqrt" || intrinsicName == "abs" || intrinsicName == "fabs" ||
-                 intrinsicName == "copysign" || intrinsicName == "floor" ||
-                 intrinsicName == "ceil" || intrinsicName == "trunc_float" ||
-                 intrinsicName == "round" || intrinsicName == "pow" || intrinsicName == "exp" ||
-                 intrinsicName == "log" || intrinsicName == "log10" || intrinsicName == "sin" ||
-                 intrinsicName == "cos")
+        else if (IsMathIntrinsic(intrinsicName: intrinsicName))
         {
             return EmitMathIntrinsic(node: node, resultTemp: resultTemp);
         }
@@ -0,0 +1,629 @@
+using System.Text;
+using Compilers.Shared.AST;
+
+namespace Compilers.Shared.CodeGen;
+
+/// <summary>
+/// Partial class generating zero-copy binary messages for records that follow
+/// <c>Serializable</c>. The layout (native/include/razorforge_wire.h) is fixed per record at
+/// compile time: a writer and a size function are emitted next to the record type, and
+/// <c>wire_read&lt;T&gt;(address, "field")</c> becomes a single load at a constant offset, so
+/// a validated buffer is read in place with no parse step.
+/// </summary>
+public partial class LLVMCodeGenerator
+{
+    private const int WireHeaderSize = 32;
+    private const uint WireMagic = 0x31574652; // "RFW1"
+    private const int WirePayloadAlignment = 16;
+
+    // List<T> as stdlib/Collections/List.rf lays it out:
+    // data (DynamicSlice: starting_address, allocated_bytes), count, capacity
+    private const int ListDataAddressOffset = 0;
+    private const int ListCountOffset = 16;
+
+    /// <summary>
+    /// One record field on the wire. Offset is from the message start; for variable fields it
+    /// is the offset of the (u32 offset, u32 length) slot, and Size is the element size.
+    /// </summary>
+    private record WireField(
+        string Name,
+        string RazorForgeType,
+        string LLVMType,
+        int StructIndex,
+        bool IsVariable,
+        bool IsText,
+        int Size,
+        int Offset);
+
+    private record WireLayout(
+        string RecordName,
+        List<WireField> Fields,
+        int FixedSize,
+        int Alignment,
+        int SlotCount,
+        ulong SchemaId);
+
+    // Layouts of the Serializable records emitted so far, by record name
+    private readonly Dictionary<string, WireLayout> _wireLayouts = new();
+
+    private readonly SortedSet<string> _wireDeclarations = new(comparer: StringComparer.Ordinal);
+    private bool _wireHelpersEmitted;
+
+    private static bool FollowsSerializable(StructDeclaration node)
+    {
+        return node.Interfaces?.Any(predicate: i => i.Name == "Serializable") ?? false;
+    }
+
+    // Full source spelling of a type, e.g. List<s32>, used in errors and in the schema id
+    private static string WireTypeName(TypeExpression type)
+    {
+        if (type.GenericArguments == null || type.GenericArguments.Count == 0)
+        {
+            return type.Name;
+        }
+
+        return
+            $"{type.Name}<{string.Join(separator: ", ", values: type.GenericArguments.Select(selector: WireTypeName))}>";
+    }
+
+    /// <summary>
+    /// Size and wire LLVM type of a scalar field type, or null if it has none. bool travels as
+    /// a byte. Addresses are not portable between processes and are rejected.
+    /// </summary>
+    private static (int Size, string LLVMType)? WireScalar(string typeName)
+    {
+        return typeName switch
+        {
+            "s8" or "u8" or "letter8" => (1, "i8"),
+            "bool" => (1, "i8"),
+            "s16" or "u16" or "letter16" => (2, "i16"),
+            "f16" => (2, "half"),
+            "s32" or "u32" or "letter32" or "letter" => (4, "i32"),
+            "f32" => (4, "float"),
+            "s64" or "u64" => (8, "i64"),
+            "f64" => (8, "double"),
+            "s128" or "u128" => (16, "i128"),
+            "f128" => (16, "fp128"),
+            _ => null
+        };
+    }
+
+    // 64-bit FNV-1a; never 0, which rf_wire_schema reserves for "not a message"
+    private static ulong WireSchemaHash(string schema)
+    {
+        ulong hash = 0xCBF29CE484222325;
+        foreach (byte b in Encoding.UTF8.GetBytes(s: schema))
+        {
+            hash = (hash ^ b) * 0x100000001B3;
+        }
+
+        return hash == 0 ? 1 : hash;
+    }
+
+    private static int AlignUp(int value, int alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    /// <summary>
+    /// Computes the wire layout of a Serializable record: variable slots first, then scalars by
+    /// decreasing alignment so padding only appears at the end of the fixed section.
+    /// </summary>
+    private WireLayout BuildWireLayout(StructDeclaration node, string typeName,
+        List<(string Name, string Type)> structFields)
+    {
+        var declarations = node.Members
+                               .OfType<VariableDeclaration>()
+                               .ToList();
+        var variable = new List<WireField>();
+        var scalars = new List<WireField>();
+
+        for (int i = 0; i < declarations.Count; i++)
+        {
+            VariableDeclaration field = declarations[index: i];
+            if (field.Type == null)
+            {
+                throw new InvalidOperationException(
+                    message: $"Serializable record {typeName}: field {field.Name} needs a declared type");
+            }
+
+            string rfType = WireTypeName(type: field.Type);
+            List<TypeExpression> arguments = field.Type.GenericArguments ?? new List<TypeExpression>();
+            string llvmType = structFields[index: i].Type;
+
+            if (field.Type.Name == "Text" &&
+                (arguments.Count == 0 || arguments[index: 0].Name == "letter8"))
+            {
+                variable.Add(item: new WireField(Name: field.Name,
+                    RazorForgeType: rfType,
+                    LLVMType: llvmType,
+                    StructIndex: i,
+                    IsVariable: true,
+                    IsText: true,
+                    Size: 1,
+                    Offset: 0));
+            }
+            else if (field.Type.Name == "List" && arguments.Count == 1 &&
+                     WireScalar(typeName: arguments[index: 0].Name) is { } element)
+            {
+                variable.Add(item: new WireField(Name: field.Name,
+                    RazorForgeType: rfType,
+                    LLVMType: llvmType,
+                    StructIndex: i,
+                    IsVariable: true,
+                    IsText: false,
+                    Size: element.Size,
+                    Offset: 0));
+            }
+            else if (arguments.Count == 0 && WireScalar(typeName: field.Type.Name) is { } scalar)
+            {
+                scalars.Add(item: new WireField(Name: field.Name,
+                    RazorForgeType: rfType,
+                    LLVMType: llvmType,
+                    StructIndex: i,
+                    IsVariable: false,
+                    IsText: false,
+                    Size: scalar.Size,
+                    Offset: 0));
+            }
+            else
+            {
+                throw new InvalidOperationException(
+                    message:
+                    $"Serializable record {typeName}: field {field.Name}: {rfType} has no wire form " +
+                    "(use integers, floats, bool, letters, Text<letter8> or a List of those)");
+            }
+        }
+
+        var fields = new List<WireField>();
+        int cursor = 0;
+        foreach (WireField slot in variable)
+        {
+            fields.Add(item: slot with { Offset = WireHeaderSize + cursor });
+            cursor += 8;
+        }
+
+        // OrderByDescending is stable, so equal sizes keep declaration order
+        foreach (WireField scalar in scalars.OrderByDescending(keySelector: f => f.Size))
+        {
+            cursor = AlignUp(value: cursor, alignment: scalar.Size);
+            fields.Add(item: scalar with { Offset = WireHeaderSize + cursor });
+            cursor += scalar.Size;
+        }
+
+        // Slots are read as u32; payload elements need their own alignment too
+        int alignment = Math.Max(
+            val1: variable.Count > 0 ? variable.Max(selector: f => Math.Max(val1: f.Size, val2: 4)) : 1,
+            val2: scalars.Count > 0 ? scalars.Max(selector: f => f.Size) : 1);
+
+        // Any change to the name, order, names or types of the fields changes the id
+        string schema =
+            $"{typeName}{{{string.Join(separator: ";", values: declarations.Select(selector: d => $"{d.Name}:{WireTypeName(type: d.Type!)}"))}}}";
+
+        return new WireLayout(RecordName: typeName,
+            Fields: fields,
+            FixedSize: AlignUp(value: cursor, alignment: 8),
+            Alignment: alignment,
+            SlotCount: variable.Count,
+            SchemaId: WireSchemaHash(schema: schema));
+    }
+
+    /// <summary>
+    /// Emits <c>@T.__wire_size</c> and <c>@T.__wire_write</c> for a Serializable record.
+    /// Called from GenerateRecordType at module level, right after the type definition.
+    /// </summary>
+    private void EmitWireFunctions(StructDeclaration node, string typeName,
+        List<(string Name, string Type)> structFields)
+    {
+        WireLayout layout = BuildWireLayout(node: node, typeName: typeName, structFields: structFields);
+        _wireLayouts[key: typeName] = layout;
+        EmitWireHelpers();
+
+        var variable = layout.Fields
+                             .Where(predicate: f => f.IsVariable)
+                             .ToList();
+        int payloadStart = WireHeaderSize + layout.FixedSize;
+
+        _output.AppendLine(
+            handler:
+            $"; Wire layout of {typeName}: schema 0x{layout.SchemaId:X16}, fixed {layout.FixedSize} bytes, align {layout.Alignment}");
+        foreach (WireField field in layout.Fields)
+        {
+            _output.AppendLine(
+                handler:
+                $";   {field.Offset,4}  {field.Name}: {field.RazorForgeType}{(field.IsVariable ? " (slot)" : "")}");
+        }
+
+        // Size: payloads start 16-byte aligned and end in a zero byte
+        _output.AppendLine(handler: $"define i64 @{typeName}.__wire_size(%{typeName} %value) {{");
+        _output.AppendLine(value: "entry:");
+        string position = payloadStart.ToString();
+        for (int j = 0; j < variable.Count; j++)
+        {
+            EmitWirePayloadLength(typeName: typeName, field: variable[index: j], index: j);
+            _output.AppendLine(handler: $"  %start{j}.up = add i64 {position}, {WirePayloadAlignment - 1}");
+            _output.AppendLine(handler: $"  %start{j} = and i64 %start{j}.up, {-WirePayloadAlignment}");
+            _output.AppendLine(handler: $"  %end{j} = add i64 %start{j}, %length{j}");
+            _output.AppendLine(handler: $"  %next{j} = add i64 %end{j}, 1");
+            position = $"%next{j}";
+        }
+
+        _output.AppendLine(handler: $"  ret i64 {position}");
+        _output.AppendLine(value: "}");
+        _output.AppendLine();
+
+        // Writer: returns the message size, or 0 if it does not fit in capacity (or in u32)
+        _output.AppendLine(
+            handler: $"define i64 @{typeName}.__wire_write(%{typeName} %value, ptr %dest, i64 %capacity) {{");
+        _output.AppendLine(value: "entry:");
+        _output.AppendLine(handler: $"  %size = call i64 @{typeName}.__wire_size(%{typeName} %value)");
+        _output.AppendLine(value: "  %fits = icmp ule i64 %size, %capacity");
+        _output.AppendLine(value: "  %representable = icmp ule i64 %size, 4294967295");
+        _output.AppendLine(value: "  %ok = and i1 %fits, %representable");
+        _output.AppendLine(value: "  br i1 %ok, label %write, label %full");
+        _output.AppendLine(value: "full:");
+        _output.AppendLine(value: "  ret i64 0");
+        _output.AppendLine(value: "write:");
+
+        // Zeroing first leaves padding and the payload terminators deterministic
+        _output.AppendLine(value: "  call void @llvm.memset.p0.i64(ptr %dest, i8 0, i64 %size, i1 false)");
+        _output.AppendLine(handler: $"  store i32 {WireMagic}, ptr %dest, align 1");
+        EmitWireStore(target: "fixed", offset: 4, llvmType: "i32", value: layout.FixedSize.ToString());
+        EmitWireStore(target: "schema", offset: 8, llvmType: "i64",
+            value: unchecked((long)layout.SchemaId).ToString());
+        _output.AppendLine(value: "  %size32 = trunc i64 %size to i32");
+        EmitWireStore(target: "total", offset: 16, llvmType: "i32", value: "%size32");
+        EmitWireStore(target: "slots", offset: 20, llvmType: "i16", value: layout.SlotCount.ToString());
+
+        foreach (WireField field in layout.Fields.Where(predicate: f => !f.IsVariable))
+        {
+            string value = $"%field.{field.Name}";
+            _output.AppendLine(
+                handler: $"  {value} = extractvalue %{typeName} %value, {field.StructIndex}");
+            var (_, wireType) = WireScalar(typeName: field.RazorForgeType)!.Value;
+            if (field.RazorForgeType == "bool")
+            {
+                _output.AppendLine(handler: $"  {value}.byte = zext i1 {value} to i8");
+                value = $"{value}.byte";
+            }
+
+            EmitWireStore(target: $"field.{field.Name}", offset: field.Offset, llvmType: wireType,
+                value: value);
+        }
+
+        position = payloadStart.ToString();
+        for (int j = 0; j < variable.Count; j++)
+        {
+            WireField field = variable[index: j];
+            EmitWirePayloadLength(typeName: typeName, field: field, index: j);
+            _output.AppendLine(handler: $"  %start{j}.up = add i64 {position}, {WirePayloadAlignment - 1}");
+            _output.AppendLine(handler: $"  %start{j} = and i64 %start{j}.up, {-WirePayloadAlignment}");
+            _output.AppendLine(handler: $"  %end{j} = add i64 %start{j}, %length{j}");
+            _output.AppendLine(handler: $"  %next{j} = add i64 %end{j}, 1");
+            position = $"%next{j}";
+
+            string source = field.IsText
+                ? $"%field{j}"
+                : $"%data{j}";
+            if (!field.IsText)
+            {
+                _output.AppendLine(handler: $"  %data{j} = call ptr @__wire_list_data(ptr %field{j})");
+            }
+
+            _output.AppendLine(handler: $"  %payload{j} = getelementptr inbounds i8, ptr %dest, i64 %start{j}");
+            _output.AppendLine(
+                handler:
+                $"  call void @llvm.memcpy.p0.p0.i64(ptr %payload{j}, ptr {source}, i64 %length{j}, i1 false)");
+            _output.AppendLine(handler: $"  %start{j}.32 = trunc i64 %start{j} to i32");
+            _output.AppendLine(handler: $"  %length{j}.32 = trunc i64 %length{j} to i32");
+            EmitWireStore(target: $"slot{j}", offset: field.Offset, llvmType: "i32", value: $"%start{j}.32");
+            EmitWireStore(target: $"slot{j}.length", offset: field.Offset + 4, llvmType: "i32",
+                value: $"%length{j}.32");
+        }
+
+        _output.AppendLine(value: "  ret i64 %size");
+        _output.AppendLine(value: "}");
+        _output.AppendLine();
+    }
+
+    // %field{index} and its payload size in bytes, %length{index}
+    private void EmitWirePayloadLength(string typeName, WireField field, int index)
+    {
+        _output.AppendLine(
+            handler: $"  %field{index} = extractvalue %{typeName} %value, {field.StructIndex}");
+        _output.AppendLine(value: field.IsText
+            ? $"  %length{index} = call i64 @__wire_text_length(ptr %field{index})"
+            : $"  %length{index} = call i64 @__wire_list_bytes(ptr %field{index}, i64 {field.Size})");
+    }
+
+    private void EmitWireStore(string target, int offset, string llvmType, string value)
+    {
+        _output.AppendLine(handler: $"  %at.{target} = getelementptr inbounds i8, ptr %dest, i64 {offset}");
+        _output.AppendLine(handler: $"  store {llvmType} {value}, ptr %at.{target}, align 1");
+    }
+
+    /// <summary>
+    /// Private helpers shared by every writer in the module: Text length (null is empty) and
+    /// the byte size and element address of a List.
+    /// </summary>
+    private void EmitWireHelpers()
+    {
+        if (_wireHelpersEmitted)
+        {
+            return;
+        }
+
+        _wireHelpersEmitted = true;
+        _wireDeclarations.Add(item: "declare i64 @strlen(ptr)");
+        _memoryDeclarations.Add(item: "declare void @llvm.memcpy.p0.p0.i64(ptr, ptr, i64, i1)");
+        _memoryDeclarations.Add(item: "declare void @llvm.memset.p0.i64(ptr, i8, i64, i1)");
+
+        _output.AppendLine(value: "define private i64 @__wire_text_length(ptr %text) {");
+        _output.AppendLine(value: "entry:");
+        _output.AppendLine(value: "  %none = icmp eq ptr %text, null");
+        _output.AppendLine(value: "  br i1 %none, label %empty, label %measure");
+        _output.AppendLine(value: "empty:");
+        _output.AppendLine(value: "  ret i64 0");
+        _output.AppendLine(value: "measure:");
+        _output.AppendLine(value: "  %length = call i64 @strlen(ptr %text)");
+        _output.AppendLine(value: "  ret i64 %length");
+        _output.AppendLine(value: "}");
+        _output.AppendLine();
+
+        _output.AppendLine(value: "define private i64 @__wire_list_bytes(ptr %list, i64 %element_size) {");
+        _output.AppendLine(value: "entry:");
+        _output.AppendLine(value: "  %none = icmp eq ptr %list, null");
+        _output.AppendLine(value: "  br i1 %none, label %empty, label %measure");
+        _output.AppendLine(value: "empty:");
+        _output.AppendLine(value: "  ret i64 0");
+        _output.AppendLine(value: "measure:");
+        _output.AppendLine(
+            handler: $"  %count.at = getelementptr inbounds i8, ptr %list, i64 {ListCountOffset}");
+        _output.AppendLine(value: "  %count = load i64, ptr %count.at, align 8");
+        _output.AppendLine(value: "  %bytes = mul i64 %count, %element_size");
+        _output.AppendLine(value: "  ret i64 %bytes");
+        _output.AppendLine(value: "}");
+        _output.AppendLine();
+
+        _output.AppendLine(value: "define private ptr @__wire_list_data(ptr %list) {");
+        _output.AppendLine(value: "entry:");
+        _output.AppendLine(value: "  %none = icmp eq ptr %list, null");
+        _output.AppendLine(value: "  br i1 %none, label %empty, label %read");
+        _output.AppendLine(value: "empty:");
+        _output.AppendLine(value: "  ret ptr null");
+        _output.AppendLine(value: "read:");
+        _output.AppendLine(
+            handler: $"  %address.at = getelementptr inbounds i8, ptr %list, i64 {ListDataAddressOffset}");
+        _output.AppendLine(value: "  %address = load i64, ptr %address.at, align 8");
+        _output.AppendLine(value: "  %data = inttoptr i64 %address to ptr");
+        _output.AppendLine(value: "  ret ptr %data");
+        _output.AppendLine(value: "}");
+        _output.AppendLine();
+    }
+
+    private void EmitWireDeclarations()
+    {
+        if (_wireDeclarations.Count == 0)
+        {
+            return;
+        }
+
+        _output.AppendLine();
+        _output.AppendLine(value: "; Serialization declarations");
+        foreach (string declaration in _wireDeclarations)
+        {
+            _output.AppendLine(value: declaration);
+        }
+    }
+
+    // ========================================================================
+    // wire_* intrinsics (stdlib/Serialize.rf)
+    // ========================================================================
+
+    private static bool IsWireIntrinsic(string functionName)
+    {
+        return functionName is "wire_schema" or "wire_size" or "wire_write" or "wire_check"
+            or "wire_read" or "wire_count";
+    }
+
+    private string HandleWireIntrinsic(GenericMethodCallExpression node, string functionName,
+        string resultTemp)
+    {
+        if (node.TypeArguments.Count == 0)
+        {
+            throw new InvalidOperationException(
+                message: $"{functionName} requires the record type as its type argument");
+        }
+
+        string recordName = node.TypeArguments[index: 0].Name;
+        if (_currentTypeSubstitutions != null &&
+            _currentTypeSubstitutions.TryGetValue(key: recordName, value: out string? concrete))
+        {
+            recordName = concrete;
+        }
+
+        if (!_wireLayouts.TryGetValue(key: recordName, value: out WireLayout? layout))
+        {
+            throw new InvalidOperationException(
+                message: $"{functionName}<{recordName}>: {recordName} is not a record that follows Serializable");
+        }
+
+        List<Expression> arguments = node.Arguments
+                                         .Select(selector: a => a is NamedArgumentExpression named
+                                              ? named.Value
+                                              : a)
+                                         .ToList();
+
+        switch (functionName)
+        {
+            case "wire_schema":
+                _output.AppendLine(
+                    handler: $"  {resultTemp} = add i64 0, {unchecked((long)layout.SchemaId)}");
+                SetWireResultType(resultTemp: resultTemp, llvmType: "i64", rfType: "u64");
+                return resultTemp;
+
+            case "wire_size":
+            {
+                string value = arguments[index: 0]
+                   .Accept(visitor: this);
+                _output.AppendLine(
+                    handler:
+                    $"  {resultTemp} = call i64 @{recordName}.__wire_size(%{recordName} {value})");
+                SetWireResultType(resultTemp: resultTemp, llvmType: "i64", rfType: "uaddr");
+                return resultTemp;
+            }
+
+            case "wire_write":
+            {
+                string value = arguments[index: 0]
+                   .Accept(visitor: this);
+                string address = arguments[index: 1]
+                   .Accept(visitor: this);
+                string capacity = arguments[index: 2]
+                   .Accept(visitor: this);
+                string dest = GetNextTemp();
+                _output.AppendLine(handler: $"  {dest} = inttoptr i64 {address} to ptr");
+                _output.AppendLine(
+                    handler:
+                    $"  {resultTemp} = call i64 @{recordName}.__wire_write(%{recordName} {value}, ptr {dest}, i64 {capacity})");
+                SetWireResultType(resultTemp: resultTemp, llvmType: "i64", rfType: "uaddr");
+                return resultTemp;
+            }
+
+            case "wire_check":
+            {
+                string address = arguments[index: 0]
+                   .Accept(visitor: this);
+                string size = arguments[index: 1]
+                   .Accept(visitor: this);
+                string data = GetNextTemp();
+                _wireDeclarations.Add(item: "declare i32 @rf_wire_check(ptr, i64, i64, i32, i32, i32)");
+                _output.AppendLine(handler: $"  {data} = inttoptr i64 {address} to ptr");
+                _output.AppendLine(
+                    handler:
+                    $"  {resultTemp} = call i32 @rf_wire_check(ptr {data}, i64 {size}, i64 {unchecked((long)layout.SchemaId)}, i32 {layout.FixedSize}, i32 {layout.SlotCount}, i32 {layout.Alignment})");
+                SetWireResultType(resultTemp: resultTemp, llvmType: "i32", rfType: "s32");
+                return resultTemp;
+            }
+
+            case "wire_read":
+            case "wire_count":
+                return EmitWireFieldRead(layout: layout,
+                    functionName: functionName,
+                    readType: node.TypeArguments.Count > 1
+                        ? WireTypeName(type: node.TypeArguments[index: 1])
+                        : null,
+                    arguments: arguments,
+                    resultTemp: resultTemp);
+
+            default:
+                throw new NotImplementedException(
+                    message: $"Wire intrinsic {functionName} not implemented");
+        }
+    }
+
+    /// <summary>
+    /// Reads a field of a checked message in place. Scalars are one aligned load; Text returns
+    /// a pointer to its zero-terminated bytes inside the message, List the address of its first
+    /// element, and wire_count the number of elements (bytes for Text).
+    /// </summary>
+    private string EmitWireFieldRead(WireLayout layout, string functionName, string? readType,
+        List<Expression> arguments, string resultTemp)
+    {
+        if (arguments.Count != 2 || arguments[index: 1] is not LiteralExpression { Value: string fieldName })
+        {
+            throw new InvalidOperationException(
+                message: $"{functionName}<{layout.RecordName}> takes a message address and a field name literal");
+        }
+
+        WireField field = layout.Fields.FirstOrDefault(predicate: f => f.Name == fieldName) ??
+                          throw new InvalidOperationException(
+                              message: $"{layout.RecordName} has no field named {fieldName}");
+
+        // The type the caller asked for must be the declared one (uaddr for Lists)
+        string fieldType = field.IsVariable && !field.IsText
+            ? "uaddr"
+            : field.RazorForgeType;
+        if (functionName == "wire_read" && readType != null && readType != fieldType &&
+            !(field.IsText && readType is "Text" or "Text<letter8>"))
+        {
+            throw new InvalidOperationException(
+                message: $"wire_read: {layout.RecordName}.{fieldName} is read as {fieldType}, not {readType}");
+        }
+
+        string address = arguments[index: 0]
+           .Accept(visitor: this);
+        string message = GetNextTemp();
+        string at = GetNextTemp();
+        _output.AppendLine(handler: $"  {message} = inttoptr i64 {address} to ptr");
+
+        if (functionName == "wire_count")
+        {
+            if (!field.IsVariable)
+            {
+                throw new InvalidOperationException(
+                    message: $"wire_count: {layout.RecordName}.{fieldName} is not a Text or List");
+            }
+
+            string length = GetNextTemp();
+            string bytes = GetNextTemp();
+            _output.AppendLine(
+                handler: $"  {at} = getelementptr inbounds i8, ptr {message}, i64 {field.Offset + 4}");
+            _output.AppendLine(handler: $"  {length} = load i32, ptr {at}, align 4");
+            _output.AppendLine(handler: $"  {bytes} = zext i32 {length} to i64");
+            _output.AppendLine(
+                handler:
+                $"  {resultTemp} = lshr i64 {bytes}, {System.Numerics.BitOperations.Log2(value: (uint)field.Size)}");
+            SetWireResultType(resultTemp: resultTemp, llvmType: "i64", rfType: "uaddr");
+            return resultTemp;
+        }
+
+        _output.AppendLine(
+            handler: $"  {at} = getelementptr inbounds i8, ptr {message}, i64 {field.Offset}");
+
+        if (field.IsVariable)
+        {
+            string offset32 = GetNextTemp();
+            string offset = GetNextTemp();
+            _output.AppendLine(handler: $"  {offset32} = load i32, ptr {at}, align 4");
+            _output.AppendLine(handler: $"  {offset} = zext i32 {offset32} to i64");
+            if (field.IsText)
+            {
+                _output.AppendLine(
+                    handler: $"  {resultTemp} = getelementptr inbounds i8, ptr {message}, i64 {offset}");
+                SetWireResultType(resultTemp: resultTemp, llvmType: "i8*", rfType: "Text<letter8>");
+                return resultTemp;
+            }
+
+            _output.AppendLine(handler: $"  {resultTemp} = add i64 {address}, {offset}");
+            SetWireResultType(resultTemp: resultTemp, llvmType: "i64", rfType: "uaddr");
+            return resultTemp;
+        }
+
+        var (size, wireType) = WireScalar(typeName: field.RazorForgeType)!.Value;
+        if (field.RazorForgeType == "bool")
+        {
+            string raw = GetNextTemp();
+            _output.AppendLine(handler: $"  {raw} = load i8, ptr {at}, align 1");
+            _output.AppendLine(handler: $"  {resultTemp} = icmp ne i8 {raw}, 0");
+            SetWireResultType(resultTemp: resultTemp, llvmType: "i1", rfType: "bool");
+            return resultTemp;
+        }
+
+        // rf_wire_check verified the message is aligned for the record's widest field
+        _output.AppendLine(handler: $"  {resultTemp} = load {wireType}, ptr {at}, align {size}");
+        _tempTypes[key: resultTemp] = new TypeInfo(LLVMType: wireType,
+            IsUnsigned: field.RazorForgeType.StartsWith(value: 'u'),
+            IsFloatingPoint: IsFloatingPointType(llvmType: wireType),
+            RazorForgeType: field.RazorForgeType);
+        return resultTemp;
+    }
+
+    private void SetWireResultType(string resultTemp, string llvmType, string rfType)
+    {
+        _tempTypes[key: resultTemp] = new TypeInfo(LLVMType: llvmType,
+            IsUnsigned: rfType.StartsWith(value: 'u'),
+            IsFloatingPoint: false,
+            RazorForgeType: rfType);
+    }
+}
@@ -57,6 +57,10 @@ public partial class LLVMCodeGenerator
         string bodyLabel = GetNextLabel();
         string endLabel = GetNextLabel();
 
+        // Divisors the loop never reassigns get their divider computed once, up front
+        Dictionary<string, InvariantDivider> outerDividers =
+            HoistInvariantDividers(condition: node.Condition, body: node.Body);
+
         _output.AppendLine(handler: $"  br label %{condLabel}");
 
         _output.AppendLine(handler: $"{condLabel}:");
@@ -68,6 +72,10 @@ public partial class LLVMCodeGenerator
         _output.AppendLine(handler: $"  br label %{condLabel}");
 
         _output.AppendLine(handler: $"{endLabel}:");
+        _invariantDividers = outerDividers;
+
+        // Overflow accumulated by a sticky-overflow loop body is reported once, on exit
+        EmitStickyOverflowCheck();
 
         return "";
     }
@@ -85,6 +93,7 @@ public partial class LLVMCodeGenerator
         {
             string value = node.Value.Accept(visitor: this);
             TypeInfo valueTypeInfo = GetValueTypeInfo(value: value);
+            EmitStickyOverflowCheck();
 
             // If the value type doesn't match the function return type, we need to cast
             if (valueTypeInfo.LLVMType != _currentFunctionReturnType)
@@ -103,6 +112,7 @@ public partial class LLVMCodeGenerator
         }
         else
         {
+            EmitStickyOverflowCheck();
             _output.AppendLine(value: "  ret void");
         }
 
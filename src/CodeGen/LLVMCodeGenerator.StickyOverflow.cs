@@ -0,0 +1,72 @@
+namespace Compilers.Shared.CodeGen;
+
+/// <summary>
+/// Partial class containing sticky-overflow arithmetic for <c>@sticky_overflow</c> routines.
+/// Checked add/sub/mul OR their <c>*.with.overflow</c> flag into one routine-wide i1 instead of
+/// branching after every operation, so loop bodies stay branch-free and can be vectorized.
+/// The flag is tested once when a loop exits and once before each return.
+/// </summary>
+public partial class LLVMCodeGenerator
+{
+    // Stack slot of the sticky flag, or null when the current routine traps per operation
+    private string? _stickyOverflowFlag;
+
+    /// <summary>
+    /// Allocates and clears the sticky flag at routine entry when the routine opts in.
+    /// </summary>
+    private void BeginStickyOverflowScope(List<string> attributes)
+    {
+        _stickyOverflowFlag = null;
+        if (!attributes.Contains(item: "sticky_overflow"))
+        {
+            return;
+        }
+
+        _stickyOverflowFlag = GetNextTemp();
+        _output.AppendLine(handler: $"  {_stickyOverflowFlag} = alloca i1");
+        _output.AppendLine(handler: $"  store i1 false, ptr {_stickyOverflowFlag}");
+    }
+
+    /// <summary>
+    /// Folds one operation's overflow bit into the sticky flag.
+    /// Returns false when the routine is not in sticky mode and the caller must trap itself.
+    /// </summary>
+    private bool TryAccumulateStickyOverflow(string overflowFlag)
+    {
+        if (_stickyOverflowFlag == null)
+        {
+            return false;
+        }
+
+        string sticky = GetNextTemp();
+        string merged = GetNextTemp();
+        _output.AppendLine(handler: $"  {sticky} = load i1, ptr {_stickyOverflowFlag}");
+        _output.AppendLine(handler: $"  {merged} = or i1 {sticky}, {overflowFlag}");
+        _output.AppendLine(handler: $"  store i1 {merged}, ptr {_stickyOverflowFlag}");
+        return true;
+    }
+
+    /// <summary>
+    /// Crashes with the overflow message if any operation since routine entry overflowed.
+    /// </summary>
+    private void EmitStickyOverflowCheck()
+    {
+        if (_stickyOverflowFlag == null)
+        {
+            return;
+        }
+
+        string sticky = GetNextTemp();
+        string trapLabel = GetNextLabel();
+        string continueLabel = GetNextLabel();
+        _output.AppendLine(handler: $"  {sticky} = load i1, ptr {_stickyOverflowFlag}");
+        _output.AppendLine(
+            handler: $"  br i1 {sticky}, label %{trapLabel}, label %{continueLabel}");
+        _output.AppendLine(handler: $"{trapLabel}:");
+        _output.AppendLine(
+            value:
+            $"  call void @rf_crash(ptr getelementptr inbounds ([20 x i8], [20 x i8]* @.str_overflow, i32 0, i32 0))");
+        _output.AppendLine(value: "  unreachable");
+        _output.AppendLine(handler: $"{continueLabel}:");
+    }
+}
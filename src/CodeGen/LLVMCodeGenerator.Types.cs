@@ -55,6 +55,17 @@ public partial class LLVMCodeGenerator
         {
             if (_symbolTypes.TryGetValue(key: identExpr.Name, value: out string? llvmType))
             {
+                // The LLVM type has no sign; an unsigned declared type keeps udiv/urem/icmp u*
+                if (_symbolRfTypes.TryGetValue(key: identExpr.Name, value: out string? rfType) &&
+                    rfType is "u8" or "u16" or "u32" or "u64" or "u128" or "usys")
+                {
+                    TypeInfo declared = GetTypeInfo(typeName: rfType);
+                    if (declared.LLVMType == llvmType)
+                    {
+                        return declared;
+                    }
+                }
+
                 return GetTypeInfo(typeName: llvmType);
             }
         }
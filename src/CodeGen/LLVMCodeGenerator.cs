@@ -343,6 +343,15 @@ public partial class LLVMCodeGenerator : IAstVisitor<string>
             }
         }
 
+        // Declarations for the math intrinsics and libm functions the module used
+        EmitMathDeclarations();
+
+        // llvm.memmove/memcpy/memset for inlined memory operations and record writers
+        EmitMemoryDeclarations();
+
+        // strlen and rf_wire_check for Serializable records
+        EmitWireDeclarations();
+
         // Emit symbol tables for stack trace runtime support
         _stackTraceCodeGen?.EmitSymbolTables();
 
@@ -2,6 +2,7 @@ using System;
 using System.Collections.Generic;
 using System.IO;
 using System.Linq;
+using System.Text.RegularExpressions;
 using Xunit;
 using Compilers.Shared.AST;
 using Compilers.Shared.Analysis;
@@ -336,6 +337,353 @@ routine overflow_math() {
         Assert.NotEmpty(collection: llvmIr);
     }
 
+    [Fact]
+    public void TestSaturatingDivisionIntrinsic()
+    {
+        string code = @"
+routine clamp_div(a: s32, b: s32) -> s32 {
+    danger! {
+        return @intrinsic.div.saturating<i32>(a, b)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // MIN / -1 is steered away from the sdiv and clamped with a select; x / 0 traps
+        Assert.Contains(expectedSubstring: "sdiv i32", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "icmp eq i32 %b, -1", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "2147483647", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "icmp eq i32 %b, 0", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "label %trap.div.", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestOverflowIntrinsicTrapsOnItsFlag()
+    {
+        string code = @"
+routine checked_sum(a: s32, b: s32) -> s32 {
+    danger! {
+        return @intrinsic.add.overflow<i32>(a, b)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // The flag half of the with.overflow result is what the trap branches on
+        Match flag = Regex.Match(input: llvmIr,
+            pattern: @"(%tmp\d+) = extractvalue \{ i32, i1 \} %tmp\d+, 1");
+        Assert.True(condition: flag.Success);
+        Assert.Contains(expectedSubstring: $"br i1 {flag.Groups[groupnum: 1].Value}, label %trap.add.",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare void @llvm.trap()", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestOverflowKernelFoldsFlagIntoStickyOverflow()
+    {
+        string code = @"
+@sticky_overflow
+routine scaled(a: s32, b: s32) -> s32 {
+    danger! {
+        return @intrinsic.div.overflow<i32>(a, b)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // MIN / -1 is the quotient's overflow and goes to the sticky flag; a zero divisor
+        // still traps on the spot
+        Match flag = Regex.Match(input: llvmIr, pattern: @"(%tmp\d+) = and i1 %tmp\d+, %tmp\d+");
+        Assert.True(condition: flag.Success);
+        Assert.Matches(expectedRegexPattern: $@"or i1 %tmp\d+, {flag.Groups[groupnum: 1].Value}\b",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "label %trap.div.", actualString: llvmIr);
+        Assert.DoesNotMatch(expectedRegexPattern: @"add i32 %tmp\d+, 0\b", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestFloatMathLowersToLLVMIntrinsics()
+    {
+        string code = @"
+routine blend(a: f64, b: f64, c: f64) -> f64 {
+    danger! {
+        let root = @intrinsic.sqrt<double>(a)
+        let fused = @intrinsic.fma<double>(root, b, c)
+        return @intrinsic.tan<double>(fused)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // Intrinsics where LLVM has them, side-effect-free libm otherwise; no runtime wrappers
+        Assert.Contains(expectedSubstring: "call double @llvm.sqrt.f64(double", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare double @llvm.fma.f64(double, double, double)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare double @tan(double) nounwind readnone willreturn",
+            actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "@rf_f64_", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestQuadMathAvoidsLongDoubleLibcalls()
+    {
+        string code = @"
+routine quad_blend(a: f128, b: f128) -> f128 {
+    danger! {
+        let root = @intrinsic.sqrt<fp128>(a)
+        let whole = @intrinsic.floor<fp128>(b)
+        return @intrinsic.fabs<fp128>(root + whole)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // llvm.sqrt.f128 would lower to the x87 sqrtl; runtime and *f128 libm take real fp128
+        Assert.Contains(expectedSubstring: "call fp128 @rf_f128_sqrt(fp128", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "call fp128 @floorf128(fp128", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "@llvm.fabs.f128", actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "@llvm.sqrt.f128", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestFastMathRoutineFlagsFloatOperations()
+    {
+        string code = @"
+@fast_math
+routine fast_axpy(a: f64, x: f64, y: f64) -> f64 {
+    return a * x + y
+}
+
+routine exact_axpy(a: f64, x: f64, y: f64) -> f64 {
+    return a * x + y
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // Only the @fast_math routine lets LLVM reassociate and contract
+        Assert.Equal(expected: 1,
+            actual: llvmIr.Split(separator: "fmul reassoc nnan arcp contract afn double")
+                          .Length - 1);
+        Assert.Contains(expectedSubstring: "fadd reassoc nnan arcp contract afn double",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "fmul double", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestStrictMathRuntimeSwitchOnlyInStrictModules()
+    {
+        string code = @"
+routine main() -> s32 {
+    return 0
+}";
+
+        Assert.DoesNotContain(expectedSubstring: "@rf_math_set_strict",
+            actualString: GenerateCode(code: code));
+
+        var strictGenerator =
+            new LLVMCodeGenerator(language: Language.RazorForge, mode: LanguageMode.Normal)
+            {
+                MathMode = FloatMathMode.Strict
+            };
+        strictGenerator.Generate(program: ParseAndAnalyze(code: code));
+        string llvmIr = strictGenerator.GetGeneratedCode();
+
+        Assert.Contains(expectedSubstring: "declare void @rf_math_set_strict(i1)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "call void @rf_math_set_strict(i1 true)",
+            actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestLoopInvariantDivisorIsHoisted()
+    {
+        string code = @"
+routine bucket_of(n: u64, buckets: u64) -> u64 {
+    while n > buckets {
+        let slot = n % buckets
+    }
+    return n
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // Divider is built once before the loop and the modulo becomes a multiply-high
+        Assert.Contains(expectedSubstring: "call i64 @rf_divider_u64_magic(i64 %buckets)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare i64 @rf_divider_u64_magic(i64)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "mul i128", actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "urem i64", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestHoistedDivisionTrapsOnZeroDivisor()
+    {
+        string code = @"
+routine bucket_of(n: u64, buckets: u64) -> u64 {
+    while n > buckets {
+        let slot = n // buckets
+    }
+    return n
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // The divider passes n through for zero, so the division itself checks and traps
+        Assert.Contains(expectedSubstring: "icmp eq i64 %buckets, 0", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "label %trap.div.", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "call void @llvm.trap()", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare void @llvm.trap()", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestDivisorReassignedInWhenClauseIsNotHoisted()
+    {
+        string code = @"
+routine bucket_of(n: u64, buckets: u64) -> u64 {
+    var divisor = buckets
+    while n > divisor {
+        let slot = n % divisor
+        when slot {
+            0 => {
+                divisor = divisor + 1
+            }
+            _ => {
+            }
+        }
+    }
+    return n
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // The write inside the when clause keeps the plain urem and its divider undeclared
+        Assert.Contains(expectedSubstring: "urem i64", actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "@rf_divider_u64_magic", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestDividerRuntimeIsDeclaredOnlyWhenUsed()
+    {
+        string code = @"
+routine halve(n: u32) -> u32 {
+    return n / 2
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        Assert.DoesNotContain(expectedSubstring: "@rf_divider_", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestStickyOverflowDefersTrapToExit()
+    {
+        string code = @"
+@sticky_overflow
+routine scaled(a: s64, b: s64) -> s64 {
+    let sum = a +? b
+    let product = sum *? b
+    return product
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // Both checked operations feed one flag, tested once before the return
+        Assert.Contains(expectedSubstring: "@llvm.sadd.with.overflow.i64", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "@llvm.smul.with.overflow.i64", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "alloca i1", actualString: llvmIr);
+        Assert.Equal(expected: 2,
+            actual: llvmIr.Split(separator: "or i1")
+                          .Length - 1);
+        Assert.Equal(expected: 1,
+            actual: llvmIr.Split(separator: "@.str_overflow, i32 0, i32 0")
+                          .Length - 1);
+    }
+
+    [Fact]
+    public void TestSerializableRecordGetsWireFunctions()
+    {
+        string code = @"
+record Tick follows Serializable {
+    price: f64
+    volume: u32
+}
+
+routine price_of(view: uaddr) -> f64 {
+    return wire_read<Tick, f64>(view, ""price"")
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // Writer and size function next to the record; a field read is one aligned load
+        Assert.Contains(expectedSubstring: "define i64 @Tick.__wire_size(%Tick %value)",
+            actualString: llvmIr);
+        Assert.Contains(
+            expectedSubstring: "define i64 @Tick.__wire_write(%Tick %value, ptr %dest, i64 %capacity)",
+            actualString: llvmIr);
+        Assert.Matches(expectedRegexPattern: @"load double, ptr %\w+, align 8", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestSmallLiteralMemoryCopyIsInlined()
+    {
+        string code = @"
+external routine memory_copy!(src: uaddr, dest: uaddr, bytes: uaddr)
+
+routine copy_header(src: uaddr, dest: uaddr) {
+    danger! {
+        memory_copy!(src, dest, 16)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // A literal size up to 256 bytes skips the runtime's size dispatch
+        Assert.Contains(expectedSubstring: "i64 16, i1 false)", actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare void @llvm.memmove.p0.p0.i64(ptr, ptr, i64, i1)",
+            actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "call void @memory_copy(", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestVolatileAccessUsesTypeWidthAndAlignment()
+    {
+        string code = @"
+routine poll(status: uaddr, command: uaddr, value: u32) -> letter8 {
+    danger! {
+        volatile_write_as<u32>!(command, value)
+        return volatile_read_as<letter8>!(status)
+    }
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // One access of exactly the type's width, never claiming more alignment than it has
+        Assert.Matches(expectedRegexPattern: @"store volatile i32 %\w+, ptr %\w+, align 4",
+            actualString: llvmIr);
+        Assert.Matches(expectedRegexPattern: @"load volatile i8, ptr %\w+, align 1", actualString: llvmIr);
+    }
+
+    [Fact]
+    public void TestSliceHalfAccessPassesBitsAsI16()
+    {
+        string code = @"
+routine swap_halves(buffer: DynamicSlice) {
+    let low = buffer.read<f16>!(0)
+    buffer.write<f16>!(2, low)
+}";
+
+        string llvmIr = GenerateCode(code: code);
+
+        // rf_f16 is uint16_t in C; a `half` argument or return would travel in XMM registers
+        Assert.Contains(expectedSubstring: "declare i16 @memory_read_f16(ptr, i64)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "declare void @memory_write_f16(ptr, i64, i16)",
+            actualString: llvmIr);
+        Assert.Contains(expectedSubstring: "to half", actualString: llvmIr);
+        Assert.DoesNotContain(expectedSubstring: "half @memory_read_f16", actualString: llvmIr);
+    }
+
     [Fact]
     public void TestModuleStructure()
     {
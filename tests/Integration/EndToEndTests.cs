@@ -518,4 +518,187 @@ routine test_function() -> s32 {
         // Memory increase should be reasonable (less than 10MB)
         Assert.True(condition: memoryIncrease < 10 * 1024 * 1024);
     }
+
+    [Fact]
+    public void TestProgramLinksAgainstRuntime()
+    {
+        // Every program links the runtime, so even an empty main catches a missing source
+        int? exitCode = BuildAndRun(code: @"
+routine main() -> s32 {
+    return 7
+}");
+
+        if (exitCode != null)
+        {
+            Assert.Equal(expected: 7, actual: exitCode);
+        }
+    }
+
+    [Fact]
+    public void TestStrictMathProgramLinksAgainstRuntime()
+    {
+        // --strict-math makes main call rf_math_set_strict from vector_math.c
+        int? exitCode = BuildAndRun(code: @"
+routine main() -> s32 {
+    return 5
+}", mathMode: FloatMathMode.Strict);
+
+        if (exitCode != null)
+        {
+            Assert.Equal(expected: 5, actual: exitCode);
+        }
+    }
+
+    [Fact]
+    public void TestQuadMathProgramLinksAgainstRuntime()
+    {
+        // f128 sqrt lowers to rf_f128_sqrt (f128.c); exported routines keep the call
+        int? exitCode = BuildAndRun(code: @"
+routine quad_root(x: f128) -> f128 {
+    danger! {
+        return @intrinsic.sqrt<fp128>(x)
+    }
+}
+
+routine main() -> s32 {
+    return 6
+}");
+
+        if (exitCode != null)
+        {
+            Assert.Equal(expected: 6, actual: exitCode);
+        }
+    }
+
+    [Fact]
+    public void TestWireCheckProgramLinksAgainstRuntime()
+    {
+        // wire_check lowers to rf_wire_check from wire.c
+        int? exitCode = BuildAndRun(code: @"
+record Tick follows Serializable {
+    price: f64
+    volume: u32
+}
+
+routine validate_tick(view: uaddr, size: uaddr) -> s32 {
+    return wire_check<Tick>(view, size)
+}
+
+routine main() -> s32 {
+    return 9
+}");
+
+        if (exitCode != null)
+        {
+            Assert.Equal(expected: 9, actual: exitCode);
+        }
+    }
+
+    [Fact]
+    public void TestHoistedDivisionTrapsOnZeroDivisor()
+    {
+        // The loop's divisor is hoisted into a divide.c divider; zero must still trap
+        const string template = @"
+routine main() -> s32 {
+    let n: u64 = 10u64
+    let divisor: u64 = DIVISORu64
+    while n > divisor {
+        let quotient = n // divisor
+        return 3
+    }
+    return 0
+}";
+
+        int? linked = BuildAndRun(code: template.Replace(oldValue: "DIVISOR", newValue: "5"));
+        int? trapped = BuildAndRun(code: template.Replace(oldValue: "DIVISOR", newValue: "0"));
+
+        if (linked != null && trapped != null)
+        {
+            Assert.Equal(expected: 3, actual: linked);
+            Assert.NotEqual(expected: 3, actual: trapped);
+            Assert.NotEqual(expected: 0, actual: trapped);
+        }
+    }
+
+    /// <summary>
+    /// Builds <paramref name="code"/> into an executable the way the driver does and runs it,
+    /// returning its exit code; null when clang is not installed.
+    /// </summary>
+    private static int? BuildAndRun(string code, FloatMathMode mathMode = FloatMathMode.Default)
+    {
+        if (!IsClangAvailable())
+        {
+            return null;
+        }
+
+        List<Token> tokens = Tokenizer.Tokenize(source: code, language: Language.RazorForge);
+        Program program = new RazorForgeParser(tokens: tokens).Parse();
+        new SemanticAnalyzer(language: Language.RazorForge, mode: LanguageMode.Normal).Analyze(
+            program: program);
+        var codeGenerator =
+            new LLVMCodeGenerator(language: Language.RazorForge, mode: LanguageMode.Normal)
+            {
+                MathMode = mathMode
+            };
+        codeGenerator.Generate(program: program);
+
+        string directory = Path.Combine(path1: Path.GetTempPath(), path2: $"rf-e2e-{Guid.NewGuid():N}");
+        Directory.CreateDirectory(path: directory);
+        try
+        {
+            string llvmFile = Path.Combine(path1: directory, path2: "program.ll");
+            File.WriteAllText(path: llvmFile, contents: codeGenerator.GetGeneratedCode());
+            string? executable = Compilers.RuntimeLinker.BuildExecutable(llvmFile: llvmFile,
+                projectRoot: FindRepositoryRoot());
+            Assert.NotNull(@object: executable);
+
+            using Process process = Process.Start(startInfo: new ProcessStartInfo
+            {
+                FileName = executable,
+                UseShellExecute = false,
+                RedirectStandardError = true
+            })!;
+            process.StandardError.ReadToEnd();
+            process.WaitForExit();
+            return process.ExitCode;
+        }
+        finally
+        {
+            Directory.Delete(path: directory, recursive: true);
+        }
+    }
+
+    private static bool IsClangAvailable()
+    {
+        try
+        {
+            using Process? process = Process.Start(startInfo: new ProcessStartInfo
+            {
+                FileName = "clang",
+                Arguments = "--version",
+                UseShellExecute = false,
+                RedirectStandardOutput = true
+            });
+            process?.StandardOutput.ReadToEnd();
+            process?.WaitForExit();
+            return process?.ExitCode == 0;
+        }
+        catch (System.ComponentModel.Win32Exception)
+        {
+            return false;
+        }
+    }
+
+    private static string FindRepositoryRoot()
+    {
+        string? directory = AppContext.BaseDirectory;
+        while (directory != null &&
+               !Directory.Exists(path: Path.Combine(path1: directory, path2: "native", path3: "runtime")))
+        {
+            directory = Path.GetDirectoryName(path: directory);
+        }
+
+        Assert.NotNull(@object: directory);
+        return directory;
+    }
 }